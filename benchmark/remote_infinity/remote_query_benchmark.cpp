@@ -51,7 +51,7 @@ struct InfinityClient {
         transport->open();
         CommonResponse response;
         ConnectRequest request;
-        request.__set_client_version(14); // 0.3.0.dev5
+        request.__set_client_version(16); // 0.3.0.dev7
         client->Connect(response, request);
         session_id = response.session_id;
     }
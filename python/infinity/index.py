@@ -31,6 +31,7 @@ class IndexType(Enum):
     EMVB = 5
     BMP = 6
     DiskAnn = 7
+    Bitmap = 8
 
     def to_ttype(self):
         match self:
@@ -48,6 +49,8 @@ class IndexType(Enum):
                 return ttypes.IndexType.BMP
             case IndexType.DiskAnn:
                 return ttypes.IndexType.DiskAnn
+            case IndexType.Bitmap:
+                return ttypes.IndexType.Bitmap
             case _:
                 raise InfinityException(ErrorCode.INVALID_INDEX_TYPE, "Unknown index type")
 
@@ -67,6 +70,8 @@ class IndexType(Enum):
                 return LocalIndexType.kBMP
             case IndexType.DiskAnn:
                 return LocalIndexType.kDiskAnn
+            case IndexType.Bitmap:
+                return LocalIndexType.kBitmap
             case _:
                 raise InfinityException(ErrorCode.INVALID_INDEX_TYPE, "Unknown index type")
 
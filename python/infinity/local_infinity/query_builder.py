@@ -47,6 +47,18 @@ class ExplainQuery(Query):
         self.explain_type = explain_type
 
 
+_embedding_array_dtypes = {
+    "unsigned tinyint": "uint8", "uint8": "uint8",
+    "tinyint": "int8", "int8": "int8",
+    "smallint": "int16", "int16": "int16",
+    "int": "int32", "int32": "int32",
+    "bigint": "int64", "int64": "int64",
+    "float": "float32", "float32": "float32",
+    "double": "float64", "float64": "float64",
+    "float16": "float16",
+}
+
+
 class InfinityLocalQueryBuilder(ABC):
     def __init__(self, table):
         self._table = table
@@ -85,8 +97,18 @@ class InfinityLocalQueryBuilder(ABC):
                 ErrorCode.INVALID_TOPK_TYPE, f"Invalid topn, type should be embedded, but get {type(topn)}"
             )
 
+        # a C-contiguous ndarray of the exact element type is handed to the engine without conversion
+        array_value = None
+        if isinstance(embedding_data, np.ndarray) and embedding_data_type in _embedding_array_dtypes \
+                and embedding_data.dtype == np.dtype(_embedding_array_dtypes[embedding_data_type]) \
+                and embedding_data.flags['C_CONTIGUOUS']:
+            array_value = embedding_data.reshape(-1)
+            embedding_data = []
+
         # type casting
-        if isinstance(embedding_data, list):
+        if array_value is not None:
+            pass
+        elif isinstance(embedding_data, list):
             embedding_data = embedding_data
         elif isinstance(embedding_data, tuple):
             embedding_data = embedding_data
@@ -139,6 +161,8 @@ class InfinityLocalQueryBuilder(ABC):
             data.bf16_array_value = embedding_data
         else:
             raise InfinityException(ErrorCode.INVALID_EMBEDDING_DATA_TYPE, f"Invalid embedding {embedding_data[0]} type")
+        if array_value is not None:
+            data.array_value = array_value
 
         dist_type = KnnDistanceType.kInvalid
         if distance_type == "l2":
@@ -292,6 +316,8 @@ class InfinityLocalQueryBuilder(ABC):
             fusion_expr.match_tensor_expr = make_match_tensor_expr(
                 vector_column_name=fusion_params["field"], embedding_data=fusion_params["data"],
                 embedding_data_type=fusion_params["data_type"], method_type="maxsim", extra_option=None)
+            if "binary_rerank_factor" in fusion_params:
+                final_option_text += f";binary_rerank_factor={fusion_params['binary_rerank_factor']}"
         else:
             raise InfinityException(ErrorCode.INVALID_EXPRESSION, "Invalid fusion method")
         fusion_expr.options_text = final_option_text
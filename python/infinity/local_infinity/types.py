@@ -155,6 +155,45 @@ def parse_tensorarray_bytes(column_data_type, bytes_data):
         results.append(tensorarray_data)
     return results
 
+_column_view_dtypes = {
+    LogicalType.kTinyInt: '<i1',
+    LogicalType.kSmallInt: '<i2',
+    LogicalType.kInteger: '<i4',
+    LogicalType.kBigInt: '<i8',
+    LogicalType.kFloat16: '<f2',
+    LogicalType.kFloat: '<f4',
+    LogicalType.kDouble: '<f8',
+}
+
+_embedding_view_dtypes = {
+    EmbeddingDataType.kElemUInt8: '<u1',
+    EmbeddingDataType.kElemInt8: '<i1',
+    EmbeddingDataType.kElemInt16: '<i2',
+    EmbeddingDataType.kElemInt32: '<i4',
+    EmbeddingDataType.kElemInt64: '<i8',
+    EmbeddingDataType.kElemFloat16: '<f2',
+    EmbeddingDataType.kElemFloat: '<f4',
+    EmbeddingDataType.kElemDouble: '<f8',
+}
+
+
+def column_views_to_list(column_type, column_data_type, column_views) -> \
+        list[Any, ...]:
+    # column_views are read-only uint8 arrays over the result buffers, one per data block,
+    # only a multi-block result is copied (once) by the concatenation
+    column_array = column_views[0] if len(column_views) == 1 else np.concatenate(column_views)
+    if column_type in _column_view_dtypes:
+        return column_array.view(_column_view_dtypes[column_type]).tolist()
+    if column_type == LogicalType.kEmbedding:
+        element_type = column_data_type.embedding_type.element_type
+        if element_type in _embedding_view_dtypes:
+            dimension = column_data_type.embedding_type.dimension
+            return column_array.view(_embedding_view_dtypes[element_type]).reshape(-1, dimension).tolist()
+    if column_type == LogicalType.kRowID:
+        return column_array.view('<i4').reshape(-1, 2).tolist()
+    return column_vector_to_list(column_type, column_data_type, [column_array.tobytes()])
+
+
 def column_vector_to_list(column_type, column_data_type, column_vectors) -> \
         list[Any, ...]:
     column_vector = b''.join(column_vectors)
@@ -381,8 +420,10 @@ def build_result(res: WrapQueryResult) -> tuple[dict[str | Any, list[Any, Any]],
 
         column_type = column_field.column_type
         column_data_type = column_def.column_type
-        column_vectors = column_field.column_vectors
-        data_list = column_vector_to_list(column_type, column_data_type, column_vectors)
+        if column_field.column_views:
+            data_list = column_views_to_list(column_type, column_data_type, column_field.column_views)
+        else:
+            data_list = column_vector_to_list(column_type, column_data_type, column_field.column_vectors)
 
         data_dict[column_name] = data_list
         data_type_dict[column_name] = column_data_type
@@ -39,6 +39,7 @@ class ThriftInfinityClient:
         if self.transport is not None:
             self.transport.close()
             self.transport = None
+        # a server started with thrift_server_type = "non_block" only accepts framed transport
         # self.transport = TTransport.TFramedTransport(TSocket.TSocket(self.uri.ip, self.uri.port))  # async
         self.transport = TTransport.TBufferedTransport(
             TSocket.TSocket(self.uri.ip, self.uri.port))  # sync
@@ -61,7 +62,9 @@ class ThriftInfinityClient:
         # version: 0.3.0.dev3, client_version: 12
         # version: 0.3.0.dev4, client_version: 13
         # version: 0.3.0.dev5, client_version: 14
-        res = self.client.Connect(ConnectRequest(client_version=14))
+        # version: 0.3.0.dev6, client_version: 15
+        # version: 0.3.0.dev7, client_version: 16
+        res = self.client.Connect(ConnectRequest(client_version=16))
         if res.error_code != 0:
             raise InfinityException(res.error_code, res.error_msg)
         self.session_id = res.session_id
@@ -149,7 +152,8 @@ class ThriftInfinityClient:
                                                       db_name=db_name,
                                                       table_name=table_name))
 
-    def insert(self, db_name: str, table_name: str, column_names: list[str], fields: list[Field]):
+    def insert(self, db_name: str, table_name: str, column_names: list[str], fields: list[Field],
+               column_fields: list[ColumnField] = None):
         retry = 0
         inner_ex = None
         while retry <= 2:
@@ -158,7 +162,8 @@ class ThriftInfinityClient:
                                                        db_name=db_name,
                                                        table_name=table_name,
                                                        column_names=column_names,
-                                                       fields=fields))
+                                                       fields=fields,
+                                                       column_fields=column_fields if column_fields is not None else []))
                 return res
             except TTransportException as ex:
                 #import traceback
@@ -194,7 +199,7 @@ class ThriftInfinityClient:
                                                 export_option=export_options))
 
     def select(self, db_name: str, table_name: str, select_list, search_expr,
-               where_expr, group_by_list, limit_expr, offset_expr):
+               where_expr, group_by_list, limit_expr, offset_expr, arrow_stream=False):
         return self.client.Select(SelectRequest(session_id=self.session_id,
                                                 db_name=db_name,
                                                 table_name=table_name,
@@ -204,8 +209,19 @@ class ThriftInfinityClient:
                                                 group_by_list=group_by_list,
                                                 limit_expr=limit_expr,
                                                 offset_expr=offset_expr,
+                                                arrow_stream=arrow_stream,
                                                 ))
 
+    def fetch_arrow_batch(self, cursor_id: int):
+        return self.client.Select(SelectRequest(session_id=self.session_id,
+                                                cursor_id=cursor_id,
+                                                ))
+
+    def close_cursor(self, cursor_id: int):
+        return self.client.CloseCursor(CloseCursorRequest(session_id=self.session_id,
+                                                          cursor_id=cursor_id,
+                                                          ))
+
     def explain(self, db_name: str, table_name: str, select_list, search_expr,
                 where_expr, group_by_list, limit_expr, offset_expr, explain_type):
         return self.client.Explain(ExplainRequest(session_id=self.session_id,
@@ -330,6 +330,7 @@ class IndexType(object):
     Secondary = 4
     EMVB = 5
     DiskAnn = 6
+    Bitmap = 7
 
     _VALUES_TO_NAMES = {
         0: "IVFFlat",
@@ -339,6 +340,7 @@ class IndexType(object):
         4: "Secondary",
         5: "EMVB",
         6: "DiskAnn",
+        7: "Bitmap",
     }
 
     _NAMES_TO_VALUES = {
@@ -349,6 +351,7 @@ class IndexType(object):
         "Secondary": 4,
         "EMVB": 5,
         "DiskAnn": 6,
+        "Bitmap": 7,
     }
 
 
@@ -5728,13 +5731,15 @@ class InsertRequest(object):
      - column_names
      - fields
      - session_id
+     - column_fields
 
     """
 
 
     def __init__(self, db_name=None, table_name=None, column_names=[
     ], fields=[
-    ], session_id=None,):
+    ], session_id=None, column_fields=[
+    ],):
         self.db_name = db_name
         self.table_name = table_name
         if column_names is self.thrift_spec[3][4]:
@@ -5746,6 +5751,10 @@ class InsertRequest(object):
             ]
         self.fields = fields
         self.session_id = session_id
+        if column_fields is self.thrift_spec[6][4]:
+            column_fields = [
+            ]
+        self.column_fields = column_fields
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -5792,6 +5801,17 @@ class InsertRequest(object):
                     self.session_id = iprot.readI64()
                 else:
                     iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.LIST:
+                    self.column_fields = []
+                    (_etype469, _size466) = iprot.readListBegin()
+                    for _i470 in range(_size466):
+                        _elem471 = ColumnField()
+                        _elem471.read(iprot)
+                        self.column_fields.append(_elem471)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -5828,6 +5848,13 @@ class InsertRequest(object):
             oprot.writeFieldBegin('session_id', TType.I64, 5)
             oprot.writeI64(self.session_id)
             oprot.writeFieldEnd()
+        if self.column_fields is not None:
+            oprot.writeFieldBegin('column_fields', TType.LIST, 6)
+            oprot.writeListBegin(TType.STRUCT, len(self.column_fields))
+            for iter472 in self.column_fields:
+                iter472.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -6421,6 +6448,8 @@ class SelectRequest(object):
      - limit_expr
      - offset_expr
      - order_by_list
+     - arrow_stream
+     - cursor_id
 
     """
 
@@ -6428,7 +6457,7 @@ class SelectRequest(object):
     def __init__(self, session_id=None, db_name=None, table_name=None, select_list=[
     ], search_expr=None, where_expr=None, group_by_list=[
     ], having_expr=None, limit_expr=None, offset_expr=None, order_by_list=[
-    ],):
+    ], arrow_stream=False, cursor_id=None,):
         self.session_id = session_id
         self.db_name = db_name
         self.table_name = table_name
@@ -6449,6 +6478,8 @@ class SelectRequest(object):
             order_by_list = [
             ]
         self.order_by_list = order_by_list
+        self.arrow_stream = arrow_stream
+        self.cursor_id = cursor_id
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -6537,6 +6568,16 @@ class SelectRequest(object):
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 12:
+                if ftype == TType.BOOL:
+                    self.arrow_stream = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 13:
+                if ftype == TType.I64:
+                    self.cursor_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -6600,6 +6641,14 @@ class SelectRequest(object):
                 iter349.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
+        if self.arrow_stream is not None:
+            oprot.writeFieldBegin('arrow_stream', TType.BOOL, 12)
+            oprot.writeBool(self.arrow_stream)
+            oprot.writeFieldEnd()
+        if self.cursor_id is not None:
+            oprot.writeFieldBegin('cursor_id', TType.I64, 13)
+            oprot.writeI64(self.cursor_id)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -6625,13 +6674,15 @@ class SelectResponse(object):
      - error_msg
      - column_defs
      - column_fields
+     - cursor_id
+     - arrow_batch
 
     """
 
 
     def __init__(self, error_code=None, error_msg=None, column_defs=[
     ], column_fields=[
-    ],):
+    ], cursor_id=None, arrow_batch=None,):
         self.error_code = error_code
         self.error_msg = error_msg
         if column_defs is self.thrift_spec[3][4]:
@@ -6642,6 +6693,8 @@ class SelectResponse(object):
             column_fields = [
             ]
         self.column_fields = column_fields
+        self.cursor_id = cursor_id
+        self.arrow_batch = arrow_batch
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -6684,6 +6737,16 @@ class SelectResponse(object):
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I64:
+                    self.cursor_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.STRING:
+                    self.arrow_batch = iprot.readBinary()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -6716,6 +6779,14 @@ class SelectResponse(object):
                 iter363.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
+        if self.cursor_id is not None:
+            oprot.writeFieldBegin('cursor_id', TType.I64, 5)
+            oprot.writeI64(self.cursor_id)
+            oprot.writeFieldEnd()
+        if self.arrow_batch is not None:
+            oprot.writeFieldBegin('arrow_batch', TType.STRING, 6)
+            oprot.writeBinary(self.arrow_batch)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -7913,6 +7984,75 @@ class ShowBlockColumnResponse(object):
 
     def __ne__(self, other):
         return not (self == other)
+
+
+class CloseCursorRequest(object):
+    """
+    Attributes:
+     - session_id
+     - cursor_id
+
+    """
+
+
+    def __init__(self, session_id=None, cursor_id=None,):
+        self.session_id = session_id
+        self.cursor_id = cursor_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.session_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.cursor_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('CloseCursorRequest')
+        if self.session_id is not None:
+            oprot.writeFieldBegin('session_id', TType.I64, 1)
+            oprot.writeI64(self.session_id)
+            oprot.writeFieldEnd()
+        if self.cursor_id is not None:
+            oprot.writeFieldBegin('cursor_id', TType.I64, 2)
+            oprot.writeI64(self.cursor_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
 all_structs.append(Property)
 Property.thrift_spec = (
     None,  # 0
@@ -8375,6 +8515,8 @@ InsertRequest.thrift_spec = (
     (4, TType.LIST, 'fields', (TType.STRUCT, [Field, None], False), [
     ], ),  # 4
     (5, TType.I64, 'session_id', None, None, ),  # 5
+    (6, TType.LIST, 'column_fields', (TType.STRUCT, [ColumnField, None], False), [
+    ], ),  # 6
 )
 all_structs.append(ImportRequest)
 ImportRequest.thrift_spec = (
@@ -8441,6 +8583,8 @@ SelectRequest.thrift_spec = (
     (10, TType.STRUCT, 'offset_expr', [ParsedExpr, None], None, ),  # 10
     (11, TType.LIST, 'order_by_list', (TType.STRUCT, [OrderByExpr, None], False), [
     ], ),  # 11
+    (12, TType.BOOL, 'arrow_stream', None, False, ),  # 12
+    (13, TType.I64, 'cursor_id', None, None, ),  # 13
 )
 all_structs.append(SelectResponse)
 SelectResponse.thrift_spec = (
@@ -8451,6 +8595,8 @@ SelectResponse.thrift_spec = (
     ], ),  # 3
     (4, TType.LIST, 'column_fields', (TType.STRUCT, [ColumnField, None], False), [
     ], ),  # 4
+    (5, TType.I64, 'cursor_id', None, None, ),  # 5
+    (6, TType.STRING, 'arrow_batch', 'BINARY', None, ),  # 6
 )
 all_structs.append(DeleteRequest)
 DeleteRequest.thrift_spec = (
@@ -8557,5 +8703,11 @@ ShowBlockColumnResponse.thrift_spec = (
     (7, TType.I64, 'extra_file_count', None, None, ),  # 7
     (8, TType.STRING, 'extra_file_names', 'UTF8', None, ),  # 8
 )
+all_structs.append(CloseCursorRequest)
+CloseCursorRequest.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'session_id', None, None, ),  # 1
+    (2, TType.I64, 'cursor_id', None, None, ),  # 2
+)
 fix_spec(all_structs)
 del all_structs
@@ -15,7 +15,7 @@
 from __future__ import annotations
 
 from abc import ABC
-from typing import List, Optional, Any
+from typing import Iterator, List, Optional, Any
 
 import numpy as np
 import pandas as pd
@@ -265,6 +265,8 @@ class InfinityThriftQueryBuilder(ABC):
             fusion_expr.optional_match_tensor_expr = make_match_tensor_expr(
                 vector_column_name=fusion_params["field"], embedding_data=fusion_params["data"],
                 embedding_data_type=fusion_params["data_type"], method_type="maxsim", extra_option=None)
+            if "binary_rerank_factor" in fusion_params:
+                final_option_text += f";binary_rerank_factor={fusion_params['binary_rerank_factor']}"
         else:
             raise InfinityException(ErrorCode.INVALID_EXPRESSION, "Invalid fusion method")
         fusion_expr.options_text = final_option_text
@@ -354,6 +356,17 @@ class InfinityThriftQueryBuilder(ABC):
     def to_arrow(self) -> Table:
         return pa.Table.from_pandas(self.to_df())
 
+    def to_arrow_batches(self) -> Iterator[pa.RecordBatch]:
+        query = Query(
+            columns=self._columns,
+            search=self._search,
+            filter=self._filter,
+            limit=self._limit,
+            offset=self._offset,
+        )
+        self.reset()
+        return self._table._execute_query_arrow_batches(query)
+
     def explain(self, explain_type=ExplainType.Physical) -> Any:
         query = ExplainQuery(
             columns=self._columns,
@@ -15,6 +15,7 @@ import functools
 import inspect
 import os
 import numpy as np
+import pyarrow as pa
 from abc import ABC
 from typing import Optional, Union, List, Any
 
@@ -27,7 +28,7 @@ from infinity.index import IndexInfo
 from infinity.remote_thrift.query_builder import Query, InfinityThriftQueryBuilder, ExplainQuery
 from infinity.remote_thrift.types import build_result
 from infinity.remote_thrift.utils import traverse_conditions, name_validity_check, select_res_to_polars
-from infinity.remote_thrift.utils import get_remote_constant_expr_from_python_value
+from infinity.remote_thrift.utils import get_remote_constant_expr_from_python_value, get_remote_column_fields_from_rows
 from infinity.table import Table, ExplainType
 from infinity.common import ConflictType, DEFAULT_MATCH_VECTOR_TOPN
 
@@ -164,6 +165,18 @@ class RemoteTable(Table, ABC):
         if isinstance(data, dict):
             data = [data]
 
+        # rows of scalars are sent column by column, without a thrift struct per value; the server decodes them
+        # since client_version 15, an older server refuses the connection instead of dropping the columns
+        column_fields = get_remote_column_fields_from_rows(data) if data else None
+        if column_fields is not None:
+            column_names = list(data[0].keys())
+            res = self._conn.insert(db_name=db_name, table_name=table_name, column_names=column_names,
+                                    fields=fields, column_fields=column_fields)
+            if res.error_code == ErrorCode.OK:
+                return res
+            else:
+                raise InfinityException(res.error_code, res.error_msg)
+
         for row in data:
             column_names = list(row.keys())
             parse_exprs = []
@@ -384,6 +397,9 @@ class RemoteTable(Table, ABC):
     def to_arrow(self):
         return self.query_builder.to_arrow()
 
+    def to_arrow_batches(self):
+        return self.query_builder.to_arrow_batches()
+
     def explain(self, explain_type: ExplainType = ExplainType.Physical):
         return self.query_builder.explain(explain_type)
 
@@ -411,6 +427,36 @@ class RemoteTable(Table, ABC):
         else:
             raise InfinityException(res.error_code, res.error_msg)
 
+    def _execute_query_arrow_batches(self, query: Query):
+        # the server keeps the result behind a cursor and hands out one arrow IPC stream per data block,
+        # the next block is only requested when the caller asks for it
+        res = self._conn.select(db_name=self._db_name,
+                                table_name=self._table_name,
+                                select_list=query.columns,
+                                search_expr=query.search,
+                                where_expr=query.filter,
+                                group_by_list=None,
+                                limit_expr=query.limit,
+                                offset_expr=query.offset,
+                                arrow_stream=True)
+        cursor_id = 0
+        try:
+            while True:
+                if res.error_code != ErrorCode.OK:
+                    raise InfinityException(res.error_code, res.error_msg)
+                cursor_id = res.cursor_id
+                reader = pa.ipc.open_stream(res.arrow_batch)
+                for batch in reader:
+                    yield batch
+                if not cursor_id:
+                    break
+                res = self._conn.fetch_arrow_batch(cursor_id)
+        finally:
+            # close() or garbage collection of an unfinished generator lands here,
+            # release the cursor instead of leaving it to the server's idle timeout
+            if cursor_id:
+                self._conn.close_cursor(cursor_id)
+
     def _explain_query(self, query: ExplainQuery) -> Any:
         res = self._conn.explain(db_name=self._db_name,
                                  table_name=self._table_name,
@@ -13,6 +13,7 @@
 # limitations under the License.
 
 import re
+import struct
 import functools
 import inspect
 import pandas as pd
@@ -236,6 +237,43 @@ def get_remote_constant_expr_from_python_value(value) -> ttypes.ConstantExpr:
     return constant_expression
 
 
+def get_remote_column_fields_from_rows(rows) -> list[ttypes.ColumnField] | None:
+    # Encode rows of scalars column by column, in the same layout ColumnField uses for select results.
+    # Return None if the rows don't share the columns, or a column mixes types or holds a non-scalar value.
+    column_names = list(rows[0].keys())
+    columns = [[] for _ in column_names]
+    for row in rows:
+        if len(row) != len(column_names):
+            return None
+        for idx, column_name in enumerate(column_names):
+            if column_name not in row:
+                return None
+            columns[idx].append(row[column_name])
+
+    column_fields = []
+    for column_name, values in zip(column_names, columns):
+        value_type = type(values[0])
+        if any(type(value) is not value_type for value in values):
+            return None
+        try:
+            if value_type is bool:
+                column_type, buffer = ttypes.ColumnType.ColumnBool, np.array(values, dtype=np.bool_).tobytes()
+            elif value_type is int or value_type is np.int64:
+                column_type, buffer = ttypes.ColumnType.ColumnInt64, np.array(values, dtype="<i8").tobytes()
+            elif value_type is float or value_type is np.float64:
+                column_type, buffer = ttypes.ColumnType.ColumnFloat64, np.array(values, dtype="<f8").tobytes()
+            elif value_type is str:
+                encoded = [value.encode("utf-8") for value in values]
+                column_type = ttypes.ColumnType.ColumnVarchar
+                buffer = b"".join(struct.pack("<i", len(value)) + value for value in encoded)
+            else:
+                return None
+        except OverflowError:
+            return None
+        column_fields.append(ttypes.ColumnField(column_type=column_type, column_vectors=[buffer], column_name=column_name))
+    return column_fields
+
+
 # invalid_name_array = [
 #     [],
 #     (),
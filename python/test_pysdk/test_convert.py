@@ -63,6 +63,47 @@ class TestInfinity:
         res = table_obj.output(["c1", "c2", "c1"]).to_arrow()
         print(res)
         db_obj.drop_table("test_to_pa"+suffix, ConflictType.Error)
+
+    @pytest.mark.usefixtures("skip_if_http")
+    @pytest.mark.usefixtures("skip_if_local_infinity")
+    def test_to_arrow_batches(self, suffix):
+        db_obj = self.infinity_obj.get_database("default_db")
+        db_obj.drop_table("test_to_arrow_batches"+suffix, ConflictType.Ignore)
+        db_obj.create_table("test_to_arrow_batches"+suffix, {
+            "c1": {"type": "int"}, "c2": {"type": "varchar"}}, ConflictType.Error)
+
+        table_obj = db_obj.get_table("test_to_arrow_batches"+suffix)
+        # one insert is limited to 8192 rows
+        table_obj.insert([{"c1": i, "c2": str(i)} for i in range(5000)])
+        table_obj.insert([{"c1": i, "c2": str(i)} for i in range(5000, 10000)])
+        batches = list(table_obj.output(["c1", "c2"]).to_arrow_batches())
+        assert len(batches) > 1
+        assert sum(batch.num_rows for batch in batches) == 10000
+        assert batches[0].schema.names == ["c1", "c2"]
+        c1 = sorted(v for batch in batches for v in batch.column(0).to_pylist())
+        assert c1 == list(range(10000))
+
+        # empty result still carries the schema
+        batches = list(table_obj.output(["c1"]).filter("c1 < 0").to_arrow_batches())
+        assert sum(batch.num_rows for batch in batches) == 0
+
+        with pytest.raises(InfinityException):
+            list(table_obj.output(["_row_id"]).to_arrow_batches())
+
+        # a generator closed before the last batch closes its cursor on the server
+        batch_iter = table_obj.output(["c1"]).to_arrow_batches()
+        next(batch_iter)
+        batch_iter.close()
+
+        # the least recently used cursors of a session are dropped beyond the per-session limit, the newest still drains
+        batch_iters = [table_obj.output(["c1"]).to_arrow_batches() for _ in range(20)]
+        first_batches = [next(batch_iter) for batch_iter in batch_iters]
+        rows = first_batches[-1].num_rows + sum(batch.num_rows for batch in batch_iters[-1])
+        assert rows == 10000
+        with pytest.raises(InfinityException):
+            list(batch_iters[0])
+        del batch_iters
+        db_obj.drop_table("test_to_arrow_batches"+suffix, ConflictType.Error)
     def test_to_df(self, suffix):
         db_obj = self.infinity_obj.get_database("default_db")
         db_obj.drop_table("test_to_df"+suffix, ConflictType.Ignore)
@@ -74,8 +74,10 @@ class TestInfinity:
             res = table.output(["*"]).explain(ExplainType.Fragment)
             print(res)
 
-            with pytest.raises(Exception, match=r".*Not implement*"):
-                res = table.output(["*"]).explain(ExplainType.Analyze)
-                print(res)
+            res = table.output(["*"]).explain(ExplainType.Analyze)
+            print(res)
+            analyze_text = "\n".join(res.get_column(res.columns[0]).to_list())
+            assert "actual rows" in analyze_text
+            assert "result rows: 3" in analyze_text
 
         db_obj.drop_table("test_explain_default", ConflictType.Error)
\ No newline at end of file
@@ -12,6 +12,7 @@ import infinity.index as index
 from infinity.errors import ErrorCode
 from infinity.common import ConflictType, InfinityException
 from common.utils import copy_data, generate_commas_enwiki
+import numpy as np
 import pandas as pd
 from numpy import dtype
 from infinity_http import infinity_http
@@ -1144,6 +1145,27 @@ class TestInfinity:
         res = db_obj.drop_table("test_with_index"+suffix, ConflictType.Error)
         assert res.error_code == ErrorCode.OK
 
+    @pytest.mark.usefixtures("skip_if_http")
+    def test_knn_ndarray_query(self, suffix):
+        db_obj = self.infinity_obj.get_database("default_db")
+        db_obj.drop_table("test_knn_ndarray_query"+suffix, conflict_type=ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_knn_ndarray_query"+suffix, {
+            "c1": {"type": "int"},
+            "c2": {"type": "vector,4,float"}
+        }, ConflictType.Error)
+        table_obj.insert([{"c1": i, "c2": [float(i), float(i + 1), float(i + 2), float(i + 3)]} for i in range(16)])
+
+        expect = table_obj.output(["c1", "c2", "_distance"]).knn("c2", [1.0, 2.0, 3.0, 4.0], "float", "l2", 5).to_df()
+        # contiguous float32 array is passed without conversion, other dtypes fall back to list conversion
+        for query in [np.array([1.0, 2.0, 3.0, 4.0], dtype=np.float32),
+                      np.array([1.0, 2.0, 3.0, 4.0], dtype=np.float64),
+                      np.array([[1.0, 3.0], [2.0, 4.0]], dtype=np.float32).T.reshape(-1)]:
+            res = table_obj.output(["c1", "c2", "_distance"]).knn("c2", query, "float", "l2", 5).to_df()
+            pd.testing.assert_frame_equal(res, expect)
+
+        res = db_obj.drop_table("test_knn_ndarray_query"+suffix, ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+
     def test_zero_dimension_vector(self, suffix):
         db_obj = self.infinity_obj.get_database("default_db")
         db_obj.drop_table("test_zero_dimension_vector"+suffix,
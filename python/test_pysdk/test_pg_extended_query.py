@@ -0,0 +1,91 @@
+# Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import pytest
+
+# psycopg 3 sends parameterized queries with the extended query protocol
+psycopg = pytest.importorskip("psycopg")
+
+PG_CONNINFO = "host=127.0.0.1 port=5432 dbname=default_db user=infinity"
+TABLE_NAME = "test_pg_extended_query"
+
+
+@pytest.fixture(scope="function")
+def pg_conn():
+    conn = psycopg.connect(PG_CONNINFO, autocommit=True)
+    conn.execute(f"drop table if exists {TABLE_NAME}")
+    conn.execute(f"create table {TABLE_NAME} (c1 integer, c2 varchar)")
+    conn.execute(f"insert into {TABLE_NAME} values (1, '007'), (2, 'abc')")
+    yield conn
+    conn.execute(f"drop table if exists {TABLE_NAME}")
+    conn.close()
+
+
+class TestPgExtendedQuery:
+    def test_text_parameter_keeps_string(self, pg_conn):
+        # a numeric looking string is bound as a string, not as the number 7
+        cur = pg_conn.execute(f"select c1, c2 from {TABLE_NAME} where c2 = %s", ("007",))
+        assert [column.name for column in cur.description] == ["c1", "c2"]
+        assert cur.fetchall() == [(1, "007")]
+
+    def test_integer_parameter(self, pg_conn):
+        cur = pg_conn.execute(f"select c2 from {TABLE_NAME} where c1 = %s", (2,))
+        assert cur.fetchall() == [("abc",)]
+        cur = pg_conn.execute(f"select c2 from {TABLE_NAME} where c1 = %s", (2,), binary=True)
+        assert cur.fetchall() == [("abc",)]
+
+    def test_invalid_integer_parameter(self, pg_conn):
+        pgconn = pg_conn.pgconn
+        res = pgconn.prepare(b"int_param", f"select c2 from {TABLE_NAME} where c1 = $1".encode(), [20])
+        assert res.status == psycopg.pq.ExecStatus.COMMAND_OK
+        res = pgconn.exec_prepared(b"int_param", [b"1-1"])
+        assert res.status == psycopg.pq.ExecStatus.FATAL_ERROR
+
+    def test_describe_prepared_select(self, pg_conn):
+        pgconn = pg_conn.pgconn
+        res = pgconn.prepare(b"select_stmt", f"select c1, c2 from {TABLE_NAME} where c1 = $1".encode())
+        assert res.status == psycopg.pq.ExecStatus.COMMAND_OK
+        res = pgconn.describe_prepared(b"select_stmt")
+        assert res.status == psycopg.pq.ExecStatus.COMMAND_OK
+        assert res.nparams == 1
+        assert res.nfields == 2
+        assert res.fname(0) == b"c1"
+        assert res.fname(1) == b"c2"
+
+    def test_describe_does_not_run_insert(self, pg_conn):
+        # the driver describes the portal before executing it, the insert must run once
+        pg_conn.execute(f"insert into {TABLE_NAME} values (%s, %s)", (3, "xyz"))
+        cur = pg_conn.execute(f"select count(*) from {TABLE_NAME}")
+        assert cur.fetchall() == [(3,)]
+
+    def test_invalid_parameter_index(self, pg_conn):
+        pgconn = pg_conn.pgconn
+        res = pgconn.prepare(b"zero_param", f"select c1 from {TABLE_NAME} where c1 = $0".encode())
+        assert res.status == psycopg.pq.ExecStatus.FATAL_ERROR
+        res = pgconn.prepare(b"large_param", f"select c1 from {TABLE_NAME} where c1 = $65536".encode())
+        assert res.status == psycopg.pq.ExecStatus.FATAL_ERROR
+
+    def test_reexecute_prepared_select(self, pg_conn):
+        # the statement is parsed and planned once, each execution binds its own values
+        pgconn = pg_conn.pgconn
+        res = pgconn.prepare(b"reused_stmt", f"select c2 from {TABLE_NAME} where c1 = $1 limit $2".encode(), [20, 20])
+        assert res.status == psycopg.pq.ExecStatus.COMMAND_OK
+        for c1, c2 in [(1, b"007"), (2, b"abc"), (1, b"007")]:
+            res = pgconn.exec_prepared(b"reused_stmt", [str(c1).encode(), b"10"])
+            assert res.status == psycopg.pq.ExecStatus.TUPLES_OK
+            assert res.ntuples == 1
+            assert res.get_value(0, 0) == c2
+        res = pgconn.exec_prepared(b"reused_stmt", [b"3", b"10"])
+        assert res.status == psycopg.pq.ExecStatus.TUPLES_OK
+        assert res.ntuples == 0
@@ -416,6 +416,10 @@ class TestInfinity:
 
         res = table_obj.output(["count(*)"]).to_pl()
         assert res.height == 1 and res.width == 1 and res.item(0, 0) == data_size
+
+        # blocks are built in parallel, every row is imported exactly once
+        res = table_obj.output(["c1"]).to_pl()
+        assert sorted(res["c1"].to_list()) == list(range(data_size))
         db_obj.drop_table("test_import_with_different_size"+suffix, ConflictType.Ignore)
 
     @pytest.mark.parametrize("check_data", [{"file_name": "pysdk_test_big_varchar_rows.csv",
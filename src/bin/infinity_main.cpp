@@ -29,28 +29,23 @@ import thrift_server;
 import http_server;
 import logger;
 import simd_init;
+import default_values;
 
 namespace {
 
-#define THRIFT_SERVER_TYPE 0
-
-#if THRIFT_SERVER_TYPE == 0
+// The thrift server is picked by the thrift_server_type option.
+// The non-block server only serves framed clients, the python and C++ clients use buffered transport.
+infinity::String thrift_server_type;
 
 infinity::Thread pool_thrift_thread;
 infinity::PoolThriftServer pool_thrift_server;
 
-#elif THRIFT_SERVER_TYPE == 1
-
 infinity::Thread non_block_pool_thrift_thread;
 infinity::NonBlockPoolThriftServer non_block_pool_thrift_server;
 
-#else
-
 infinity::Thread threaded_thrift_thread;
 infinity::ThreadedThriftServer threaded_thrift_server;
 
-#endif
-
 infinity::Thread http_server_thread;
 infinity::HTTPServer http_server;
 
@@ -76,19 +71,13 @@ void ShutdownServer() {
 
     infinity::LOG_INFO("HTTP Server is shutdown.");
 
-#if THRIFT_SERVER_TYPE == 0
-
-    pool_thrift_server.Shutdown();
-
-#elif THRIFT_SERVER_TYPE == 1
-
-    non_block_pool_thrift_server.Shutdown();
-
-#else
-
-    threaded_thrift_server.Shutdown();
-
-#endif
+    if (thrift_server_type == infinity::THRIFT_SERVER_TYPE_NON_BLOCK) {
+        non_block_pool_thrift_server.Shutdown();
+    } else if (thrift_server_type == infinity::THRIFT_SERVER_TYPE_THREADED) {
+        threaded_thrift_server.Shutdown();
+    } else {
+        pool_thrift_server.Shutdown();
+    }
 
     infinity::LOG_INFO("Thrift Server is shutdown.");
 
@@ -194,25 +183,22 @@ auto main(int argc, char **argv) -> int {
     http_server_thread = infinity::Thread([&]() { http_server.Start(InfinityContext::instance().config()->HTTPPort()); });
 
     u32 thrift_server_port = InfinityContext::instance().config()->ClientPort();
-
-#if THRIFT_SERVER_TYPE == 0
-
-    i32 thrift_server_pool_size = InfinityContext::instance().config()->ConnectionPoolSize();
-    pool_thrift_server.Init(thrift_server_port, thrift_server_pool_size);
-    pool_thrift_thread = infinity::Thread([&]() { pool_thrift_server.Start(); });
-
-#elif THRIFT_SERVER_TYPE == 1
-
-    i32 thrift_server_pool_size = InfinityContext::instance().config()->ConnectionPoolSize();
-    non_block_pool_thrift_server.Init(thrift_server_port, thrift_server_pool_size);
-    non_block_pool_thrift_thread = infinity::Thread([&]() { non_block_pool_thrift_server.Start(); });
-
-#else
-
-    threaded_thrift_server.Init(thrift_server_port);
-    threaded_thrift_thread = infinity::Thread([&]() { threaded_thrift_server.Start(); });
-
-#endif
+    thrift_server_type = InfinityContext::instance().config()->ThriftServerType();
+
+    if (thrift_server_type == THRIFT_SERVER_TYPE_NON_BLOCK) {
+        i32 thrift_server_pool_size = InfinityContext::instance().config()->ConnectionPoolSize();
+        SizeT thrift_io_threads = InfinityContext::instance().config()->ThriftIOThreads();
+        SizeT thrift_max_frame_size = InfinityContext::instance().config()->ThriftMaxFrameSize();
+        non_block_pool_thrift_server.Init(thrift_server_port, thrift_server_pool_size, thrift_io_threads, thrift_max_frame_size);
+        non_block_pool_thrift_thread = infinity::Thread([&]() { non_block_pool_thrift_server.Start(); });
+    } else if (thrift_server_type == THRIFT_SERVER_TYPE_THREADED) {
+        threaded_thrift_server.Init(thrift_server_port);
+        threaded_thrift_thread = infinity::Thread([&]() { threaded_thrift_server.Start(); });
+    } else {
+        i32 thrift_server_pool_size = InfinityContext::instance().config()->ConnectionPoolSize();
+        pool_thrift_server.Init(thrift_server_port, thrift_server_pool_size);
+        pool_thrift_thread = infinity::Thread([&]() { pool_thrift_server.Start(); });
+    }
 
     pg_thread = infinity::Thread([&]() { pg_server.Run(); });
 
@@ -224,19 +210,13 @@ auto main(int argc, char **argv) -> int {
 
     http_server_thread.join();
 
-#if THRIFT_SERVER_TYPE == 0
-
-    pool_thrift_thread.join();
-
-#elif THRIFT_SERVER_TYPE == 1
-
-    non_block_pool_thrift_server.join();
-
-#else
-
-    threaded_thrift_thread.join();
-
-#endif
+    if (thrift_server_type == THRIFT_SERVER_TYPE_NON_BLOCK) {
+        non_block_pool_thrift_thread.join();
+    } else if (thrift_server_type == THRIFT_SERVER_TYPE_THREADED) {
+        threaded_thrift_thread.join();
+    } else {
+        pool_thrift_thread.join();
+    }
 
     pg_thread.join();
 
@@ -108,10 +108,35 @@ export {
     constexpr std::string_view DEFAULT_OPTIMIZE_INTERVAL_SEC_STR = "10s"; // 10 seconds
     constexpr SizeT MAX_OPTIMIZE_INTERVAL_SEC = 60 * 60 * 24 * 30; // 1 month
 
+    constexpr i64 MIN_COMPACTION_IO_LIMIT = 0; // 0 means no limit
+    constexpr i64 DEFAULT_COMPACTION_IO_LIMIT = 0;
+    constexpr i64 MAX_COMPACTION_IO_LIMIT = 1024l * 1024l * 1024l * 1024l; // 1TB per second
+
+    // pool: a thread per connection from a pool, buffered transport
+    // non_block: connections share a few event loop threads, framed transport
+    // threaded: a thread per connection, buffered transport
+    constexpr std::string_view THRIFT_SERVER_TYPE_POOL = "pool";
+    constexpr std::string_view THRIFT_SERVER_TYPE_NON_BLOCK = "non_block";
+    constexpr std::string_view THRIFT_SERVER_TYPE_THREADED = "threaded";
+
+    constexpr i64 MIN_THRIFT_IO_THREADS = 1;
+    constexpr i64 DEFAULT_THRIFT_IO_THREADS = 4;
+    constexpr i64 MAX_THRIFT_IO_THREADS = 64;
+
+    constexpr i64 MIN_THRIFT_MAX_FRAME_SIZE = 1024l * 1024l;                // 1MB
+    constexpr i64 DEFAULT_THRIFT_MAX_FRAME_SIZE = 256l * 1024l * 1024l;     // 256MB
+    constexpr i64 MAX_THRIFT_MAX_FRAME_SIZE = 2047l * 1024l * 1024l;        // a frame size is an i32
+
+    constexpr i64 MIN_APPEND_STREAM_COUNT = 1;
+    constexpr i64 DEFAULT_APPEND_STREAM_COUNT = 1;
+    constexpr i64 MAX_APPEND_STREAM_COUNT = 64;
+
     constexpr SizeT MIN_MEMINDEX_CAPACITY = DEFAULT_BLOCK_CAPACITY;           // 1 Block
     constexpr SizeT DEFAULT_MEMINDEX_CAPACITY = 128 * DEFAULT_BLOCK_CAPACITY; // 128 * 8192 = 1M rows
     constexpr SizeT MAX_MEMINDEX_CAPACITY = DEFAULT_SEGMENT_CAPACITY;         // 1 Segment
 
+    constexpr SizeT DEFAULT_PLAN_CACHE_CAPACITY = 1024; // number of cached physical plans
+
     constexpr i64 MIN_WAL_FILE_SIZE_THRESHOLD = 1024;                                    // 1KB
     constexpr i64 DEFAULT_WAL_FILE_SIZE_THRESHOLD = 1 * 1024l * 1024l * 1024l;           // 1GB
     constexpr std::string_view DEFAULT_WAL_FILE_SIZE_THRESHOLD_STR = "1GB";           // 1GB
@@ -160,6 +185,10 @@ export {
     constexpr SizeT HNSW_EF_CONSTRUCTION = 200;
     constexpr SizeT HNSW_EF = 200;
     constexpr SizeT HNSW_BLOCK_SIZE = 8192;
+    // strategy of the filtered hnsw search of a segment, see `KnnFilterStrategy`
+    constexpr SizeT HNSW_FILTER_BRUTE_FORCE_ROWS = DEFAULT_BLOCK_CAPACITY; // brute force over the passing rows when no more rows pass
+    constexpr f64 HNSW_FILTER_TWO_HOP_SELECTIVITY = 0.1;                  // expand the neighbors of the filtered out vertices below it
+    constexpr SizeT HNSW_FILTER_MAX_EF = 4096;                             // upper bound of the ef enlarged by the selectivity
 
     constexpr SizeT BMP_BLOCK_SIZE = 16;
 
@@ -170,6 +199,14 @@ export {
     constexpr SizeT DBT_COMPACTION_M = 4;
     constexpr SizeT DBT_COMPACTION_C = 4;
     constexpr SizeT DBT_COMPACTION_S = DEFAULT_BLOCK_CAPACITY;
+    constexpr f64 DBT_COMPACTION_DELETE_RATIO = 0.3; // rewrite a segment alone when this ratio of rows is deleted, 0 means disable
+    constexpr f64 DBT_COMPACTION_MAX_DELETE_RATIO = 0.9;
+
+    // relative cost of rebuilding one row of each index type when compacting, the row copy itself costs 1
+    constexpr f64 COMPACTION_SECONDARY_INDEX_COST = 1;
+    constexpr f64 COMPACTION_FULLTEXT_INDEX_COST = 4;
+    constexpr f64 COMPACTION_OTHER_INDEX_COST = 8;
+    constexpr f64 COMPACTION_HNSW_INDEX_COST = 16;
 
     // default query option parameter
     constexpr u32 DEFAULT_MATCH_TEXT_OPTION_TOP_N = 10;
@@ -204,6 +241,9 @@ export {
     constexpr std::string_view HTTP_PORT_OPTION_NAME = "http_port";
     constexpr std::string_view CLIENT_PORT_OPTION_NAME = "client_port";
     constexpr std::string_view CONNECTION_POOL_SIZE_OPTION_NAME = "connection_pool_size";
+    constexpr std::string_view THRIFT_SERVER_TYPE_OPTION_NAME = "thrift_server_type";
+    constexpr std::string_view THRIFT_IO_THREADS_OPTION_NAME = "thrift_io_threads";
+    constexpr std::string_view THRIFT_MAX_FRAME_SIZE_OPTION_NAME = "thrift_max_frame_size";
     constexpr std::string_view LOG_FILENAME_OPTION_NAME = "log_filename";
 
     constexpr std::string_view LOG_DIR_OPTION_NAME = "log_dir";
@@ -217,6 +257,8 @@ export {
     constexpr std::string_view COMPACT_INTERVAL_OPTION_NAME = "compact_interval";
     constexpr std::string_view OPTIMIZE_INTERVAL_OPTION_NAME = "optimize_interval";
     constexpr std::string_view MEM_INDEX_CAPACITY_OPTION_NAME = "mem_index_capacity";
+    constexpr std::string_view COMPACTION_IO_LIMIT_OPTION_NAME = "compaction_io_limit";
+    constexpr std::string_view APPEND_STREAM_COUNT_OPTION_NAME = "append_stream_count";
 
     constexpr std::string_view PERSISTENCE_DIR_OPTION_NAME = "persistence_dir";
     constexpr std::string_view PERSISTENCE_OBJECT_SIZE_LIMIT_OPTION_NAME = "persistence_object_size_limit";
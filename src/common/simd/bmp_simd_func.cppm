@@ -106,6 +106,45 @@ export void MultiF32StoreI32(const int32_t *idx, const float *data, float *dest,
     }
 }
 
+#if defined(__AVX2__)
+void MultiF32AddPositiveF32AVX(const float *data, float *dest, float x, size_t dim) {
+    const float *data_end = data + (dim & ~7);
+    __m256 vx = _mm256_set1_ps(x);
+    __m256 vzero = _mm256_setzero_ps();
+    while (data < data_end) {
+        __m256 vdata = _mm256_max_ps(_mm256_loadu_ps(data), vzero);
+        __m256 vdest = _mm256_add_ps(_mm256_mul_ps(vdata, vx), _mm256_loadu_ps(dest));
+        _mm256_storeu_ps(dest, vdest);
+        dest += 8;
+        data += 8;
+    }
+}
+#endif
+
+void MultiF32AddPositiveF32BF(const float *data, float *dest, float x, size_t dim) {
+    for (size_t i = 0; i < dim; ++i) {
+        if (data[i] > 0.0f) {
+            dest[i] += data[i] * x;
+        }
+    }
+}
+
+// for every positive data[i], multiple with x and add to dest[i]
+export void MultiF32AddPositiveF32(const float *data, float *dest, float x, size_t dim) {
+#if defined(__AVX2__)
+    if (dim >= 8) {
+        MultiF32AddPositiveF32AVX(data, dest, x, dim);
+        size_t step = dim & ~7;
+        data += step;
+        dest += step;
+        dim &= 7;
+    }
+#endif
+    if (dim > 0) {
+        MultiF32AddPositiveF32BF(data, dest, x, dim);
+    }
+}
+
 #if defined(__AVX2__)
 
 void MultiF32StoreI8AVX(const int8_t *idx, const float *data, float *dest, float x, size_t dim) {
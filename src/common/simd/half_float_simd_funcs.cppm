@@ -0,0 +1,234 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+#include <cstring>
+#include "simd_common_intrin_include.h"
+
+export module half_float_simd_funcs;
+
+import stl;
+import simd_common_tools;
+
+namespace infinity {
+
+// Distances between f32 queries and a vector of half precision floats stored as the raw 16 bits: IEEE fp16 or bf16.
+// The half floats are widened to f32 in the registers, the column data is never converted as a whole.
+// The distances match the f32 distance functions: squared l2, inner product and cosine similarity.
+export enum class HalfDistanceMetric : i8 { kL2, kIP, kCos };
+
+export template <bool BF16>
+inline f32 HalfToF32(u16 h) {
+    u32 bits;
+    if constexpr (BF16) {
+        bits = static_cast<u32>(h) << 16;
+    } else {
+        u32 sign = static_cast<u32>(h & 0x8000u) << 16;
+        u32 exp = (h >> 10) & 0x1fu;
+        u32 mant = h & 0x3ffu;
+        if (exp == 0x1fu) {
+            bits = sign | 0x7f800000u | (mant << 13);
+        } else if (exp != 0) {
+            bits = sign | ((exp + 112) << 23) | (mant << 13);
+        } else if (mant == 0) {
+            bits = sign;
+        } else {
+            // subnormal
+            f32 v = std::ldexp(static_cast<f32>(mant), -24);
+            return sign ? -v : v;
+        }
+    }
+    f32 res;
+    std::memcpy(&res, &bits, sizeof(res));
+    return res;
+}
+
+template <HalfDistanceMetric Metric>
+inline f32 HalfDistanceResult(f32 acc, f32 query_norm_sq, f32 data_norm_sq) {
+    if constexpr (Metric == HalfDistanceMetric::kCos) {
+        return acc ? acc / std::sqrt(query_norm_sq * data_norm_sq) : 0.0f;
+    } else {
+        return acc;
+    }
+}
+
+// Accumulates the tail of the vectors that does not fill a register
+template <bool BF16, HalfDistanceMetric Metric, SizeT N>
+inline void HalfDistanceTail(const f32 *queries, const u16 *data, SizeT dim, SizeT begin, f32 *acc, f32 *query_norm_sq, f32 &data_norm_sq) {
+    for (SizeT j = begin; j < dim; ++j) {
+        f32 d = HalfToF32<BF16>(data[j]);
+        if constexpr (Metric == HalfDistanceMetric::kCos) {
+            data_norm_sq += d * d;
+        }
+        for (SizeT i = 0; i < N; ++i) {
+            f32 q = queries[i * dim + j];
+            if constexpr (Metric == HalfDistanceMetric::kL2) {
+                f32 diff = q - d;
+                acc[i] += diff * diff;
+            } else {
+                acc[i] += q * d;
+                if constexpr (Metric == HalfDistanceMetric::kCos) {
+                    query_norm_sq[i] += q * q;
+                }
+            }
+        }
+    }
+}
+
+// `dists[i]` is the distance of `data` to the query `queries + i * dim`
+export template <bool BF16, HalfDistanceMetric Metric>
+void HalfBatchDistanceBF(const f32 *queries, SizeT query_n, const u16 *data, SizeT dim, f32 *dists) {
+    for (SizeT i = 0; i < query_n; ++i) {
+        f32 acc = 0, query_norm_sq = 0, data_norm_sq = 0;
+        HalfDistanceTail<BF16, Metric, 1>(queries + i * dim, data, dim, 0, &acc, &query_norm_sq, data_norm_sq);
+        dists[i] = HalfDistanceResult<Metric>(acc, query_norm_sq, data_norm_sq);
+    }
+}
+
+#if defined(__AVX2__) && defined(__F16C__) && defined(__FMA__)
+
+template <bool BF16>
+inline __m256 LoadHalf8AVX2(const u16 *data) {
+    __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+    if constexpr (BF16) {
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(raw), 16));
+    } else {
+        return _mm256_cvtph_ps(raw);
+    }
+}
+
+// Each lane of the data is widened once and compared with `N` queries
+template <bool BF16, HalfDistanceMetric Metric, SizeT N>
+inline void HalfGroupDistanceAVX2(const f32 *queries, const u16 *data, SizeT dim, f32 *dists) {
+    __m256 acc[N];
+    __m256 query_norm[N];
+    __m256 data_norm = _mm256_setzero_ps();
+    for (SizeT i = 0; i < N; ++i) {
+        acc[i] = _mm256_setzero_ps();
+        query_norm[i] = _mm256_setzero_ps();
+    }
+    SizeT j = 0;
+    for (; j + 8 <= dim; j += 8) {
+        __m256 d = LoadHalf8AVX2<BF16>(data + j);
+        if constexpr (Metric == HalfDistanceMetric::kCos) {
+            data_norm = _mm256_fmadd_ps(d, d, data_norm);
+        }
+        for (SizeT i = 0; i < N; ++i) {
+            __m256 q = _mm256_loadu_ps(queries + i * dim + j);
+            if constexpr (Metric == HalfDistanceMetric::kL2) {
+                __m256 diff = _mm256_sub_ps(q, d);
+                acc[i] = _mm256_fmadd_ps(diff, diff, acc[i]);
+            } else {
+                acc[i] = _mm256_fmadd_ps(q, d, acc[i]);
+                if constexpr (Metric == HalfDistanceMetric::kCos) {
+                    query_norm[i] = _mm256_fmadd_ps(q, q, query_norm[i]);
+                }
+            }
+        }
+    }
+    f32 acc_sum[N];
+    f32 query_norm_sq[N];
+    for (SizeT i = 0; i < N; ++i) {
+        acc_sum[i] = hsum256_ps_avx(acc[i]);
+        query_norm_sq[i] = hsum256_ps_avx(query_norm[i]);
+    }
+    f32 data_norm_sq = hsum256_ps_avx(data_norm);
+    HalfDistanceTail<BF16, Metric, N>(queries, data, dim, j, acc_sum, query_norm_sq, data_norm_sq);
+    for (SizeT i = 0; i < N; ++i) {
+        dists[i] = HalfDistanceResult<Metric>(acc_sum[i], query_norm_sq[i], data_norm_sq);
+    }
+}
+
+export template <bool BF16, HalfDistanceMetric Metric>
+void HalfBatchDistanceAVX2(const f32 *queries, SizeT query_n, const u16 *data, SizeT dim, f32 *dists) {
+    SizeT i = 0;
+    for (; i + 4 <= query_n; i += 4) {
+        HalfGroupDistanceAVX2<BF16, Metric, 4>(queries + i * dim, data, dim, dists + i);
+    }
+    for (; i < query_n; ++i) {
+        HalfGroupDistanceAVX2<BF16, Metric, 1>(queries + i * dim, data, dim, dists + i);
+    }
+}
+
+#endif
+
+#if defined(__AVX512F__)
+
+template <bool BF16>
+inline __m512 LoadHalf16AVX512(const u16 *data) {
+    __m256i raw = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+    if constexpr (BF16) {
+        return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(raw), 16));
+    } else {
+        return _mm512_cvtph_ps(raw);
+    }
+}
+
+template <bool BF16, HalfDistanceMetric Metric, SizeT N>
+inline void HalfGroupDistanceAVX512(const f32 *queries, const u16 *data, SizeT dim, f32 *dists) {
+    __m512 acc[N];
+    __m512 query_norm[N];
+    __m512 data_norm = _mm512_setzero_ps();
+    for (SizeT i = 0; i < N; ++i) {
+        acc[i] = _mm512_setzero_ps();
+        query_norm[i] = _mm512_setzero_ps();
+    }
+    SizeT j = 0;
+    for (; j + 16 <= dim; j += 16) {
+        __m512 d = LoadHalf16AVX512<BF16>(data + j);
+        if constexpr (Metric == HalfDistanceMetric::kCos) {
+            data_norm = _mm512_fmadd_ps(d, d, data_norm);
+        }
+        for (SizeT i = 0; i < N; ++i) {
+            __m512 q = _mm512_loadu_ps(queries + i * dim + j);
+            if constexpr (Metric == HalfDistanceMetric::kL2) {
+                __m512 diff = _mm512_sub_ps(q, d);
+                acc[i] = _mm512_fmadd_ps(diff, diff, acc[i]);
+            } else {
+                acc[i] = _mm512_fmadd_ps(q, d, acc[i]);
+                if constexpr (Metric == HalfDistanceMetric::kCos) {
+                    query_norm[i] = _mm512_fmadd_ps(q, q, query_norm[i]);
+                }
+            }
+        }
+    }
+    f32 acc_sum[N];
+    f32 query_norm_sq[N];
+    for (SizeT i = 0; i < N; ++i) {
+        acc_sum[i] = _mm512_reduce_add_ps(acc[i]);
+        query_norm_sq[i] = _mm512_reduce_add_ps(query_norm[i]);
+    }
+    f32 data_norm_sq = _mm512_reduce_add_ps(data_norm);
+    HalfDistanceTail<BF16, Metric, N>(queries, data, dim, j, acc_sum, query_norm_sq, data_norm_sq);
+    for (SizeT i = 0; i < N; ++i) {
+        dists[i] = HalfDistanceResult<Metric>(acc_sum[i], query_norm_sq[i], data_norm_sq);
+    }
+}
+
+export template <bool BF16, HalfDistanceMetric Metric>
+void HalfBatchDistanceAVX512(const f32 *queries, SizeT query_n, const u16 *data, SizeT dim, f32 *dists) {
+    SizeT i = 0;
+    for (; i + 4 <= query_n; i += 4) {
+        HalfGroupDistanceAVX512<BF16, Metric, 4>(queries + i * dim, data, dim, dists + i);
+    }
+    for (; i < query_n; ++i) {
+        HalfGroupDistanceAVX512<BF16, Metric, 1>(queries + i * dim, data, dim, dists + i);
+    }
+}
+
+#endif
+
+} // namespace infinity
@@ -957,6 +957,109 @@ export int32_t U8L2SSE2Residual(const uint8_t *pv1, const uint8_t *pv2, size_t d
 
 //------------------------------//------------------------------//------------------------------
 
+// 4-bit codes packed two in a byte, the low nibble first. `dim` is the number of the packed bytes.
+export int32_t U4IPBF(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < dim; ++i) {
+        res += static_cast<int32_t>(pv1[i] & 0x0F) * static_cast<int32_t>(pv2[i] & 0x0F);
+        res += static_cast<int32_t>(pv1[i] >> 4) * static_cast<int32_t>(pv2[i] >> 4);
+    }
+    return res;
+}
+
+#if defined(__AVX512BW__)
+export int32_t U4IPAVX512BW(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    const uint8_t *pEnd1 = pv1 + (dim & ~(63u));
+    const __m512i mask = _mm512_set1_epi8(0x0F);
+    const __m512i ones = _mm512_set1_epi16(1);
+    __m512i sum = _mm512_setzero_si512();
+    while (pv1 < pEnd1) {
+        __m512i v1 = _mm512_loadu_si512((__m512i *)pv1);
+        __m512i v2 = _mm512_loadu_si512((__m512i *)pv2);
+        __m512i v1_lo = _mm512_and_si512(v1, mask);
+        __m512i v2_lo = _mm512_and_si512(v2, mask);
+        __m512i v1_hi = _mm512_and_si512(_mm512_srli_epi16(v1, 4), mask);
+        __m512i v2_hi = _mm512_and_si512(_mm512_srli_epi16(v2, 4), mask);
+        // the codes are less than 16, the sums of the adjacent products never saturate
+        __m512i mul = _mm512_add_epi16(_mm512_maddubs_epi16(v1_lo, v2_lo), _mm512_maddubs_epi16(v1_hi, v2_hi));
+        sum = _mm512_add_epi32(sum, _mm512_madd_epi16(mul, ones));
+        pv1 += 64;
+        pv2 += 64;
+    }
+    return hsum_epi32_avx512(sum);
+}
+
+export int32_t U4IPAVX512BWResidual(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    return U4IPAVX512BW(pv1, pv2, dim) + U4IPBF(pv1 + (dim & ~63), pv2 + (dim & ~63), dim & 63);
+}
+#endif
+
+#if defined(__AVX2__)
+export int32_t U4IPAVX2(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    const uint8_t *pEnd1 = pv1 + (dim & ~(31u));
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i sum = _mm256_setzero_si256();
+    while (pv1 < pEnd1) {
+        __m256i v1 = _mm256_loadu_si256((__m256i *)pv1);
+        __m256i v2 = _mm256_loadu_si256((__m256i *)pv2);
+        __m256i v1_lo = _mm256_and_si256(v1, mask);
+        __m256i v2_lo = _mm256_and_si256(v2, mask);
+        __m256i v1_hi = _mm256_and_si256(_mm256_srli_epi16(v1, 4), mask);
+        __m256i v2_hi = _mm256_and_si256(_mm256_srli_epi16(v2, 4), mask);
+        // the codes are less than 16, the sums of the adjacent products never saturate
+        __m256i mul = _mm256_add_epi16(_mm256_maddubs_epi16(v1_lo, v2_lo), _mm256_maddubs_epi16(v1_hi, v2_hi));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(mul, ones));
+        pv1 += 32;
+        pv2 += 32;
+    }
+    return hsum_8x32_avx2(sum);
+}
+
+export int32_t U4IPAVX2Residual(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    return U4IPAVX2(pv1, pv2, dim) + U4IPBF(pv1 + (dim & ~31), pv2 + (dim & ~31), dim & 31);
+}
+#endif
+
+//------------------------------//------------------------------//------------------------------
+
+// Hamming distance of the bit codes. `dim` is the number of the 64-bit words.
+export int32_t BinaryHammingBF(const uint64_t *pv1, const uint64_t *pv2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < dim; ++i) {
+        res += __builtin_popcountll(pv1[i] ^ pv2[i]);
+    }
+    return res;
+}
+
+#if defined(__AVX2__)
+export int32_t BinaryHammingAVX2(const uint64_t *pv1, const uint64_t *pv2, size_t dim) {
+    const uint64_t *pEnd1 = pv1 + (dim & ~(3u));
+    // bit count of each nibble
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    __m256i sum = _mm256_setzero_si256();
+    while (pv1 < pEnd1) {
+        __m256i v1 = _mm256_loadu_si256((__m256i *)pv1);
+        __m256i v2 = _mm256_loadu_si256((__m256i *)pv2);
+        __m256i v = _mm256_xor_si256(v1, v2);
+        __m256i cnt_lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, mask));
+        __m256i cnt_hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), mask));
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_add_epi8(cnt_lo, cnt_hi), _mm256_setzero_si256()));
+        pv1 += 4;
+        pv2 += 4;
+    }
+    return static_cast<int32_t>(_mm256_extract_epi64(sum, 0) + _mm256_extract_epi64(sum, 1) + _mm256_extract_epi64(sum, 2) +
+                                _mm256_extract_epi64(sum, 3));
+}
+
+export int32_t BinaryHammingAVX2Residual(const uint64_t *pv1, const uint64_t *pv2, size_t dim) {
+    return BinaryHammingAVX2(pv1, pv2, dim) + BinaryHammingBF(pv1 + (dim & ~3), pv2 + (dim & ~3), dim & 3);
+}
+#endif
+
+//------------------------------//------------------------------//------------------------------
+
 export float F32L2BF(const float *pv1, const float *pv2, size_t dim) {
     float res = 0;
     for (size_t i = 0; i < dim; i++) {
@@ -17,6 +17,7 @@ module;
 #include "simd_common_intrin_include.h"
 #include <bit>
 #include <cassert>
+#include <cstring>
 
 export module maxsim_simd_funcs;
 import stl;
@@ -213,4 +214,77 @@ export i64 maxsim_i64_bit_ip_avx512(const i64 *v1, const u8 *v2, SizeT dim) {
 }
 #endif
 
+// hamming distance of two bit vectors of `bytes` bytes
+export u32 maxsim_bit_hamming_plain(const u8 *v1, const u8 *v2, SizeT bytes) {
+    u32 res = 0;
+    SizeT i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        u64 w1, w2;
+        std::memcpy(&w1, v1 + i, sizeof(u64));
+        std::memcpy(&w2, v2 + i, sizeof(u64));
+        res += std::popcount(w1 ^ w2);
+    }
+    for (; i < bytes; ++i) {
+        res += std::popcount(static_cast<u32>(v1[i] ^ v2[i]));
+    }
+    return res;
+}
+
+#if defined(__AVX2__)
+export u32 maxsim_bit_hamming_avx2(const u8 *v1, const u8 *v2, SizeT bytes) {
+    // popcount of each nibble
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i sum_4 = _mm256_setzero_si256();
+    SizeT i = 0;
+    for (; i + 32 <= bytes; i += 32) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(v1 + i)),
+                                     _mm256_loadu_si256(reinterpret_cast<const __m256i *>(v2 + i)));
+        __m256i lo = _mm256_and_si256(x, low_mask);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), low_mask);
+        __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+        sum_4 = _mm256_add_epi64(sum_4, _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+    }
+    __m128i sum_2 = _mm_add_epi64(_mm256_castsi256_si128(sum_4), _mm256_extracti128_si256(sum_4, 1));
+    alignas(16) u64 v[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(v), sum_2);
+    return static_cast<u32>(v[0] + v[1]) + maxsim_bit_hamming_plain(v1 + i, v2 + i, bytes - i);
+}
+#endif
+
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+export u32 maxsim_bit_hamming_avx512(const u8 *v1, const u8 *v2, SizeT bytes) {
+    __m512i sum = _mm512_setzero_si512();
+    SizeT i = 0;
+    for (; i + 64 <= bytes; i += 64) {
+        __m512i x = _mm512_xor_si512(_mm512_loadu_si512(v1 + i), _mm512_loadu_si512(v2 + i));
+        sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(x));
+    }
+    return static_cast<u32>(_mm512_reduce_add_epi64(sum)) + maxsim_bit_hamming_avx2(v1 + i, v2 + i, bytes - i);
+}
+#endif
+
+// 1-bit quantization of a f32 embedding: bit j (the lowest bit first in each byte) is set when v[j] > 0
+export void maxsim_f32_to_bits_plain(const f32 *v, u8 *bits, SizeT dim) {
+    std::memset(bits, 0, (dim + 7) / 8);
+    for (SizeT j = 0; j < dim; ++j) {
+        if (v[j] > 0.0f) {
+            bits[j / 8] |= static_cast<u8>(1u << (j % 8));
+        }
+    }
+}
+
+#if defined(__AVX2__)
+export void maxsim_f32_to_bits_avx2(const f32 *v, u8 *bits, SizeT dim) {
+    const __m256 zero = _mm256_setzero_ps();
+    SizeT i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        bits[i / 8] = static_cast<u8>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(v + i), zero, _CMP_GT_OQ)));
+    }
+    if (i < dim) {
+        maxsim_f32_to_bits_plain(v + i, bits + i / 8, dim - i);
+    }
+}
+#endif
+
 } // namespace infinity
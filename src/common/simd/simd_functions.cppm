@@ -56,11 +56,29 @@ export struct SIMD_FUNCTIONS {
     U8DistanceFuncType HNSW_U8IP_64_ptr_ = Get_HNSW_U8IP_64_ptr();
     U8CosDistanceFuncType HNSW_U8Cos_ptr_ = Get_HNSW_U8Cos_ptr();
 
+    // HNSW U4
+    U4DistanceFuncType HNSW_U4IP_ptr_ = Get_HNSW_U4IP_ptr();
+
+    // HNSW Binary
+    BinaryDistanceFuncType HNSW_BinaryHamming_ptr_ = Get_HNSW_BinaryHamming_ptr();
+
+    // F32 queries with F16 / BF16 data, the distances of a vector to a batch of queries
+    HalfBatchDistanceFuncType F16L2Batch_func_ptr_ = GetF16L2BatchFuncPtr();
+    HalfBatchDistanceFuncType F16IPBatch_func_ptr_ = GetF16IPBatchFuncPtr();
+    HalfBatchDistanceFuncType F16CosBatch_func_ptr_ = GetF16CosBatchFuncPtr();
+    HalfBatchDistanceFuncType BF16L2Batch_func_ptr_ = GetBF16L2BatchFuncPtr();
+    HalfBatchDistanceFuncType BF16IPBatch_func_ptr_ = GetBF16IPBatchFuncPtr();
+    HalfBatchDistanceFuncType BF16CosBatch_func_ptr_ = GetBF16CosBatchFuncPtr();
+
     // MaxSim IP
     MaxSimF32BitIPFuncType MaxSimF32BitIP_func_ptr_ = GetMaxSimF32BitIPFuncPtr();
     MaxSimI32BitIPFuncType MaxSimI32BitIP_func_ptr_ = GetMaxSimI32BitIPFuncPtr();
     MaxSimI64BitIPFuncType MaxSimI64BitIP_func_ptr_ = GetMaxSimI64BitIPFuncPtr();
 
+    // MaxSim of 1-bit quantized embeddings
+    MaxSimBitHammingFuncType MaxSimBitHamming_func_ptr_ = GetMaxSimBitHammingFuncPtr();
+    MaxSimF32ToBitsFuncType MaxSimF32ToBits_func_ptr_ = GetMaxSimF32ToBitsFuncPtr();
+
     // EMVB
     FilterScoresOutputIdsFuncType FilterScoresOutputIds_func_ptr_ = GetFilterScoresOutputIdsFuncPtr();
 
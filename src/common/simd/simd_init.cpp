@@ -21,6 +21,7 @@ import hnsw_simd_func;
 import maxsim_simd_funcs;
 import emvb_simd_funcs;
 import search_top_1_sgemm;
+import half_float_simd_funcs;
 
 namespace infinity {
 
@@ -522,6 +523,56 @@ U8CosDistanceFuncType Get_HNSW_U8Cos_ptr() {
     return &U8CosBF;
 }
 
+U4DistanceFuncType Get_HNSW_U4IP_ptr() {
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        return &U4IPAVX512BWResidual;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &U4IPAVX2Residual;
+    }
+#endif
+    return &U4IPBF;
+}
+
+BinaryDistanceFuncType Get_HNSW_BinaryHamming_ptr() {
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &BinaryHammingAVX2Residual;
+    }
+#endif
+    return &BinaryHammingBF;
+}
+
+template <bool BF16, HalfDistanceMetric Metric>
+HalfBatchDistanceFuncType GetHalfBatchDistanceFuncPtr() {
+#if defined(__AVX512F__)
+    if (IsAVX512Supported()) {
+        return &HalfBatchDistanceAVX512<BF16, Metric>;
+    }
+#endif
+#if defined(__AVX2__) && defined(__F16C__) && defined(__FMA__)
+    if (IsAVX2Supported() && IsF16CSupported()) {
+        return &HalfBatchDistanceAVX2<BF16, Metric>;
+    }
+#endif
+    return &HalfBatchDistanceBF<BF16, Metric>;
+}
+
+HalfBatchDistanceFuncType GetF16L2BatchFuncPtr() { return GetHalfBatchDistanceFuncPtr<false, HalfDistanceMetric::kL2>(); }
+
+HalfBatchDistanceFuncType GetF16IPBatchFuncPtr() { return GetHalfBatchDistanceFuncPtr<false, HalfDistanceMetric::kIP>(); }
+
+HalfBatchDistanceFuncType GetF16CosBatchFuncPtr() { return GetHalfBatchDistanceFuncPtr<false, HalfDistanceMetric::kCos>(); }
+
+HalfBatchDistanceFuncType GetBF16L2BatchFuncPtr() { return GetHalfBatchDistanceFuncPtr<true, HalfDistanceMetric::kL2>(); }
+
+HalfBatchDistanceFuncType GetBF16IPBatchFuncPtr() { return GetHalfBatchDistanceFuncPtr<true, HalfDistanceMetric::kIP>(); }
+
+HalfBatchDistanceFuncType GetBF16CosBatchFuncPtr() { return GetHalfBatchDistanceFuncPtr<true, HalfDistanceMetric::kCos>(); }
+
 MaxSimF32BitIPFuncType GetMaxSimF32BitIPFuncPtr() {
 #if defined(__AVX512F__)
     if (IsAVX512Supported()) {
@@ -564,6 +615,29 @@ MaxSimI64BitIPFuncType GetMaxSimI64BitIPFuncPtr() {
     return &maxsim_i64_bit_ip_plain;
 }
 
+MaxSimBitHammingFuncType GetMaxSimBitHammingFuncPtr() {
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    if (IsAVX512Supported() && IsAVX512VPOPCNTDQSupported()) {
+        return &maxsim_bit_hamming_avx512;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &maxsim_bit_hamming_avx2;
+    }
+#endif
+    return &maxsim_bit_hamming_plain;
+}
+
+MaxSimF32ToBitsFuncType GetMaxSimF32ToBitsFuncPtr() {
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &maxsim_f32_to_bits_avx2;
+    }
+#endif
+    return &maxsim_f32_to_bits_plain;
+}
+
 FilterScoresOutputIdsFuncType GetFilterScoresOutputIdsFuncPtr() {
 #if defined(__AVX2__)
     if (IsAVX2Supported()) {
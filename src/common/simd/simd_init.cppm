@@ -26,15 +26,21 @@ export using infinity::IsSSE2Supported;
 export using infinity::IsAVX2Supported;
 export using infinity::IsAVX512Supported;
 export using infinity::IsAVX512BWSupported;
+export using infinity::IsAVX512VPOPCNTDQSupported;
 
 export using F32DistanceFuncType = f32(*)(const f32 *, const f32 *, SizeT);
 export using I8DistanceFuncType = i32(*)(const i8 *, const i8 *, SizeT);
 export using I8CosDistanceFuncType = f32(*)(const i8 *, const i8 *, SizeT);
 export using U8DistanceFuncType = i32(*)(const u8 *, const u8 *, SizeT);
 export using U8CosDistanceFuncType = f32(*)(const u8 *, const u8 *, SizeT);
+export using U4DistanceFuncType = i32(*)(const u8 *, const u8 *, SizeT);
+export using BinaryDistanceFuncType = i32(*)(const u64 *, const u64 *, SizeT);
+export using HalfBatchDistanceFuncType = void(*)(const f32 *, SizeT, const u16 *, SizeT, f32 *);
 export using MaxSimF32BitIPFuncType = f32(*)(const f32 *, const u8 *, SizeT);
 export using MaxSimI32BitIPFuncType = i32(*)(const i32 *, const u8 *, SizeT);
 export using MaxSimI64BitIPFuncType = i64(*)(const i64 *, const u8 *, SizeT);
+export using MaxSimBitHammingFuncType = u32(*)(const u8 *, const u8 *, SizeT);
+export using MaxSimF32ToBitsFuncType = void(*)(const f32 *, u8 *, SizeT);
 export using FilterScoresOutputIdsFuncType = u32 * (*)(u32 *, f32, const f32 *, u32);
 export using SearchTop1WithDisF32U32FuncType = void(*)(u32, u32, const f32 *, u32, const f32 *, u32 *, f32 *);
 
@@ -69,10 +75,24 @@ export U8DistanceFuncType Get_HNSW_U8IP_16_ptr();
 export U8DistanceFuncType Get_HNSW_U8IP_32_ptr();
 export U8DistanceFuncType Get_HNSW_U8IP_64_ptr();
 export U8CosDistanceFuncType Get_HNSW_U8Cos_ptr();
+// HNSW U4
+export U4DistanceFuncType Get_HNSW_U4IP_ptr();
+// HNSW Binary
+export BinaryDistanceFuncType Get_HNSW_BinaryHamming_ptr();
+// F32 queries with F16 / BF16 data
+export HalfBatchDistanceFuncType GetF16L2BatchFuncPtr();
+export HalfBatchDistanceFuncType GetF16IPBatchFuncPtr();
+export HalfBatchDistanceFuncType GetF16CosBatchFuncPtr();
+export HalfBatchDistanceFuncType GetBF16L2BatchFuncPtr();
+export HalfBatchDistanceFuncType GetBF16IPBatchFuncPtr();
+export HalfBatchDistanceFuncType GetBF16CosBatchFuncPtr();
 // MaxSim IP
 export MaxSimF32BitIPFuncType GetMaxSimF32BitIPFuncPtr();
 export MaxSimI32BitIPFuncType GetMaxSimI32BitIPFuncPtr();
 export MaxSimI64BitIPFuncType GetMaxSimI64BitIPFuncPtr();
+// MaxSim of 1-bit quantized embeddings
+export MaxSimBitHammingFuncType GetMaxSimBitHammingFuncPtr();
+export MaxSimF32ToBitsFuncType GetMaxSimF32ToBitsFuncPtr();
 // EMVB
 export FilterScoresOutputIdsFuncType GetFilterScoresOutputIdsFuncPtr();
 // K-means
@@ -24,6 +24,7 @@ struct SupportedSimdTypes {
     bool is_avx2_ = NGT::CpuInfo::isAVX2();
     bool is_avx512_ = NGT::CpuInfo::isAVX512();
     bool is_avx512bw_ = NGT::CpuInfo::isAVX512BW();
+    bool is_avx512vpopcntdq_ = NGT::CpuInfo::isAVX512VPOPCNTDQ();
 };
 
 const SupportedSimdTypes &GetSupportedSimdTypes() {
@@ -43,4 +44,6 @@ bool IsAVX512Supported() { return GetSupportedSimdTypes().is_avx512_; }
 
 bool IsAVX512BWSupported() { return GetSupportedSimdTypes().is_avx512bw_; }
 
+bool IsAVX512VPOPCNTDQSupported() { return GetSupportedSimdTypes().is_avx512vpopcntdq_; }
+
 } // namespace infinity
@@ -2,6 +2,7 @@ module;
 #include <cassert>
 #include <cstring>
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <string>
 
 module wrap_infinity;
@@ -215,9 +216,41 @@ ParsedExpr *WrapBetweenExpr::GetParsedExpr(Status &status) {
     return between_expr;
 }
 
-Tuple<void *, i64> GetEmbeddingDataTypeDataPtrFromProto(const EmbeddingData &embedding_data, Status &status) {
+nb::dlpack::dtype EmbeddingDataTypeToDLPackType(EmbeddingDataType embedding_data_type) {
+    switch (embedding_data_type) {
+        case EmbeddingDataType::kElemUInt8:
+            return nb::dtype<u8>();
+        case EmbeddingDataType::kElemInt8:
+            return nb::dtype<i8>();
+        case EmbeddingDataType::kElemInt16:
+            return nb::dtype<i16>();
+        case EmbeddingDataType::kElemInt32:
+            return nb::dtype<i32>();
+        case EmbeddingDataType::kElemInt64:
+            return nb::dtype<i64>();
+        case EmbeddingDataType::kElemFloat:
+            return nb::dtype<f32>();
+        case EmbeddingDataType::kElemDouble:
+            return nb::dtype<f64>();
+        case EmbeddingDataType::kElemFloat16:
+            return {static_cast<u8>(nb::dlpack::dtype_code::Float), 16, 1};
+        case EmbeddingDataType::kElemBFloat16:
+            return {static_cast<u8>(nb::dlpack::dtype_code::Bfloat), 16, 1};
+        default:
+            return {};
+    }
+}
+
+Tuple<void *, i64> GetEmbeddingDataTypeDataPtrFromProto(const EmbeddingData &embedding_data, EmbeddingDataType embedding_data_type, Status &status) {
     status.code_ = ErrorCode::kOk;
-    if (embedding_data.u8_array_value.size() != 0) {
+    if (embedding_data.array_value.is_valid()) {
+        // the array stays referenced by the caller during the query, so the expression can point into it
+        if (embedding_data.array_value.dtype() != EmbeddingDataTypeToDLPackType(embedding_data_type)) {
+            status = Status::InvalidEmbeddingDataType("array dtype does not match the embedding data type");
+            return {nullptr, 0};
+        }
+        return {const_cast<void *>(embedding_data.array_value.data()), static_cast<i64>(embedding_data.array_value.size())};
+    } else if (embedding_data.u8_array_value.size() != 0) {
         auto ptr_i16 = (int16_t *)(embedding_data.u8_array_value.data());
         auto ptr_u8 = (uint8_t *)(embedding_data.u8_array_value.data());
         for (size_t i = 0; i < embedding_data.u8_array_value.size(); ++i) {
@@ -285,7 +318,7 @@ ParsedExpr *WrapKnnExpr::GetParsedExpr(Status &status) {
         status = Status::InvalidEmbeddingDataType("unknown type");
         return nullptr;
     }
-    auto [embedding_data_ptr, dimension] = GetEmbeddingDataTypeDataPtrFromProto(embedding_data, status);
+    auto [embedding_data_ptr, dimension] = GetEmbeddingDataTypeDataPtrFromProto(embedding_data, embedding_data_type, status);
     if (status.code_ != ErrorCode::kOk) {
         delete knn_expr;
         knn_expr = nullptr;
@@ -366,7 +399,7 @@ ParsedExpr *WrapMatchTensorExpr::GetParsedExpr(Status &status) {
         return nullptr;
     }
 
-    auto [embedding_data_ptr, dimension] = GetEmbeddingDataTypeDataPtrFromProto(embedding_data, status);
+    auto [embedding_data_ptr, dimension] = GetEmbeddingDataTypeDataPtrFromProto(embedding_data, embedding_data_type, status);
     if (status.code_ != ErrorCode::kOk) {
         delete match_tensor_expr;
         return nullptr;
@@ -866,9 +899,17 @@ void HandleBoolType(ColumnField &output_column_field, SizeT row_count, const Sha
     output_column_field.column_vectors.emplace_back(dst.c_str(), dst.size());
 }
 
+// Expose the column vector buffer to python as it is, the capsule holds a reference of the column vector until the array is released
+void HandleFixedWidthType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector) {
+    SizeT size = column_vector->data_type()->Size() * row_count;
+    auto *owner = new SharedPtr<ColumnVector>(column_vector);
+    nb::capsule owner_capsule(owner, [](void *ptr) noexcept { delete static_cast<SharedPtr<ColumnVector> *>(ptr); });
+    output_column_field.column_views.emplace_back(column_vector->data(), std::initializer_list<SizeT>{size}, owner_capsule);
+    output_column_field.column_type = column_vector->data_type()->type();
+}
+
 void HandlePodType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector) {
-    auto size = column_vector->data_type()->Size() * row_count;
-    output_column_field.column_vectors.emplace_back(column_vector->data(), size);
+    HandleFixedWidthType(output_column_field, row_count, column_vector);
 }
 
 void HandleVarcharType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector) {
@@ -902,9 +943,7 @@ void HandleVarcharType(ColumnField &output_column_field, SizeT row_count, const
 }
 
 void HandleEmbeddingType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector) {
-    auto size = column_vector->data_type()->Size() * row_count;
-    output_column_field.column_vectors.emplace_back(column_vector->data(), size);
-    output_column_field.column_type = column_vector->data_type()->type();
+    HandleFixedWidthType(output_column_field, row_count, column_vector);
 }
 
 void HandleTensorType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector) {
@@ -1007,9 +1046,7 @@ void HandleSparseType(ColumnField &output_column_field, SizeT row_count, const S
 }
 
 void HandleRowIDType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector) {
-    auto size = column_vector->data_type()->Size() * row_count;
-    output_column_field.column_vectors.emplace_back(column_vector->data(), size);
-    output_column_field.column_type = column_vector->data_type()->type();
+    HandleFixedWidthType(output_column_field, row_count, column_vector);
 }
 
 void ProcessColumnFieldType(ColumnField &output_column_field, SizeT row_count, const SharedPtr<ColumnVector> &column_vector) {
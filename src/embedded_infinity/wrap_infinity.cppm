@@ -3,6 +3,7 @@ module;
 #include "parser/type/complex/embedding_type.h"
 #include <cstring>
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <string>
 
 export module wrap_infinity;
@@ -51,9 +52,15 @@ namespace nb = nanobind;
 // wrap Infinity function for nanobind infinity
 namespace infinity {
 
+// Read-only byte view of a result column vector, it keeps the column vector alive instead of copying it
+export using ColumnView = nb::ndarray<nb::numpy, const u8, nb::ndim<1>, nb::c_contig, nb::device::cpu>;
+
 export struct ColumnField {
     LogicalType column_type;
+    // variable length columns (and compact booleans) are serialized per data block
     Vector<nb::bytes> column_vectors;
+    // fixed width columns (numbers, embeddings, row ids) are exposed per data block without copy
+    Vector<ColumnView> column_views;
     String column_name;
 };
 
@@ -181,6 +188,8 @@ export struct EmbeddingData {
     Vector<double> f64_array_value;
     Vector<double> f16_array_value;
     Vector<double> bf16_array_value;
+    // C-contiguous query embedding whose dtype matches the embedding data type, used in place without conversion
+    nb::ndarray<nb::c_contig, nb::device::cpu> array_value;
 };
 
 export struct WrapKnnExpr {
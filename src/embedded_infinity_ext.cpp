@@ -1,4 +1,5 @@
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <nanobind/stl/set.h>
 #include <nanobind/stl/shared_ptr.h>
 #include <nanobind/stl/string.h>
@@ -61,6 +62,7 @@ NB_MODULE(embedded_infinity_ext, m) {
         .def(nb::init<>())
         .def_rw("column_type", &ColumnField::column_type)
         .def_rw("column_vectors", &ColumnField::column_vectors)
+        .def_rw("column_views", &ColumnField::column_views)
         .def_rw("column_name", &ColumnField::column_name);
 
     nb::class_<WrapDataType>(m, "WrapDataType")
@@ -152,7 +154,8 @@ NB_MODULE(embedded_infinity_ext, m) {
         .def_rw("f16_array_value", &EmbeddingData::f16_array_value)
         .def_rw("bf16_array_value", &EmbeddingData::bf16_array_value)
         .def_rw("f32_array_value", &EmbeddingData::f32_array_value)
-        .def_rw("f64_array_value", &EmbeddingData::f64_array_value);
+        .def_rw("f64_array_value", &EmbeddingData::f64_array_value)
+        .def_rw("array_value", &EmbeddingData::array_value);
 
     // Bind WrapMatchExpr
     nb::class_<WrapMatchExpr>(m, "WrapMatchExpr")
@@ -473,6 +476,7 @@ NB_MODULE(embedded_infinity_ext, m) {
         .value("kBMP", IndexType::kBMP)
         .value("kEMVB", IndexType::kEMVB)
         .value("kDiskAnn", IndexType::kDiskAnn)
+        .value("kBitmap", IndexType::kBitmap)
         .value("kInvalid", IndexType::kInvalid)
         .export_values();
 
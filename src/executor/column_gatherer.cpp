@@ -0,0 +1,135 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module column_gatherer;
+
+import stl;
+import column_vector;
+import internal_types;
+import block_index;
+import block_entry;
+import block_column_entry;
+import buffer_manager;
+import default_values;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+u64 BlockKey(const RowID &row_id) { return (u64(row_id.segment_id_) << 32) | (row_id.segment_offset_ / DEFAULT_BLOCK_CAPACITY); }
+
+// consecutive rows of one block
+struct GatherRun {
+    u64 block_key_;
+    BlockOffset block_offset_;
+    SizeT row_count_;
+};
+
+} // namespace
+
+ColumnGatherer::ColumnGatherer(const BlockIndex *block_index, BufferManager *buffer_mgr, Vector<SizeT> column_ids)
+    : block_index_(block_index), buffer_mgr_(buffer_mgr), column_ids_(std::move(column_ids)) {}
+
+Vector<ColumnVector> ColumnGatherer::PinBlockColumns(u64 block_key) const {
+    auto segment_id = static_cast<SegmentID>(block_key >> 32);
+    auto block_id = static_cast<BlockID>(block_key & 0xFFFFFFFF);
+    const BlockEntry *block_entry = block_index_->GetBlockEntry(segment_id, block_id);
+    if (block_entry == nullptr) {
+        String error_message = fmt::format("Block not found, segment_id: {}, block_id: {}", segment_id, block_id);
+        UnrecoverableError(error_message);
+    }
+    Vector<ColumnVector> block_columns;
+    block_columns.reserve(column_ids_.size());
+    for (SizeT column_id : column_ids_) {
+        BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(column_id);
+        block_columns.emplace_back(block_column_ptr->GetConstColumnVector(buffer_mgr_));
+    }
+    return block_columns;
+}
+
+void ColumnGatherer::Gather(const RowID *row_ids, SizeT row_count, const Vector<ColumnVector *> &output_columns) const {
+    if (row_count == 0 || column_ids_.empty()) {
+        return;
+    }
+    SizeT column_n = column_ids_.size();
+
+    // 1. split row_ids into runs of consecutive rows in one block, each run is copied with a single AppendWith
+    Vector<GatherRun> runs;
+    for (SizeT run_begin = 0; run_begin < row_count;) {
+        const RowID &first_row_id = row_ids[run_begin];
+        u64 block_key = BlockKey(first_row_id);
+        SizeT run_end = run_begin + 1;
+        while (run_end < row_count && row_ids[run_end].segment_id_ == first_row_id.segment_id_ &&
+               row_ids[run_end].segment_offset_ == first_row_id.segment_offset_ + (run_end - run_begin) && BlockKey(row_ids[run_end]) == block_key) {
+            ++run_end;
+        }
+        runs.push_back({block_key, static_cast<BlockOffset>(first_row_id.segment_offset_ % DEFAULT_BLOCK_CAPACITY), run_end - run_begin});
+        run_begin = run_end;
+    }
+
+    // 2. visit the blocks in storage order, only one block is pinned at a time
+    Vector<SizeT> run_order(runs.size());
+    std::iota(run_order.begin(), run_order.end(), 0);
+    std::stable_sort(run_order.begin(), run_order.end(), [&](SizeT lhs, SizeT rhs) { return runs[lhs].block_key_ < runs[rhs].block_key_; });
+    bool in_block_order = true;
+    for (SizeT run_i = 1; run_i < runs.size() && in_block_order; ++run_i) {
+        in_block_order = runs[run_i - 1].block_key_ <= runs[run_i].block_key_;
+    }
+
+    // rows not in block order (e.g. ordered by score) are staged in block order first, then appended in the order of row_ids
+    Vector<ColumnVector> staged_columns;
+    Vector<SizeT> staged_offsets;
+    if (!in_block_order) {
+        staged_columns.reserve(column_n);
+        for (SizeT k = 0; k < column_n; ++k) {
+            staged_columns.emplace_back(output_columns[k]->data_type());
+            staged_columns.back().Initialize(ColumnVectorType::kFlat, std::max<SizeT>(row_count, DEFAULT_VECTOR_SIZE));
+        }
+        staged_offsets.resize(runs.size());
+    }
+
+    for (SizeT order_i = 0; order_i < run_order.size();) {
+        u64 block_key = runs[run_order[order_i]].block_key_;
+        Vector<ColumnVector> block_columns = PinBlockColumns(block_key);
+        for (; order_i < run_order.size() && runs[run_order[order_i]].block_key_ == block_key; ++order_i) {
+            SizeT run_i = run_order[order_i];
+            const GatherRun &run = runs[run_i];
+            if (in_block_order) {
+                for (SizeT k = 0; k < column_n; ++k) {
+                    output_columns[k]->AppendWith(block_columns[k], run.block_offset_, run.row_count_);
+                }
+            } else {
+                staged_offsets[run_i] = staged_columns[0].Size();
+                for (SizeT k = 0; k < column_n; ++k) {
+                    staged_columns[k].AppendWith(block_columns[k], run.block_offset_, run.row_count_);
+                }
+            }
+        }
+        // block_columns is released here, before the next block is pinned
+    }
+
+    if (!in_block_order) {
+        for (SizeT run_i = 0; run_i < runs.size(); ++run_i) {
+            for (SizeT k = 0; k < column_n; ++k) {
+                output_columns[k]->AppendWith(staged_columns[k], staged_offsets[run_i], runs[run_i].row_count_);
+            }
+        }
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,47 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module column_gatherer;
+
+import stl;
+import column_vector;
+import internal_types;
+
+namespace infinity {
+
+struct BlockIndex;
+class BufferManager;
+
+// Late materialization of the rows found by a search (knn, match, ...) by RowID.
+// Every block column touched is pinned once, in (segment, block) order, however many rows come from it,
+// and released before the next block is pinned. Runs of consecutive rows of one block are copied with a single AppendWith.
+export class ColumnGatherer {
+public:
+    ColumnGatherer(const BlockIndex *block_index, BufferManager *buffer_mgr, Vector<SizeT> column_ids);
+
+    // Append the `column_ids_` columns of `row_ids` to `output_columns`, keeping the order of `row_ids`
+    void Gather(const RowID *row_ids, SizeT row_count, const Vector<ColumnVector *> &output_columns) const;
+
+private:
+    Vector<ColumnVector> PinBlockColumns(u64 block_key) const;
+
+private:
+    const BlockIndex *block_index_{};
+    BufferManager *buffer_mgr_{};
+    Vector<SizeT> column_ids_{};
+};
+
+} // namespace infinity
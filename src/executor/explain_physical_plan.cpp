@@ -92,10 +92,16 @@ import flush_statement;
 import common_query_filter;
 import table_entry;
 import logger;
+import default_values;
+import profiler;
 
 namespace infinity {
 
-void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<SharedPtr<String>>> &result, bool is_recursive, i64 intent_size) {
+void ExplainPhysicalPlan::Explain(const PhysicalOperator *op,
+                                  SharedPtr<Vector<SharedPtr<String>>> &result,
+                                  bool is_recursive,
+                                  i64 intent_size,
+                                  const HashMap<u64, OperatorProfile> *operator_profiles) {
     switch (op->operator_type()) {
         case PhysicalOperatorType::kAggregate: {
             Explain((PhysicalAggregate *)op, result, intent_size);
@@ -310,17 +316,68 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
         }
     }
 
+    if (operator_profiles != nullptr) {
+        auto iter = operator_profiles->find(op->node_id());
+        Explain(iter != operator_profiles->end() ? &iter->second : nullptr, result, intent_size);
+    }
+
     if (is_recursive) {
         if (op->left() != nullptr) {
-            ExplainPhysicalPlan::Explain(op->left(), result, is_recursive, intent_size + 2);
+            ExplainPhysicalPlan::Explain(op->left(), result, is_recursive, intent_size + 2, operator_profiles);
         }
 
         if (op->right() != nullptr) {
-            ExplainPhysicalPlan::Explain(op->right(), result, is_recursive, intent_size + 2);
+            ExplainPhysicalPlan::Explain(op->right(), result, is_recursive, intent_size + 2, operator_profiles);
         }
     }
 }
 
+void ExplainPhysicalPlan::Explain(const OperatorProfile *operator_profile, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    if (operator_profile == nullptr) {
+        String not_executed_str = String(intent_size, ' ') + " - actual time: not executed";
+        result->emplace_back(MakeShared<String>(not_executed_str));
+        return;
+    }
+
+    // Time
+    {
+        String time_str = String(intent_size, ' ') + " - actual time: " + BaseProfiler::ElapsedToString(NanoSeconds(operator_profile->elapsed_)) +
+                          ", executions: " + std::to_string(operator_profile->execute_n_);
+        result->emplace_back(MakeShared<String>(time_str));
+    }
+
+    // Rows and the memory of the output
+    {
+        String rows_str = String(intent_size, ' ') + " - actual rows: input " + std::to_string(operator_profile->input_rows_) + ", output " +
+                          std::to_string(operator_profile->output_rows_) + ", output size " + std::to_string(operator_profile->output_data_size_) +
+                          " bytes";
+        result->emplace_back(MakeShared<String>(rows_str));
+    }
+
+    // I/O
+    const ProfileCounters &counters = operator_profile->counters_;
+    {
+        String buffer_str = String(intent_size, ' ') + " - buffer: hits " + std::to_string(counters.buffer_hits_) + ", misses " +
+                            std::to_string(counters.buffer_misses_) + ", read " + std::to_string(counters.bytes_read_) + " bytes";
+        result->emplace_back(MakeShared<String>(buffer_str));
+    }
+
+    if (operator_profile->hash_table_size_ > 0) {
+        String hash_table_str = String(intent_size, ' ') + " - hash table entries: " + std::to_string(operator_profile->hash_table_size_);
+        result->emplace_back(MakeShared<String>(hash_table_str));
+    }
+
+    // Index search
+    if (counters.hnsw_hops_ > 0) {
+        String hnsw_str = String(intent_size, ' ') + " - hnsw hops: " + std::to_string(counters.hnsw_hops_);
+        result->emplace_back(MakeShared<String>(hnsw_str));
+    }
+    if (counters.posting_blocks_decoded_ > 0) {
+        String posting_str = String(intent_size, ' ') + " - posting blocks decoded: " + std::to_string(counters.posting_blocks_decoded_);
+        result->emplace_back(MakeShared<String>(posting_str));
+    }
+}
+
 void ExplainPhysicalPlan::Explain(const PhysicalCreateSchema *create_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
     {
         String create_header_str;
@@ -842,6 +899,24 @@ void ExplainPhysicalPlan::Explain(const PhysicalKnnScan *knn_scan_node, SharedPt
         String filter_str = String(intent_size, ' ') + " - filter: ";
         ExplainLogicalPlan::Explain(knn_scan_node->common_query_filter_->original_filter_.get(), filter_str);
         result->emplace_back(MakeShared<String>(filter_str));
+
+        if (knn_scan_node->index_entries_size_ > 0) {
+            // the strategy of each segment is chosen when the filter is built, only the decisions of the executed scan are known
+            String filter_strategy_str = String(intent_size, ' ') +
+                                         fmt::format(" - filter strategy: adaptive (brute force <= {} rows, two hop < {} selectivity, max ef {})",
+                                                     HNSW_FILTER_BRUTE_FORCE_ROWS,
+                                                     HNSW_FILTER_TWO_HOP_SELECTIVITY,
+                                                     HNSW_FILTER_MAX_EF);
+            result->emplace_back(MakeShared<String>(filter_strategy_str));
+            for (const auto &[segment_id, decision] : knn_scan_node->FilterDecisions()) {
+                String decision_str = String(intent_size + 2, ' ') + fmt::format(" - segment {}: {}, passed {}/{} rows",
+                                                                                 segment_id,
+                                                                                 KnnFilterStrategyToString(decision.strategy_),
+                                                                                 decision.passed_row_count_,
+                                                                                 decision.row_count_);
+                result->emplace_back(MakeShared<String>(decision_str));
+            }
+        }
     }
 
     // Output columns
@@ -1867,6 +1942,11 @@ void ExplainPhysicalPlan::Explain(const PhysicalImport *import_node, SharedPtr<V
         }
         case CopyFileType::kPARQUET: {
             SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: PARQUET");
+            result->emplace_back(file_type);
+            if (!import_node->filter().empty()) {
+                SharedPtr<String> filter = MakeShared<String>(String(intent_size, ' ') + " - filter: " + import_node->filter());
+                result->emplace_back(filter);
+            }
             break;
         }
         case CopyFileType::kInvalid: {
@@ -1949,6 +2029,10 @@ void ExplainPhysicalPlan::Explain(const PhysicalExport *export_node, SharedPtr<V
         case CopyFileType::kPARQUET: {
             SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: PARQUET");
             result->emplace_back(file_type);
+            if (!export_node->compression().empty()) {
+                SharedPtr<String> compression = MakeShared<String>(String(intent_size, ' ') + " - compression: " + export_node->compression());
+                result->emplace_back(compression);
+            }
             break;
         }
         case CopyFileType::kInvalid: {
@@ -66,6 +66,7 @@ import physical_match;
 import physical_match_tensor_scan;
 import physical_fusion;
 import physical_merge_aggregate;
+import profiler;
 
 export module explain_physical_plan;
 
@@ -73,7 +74,14 @@ namespace infinity {
 
 export class ExplainPhysicalPlan {
 public:
-    static void Explain(const PhysicalOperator *op, SharedPtr<Vector<SharedPtr<String>>> &result, bool is_recursive = true, i64 intent_size = 0);
+    // With `operator_profiles`, the profile of each operator collected by EXPLAIN ANALYZE follows the description of the operator
+    static void Explain(const PhysicalOperator *op,
+                        SharedPtr<Vector<SharedPtr<String>>> &result,
+                        bool is_recursive = true,
+                        i64 intent_size = 0,
+                        const HashMap<u64, OperatorProfile> *operator_profiles = nullptr);
+
+    static void Explain(const OperatorProfile *operator_profile, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
 
     static void Explain(const PhysicalUnionAll *create_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
 
@@ -62,10 +62,7 @@ void FragmentBuilder::BuildExplain(PhysicalOperator *phys_op, PlanFragment *curr
     PhysicalExplain *explain_op = (PhysicalExplain *)phys_op;
     switch (explain_op->explain_type()) {
 
-        case ExplainType::kAnalyze: {
-            Status status = Status::NotSupport("Not implement: Query analyze");
-            RecoverableError(status);
-        }
+        case ExplainType::kAnalyze:
         case ExplainType::kAst:
         case ExplainType::kUnOpt:
         case ExplainType::kOpt:
@@ -36,6 +36,9 @@ import status;
 import infinity_exception;
 import variables;
 import logger;
+import compaction_process;
+import token_bucket;
+import default_values;
 
 namespace infinity {
 
@@ -195,6 +198,16 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
                             config->SetCompactInterval(interval);
                             break;
                         }
+                        case GlobalOptionIndex::kCompactionIOLimit: {
+                            i64 limit = set_command->value_int();
+                            if(limit < MIN_COMPACTION_IO_LIMIT || limit > MAX_COMPACTION_IO_LIMIT) {
+                                Status status = Status::InvalidCommand(fmt::format("Attempt to set compaction io limit: {}", limit));
+                                RecoverableError(status);
+                            }
+                            query_context->storage()->compaction_processor()->throttle()->SetRate(limit);
+                            config->SetCompactionIOLimit(limit);
+                            break;
+                        }
                         case GlobalOptionIndex::kOptimizeIndexInterval: {
                             i64 interval = set_command->value_int();
                             if(interval < 0) {
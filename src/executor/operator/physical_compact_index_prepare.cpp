@@ -26,9 +26,118 @@ import block_index;
 import txn;
 import status;
 import base_table_ref;
+import segment_entry;
+import table_entry;
+import index_base;
+import column_def;
+import compact_state_data;
+import segment_index_entry;
+import chunk_index_entry;
+import block_entry;
+import create_index_info;
+import internal_types;
+import abstract_hnsw;
+import buffer_handle;
 
 namespace infinity {
 
+namespace {
+
+// For each new segment, pick the largest hnsw index chunk among its compacted segments as the base of the new index.
+// A graph can not drop vertices, so only a segment without deleted rows that is indexed by one chunk can be the base,
+// and its rows must be copied into a contiguous range of the new segment.
+// The chunk must also be encoded as the index being built: a chunk optimized to lvq or stored in another encoding is skipped.
+HashMap<SegmentID, CompactIndexBase> PickHnswCompactBases(const CompactStateData *compact_state_data,
+                                                          const IndexSnapshot *index_snapshot,
+                                                          const ColumnDef *column_def,
+                                                          Txn *txn) {
+    HashMap<SegmentID, CompactIndexBase> compact_bases;
+    const AbstractHnsw new_hnsw = HnswIndexInMem::InitAbstractIndex(index_snapshot->table_index_entry_->index_base(), column_def);
+    auto same_encoding = [&new_hnsw](const AbstractHnsw &base_hnsw) {
+        return std::visit(
+            [&new_hnsw](auto &&index) {
+                using T = std::decay_t<decltype(index)>;
+                return !std::is_same_v<T, std::nullptr_t> && std::holds_alternative<T>(new_hnsw);
+            },
+            base_hnsw);
+    };
+    const RowIDRemap *remapper = &compact_state_data->remapper_;
+    for (const auto &compact_segment_data : compact_state_data->segment_data_list_) {
+        SegmentID new_segment_id = compact_segment_data.new_segment_->segment_id();
+        CompactIndexBase compact_base;
+        for (SegmentEntry *old_segment : compact_segment_data.old_segments_) {
+            SizeT row_count = old_segment->row_count();
+            if (row_count == 0 || old_segment->actual_row_count() != row_count || row_count <= compact_base.skip_end_ - compact_base.skip_begin_) {
+                continue;
+            }
+            SegmentID old_segment_id = old_segment->segment_id();
+            auto iter = index_snapshot->segment_index_entries_.find(old_segment_id);
+            if (iter == index_snapshot->segment_index_entries_.end()) {
+                continue;
+            }
+            SegmentIndexEntry *segment_index_entry = iter->second;
+            if (auto memory_hnsw_index = std::get<1>(segment_index_entry->GetHnswIndexSnapshot());
+                memory_hnsw_index.get() != nullptr && memory_hnsw_index->GetRowCount() > 0) {
+                continue;
+            }
+            Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
+            segment_index_entry->GetChunkIndexEntries(chunk_index_entries, txn);
+            if (chunk_index_entries.size() != 1 || chunk_index_entries[0]->base_rowid_.segment_offset_ != 0 ||
+                chunk_index_entries[0]->GetRowCount() != row_count) {
+                continue;
+            }
+
+            auto remap = [remapper, old_segment_id](SegmentOffset offset) {
+                return remapper->GetNewRowID(RowID(old_segment_id, offset)).segment_offset_;
+            };
+            // check that the blocks are copied one after another
+            bool contiguous = true;
+            SegmentOffset skip_begin = 0;
+            SegmentOffset skip_end = 0;
+            {
+                auto blocks_guard = old_segment->GetBlocksGuard();
+                for (const auto &block_entry : blocks_guard.block_entries_) {
+                    SizeT block_row_count = block_entry->row_count();
+                    if (block_row_count == 0) {
+                        continue;
+                    }
+                    SegmentOffset block_begin = block_entry->segment_offset();
+                    RowID new_begin = remapper->GetNewRowID(RowID(old_segment_id, block_begin));
+                    RowID new_last = remapper->GetNewRowID(RowID(old_segment_id, block_begin + block_row_count - 1));
+                    if (new_begin.segment_id_ != new_segment_id || new_last.segment_offset_ + 1 - new_begin.segment_offset_ != block_row_count ||
+                        (skip_end != skip_begin && new_begin.segment_offset_ != skip_end)) {
+                        contiguous = false;
+                        break;
+                    }
+                    if (skip_end == skip_begin) {
+                        skip_begin = new_begin.segment_offset_;
+                    }
+                    skip_end = new_last.segment_offset_ + 1;
+                }
+            }
+            if (!contiguous || skip_end - skip_begin != row_count) {
+                continue;
+            }
+            {
+                BufferHandle base_handle = chunk_index_entries[0]->GetIndex();
+                if (!same_encoding(*static_cast<const AbstractHnsw *>(base_handle.GetData()))) {
+                    continue;
+                }
+            }
+            compact_base.chunk_index_entry_ = chunk_index_entries[0];
+            compact_base.remap_ = std::move(remap);
+            compact_base.skip_begin_ = skip_begin;
+            compact_base.skip_end_ = skip_end;
+        }
+        if (compact_base.chunk_index_entry_.get() != nullptr) {
+            compact_bases.emplace(new_segment_id, std::move(compact_base));
+        }
+    }
+    return compact_bases;
+}
+
+} // namespace
+
 bool PhysicalCompactIndexPrepare::Execute(QueryContext *query_context, OperatorState *operator_state) {
     auto *compact_index_prepare_operator_state = static_cast<CompactIndexPrepareOperatorState *>(operator_state);
     auto *compact_state_data = compact_index_prepare_operator_state->compact_state_data_.get();
@@ -45,7 +154,8 @@ bool PhysicalCompactIndexPrepare::Execute(QueryContext *query_context, OperatorS
         operator_state->SetComplete();
         return true;
     }
-    auto *table_index_entry = index_index->index_snapshots_vec_[create_index_idx]->table_index_entry_;
+    auto *index_snapshot = index_index->index_snapshots_vec_[create_index_idx];
+    auto *table_index_entry = index_snapshot->table_index_entry_;
 
     const auto *create_index_shared_data = compact_index_prepare_operator_state->create_index_shared_data_.get();
     if (create_index_shared_data != nullptr) {
@@ -53,7 +163,15 @@ bool PhysicalCompactIndexPrepare::Execute(QueryContext *query_context, OperatorS
     }
 
     Txn *txn = query_context->GetTxn();
-    auto [segment_index_entries, status] = txn->CreateIndexPrepare(table_index_entry, new_table_ref, prepare_, false);
+    const IndexBase *index_base = table_index_entry->index_base();
+    TableEntry *table_entry = new_table_ref->table_entry_ptr_;
+    HashMap<SegmentID, CompactIndexBase> compact_bases;
+    if (index_base->index_type_ == IndexType::kHnsw) {
+        auto column_def = table_entry->GetColumnDefByName(index_base->column_name());
+        compact_bases = PickHnswCompactBases(compact_state_data, index_snapshot, column_def.get(), txn);
+    }
+
+    auto [segment_index_entries, status] = txn->CreateIndexPrepare(table_index_entry, new_table_ref, prepare_, false, &compact_bases);
     if (!status.ok()) {
         operator_state->status_ = status;
         return true;
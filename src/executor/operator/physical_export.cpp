@@ -18,6 +18,8 @@ module;
 #include <arrow/io/caching.h>
 #include <arrow/io/file.h>
 #include <parquet/arrow/writer.h>
+#include <arrow/util/compression.h>
+#include <future>
 #include <parquet/properties.h>
 #include <string>
 
@@ -44,6 +46,8 @@ import status;
 import buffer_manager;
 import default_values;
 import internal_types;
+import arrow_array_builder;
+import infinity_context;
 
 namespace infinity {
 
@@ -473,24 +477,59 @@ SizeT PhysicalExport::ExportToPARQUET(QueryContext *query_context, ExportOperato
         select_columns = column_idx_array_;
     }
 
-    SizeT select_column_count = select_columns.size();
-
     Vector<SharedPtr<arrow::Field>> fields;
     for (auto &column_id : select_columns) {
         ColumnDef *column_def = column_defs[column_id].get();
-        auto arrow_type = GetArrowType(column_def);
+        auto arrow_type = GetArrowType(column_def->type());
         fields.emplace_back(::arrow::field(column_def->name(), std::move(arrow_type)));
     }
 
+    ::parquet::WriterProperties::Builder writer_properties_builder;
+    if (!compression_.empty()) {
+        auto compression_type = ::arrow::util::Codec::GetCompressionType(compression_);
+        if (!compression_type.ok() || !::arrow::util::Codec::IsAvailable(*compression_type)) {
+            RecoverableError(Status::NotSupport(fmt::format("Unsupported parquet compression: {}", compression_)));
+        }
+        writer_properties_builder.compression(*compression_type);
+    }
+    // the column chunks of a row group are encoded concurrently
+    ::parquet::ArrowWriterProperties::Builder arrow_properties_builder;
+    arrow_properties_builder.set_use_threads(true);
+
     arrow::MemoryPool *pool = arrow::DefaultMemoryPool();
     SharedPtr<arrow::Schema> schema = ::arrow::schema(std::move(fields));
     SharedPtr<::arrow::io::FileOutputStream> file_stream;
     SharedPtr<::parquet::arrow::FileWriter> file_writer;
 
     file_stream = ::arrow::io::FileOutputStream::Open(file_path_, pool).ValueOrDie();
-    file_writer = ::parquet::arrow::FileWriter::Open(*schema, pool, file_stream, ::parquet::default_writer_properties()).ValueOrDie();
+    file_writer =
+        ::parquet::arrow::FileWriter::Open(*schema, pool, file_stream, writer_properties_builder.build(), arrow_properties_builder.build())
+            .ValueOrDie();
+
+    // The record batches of the blocks are built on the copy thread pool and written in block order by this thread, at most
+    // `max_pending` batches are in flight at the same time.
+    ThreadPool &thread_pool = InfinityContext::instance().GetCopyThreadPool();
+    const SizeT max_pending = 2 * thread_pool.size();
+    Deque<std::future<SharedPtr<arrow::RecordBatch>>> pending_batches;
+    DeferFn wait_pending([&]() {
+        for (auto &pending_batch : pending_batches) {
+            pending_batch.wait();
+        }
+    });
 
     SizeT row_count{0};
+    auto write_oldest_batch = [&]() {
+        SharedPtr<arrow::RecordBatch> block_batch = pending_batches.front().get();
+        pending_batches.pop_front();
+        auto status = file_writer->WriteRecordBatch(*block_batch);
+        if (!status.ok()) {
+            String error_message = fmt::format("Failed to write record batch to parquet file: {}", status.message());
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        row_count += block_batch->num_rows();
+    };
+
     Map<SegmentID, SegmentSnapshot> &segment_block_index_ref = block_index_->segment_block_index_;
     BufferManager *buffer_manager = query_context->storage()->buffer_manager();
     for (auto &[segment_id, segment_snapshot] : segment_block_index_ref) {
@@ -499,62 +538,18 @@ SizeT PhysicalExport::ExportToPARQUET(QueryContext *query_context, ExportOperato
         for (SizeT block_idx = 0; block_idx < block_count; ++block_idx) {
             LOG_DEBUG(fmt::format("Export block_idx: {}", block_idx));
             BlockEntry *block_entry = segment_snapshot.block_map_[block_idx];
-            SizeT block_row_count = block_entry->row_count();
-
-            Vector<ColumnVector> column_vectors;
-            column_vectors.reserve(select_column_count);
-
-            for (ColumnID block_column_idx = 0; block_column_idx < select_column_count; ++block_column_idx) {
-                ColumnID select_column_idx = select_columns[block_column_idx];
-                switch (select_column_idx) {
-                    case COLUMN_IDENTIFIER_ROW_ID: {
-                        u16 block_id = block_entry->block_id();
-                        u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY;
-                        auto column_vector = ColumnVector(MakeShared<DataType>(LogicalType::kRowID));
-                        column_vector.Initialize();
-                        column_vector.AppendWith(RowID(segment_id, segment_offset), block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    case COLUMN_IDENTIFIER_CREATE: {
-                        ColumnVector column_vector = block_entry->GetCreateTSVector(buffer_manager, 0, block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    case COLUMN_IDENTIFIER_DELETE: {
-                        ColumnVector column_vector = block_entry->GetDeleteTSVector(buffer_manager, 0, block_row_count);
-                        column_vectors.emplace_back(column_vector);
-                        break;
-                    }
-                    default: {
-                        column_vectors.emplace_back(block_entry->GetColumnBlockEntry(select_column_idx)->GetColumnVector(buffer_manager));
-                        if (column_vectors[block_column_idx].Size() != block_row_count) {
-                            String error_message = "Unmatched row_count between block and block_column";
-                            LOG_CRITICAL(error_message);
-                            UnrecoverableError(error_message);
-                        }
-                    }
-                }
-            }
-
-            Vector<SharedPtr<arrow::Array>> block_arrays;
-            for (ColumnID block_column_idx = 0; block_column_idx < select_column_count; ++block_column_idx) {
-                ColumnID select_column_idx = select_columns[block_column_idx];
-                ColumnDef *column_def = column_defs[select_column_idx].get();
-                ColumnVector &column_vector = column_vectors[block_column_idx];
-                block_arrays.emplace_back(BuildArrowArray(column_def, column_vector));
-            }
-
-            SharedPtr<arrow::RecordBatch> block_batch = arrow::RecordBatch::Make(schema, block_row_count, block_arrays);
-            auto status = file_writer->WriteRecordBatch(*block_batch);
-            if (!status.ok()) {
-                String error_message = fmt::format("Failed to write record batch to parquet file: {}", status.message());
-                LOG_CRITICAL(error_message);
-                UnrecoverableError(error_message);
+            pending_batches.push_back(
+                thread_pool.push([this, segment_id, block_entry, &select_columns, &schema, buffer_manager](int) {
+                    return BuildParquetBatch(segment_id, block_entry, select_columns, schema, buffer_manager);
+                }));
+            while (pending_batches.size() > max_pending) {
+                write_oldest_batch();
             }
-            row_count += block_row_count;
         }
     }
+    while (!pending_batches.empty()) {
+        write_oldest_batch();
+    }
 
     auto status = file_writer->Close();
     if (!status.ok()) {
@@ -566,462 +561,60 @@ SizeT PhysicalExport::ExportToPARQUET(QueryContext *query_context, ExportOperato
     return row_count;
 }
 
-SharedPtr<arrow::DataType> PhysicalExport::GetArrowType(ColumnDef *column_def) {
-    auto &column_type = column_def->type();
-    switch (column_type->type()) {
-        case LogicalType::kBoolean:
-            return arrow::boolean();
-        case LogicalType::kTinyInt:
-            return arrow::int8();
-        case LogicalType::kSmallInt:
-            return arrow::int16();
-        case LogicalType::kInteger:
-            return arrow::int32();
-        case LogicalType::kBigInt:
-            return arrow::int64();
-        case LogicalType::kFloat16:
-            return arrow::float16();
-        case LogicalType::kBFloat16:
-            return arrow::float32();
-        case LogicalType::kFloat:
-            return arrow::float32();
-        case LogicalType::kDouble:
-            return arrow::float64();
-        case LogicalType::kDate:
-            return arrow::date32();
-        case LogicalType::kTime:
-            return arrow::time32(arrow::TimeUnit::SECOND);
-        case LogicalType::kDateTime:
-        case LogicalType::kTimestamp:
-            return arrow::timestamp(arrow::TimeUnit::SECOND);
-        case LogicalType::kVarchar:
-            return arrow::utf8();
-        case LogicalType::kSparse: {
-            const auto *sparse_info = static_cast<const SparseInfo *>(column_def->type()->type_info().get());
-
-            SharedPtr<arrow::DataType> index_type;
-            Optional<SharedPtr<arrow::DataType>> value_type = None;
-            switch (sparse_info->IndexType()) {
-                case EmbeddingDataType::kElemInt8: {
-                    index_type = ::arrow::list(::arrow::int8());
-                    break;
-                }
-                case EmbeddingDataType::kElemInt16: {
-                    index_type = ::arrow::list(::arrow::int16());
-                    break;
-                }
-                case EmbeddingDataType::kElemInt32: {
-                    index_type = ::arrow::list(::arrow::int32());
-                    break;
-                }
-                case EmbeddingDataType::kElemInt64: {
-                    index_type = ::arrow::list(::arrow::int64());
-                    break;
-                }
-                default: {
-                    UnrecoverableError("Index type invalid");
-                }
-            }
-            switch (sparse_info->DataType()) {
-                case EmbeddingDataType::kElemBit: {
-                    break;
-                }
-                case EmbeddingDataType::kElemInt8: {
-                    value_type = ::arrow::list(::arrow::int8());
-                    break;
-                }
-                case EmbeddingDataType::kElemInt16: {
-                    value_type = ::arrow::list(::arrow::int16());
-                    break;
-                }
-                case EmbeddingDataType::kElemInt32: {
-                    value_type = ::arrow::list(::arrow::int32());
-                    break;
-                }
-                case EmbeddingDataType::kElemInt64: {
-                    value_type = ::arrow::list(::arrow::int64());
-                    break;
-                }
-                case EmbeddingDataType::kElemFloat: {
-                    value_type = ::arrow::list(::arrow::float32());
-                    break;
-                }
-                case EmbeddingDataType::kElemDouble: {
-                    value_type = ::arrow::list(::arrow::float64());
-                    break;
-                }
-                case EmbeddingDataType::kElemUInt8: {
-                    value_type = ::arrow::list(::arrow::uint8());
-                    break;
-                }
-                case EmbeddingDataType::kElemFloat16: {
-                    value_type = ::arrow::list(::arrow::float16());
-                    break;
-                }
-                case EmbeddingDataType::kElemBFloat16: {
-                    value_type = ::arrow::list(::arrow::float32());
-                    break;
-                }
-                default: {
-                    UnrecoverableError("Data type invalid");
-                }
-            }
-
-            arrow::FieldVector fields{::arrow::field("index", std::move(index_type))};
-            if (value_type.has_value()) {
-                fields.emplace_back(::arrow::field("value", value_type.value()));
-            }
-            return arrow::struct_(std::move(fields));
-        }
-        case LogicalType::kEmbedding:
-        case LogicalType::kTensor:
-        case LogicalType::kTensorArray: {
-            const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_type->type_info().get());
-            const SizeT dimension = embedding_info->Dimension();
-            SharedPtr<arrow::DataType> arrow_embedding_elem_type;
-            switch (embedding_info->Type()) {
-                case EmbeddingDataType::kElemBit: {
-                    arrow_embedding_elem_type = ::arrow::boolean();
-                    break;
-                }
-                case EmbeddingDataType::kElemInt8: {
-                    arrow_embedding_elem_type = ::arrow::int8();
-                    break;
-                }
-                case EmbeddingDataType::kElemInt16: {
-                    arrow_embedding_elem_type = ::arrow::int16();
-                    break;
-                }
-                case EmbeddingDataType::kElemInt32: {
-                    arrow_embedding_elem_type = ::arrow::int32();
-                    break;
-                }
-                case EmbeddingDataType::kElemInt64: {
-                    arrow_embedding_elem_type = ::arrow::int64();
-                    break;
-                }
-                case EmbeddingDataType::kElemFloat: {
-                    arrow_embedding_elem_type = ::arrow::float32();
-                    break;
-                }
-                case EmbeddingDataType::kElemDouble: {
-                    arrow_embedding_elem_type = ::arrow::float64();
-                    break;
-                }
-                case EmbeddingDataType::kElemUInt8: {
-                    arrow_embedding_elem_type = ::arrow::uint8();
-                    break;
-                }
-                case EmbeddingDataType::kElemFloat16: {
-                    arrow_embedding_elem_type = ::arrow::float16();
-                    break;
-                }
-                case EmbeddingDataType::kElemBFloat16: {
-                    arrow_embedding_elem_type = ::arrow::float32();
-                    break;
-                }
-                case EmbeddingDataType::kElemInvalid: {
-                    UnrecoverableError("Invalid case EmbeddingDataType::kElemInvalid");
-                    break;
-                }
-            }
-            auto arrow_embedding_type = ::arrow::fixed_size_list(std::move(arrow_embedding_elem_type), dimension);
-            if (column_type->type() == LogicalType::kEmbedding) {
-                return arrow_embedding_type;
-            }
-            auto arrow_tensor_type = ::arrow::list(std::move(arrow_embedding_type));
-            if (column_type->type() == LogicalType::kTensor) {
-                return arrow_tensor_type;
-            }
-            auto arrow_tensor_array_type = ::arrow::list(std::move(arrow_tensor_type));
-            if (column_type->type() == LogicalType::kTensorArray) {
-                return arrow_tensor_array_type;
-            }
-            UnrecoverableError("Unreachable code!");
-            return {};
-        }
-        case LogicalType::kRowID:
-        case LogicalType::kInterval:
-        case LogicalType::kHugeInt:
-        case LogicalType::kDecimal:
-        case LogicalType::kArray:
-        case LogicalType::kTuple:
-        case LogicalType::kPoint:
-        case LogicalType::kLine:
-        case LogicalType::kLineSeg:
-        case LogicalType::kBox:
-        case LogicalType::kCircle:
-        case LogicalType::kUuid:
-        case LogicalType::kMixed:
-        case LogicalType::kNull:
-        case LogicalType::kMissing:
-        case LogicalType::kEmptyArray:
-        case LogicalType::kInvalid: {
-            String error_message = "Invalid data type";
-            LOG_CRITICAL(error_message);
-            UnrecoverableError(error_message);
-        }
-    }
-    return nullptr;
-}
-
-SharedPtr<arrow::Array> PhysicalExport::BuildArrowArray(ColumnDef *column_def, const ColumnVector &column_vector) {
-    SharedPtr<arrow::ArrayBuilder> array_builder = nullptr;
-    auto &column_type = column_def->type();
-
-    switch (column_type->type()) {
-        case LogicalType::kBoolean: {
-            array_builder = MakeShared<arrow::BooleanBuilder>();
-            break;
-        }
-        case LogicalType::kTinyInt: {
-            array_builder = MakeShared<::arrow::Int8Builder>();
-            break;
-        }
-        case LogicalType::kSmallInt: {
-            array_builder = MakeShared<::arrow::Int16Builder>();
-            break;
-        }
-        case LogicalType::kInteger: {
-            array_builder = MakeShared<::arrow::Int32Builder>();
-            break;
-        }
-        case LogicalType::kBigInt: {
-            array_builder = MakeShared<::arrow::Int64Builder>();
-            break;
-        }
-        case LogicalType::kFloat: {
-            array_builder = MakeShared<::arrow::FloatBuilder>();
-            break;
-        }
-        case LogicalType::kDouble: {
-            array_builder = MakeShared<::arrow::DoubleBuilder>();
-            break;
-        }
-        case LogicalType::kFloat16: {
-            array_builder = MakeShared<::arrow::HalfFloatBuilder>();
-            break;
-        }
-        case LogicalType::kBFloat16: {
-            array_builder = MakeShared<::arrow::FloatBuilder>();
-            break;
-        }
-        case LogicalType::kDate: {
-            array_builder = MakeShared<::arrow::Date32Builder>();
-            break;
-        }
-        case LogicalType::kTime: {
-            array_builder = MakeShared<::arrow::Time32Builder>(arrow::time32(arrow::TimeUnit::SECOND), arrow::DefaultMemoryPool());
-            break;
-        }
-        case LogicalType::kDateTime:
-        case LogicalType::kTimestamp: {
-            array_builder = MakeShared<::arrow::TimestampBuilder>(::arrow::timestamp(arrow::TimeUnit::SECOND), arrow::DefaultMemoryPool());
-            break;
-        }
-        case LogicalType::kVarchar: {
-            array_builder = MakeShared<::arrow::StringBuilder>();
-            break;
-        }
-        case LogicalType::kSparse: {
-            const auto *sparse_info = static_cast<const SparseInfo *>(column_def->type()->type_info().get());
-            SharedPtr<arrow::ArrayBuilder> index_builder = nullptr;
-            SharedPtr<arrow::ArrayBuilder> value_builder = nullptr;
-            switch (sparse_info->IndexType()) {
-                case EmbeddingDataType::kElemInt8: {
-                    auto int8_builder = MakeShared<::arrow::Int8Builder>();
-                    index_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int8_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemInt16: {
-                    auto int16_builder = MakeShared<::arrow::Int16Builder>();
-                    index_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int16_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemInt32: {
-                    auto int32_builder = MakeShared<::arrow::Int32Builder>();
-                    index_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int32_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemInt64: {
-                    auto int64_builder = MakeShared<::arrow::Int64Builder>();
-                    index_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int64_builder);
-                    break;
-                }
-                default: {
-                    UnrecoverableError("Invalid index type.");
-                }
+SharedPtr<arrow::RecordBatch> PhysicalExport::BuildParquetBatch(SegmentID segment_id,
+                                                                BlockEntry *block_entry,
+                                                                const Vector<ColumnID> &select_columns,
+                                                                const SharedPtr<arrow::Schema> &schema,
+                                                                BufferManager *buffer_manager) const {
+    const Vector<SharedPtr<ColumnDef>> &column_defs = table_entry_->column_defs();
+    SizeT select_column_count = select_columns.size();
+    SizeT block_row_count = block_entry->row_count();
+
+    Vector<ColumnVector> column_vectors;
+    column_vectors.reserve(select_column_count);
+
+    for (ColumnID block_column_idx = 0; block_column_idx < select_column_count; ++block_column_idx) {
+        ColumnID select_column_idx = select_columns[block_column_idx];
+        switch (select_column_idx) {
+            case COLUMN_IDENTIFIER_ROW_ID: {
+                u16 block_id = block_entry->block_id();
+                u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY;
+                auto column_vector = ColumnVector(MakeShared<DataType>(LogicalType::kRowID));
+                column_vector.Initialize();
+                column_vector.AppendWith(RowID(segment_id, segment_offset), block_row_count);
+                column_vectors.emplace_back(column_vector);
+                break;
             }
-            switch (sparse_info->DataType()) {
-                case EmbeddingDataType::kElemBit: {
-                    break;
-                }
-                case EmbeddingDataType::kElemInt8: {
-                    auto int8_builder = MakeShared<::arrow::Int8Builder>();
-                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int8_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemInt16: {
-                    auto int16_builder = MakeShared<::arrow::Int16Builder>();
-                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int16_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemInt32: {
-                    auto int32_builder = MakeShared<::arrow::Int32Builder>();
-                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int32_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemInt64: {
-                    auto int64_builder = MakeShared<::arrow::Int64Builder>();
-                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int64_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemFloat: {
-                    auto float_builder = MakeShared<::arrow::FloatBuilder>();
-                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), float_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemDouble: {
-                    auto double_builder = MakeShared<::arrow::DoubleBuilder>();
-                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), double_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemUInt8: {
-                    auto uint8_builder = MakeShared<::arrow::UInt8Builder>();
-                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), uint8_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemFloat16: {
-                    auto float16_builder = MakeShared<::arrow::HalfFloatBuilder>();
-                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), float16_builder);
-                    break;
-                }
-                case EmbeddingDataType::kElemBFloat16: {
-                    auto float_builder = MakeShared<::arrow::FloatBuilder>();
-                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), float_builder);
-                    break;
-                }
-                default: {
-                    UnrecoverableError("Invalid data type.");
-                }
+            case COLUMN_IDENTIFIER_CREATE: {
+                ColumnVector column_vector = block_entry->GetCreateTSVector(buffer_manager, 0, block_row_count);
+                column_vectors.emplace_back(column_vector);
+                break;
             }
-            auto struct_type = arrow::struct_({arrow::field("index", index_builder->type()), arrow::field("value", value_builder->type())});
-            Vector<SharedPtr<arrow::ArrayBuilder>> field_builders = {index_builder};
-            if (value_builder.get() != nullptr) {
-                field_builders.emplace_back(value_builder);
+            case COLUMN_IDENTIFIER_DELETE: {
+                ColumnVector column_vector = block_entry->GetDeleteTSVector(buffer_manager, 0, block_row_count);
+                column_vectors.emplace_back(column_vector);
+                break;
             }
-            array_builder = MakeShared<::arrow::StructBuilder>(struct_type, arrow::DefaultMemoryPool(), std::move(field_builders));
-            break;
-        }
-        case LogicalType::kEmbedding:
-        case LogicalType::kTensor:
-        case LogicalType::kTensorArray: {
-            const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_type->type_info().get());
-            SharedPtr<::arrow::ArrayBuilder> embedding_element_builder;
-            switch (embedding_info->Type()) {
-                case EmbeddingDataType::kElemBit: {
-                    embedding_element_builder = MakeShared<::arrow::BooleanBuilder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemInt8: {
-                    embedding_element_builder = MakeShared<::arrow::Int8Builder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemInt16: {
-                    embedding_element_builder = MakeShared<::arrow::Int16Builder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemInt32: {
-                    embedding_element_builder = MakeShared<::arrow::Int32Builder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemInt64: {
-                    embedding_element_builder = MakeShared<::arrow::Int64Builder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemFloat: {
-                    embedding_element_builder = MakeShared<::arrow::FloatBuilder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemDouble: {
-                    embedding_element_builder = MakeShared<::arrow::DoubleBuilder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemUInt8: {
-                    embedding_element_builder = MakeShared<::arrow::UInt8Builder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemFloat16: {
-                    embedding_element_builder = MakeShared<::arrow::HalfFloatBuilder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemBFloat16: {
-                    embedding_element_builder = MakeShared<::arrow::FloatBuilder>();
-                    break;
-                }
-                case EmbeddingDataType::kElemInvalid: {
-                    String error_message = "Invalid embedding data type: EmbeddingDataType::kElemInvalid";
+            default: {
+                column_vectors.emplace_back(block_entry->GetColumnBlockEntry(select_column_idx)->GetColumnVector(buffer_manager));
+                if (column_vectors[block_column_idx].Size() != block_row_count) {
+                    String error_message = "Unmatched row_count between block and block_column";
                     LOG_CRITICAL(error_message);
                     UnrecoverableError(error_message);
-                    break;
                 }
             }
-            const SizeT dimension = embedding_info->Dimension();
-            auto embedding_arrow_array_builder =
-                MakeShared<::arrow::FixedSizeListBuilder>(arrow::DefaultMemoryPool(), embedding_element_builder, dimension);
-            if (column_type->type() == LogicalType::kEmbedding) {
-                array_builder = std::move(embedding_arrow_array_builder);
-                break;
-            }
-            auto tensor_arrow_array_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), embedding_arrow_array_builder);
-            if (column_type->type() == LogicalType::kTensor) {
-                array_builder = std::move(tensor_arrow_array_builder);
-                break;
-            }
-            auto tensor_array_arrow_array_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), tensor_arrow_array_builder);
-            if (column_type->type() == LogicalType::kTensorArray) {
-                array_builder = std::move(tensor_array_arrow_array_builder);
-                break;
-            }
-            UnrecoverableError("Unreachable code!");
-            break;
-        }
-        case LogicalType::kRowID:
-        case LogicalType::kInterval:
-        case LogicalType::kHugeInt:
-        case LogicalType::kDecimal:
-        case LogicalType::kArray:
-        case LogicalType::kTuple:
-        case LogicalType::kPoint:
-        case LogicalType::kLine:
-        case LogicalType::kLineSeg:
-        case LogicalType::kBox:
-        case LogicalType::kCircle:
-        case LogicalType::kUuid:
-        case LogicalType::kMixed:
-        case LogicalType::kNull:
-        case LogicalType::kMissing:
-        case LogicalType::kEmptyArray:
-        case LogicalType::kInvalid: {
-            String error_message = "Invalid data type";
-            LOG_CRITICAL(error_message);
-            UnrecoverableError(error_message);
         }
     }
 
-    for (SizeT i = 0; i < column_vector.Size(); ++i) {
-        auto value = column_vector.GetValue(i);
-        value.AppendToArrowArray(column_type, array_builder);
+    Vector<SharedPtr<arrow::Array>> block_arrays;
+    for (ColumnID block_column_idx = 0; block_column_idx < select_column_count; ++block_column_idx) {
+        ColumnID select_column_idx = select_columns[block_column_idx];
+        ColumnDef *column_def = column_defs[select_column_idx].get();
+        ColumnVector &column_vector = column_vectors[block_column_idx];
+        block_arrays.emplace_back(BuildArrowArray(column_def->type(), column_vector));
     }
 
-    SharedPtr<arrow::Array> array;
-    auto status = array_builder->Finish(&array);
-    if (!status.ok()) {
-        String error_message = fmt::format("Failed to build arrow array: {}", status.message());
-        LOG_CRITICAL(error_message);
-        UnrecoverableError(error_message);
-    }
-    return array;
+    return arrow::RecordBatch::Make(schema, block_row_count, block_arrays);
 }
 
 } // namespace infinity
@@ -33,6 +33,8 @@ import logger;
 import third_party;
 import column_def;
 import column_vector;
+import block_entry;
+import buffer_manager;
 
 namespace infinity {
 
@@ -49,11 +51,12 @@ public:
                             SizeT offset,
                             SizeT limit,
                             SizeT row_limit,
+                            String compression,
                             Vector<u64> column_idx_array,
                             SharedPtr<BlockIndex> block_index,
                             SharedPtr<Vector<LoadMeta>> load_metas)
         : PhysicalOperator(PhysicalOperatorType::kExport, nullptr, nullptr, id, load_metas), table_entry_(table_entry), file_type_(type), file_path_(std::move(file_path)),
-          table_name_(std::move(table_name)), schema_name_(std::move(schema_name)), header_(header), delimiter_(delimiter), offset_(offset), limit_(limit), row_limit_(row_limit), column_idx_array_(std::move(column_idx_array)), block_index_(std::move(block_index)) {}
+          table_name_(std::move(table_name)), schema_name_(std::move(schema_name)), header_(header), delimiter_(delimiter), offset_(offset), limit_(limit), row_limit_(row_limit), compression_(std::move(compression)), column_idx_array_(std::move(column_idx_array)), block_index_(std::move(block_index)) {}
 
     ~PhysicalExport() override = default;
 
@@ -79,6 +82,13 @@ public:
 
     SizeT ExportToPARQUET(QueryContext *query_context, ExportOperatorState *export_op_state);
 
+    // the selected columns of one block as a record batch of `schema`
+    SharedPtr<arrow::RecordBatch> BuildParquetBatch(SegmentID segment_id,
+                                                    BlockEntry *block_entry,
+                                                    const Vector<ColumnID> &select_columns,
+                                                    const SharedPtr<arrow::Schema> &schema,
+                                                    BufferManager *buffer_manager) const;
+
     inline CopyFileType FileType() const { return file_type_; }
 
     inline const String &file_path() const { return file_path_; }
@@ -91,10 +101,7 @@ public:
 
     inline char delimiter() const { return delimiter_; }
 
-private:
-    SharedPtr<arrow::DataType> GetArrowType(ColumnDef *column_def);
-
-    SharedPtr<arrow::Array> BuildArrowArray(ColumnDef *column_def, const ColumnVector &column_vectors);
+    inline const String &compression() const { return compression_; }
 
 private:
     SharedPtr<Vector<String>> output_names_{};
@@ -110,6 +117,8 @@ private:
     SizeT offset_{};
     SizeT limit_{};
     SizeT row_limit_{};
+    // codec of parquet file, default of the parquet writer if empty
+    String compression_{};
     Vector<u64> column_idx_array_;
     SharedPtr<BlockIndex> block_index_{};
 };
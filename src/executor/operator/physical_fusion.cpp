@@ -58,16 +58,6 @@ import physical_merge_knn;
 
 namespace infinity {
 
-struct DocScore {
-    RowID row_id_;
-    u64 from_input_data_block_id_;
-    u32 from_block_idx_;
-    u32 from_row_idx_;
-    float fusion_score_;
-    Vector<float> child_scores_;
-    Vector<bool> mask_;
-};
-
 PhysicalFusion::PhysicalFusion(const u64 id,
                                SharedPtr<BaseTableRef> base_table_ref,
                                UniquePtr<PhysicalOperator> left,
@@ -112,9 +102,66 @@ void PhysicalFusion::Init() {
     }
 }
 
+void PhysicalFusion::MergeRRFWeightedInput(FusionOperatorState *fusion_operator_state) const {
+    const SizeT num_children = 2 + other_children_.size();
+    Vector<FusionDocScore> &rescore_vec = fusion_operator_state->rescore_vec_;
+    HashMap<u64, SizeT> &rescore_map = fusion_operator_state->rescore_map_;
+    for (const auto &[fragment_id, input_blocks] : fusion_operator_state->input_data_blocks_) {
+        const auto child_it = fusion_operator_state->input_child_idx_.find(fragment_id);
+        if (child_it == fusion_operator_state->input_child_idx_.end() || child_it->second >= num_children) {
+            String error_message = fmt::format("Fusion input from unexpected fragment {}.", fragment_id);
+            UnrecoverableError(error_message);
+        }
+        const SizeT child_idx = child_it->second;
+        SizeT &merged_block_n = fusion_operator_state->merged_block_n_[fragment_id];
+        SizeT &merged_row_n = fusion_operator_state->merged_row_n_[fragment_id];
+        for (; merged_block_n < input_blocks.size(); ++merged_block_n) {
+            const UniquePtr<DataBlock> &input_data_block = input_blocks[merged_block_n];
+            if (input_data_block->column_count() != GetOutputTypes()->size()) {
+                String error_message = fmt::format("input_data_block column count {} is incorrect, expect {}.",
+                                                   input_data_block->column_count(),
+                                                   GetOutputTypes()->size());
+                UnrecoverableError(error_message);
+            }
+            auto &row_id_column = *input_data_block->column_vectors[input_data_block->column_count() - 1];
+            auto row_ids = reinterpret_cast<RowID *>(row_id_column.data());
+            SizeT row_n = input_data_block->row_count();
+            auto &row_score_column = *input_data_block->column_vectors[input_data_block->column_count() - 2];
+            auto row_scores = reinterpret_cast<float *>(row_score_column.data());
+            for (SizeT i = 0; i < row_n; i++) {
+                const RowID docId = row_ids[i];
+                const SizeT rank = merged_row_n + i + 1;
+                const auto [doc_it, inserted] = rescore_map.emplace(docId.ToUint64(), rescore_vec.size());
+                if (inserted) {
+                    FusionDocScore &doc = rescore_vec.emplace_back();
+                    doc.row_id_ = docId;
+                    doc.first_child_idx_ = num_children;
+                    doc.child_scores_.resize(num_children, 0.0f);
+                    doc.mask_.resize(num_children, false);
+                }
+                FusionDocScore &doc = rescore_vec[doc_it->second];
+                if (child_idx < doc.first_child_idx_) {
+                    doc.from_input_data_block_id_ = fragment_id;
+                    doc.from_block_idx_ = merged_block_n;
+                    doc.from_row_idx_ = i;
+                    doc.first_child_idx_ = child_idx;
+                    doc.first_rank_ = rank;
+                }
+                doc.mask_[child_idx] = true;
+                if (fusion_method_ == FusionMethod::kRRF) {
+                    doc.child_scores_[child_idx] = rank;
+                } else {
+                    assert(fusion_method_ == FusionMethod::kWeightedSum);
+                    doc.child_scores_[child_idx] = row_scores[i];
+                }
+            }
+            merged_row_n += row_n;
+        }
+    }
+}
+
 // Refers to https://www.elastic.co/guide/en/elasticsearch/reference/current/rrf.html
-void PhysicalFusion::ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBlock>>> &input_data_blocks,
-                                        Vector<UniquePtr<DataBlock>> &output_data_block_array) const {
+void PhysicalFusion::ExecuteRRFWeighted(FusionOperatorState *fusion_operator_state, Vector<UniquePtr<DataBlock>> &output_data_block_array) const {
     SizeT num_children = 2 + other_children_.size();
     SizeT rank_constant = 60;
     SizeT topn = DEFAULT_FUSION_OPTION_TOP_N;
@@ -161,56 +208,10 @@ void PhysicalFusion::ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBloc
         }
     }
 
-    Vector<DocScore> rescore_vec;
-    Map<RowID, SizeT> rescore_map; // row_id to index of rescore_vec_
-    // 1 Prepare rescore_vec
-    SizeT fragment_idx = 0;
-    for (const auto &[fragment_id, input_blocks] : input_data_blocks) {
-        SizeT base_rank = 1;
-        u32 from_block_idx = 0;
-        for (const UniquePtr<DataBlock> &input_data_block : input_blocks) {
-            if (input_data_block->column_count() != GetOutputTypes()->size()) {
-                String error_message = fmt::format("input_data_block column count {} is incorrect, expect {}.",
-                                                   input_data_block->column_count(),
-                                                   GetOutputTypes()->size());
-                UnrecoverableError(error_message);
-            }
-            auto &row_id_column = *input_data_block->column_vectors[input_data_block->column_count() - 1];
-            auto row_ids = reinterpret_cast<RowID *>(row_id_column.data());
-            SizeT row_n = input_data_block->row_count();
-            auto &row_score_column = *input_data_block->column_vectors[input_data_block->column_count() - 2];
-            auto row_scores = reinterpret_cast<float *>(row_score_column.data());
-            for (SizeT i = 0; i < row_n; i++) {
-                RowID docId = row_ids[i];
-                if (rescore_map.find(docId) == rescore_map.end()) {
-                    DocScore doc;
-                    doc.row_id_ = docId;
-                    doc.from_input_data_block_id_ = fragment_id;
-                    doc.from_block_idx_ = from_block_idx;
-                    doc.from_row_idx_ = i;
-                    doc.child_scores_.resize(num_children, 0.0f);
-                    doc.mask_.resize(num_children, false);
-                    rescore_vec.push_back(doc);
-                    rescore_map[docId] = rescore_vec.size() - 1;
-                }
-                SizeT doc_idx = rescore_map[docId];
-                DocScore &doc = rescore_vec[doc_idx];
-                assert(fragment_idx < num_children);
-                doc.mask_[fragment_idx] = true;
-                if (fusion_method_ == FusionMethod::kRRF) {
-                    doc.child_scores_[fragment_idx] = base_rank + i;
-                } else {
-                    assert(fusion_method_ == FusionMethod::kWeightedSum);
-                    doc.child_scores_[fragment_idx] = row_scores[i];
-                }
-            }
-            base_rank += row_n;
-            from_block_idx++;
-        }
-        fragment_idx++;
-    }
+    const Map<u64, Vector<UniquePtr<DataBlock>>> &input_data_blocks = fusion_operator_state->input_data_blocks_;
+    Vector<FusionDocScore> &rescore_vec = fusion_operator_state->rescore_vec_;
 
-    // 2 calculate every doc's fusion_score
+    // 1 calculate every doc's fusion_score
     if (fusion_method_ == FusionMethod::kRRF) {
         for (auto &doc : rescore_vec) {
             doc.fusion_score_ = 0.0f;
@@ -269,20 +270,26 @@ void PhysicalFusion::ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBloc
         }
     }
 
-    // 3 sort docs in reverse per their fusion_score
-    std::stable_sort(std::begin(rescore_vec), std::end(rescore_vec), [](const DocScore &lhs, const DocScore &rhs) noexcept {
-        return lhs.fusion_score_ > rhs.fusion_score_;
-    });
+    // 2 sort docs in reverse per their fusion_score, the docs of the same score in the order of the children and the ranks
+    const auto doc_order = [](const FusionDocScore &lhs, const FusionDocScore &rhs) noexcept {
+        if (lhs.fusion_score_ != rhs.fusion_score_) {
+            return lhs.fusion_score_ > rhs.fusion_score_;
+        }
+        return std::tie(lhs.first_child_idx_, lhs.first_rank_) < std::tie(rhs.first_child_idx_, rhs.first_rank_);
+    };
     if (rescore_vec.size() > topn) {
+        std::partial_sort(rescore_vec.begin(), rescore_vec.begin() + topn, rescore_vec.end(), doc_order);
         rescore_vec.resize(topn);
+    } else {
+        std::sort(rescore_vec.begin(), rescore_vec.end(), doc_order);
     }
 
-    // 4 generate output data blocks
+    // 3 generate output data blocks
     UniquePtr<DataBlock> output_data_block = DataBlock::MakeUniquePtr();
     output_data_block->Init(*GetOutputTypes());
     SizeT row_count = 0;
-    for (DocScore &doc : rescore_vec) {
-        // 4.1 get every doc's columns from input data blocks
+    for (FusionDocScore &doc : rescore_vec) {
+        // 3.1 get every doc's columns from input data blocks
         if (row_count == output_data_block->capacity()) {
             output_data_block->Finalize();
             output_data_block_array.push_back(std::move(output_data_block));
@@ -295,7 +302,7 @@ void PhysicalFusion::ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBloc
         for (SizeT i = 0; i < column_n; ++i) {
             output_data_block->column_vectors[i]->AppendWith(*input_blocks[doc.from_block_idx_]->column_vectors[i], doc.from_row_idx_, 1);
         }
-        // 4.2 add hidden columns: score, row_id
+        // 3.2 add hidden columns: score, row_id
         Value v = Value::MakeFloat(doc.fusion_score_);
         output_data_block->column_vectors[column_n]->AppendValue(v);
         output_data_block->column_vectors[column_n + 1]->AppendWith(doc.row_id_, 1);
@@ -337,6 +344,8 @@ void PhysicalFusion::ExecuteMatchTensor(QueryContext *query_context,
     }
     // prepare topn
     u32 topn = DEFAULT_MATCH_TENSOR_OPTION_TOP_N;
+    // the docs scored with the float embeddings after the binary first stage are binary_rerank_factor * topn
+    u32 binary_rerank_factor = 0;
     // find topn
     if (fusion_expr_->options_.get() != nullptr) {
         const auto &options = fusion_expr_->options_->options_;
@@ -345,6 +354,13 @@ void PhysicalFusion::ExecuteMatchTensor(QueryContext *query_context,
                 topn = topn_int;
             }
         }
+        if (auto factor_it = options.find("binary_rerank_factor"); factor_it != options.end()) {
+            const int factor_int = std::stoi(factor_it->second);
+            if (factor_int < 0) {
+                RecoverableError(Status::SyntaxError("binary_rerank_factor must be a non-negative integer"));
+            }
+            binary_rerank_factor = factor_int;
+        }
     }
     BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
     Vector<MatchTensorRerankDoc> rerank_docs;
@@ -377,7 +393,15 @@ void PhysicalFusion::ExecuteMatchTensor(QueryContext *query_context,
         return lhs.row_id_ < rhs.row_id_;
     });
     // 3. calculate score
-    CalculateFusionMatchTensorRerankerScores(rerank_docs, buffer_mgr, column_data_type, column_id, block_index, *fusion_expr_->match_tensor_expr_);
+    // saturate the candidate count, more candidates than docs means every doc is scored in full precision anyway
+    const u32 binary_candidate_n = static_cast<u32>(std::min<u64>(u64(binary_rerank_factor) * topn, std::numeric_limits<u32>::max()));
+    CalculateFusionMatchTensorRerankerScores(rerank_docs,
+                                             buffer_mgr,
+                                             column_data_type,
+                                             column_id,
+                                             block_index,
+                                             *fusion_expr_->match_tensor_expr_,
+                                             binary_candidate_n);
     // 4. sort by score
     std::sort(rerank_docs.begin(), rerank_docs.end(), [](const MatchTensorRerankDoc &lhs, const MatchTensorRerankDoc &rhs) noexcept {
         return lhs.score_ > rhs.score_;
@@ -423,15 +447,22 @@ bool PhysicalFusion::Execute(QueryContext *query_context, OperatorState *operato
 }
 
 bool PhysicalFusion::ExecuteFirstOp(QueryContext *query_context, FusionOperatorState *fusion_operator_state) const {
-    if (!fusion_operator_state->input_complete_) {
-        return false;
-    }
     if (fusion_method_ == FusionMethod::kRRF || fusion_method_ == FusionMethod::kWeightedSum) {
-        ExecuteRRFWeighted(fusion_operator_state->input_data_blocks_, fusion_operator_state->data_block_array_);
+        MergeRRFWeightedInput(fusion_operator_state);
+        fusion_operator_state->hash_table_size_ = fusion_operator_state->rescore_map_.size();
+        if (!fusion_operator_state->input_complete_) {
+            return false;
+        }
+        ExecuteRRFWeighted(fusion_operator_state, fusion_operator_state->data_block_array_);
         fusion_operator_state->input_data_blocks_.clear();
+        fusion_operator_state->rescore_vec_.clear();
+        fusion_operator_state->rescore_map_.clear();
         fusion_operator_state->SetComplete();
         return true;
     }
+    if (!fusion_operator_state->input_complete_) {
+        return false;
+    }
     if (fusion_method_ == FusionMethod::kMatchTensor) {
         ExecuteMatchTensor(query_context, fusion_operator_state->input_data_blocks_, fusion_operator_state->data_block_array_);
         fusion_operator_state->input_data_blocks_.clear();
@@ -74,8 +74,9 @@ private:
     bool ExecuteFirstOp(QueryContext *query_context, FusionOperatorState *fusion_operator_state) const;
     bool ExecuteNotFirstOp(QueryContext *query_context, OperatorState *operator_state) const;
     // RRF and WeightedSum have multiple input sources, must be first fusion op
-    void ExecuteRRFWeighted(const Map<u64, Vector<UniquePtr<DataBlock>>> &input_data_blocks,
-                            Vector<UniquePtr<DataBlock>> &output_data_block_array) const;
+    // The ranked input blocks are merged as they arrive, while the other children are still running
+    void MergeRRFWeightedInput(FusionOperatorState *fusion_operator_state) const;
+    void ExecuteRRFWeighted(FusionOperatorState *fusion_operator_state, Vector<UniquePtr<DataBlock>> &output_data_block_array) const;
     // MatchTensor may have multiple or single input source, can be first or not first fusion op
     void ExecuteMatchTensor(QueryContext *query_context,
                             const Map<u64, Vector<UniquePtr<DataBlock>>> &input_data_blocks,
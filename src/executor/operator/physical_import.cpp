@@ -20,11 +20,26 @@ module;
 // }
 
 #include <cerrno>
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <type_traits>
 #include <vector>
 
+#include "arrow/type_fwd.h"
+#include <arrow/array.h>
+#include <arrow/chunked_array.h>
+#include <arrow/table.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/arrow/schema.h>
+#include <parquet/file_reader.h>
+#include <parquet/metadata.h>
+#include <parquet/statistics.h>
+
 module physical_import;
 
 import stl;
@@ -66,6 +81,13 @@ import catalog_delta_entry;
 import build_fast_rough_filter_task;
 import stream_io;
 import parser_assert;
+import infinity_context;
+import expr_parser;
+import expression_parser_result;
+import parsed_expr;
+import function_expr;
+import column_expr;
+import between_expr;
 
 namespace infinity {
 
@@ -483,22 +505,12 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
     if (!fp) {
         UnrecoverableError(strerror(errno));
     }
+    DeferFn file_defer([&]() { fclose(fp); });
 
-    UniquePtr<ZxvParserCtx> parser_context = nullptr;
+    // The rows are parsed by zsv on this thread and converted into the blocks on the copy thread pool.
     Txn *txn = query_context->GetTxn();
-    {
-        auto *buffer_mgr = txn->buffer_mgr();
-        u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-        SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-        UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
-        Vector<ColumnVector> column_vectors;
-        int column_count = table_entry_->ColumnCount();
-        for (int i = 0; i < column_count; ++i) {
-            auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-            column_vectors.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
-        }
-        parser_context = MakeUnique<ZxvParserCtx>(table_entry_, txn, segment_entry, std::move(block_entry), std::move(column_vectors), delimiter_);
-    }
+    ImportBlockWriter block_writer(table_entry_, txn);
+    auto parser_context = MakeUnique<ZxvParserCtx>(table_entry_, &block_writer, delimiter_);
 
     auto opts = MakeUnique<ZsvOpts>();
     if (header_) {
@@ -514,41 +526,11 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
     parser_context->parser_ = ZsvParser(opts.get());
 
     ZsvStatus csv_parser_status;
-    try {
-        while ((csv_parser_status = parser_context->parser_.ParseMore()) == zsv_status_ok) {
-            ;
-        }
-    } catch (const ParserException &e) {
-        parser_context->column_vectors_.clear();
-        std::move(*parser_context->block_entry_).Cleanup();
-        std::move(*parser_context->segment_entry_).Cleanup();
-        throw;
-    } catch (const RecoverableException &e) {
-        parser_context->column_vectors_.clear();
-        std::move(*parser_context->block_entry_).Cleanup();
-        std::move(*parser_context->segment_entry_).Cleanup();
-        throw;
+    while ((csv_parser_status = parser_context->parser_.ParseMore()) == zsv_status_ok) {
+        ;
     }
     parser_context->parser_.Finish();
 
-    { // add the last segment entry
-        auto segment_entry = parser_context->segment_entry_;
-        auto &block_entry = parser_context->block_entry_;
-        if (block_entry->row_count() > 0) {
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-        } else {
-            parser_context->column_vectors_.clear();
-            std::move(*block_entry).Cleanup();
-        }
-        if (segment_entry->row_count() == 0) {
-            parser_context->column_vectors_.clear();
-            std::move(*segment_entry).Cleanup();
-        } else {
-            SaveSegmentData(table_entry_, txn, segment_entry);
-        }
-    }
-    fclose(fp);
-
     if (csv_parser_status != zsv_status_no_more_input) {
         if (parser_context->err_msg_.get() != nullptr) {
             UnrecoverableError(*parser_context->err_msg_);
@@ -558,7 +540,12 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
         }
     }
 
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", parser_context->row_count_));
+    if (!parser_context->block_rows_->row_begins_.empty()) {
+        SubmitCSVRows(parser_context.get());
+    }
+    SizeT row_count = block_writer.Finish();
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
     import_op_state->result_msg_ = std::move(result_msg);
 }
 
@@ -567,66 +554,32 @@ void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorStat
     stream_io.Init(file_path_, FileFlags::READ_FLAG);
     DeferFn file_defer([&]() { stream_io.Close(); });
 
+    // Lines are read on this thread, parsed and converted into the blocks on the copy thread pool.
     Txn *txn = query_context->GetTxn();
-    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
-
-    Vector<ColumnVector> column_vectors;
-    for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-        auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-        column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
-    }
-
-    SizeT row_count{0};
+    ImportBlockWriter block_writer(table_entry_, txn);
     while (true) {
+        auto lines = MakeShared<Vector<String>>();
+        lines->reserve(DEFAULT_BLOCK_CAPACITY);
         String json_str;
-        if (stream_io.ReadLine(json_str)) {
-            nlohmann::json line_json = nlohmann::json::parse(json_str);
-            try {
+        while (lines->size() < static_cast<SizeT>(DEFAULT_BLOCK_CAPACITY) && stream_io.ReadLine(json_str)) {
+            lines->emplace_back(std::move(json_str));
+            json_str.clear();
+        }
+        if (lines->empty()) {
+            break;
+        }
+        block_writer.Submit([this, lines](Vector<ColumnVector> &column_vectors) {
+            for (const String &line : *lines) {
+                nlohmann::json line_json = nlohmann::json::parse(line);
                 JSONLRowHandler(line_json, column_vectors);
-            } catch (const RecoverableException &e) {
-                column_vectors.clear();
-                std::move(*block_entry).Cleanup();
-                std::move(*segment_entry).Cleanup();
-                throw;
-            }
-            block_entry->IncreaseRowCount(1);
-            ++row_count;
-
-            if (block_entry->GetAvailableCapacity() <= 0) {
-                LOG_DEBUG(fmt::format("Block {} saved, total rows: {}", block_entry->block_id(), row_count));
-                segment_entry->AppendBlockEntry(std::move(block_entry));
-                if (segment_entry->Room() <= 0) {
-                    LOG_DEBUG(fmt::format("Segment {} saved, total rows: {}", segment_entry->segment_id(), row_count));
-                    SaveSegmentData(table_entry_, txn, segment_entry);
-                    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-                    segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-                }
-
-                block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-                column_vectors.clear();
-                for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-                    auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-                    column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
-                }
-            }
-        } else {
-            if (block_entry->row_count() == 0) {
-                column_vectors.clear();
-                std::move(*block_entry).Cleanup();
-            } else {
-                segment_entry->AppendBlockEntry(std::move(block_entry));
-            }
-            if (segment_entry->row_count() == 0) {
-                std::move(*segment_entry).Cleanup();
-            } else {
-                SaveSegmentData(table_entry_, txn, segment_entry);
-                LOG_DEBUG(fmt::format("Last segment {} saved, total rows: {}", segment_entry->segment_id(), row_count));
             }
+            return lines->size();
+        });
+        if (lines->size() < static_cast<SizeT>(DEFAULT_BLOCK_CAPACITY)) {
             break;
         }
     }
+    SizeT row_count = block_writer.Finish();
 
     auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
     import_op_state->result_msg_ = std::move(result_msg);
@@ -659,56 +612,26 @@ void PhysicalImport::ImportJSON(QueryContext *query_context, ImportOperatorState
         json_arr = nlohmann::json::parse(json_str);
     }
 
-    Txn *txn = query_context->GetTxn();
-    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
-
-    Vector<ColumnVector> column_vectors;
-    for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-        auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-        column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
-    }
-
     if (!json_arr.is_array()) {
         auto result_msg = MakeUnique<String>(fmt::format("Invalid json format, IMPORT 0 rows"));
         import_op_state->result_msg_ = std::move(result_msg);
         return;
     }
 
-    SizeT row_count{0};
-    for (const auto &json_entry : json_arr) {
-        if (block_entry->GetAvailableCapacity() <= 0) {
-            LOG_DEBUG(fmt::format("Block {} saved", block_entry->block_id()));
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-            if (segment_entry->Room() <= 0) {
-                LOG_DEBUG(fmt::format("Segment {} saved", segment_entry->segment_id()));
-                SaveSegmentData(table_entry_, txn, segment_entry);
-                u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-                segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-            }
-
-            block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-            column_vectors.clear();
-            for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-                auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-                column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
+    Txn *txn = query_context->GetTxn();
+    ImportBlockWriter block_writer(table_entry_, txn);
+    const nlohmann::json &json_entries = json_arr;
+    SizeT json_entry_count = json_entries.size();
+    for (SizeT begin = 0; begin < json_entry_count; begin += DEFAULT_BLOCK_CAPACITY) {
+        SizeT end = std::min(begin + DEFAULT_BLOCK_CAPACITY, json_entry_count);
+        block_writer.Submit([this, &json_entries, begin, end](Vector<ColumnVector> &column_vectors) {
+            for (SizeT idx = begin; idx < end; ++idx) {
+                JSONLRowHandler(json_entries[idx], column_vectors);
             }
-        }
-        try {
-            JSONLRowHandler(json_entry, column_vectors);
-        } catch (const RecoverableException &e) {
-            column_vectors.clear();
-            std::move(*block_entry).Cleanup();
-            std::move(*segment_entry).Cleanup();
-            throw;
-        }
-        block_entry->IncreaseRowCount(1);
-        ++row_count;
+            return end - begin;
+        });
     }
-
-    segment_entry->AppendBlockEntry(std::move(block_entry));
-    SaveSegmentData(table_entry_, txn, segment_entry);
+    SizeT row_count = block_writer.Finish();
 
     auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
     import_op_state->result_msg_ = std::move(result_msg);
@@ -745,15 +668,10 @@ void PhysicalImport::CSVHeaderHandler(void *context) {
 
 void PhysicalImport::CSVRowHandler(void *context) {
     ZxvParserCtx *parser_context = static_cast<ZxvParserCtx *>(context);
+    ZsvParser &parser = parser_context->parser_;
 
     auto *table_entry = parser_context->table_entry_;
-    SizeT column_count = parser_context->parser_.CellCount();
-
-    auto *txn = parser_context->txn_;
-    auto *buffer_mgr = txn->buffer_mgr();
-
-    auto segment_entry = parser_context->segment_entry_;
-    UniquePtr<BlockEntry> &block_entry = parser_context->block_entry_;
+    SizeT column_count = parser.CellCount();
 
     // if column count is larger than columns defined from schema, extra columns are abandoned
     if (column_count > table_entry->ColumnCount()) {
@@ -763,26 +681,56 @@ void PhysicalImport::CSVRowHandler(void *context) {
                         column_count,
                         table_entry->ColumnCount()));
         for (SizeT i = 0; i < column_count; ++i) {
-            ZsvCell cell = parser_context->parser_.GetCell(i);
+            ZsvCell cell = parser.GetCell(i);
             LOG_ERROR(fmt::format("Column {}: {}", i, std::string_view((char *)cell.str, cell.len)));
         }
         Status status = Status::ColumnCountMismatch(*err_msg);
         RecoverableError(status);
     }
 
-    // append data to segment entry
+    // the cells only live until the next row is parsed
+    CSVBlockRows &block_rows = *parser_context->block_rows_;
+    block_rows.row_begins_.push_back(block_rows.cells_.size());
     for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
-        ZsvCell cell = parser_context->parser_.GetCell(column_idx);
-        std::string_view str_view{};
-        auto column_def = table_entry->GetColumnDefByID(column_idx);
-        if (cell.len) {
-            str_view = std::string_view((char *)cell.str, cell.len);
-            auto &column_vector = parser_context->column_vectors_[column_idx];
-            column_vector.AppendByStringView(str_view);
-        } else {
+        ZsvCell cell = parser.GetCell(column_idx);
+        block_rows.cells_.emplace_back(block_rows.data_.size(), cell.len);
+        block_rows.data_.append(reinterpret_cast<const char *>(cell.str), cell.len);
+    }
+    ++parser_context->row_count_;
+
+    if (block_rows.row_begins_.size() == static_cast<SizeT>(DEFAULT_BLOCK_CAPACITY)) {
+        SubmitCSVRows(parser_context);
+    }
+}
+
+void PhysicalImport::SubmitCSVRows(ZxvParserCtx *parser_context) {
+    SharedPtr<CSVBlockRows> block_rows = std::move(parser_context->block_rows_);
+    parser_context->block_rows_ = MakeShared<CSVBlockRows>();
+
+    const TableEntry *table_entry = parser_context->table_entry_;
+    parser_context->block_writer_->Submit(
+        [table_entry, block_rows](Vector<ColumnVector> &column_vectors) { return CSVBlockHandler(table_entry, *block_rows, column_vectors); });
+}
+
+SizeT PhysicalImport::CSVBlockHandler(const TableEntry *table_entry, const CSVBlockRows &block_rows, Vector<ColumnVector> &column_vectors) {
+    SizeT row_count = block_rows.row_begins_.size();
+    SizeT cell_count = block_rows.cells_.size();
+    // convert column by column so that the type dispatch and the column data stay hot in cache
+    for (SizeT column_idx = 0; column_idx < column_vectors.size(); ++column_idx) {
+        auto &column_vector = column_vectors[column_idx];
+        const ColumnDef *column_def = table_entry->GetColumnDefByID(column_idx);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            SizeT cell_begin = block_rows.row_begins_[row_idx];
+            SizeT cell_end = row_idx + 1 < row_count ? block_rows.row_begins_[row_idx + 1] : cell_count;
+            if (cell_begin + column_idx < cell_end) {
+                const auto &[offset, len] = block_rows.cells_[cell_begin + column_idx];
+                if (len) {
+                    column_vector.AppendByStringView(std::string_view(block_rows.data_.data() + offset, len));
+                    continue;
+                }
+            }
             if (column_def->has_default_value()) {
                 auto const_expr = dynamic_cast<ConstantExpr *>(column_def->default_expr_.get());
-                auto &column_vector = parser_context->column_vectors_[column_idx];
                 column_vector.AppendByConstantExpr(const_expr);
             } else {
                 Status status = Status::ImportFileFormatError(fmt::format("Column {} is empty.", column_def->name_));
@@ -790,42 +738,7 @@ void PhysicalImport::CSVRowHandler(void *context) {
             }
         }
     }
-    for (SizeT column_idx = column_count; column_idx < table_entry->ColumnCount(); ++column_idx) {
-        auto column_def = table_entry->GetColumnDefByID(column_idx);
-        auto &column_vector = parser_context->column_vectors_[column_idx];
-        if (column_def->has_default_value()) {
-            auto const_expr = dynamic_cast<ConstantExpr *>(column_def->default_expr_.get());
-            column_vector.AppendByConstantExpr(const_expr);
-        } else {
-            Status status = Status::ImportFileFormatError(fmt::format("Column {} is empty.", column_def->name_));
-            RecoverableError(status);
-        }
-    }
-    block_entry->IncreaseRowCount(1);
-    ++parser_context->row_count_;
-
-    if (block_entry->GetAvailableCapacity() <= 0) {
-        LOG_DEBUG(fmt::format("Block {} saved", block_entry->block_id()));
-        segment_entry->AppendBlockEntry(std::move(block_entry));
-        // we have already used all space of the segment
-        if (segment_entry->Room() <= 0) {
-            LOG_DEBUG(fmt::format("Segment {} saved", segment_entry->segment_id()));
-            SaveSegmentData(table_entry, txn, segment_entry);
-            u64 segment_id = Catalog::GetNextSegmentID(parser_context->table_entry_);
-            segment_entry = SegmentEntry::NewSegmentEntry(table_entry, segment_id, txn);
-            parser_context->segment_entry_ = segment_entry;
-        }
-
-        block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry->ColumnCount(), txn);
-        parser_context->column_vectors_.clear();
-        for (SizeT i = 0; i < column_count; ++i) {
-            auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-            parser_context->column_vectors_.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
-        }
-    }
-
-    // set parser context
-    parser_context->block_entry_ = std::move(block_entry);
+    return row_count;
 }
 
 SharedPtr<ConstantExpr> BuildConstantExprFromJson(const nlohmann::json &json_object) {
@@ -1396,91 +1309,616 @@ void PhysicalImport::JSONLRowHandler(const nlohmann::json &line_json, Vector<Col
     }
 }
 
-void PhysicalImport::ImportPARQUET(QueryContext *query_context, ImportOperatorState *import_op_state) {
-    Txn *txn = query_context->GetTxn();
-    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-    SizeT row_count = 0;
+namespace {
+
+// A numeric constant of the FILTER option of a parquet import, an integer keeps its exact value
+struct ParquetFilterValue {
+    bool is_integer_{};
+    i64 integer_{};
+    f64 double_{};
+};
+
+// Accepted values of one value type, a bound is unset until a comparison gives it
+template <typename T>
+struct ParquetValueRange {
+    T lower_{};
+    T upper_{};
+    bool lower_bounded_{false};
+    bool upper_bounded_{false};
+    bool lower_inclusive_{true};
+    bool upper_inclusive_{true};
+    // no value of the type is accepted
+    bool empty_{false};
+
+    bool AboveLower(T value) const { return !lower_bounded_ || value > lower_ || (value == lower_ && lower_inclusive_); }
+
+    bool BelowUpper(T value) const { return !upper_bounded_ || value < upper_ || (value == upper_ && upper_inclusive_); }
+
+    bool Contains(T value) const { return !empty_ && AboveLower(value) && BelowUpper(value); }
+
+    // whether any value in [min_value, max_value] is accepted
+    bool Overlaps(T min_value, T max_value) const { return !empty_ && AboveLower(max_value) && BelowUpper(min_value); }
+
+    void SetLower(T value, bool inclusive) {
+        if (!lower_bounded_ || value > lower_ || (value == lower_ && !inclusive)) {
+            lower_ = value;
+            lower_inclusive_ = inclusive;
+            lower_bounded_ = true;
+        }
+    }
+
+    void SetUpper(T value, bool inclusive) {
+        if (!upper_bounded_ || value < upper_ || (value == upper_ && !inclusive)) {
+            upper_ = value;
+            upper_inclusive_ = inclusive;
+            upper_bounded_ = true;
+        }
+    }
+};
+
+// Values of a numeric column accepted by the FILTER option of a parquet import, the column is named as in the target table.
+// Integer values are compared with i64 bounds, so a bigint bound isn't rounded to a double. Floating point values are compared
+// with f64 bounds.
+struct ParquetColumnRange {
+    ColumnID column_idx_{};
+    ParquetValueRange<i64> integer_range_{};
+    ParquetValueRange<f64> float_range_{};
+
+    static constexpr f64 kI64Limit = 9223372036854775808.0; // 2^63
 
+    void SetLower(const ParquetFilterValue &value, bool inclusive) {
+        if (value.is_integer_) {
+            integer_range_.SetLower(value.integer_, inclusive);
+            float_range_.SetLower(static_cast<f64>(value.integer_), inclusive);
+            return;
+        }
+        float_range_.SetLower(value.double_, inclusive);
+        // the smallest integer above a fractional bound is accepted
+        f64 bound = std::ceil(value.double_);
+        if (bound >= kI64Limit) {
+            integer_range_.empty_ = true;
+        } else if (bound >= -kI64Limit) {
+            integer_range_.SetLower(static_cast<i64>(bound), inclusive || bound != value.double_);
+        }
+    }
+
+    void SetUpper(const ParquetFilterValue &value, bool inclusive) {
+        if (value.is_integer_) {
+            integer_range_.SetUpper(value.integer_, inclusive);
+            float_range_.SetUpper(static_cast<f64>(value.integer_), inclusive);
+            return;
+        }
+        float_range_.SetUpper(value.double_, inclusive);
+        // the largest integer below a fractional bound is accepted
+        f64 bound = std::floor(value.double_);
+        if (bound < -kI64Limit) {
+            integer_range_.empty_ = true;
+        } else if (bound < kI64Limit) {
+            integer_range_.SetUpper(static_cast<i64>(bound), inclusive || bound != value.double_);
+        }
+    }
+
+    template <typename T>
+    bool Contains(T value) const {
+        if constexpr (std::is_floating_point_v<T>) {
+            return float_range_.Contains(value);
+        } else if constexpr (std::is_same_v<T, u64>) {
+            if (value > static_cast<u64>(std::numeric_limits<i64>::max())) {
+                // above every i64 bound
+                return !integer_range_.empty_ && !integer_range_.upper_bounded_;
+            }
+            return integer_range_.Contains(static_cast<i64>(value));
+        } else {
+            return integer_range_.Contains(static_cast<i64>(value));
+        }
+    }
+};
+
+bool ParquetFilterConstant(const ParsedExpr *expr, ParquetFilterValue &value) {
+    if (expr->type_ == ParsedExprType::kFunction) {
+        const auto *func_expr = static_cast<const FunctionExpr *>(expr);
+        if (func_expr->func_name_ != "-" || func_expr->arguments_ == nullptr || func_expr->arguments_->size() != 1) {
+            return false;
+        }
+        if (!ParquetFilterConstant(func_expr->arguments_->at(0), value)) {
+            return false;
+        }
+        // -(-2^63) is out of the i64 range
+        if (value.is_integer_ && value.integer_ == std::numeric_limits<i64>::min()) {
+            value.is_integer_ = false;
+        }
+        if (value.is_integer_) {
+            value.integer_ = -value.integer_;
+        }
+        value.double_ = -value.double_;
+        return true;
+    }
+    if (expr->type_ != ParsedExprType::kConstant) {
+        return false;
+    }
+    const auto *constant_expr = static_cast<const ConstantExpr *>(expr);
+    switch (constant_expr->literal_type_) {
+        case LiteralType::kInteger: {
+            value.is_integer_ = true;
+            value.integer_ = constant_expr->integer_value_;
+            value.double_ = static_cast<f64>(constant_expr->integer_value_);
+            return true;
+        }
+        case LiteralType::kDouble: {
+            value.is_integer_ = false;
+            value.double_ = constant_expr->double_value_;
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+// column id of a numeric column of the table, false if the expression isn't such a column
+bool ParquetFilterColumn(const TableEntry *table_entry, const ParsedExpr *expr, ColumnID &column_idx) {
+    if (expr->type_ != ParsedExprType::kColumn) {
+        return false;
+    }
+    const auto *column_expr = static_cast<const ColumnExpr *>(expr);
+    if (column_expr->star_ || column_expr->names_.empty()) {
+        return false;
+    }
+    column_idx = table_entry->GetColumnIdByName(column_expr->names_.back());
+    switch (table_entry->GetColumnDefByID(column_idx)->type()->type()) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble: {
+            return true;
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("Filter on column {} of type {} when importing parquet file",
+                                                            column_expr->names_.back(),
+                                                            table_entry->GetColumnDefByID(column_idx)->type()->ToString())));
+            return false;
+        }
+    }
+}
+
+ParquetColumnRange &ParquetRangeOfColumn(Vector<ParquetColumnRange> &ranges, ColumnID column_idx) {
+    for (auto &range : ranges) {
+        if (range.column_idx_ == column_idx) {
+            return range;
+        }
+    }
+    ranges.emplace_back().column_idx_ = column_idx;
+    return ranges.back();
+}
+
+bool AddParquetFilterExpr(const TableEntry *table_entry, const ParsedExpr *expr, Vector<ParquetColumnRange> &ranges) {
+    if (expr->type_ == ParsedExprType::kBetween) {
+        const auto *between_expr = static_cast<const BetweenExpr *>(expr);
+        ColumnID column_idx{};
+        ParquetFilterValue lower{}, upper{};
+        if (!ParquetFilterColumn(table_entry, between_expr->value_, column_idx) || !ParquetFilterConstant(between_expr->lower_bound_, lower) ||
+            !ParquetFilterConstant(between_expr->upper_bound_, upper)) {
+            return false;
+        }
+        auto &range = ParquetRangeOfColumn(ranges, column_idx);
+        range.SetLower(lower, true);
+        range.SetUpper(upper, true);
+        return true;
+    }
+    if (expr->type_ != ParsedExprType::kFunction) {
+        return false;
+    }
+    const auto *func_expr = static_cast<const FunctionExpr *>(expr);
+    if (func_expr->arguments_ == nullptr || func_expr->arguments_->size() != 2) {
+        return false;
+    }
+    const ParsedExpr *left = func_expr->arguments_->at(0);
+    const ParsedExpr *right = func_expr->arguments_->at(1);
+    if (func_expr->func_name_ == "and") {
+        return AddParquetFilterExpr(table_entry, left, ranges) && AddParquetFilterExpr(table_entry, right, ranges);
+    }
+
+    String op = func_expr->func_name_;
+    ColumnID column_idx{};
+    ParquetFilterValue value{};
+    if (ParquetFilterColumn(table_entry, left, column_idx)) {
+        if (!ParquetFilterConstant(right, value)) {
+            return false;
+        }
+    } else if (ParquetFilterColumn(table_entry, right, column_idx)) {
+        if (!ParquetFilterConstant(left, value)) {
+            return false;
+        }
+        // constant op column -> column mirrored_op constant
+        if (op == "<") {
+            op = ">";
+        } else if (op == ">") {
+            op = "<";
+        } else if (op == "<=") {
+            op = ">=";
+        } else if (op == ">=") {
+            op = "<=";
+        }
+    } else {
+        return false;
+    }
+
+    auto &range = ParquetRangeOfColumn(ranges, column_idx);
+    if (op == "=") {
+        range.SetLower(value, true);
+        range.SetUpper(value, true);
+    } else if (op == ">") {
+        range.SetLower(value, false);
+    } else if (op == ">=") {
+        range.SetLower(value, true);
+    } else if (op == "<") {
+        range.SetUpper(value, false);
+    } else if (op == "<=") {
+        range.SetUpper(value, true);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// The filter is a conjunction of comparisons between numeric columns and constants, e.g. "c1 >= 10 and c1 < 20 and c2 = 3".
+Vector<ParquetColumnRange> ParseParquetFilter(const TableEntry *table_entry, const String &filter) {
+    Vector<ParquetColumnRange> ranges;
+    if (filter.empty()) {
+        return ranges;
+    }
+    auto expr_parsed_result = MakeUnique<ExpressionParserResult>();
+    ExprParser expr_parser;
+    expr_parser.Parse(filter, expr_parsed_result.get());
+    if (expr_parsed_result->IsError() || expr_parsed_result->exprs_ptr_->size() != 1 ||
+        !AddParquetFilterExpr(table_entry, expr_parsed_result->exprs_ptr_->at(0), ranges)) {
+        RecoverableError(Status::InvalidFilterExpression(filter));
+    }
+    return ranges;
+}
+
+// Whether the statistics of a row group allow any row matching the ranges. `leaf_idxs` is the parquet column of every table
+// column, -1 if the table column isn't a primitive parquet column.
+bool ParquetRowGroupMayMatch(const ::parquet::RowGroupMetaData &row_group_meta,
+                             const Vector<ParquetColumnRange> &ranges,
+                             const Vector<int> &leaf_idxs) {
+    for (const auto &range : ranges) {
+        int leaf_idx = leaf_idxs[range.column_idx_];
+        if (leaf_idx < 0) {
+            continue;
+        }
+        auto column_chunk_meta = row_group_meta.ColumnChunk(leaf_idx);
+        if (!column_chunk_meta->is_stats_set()) {
+            continue;
+        }
+        SharedPtr<::parquet::Statistics> statistics = column_chunk_meta->statistics();
+        if (statistics.get() == nullptr || !statistics->HasMinMax() || statistics->descr()->sort_order() != ::parquet::SortOrder::SIGNED) {
+            continue;
+        }
+        bool may_match = true;
+        switch (statistics->physical_type()) {
+            case ::parquet::Type::INT32: {
+                auto typed_statistics = std::static_pointer_cast<::parquet::Int32Statistics>(statistics);
+                may_match = range.integer_range_.Overlaps(typed_statistics->min(), typed_statistics->max());
+                break;
+            }
+            case ::parquet::Type::INT64: {
+                auto typed_statistics = std::static_pointer_cast<::parquet::Int64Statistics>(statistics);
+                may_match = range.integer_range_.Overlaps(typed_statistics->min(), typed_statistics->max());
+                break;
+            }
+            case ::parquet::Type::FLOAT: {
+                auto typed_statistics = std::static_pointer_cast<::parquet::FloatStatistics>(statistics);
+                may_match = range.float_range_.Overlaps(typed_statistics->min(), typed_statistics->max());
+                break;
+            }
+            case ::parquet::Type::DOUBLE: {
+                auto typed_statistics = std::static_pointer_cast<::parquet::DoubleStatistics>(statistics);
+                may_match = range.float_range_.Overlaps(typed_statistics->min(), typed_statistics->max());
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+        if (!may_match) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename ArrayType>
+void MatchParquetRange(const arrow::Array &array, const ParquetColumnRange &range, u8 *matched) {
+    const auto &typed_array = static_cast<const ArrayType &>(array);
+    for (i64 i = 0; i < typed_array.length(); ++i) {
+        if (matched[i] && (typed_array.IsNull(i) || !range.Contains(typed_array.Value(i)))) {
+            matched[i] = 0;
+        }
+    }
+}
+
+// Runs of the rows matching all ranges, as pairs of first row and row count
+Vector<Pair<i64, i64>>
+ParquetMatchedRows(const Vector<SharedPtr<arrow::ChunkedArray>> &columns, const Vector<ParquetColumnRange> &ranges, i64 row_count) {
+    Vector<u8> matched(row_count, 1);
+    for (const auto &range : ranges) {
+        i64 offset = 0;
+        for (const auto &chunk : columns[range.column_idx_]->chunks()) {
+            u8 *chunk_matched = matched.data() + offset;
+            switch (chunk->type_id()) {
+                case ::arrow::Type::INT8: {
+                    MatchParquetRange<::arrow::Int8Array>(*chunk, range, chunk_matched);
+                    break;
+                }
+                case ::arrow::Type::INT16: {
+                    MatchParquetRange<::arrow::Int16Array>(*chunk, range, chunk_matched);
+                    break;
+                }
+                case ::arrow::Type::INT32: {
+                    MatchParquetRange<::arrow::Int32Array>(*chunk, range, chunk_matched);
+                    break;
+                }
+                case ::arrow::Type::INT64: {
+                    MatchParquetRange<::arrow::Int64Array>(*chunk, range, chunk_matched);
+                    break;
+                }
+                case ::arrow::Type::UINT8: {
+                    MatchParquetRange<::arrow::UInt8Array>(*chunk, range, chunk_matched);
+                    break;
+                }
+                case ::arrow::Type::UINT16: {
+                    MatchParquetRange<::arrow::UInt16Array>(*chunk, range, chunk_matched);
+                    break;
+                }
+                case ::arrow::Type::UINT32: {
+                    MatchParquetRange<::arrow::UInt32Array>(*chunk, range, chunk_matched);
+                    break;
+                }
+                case ::arrow::Type::UINT64: {
+                    MatchParquetRange<::arrow::UInt64Array>(*chunk, range, chunk_matched);
+                    break;
+                }
+                case ::arrow::Type::FLOAT: {
+                    MatchParquetRange<::arrow::FloatArray>(*chunk, range, chunk_matched);
+                    break;
+                }
+                case ::arrow::Type::DOUBLE: {
+                    MatchParquetRange<::arrow::DoubleArray>(*chunk, range, chunk_matched);
+                    break;
+                }
+                default: {
+                    RecoverableError(Status::ImportFileFormatError(fmt::format("Filter on parquet column of type {}", chunk->type()->ToString())));
+                }
+            }
+            offset += chunk->length();
+        }
+    }
+
+    Vector<Pair<i64, i64>> runs;
+    for (i64 row = 0; row < row_count;) {
+        if (!matched[row]) {
+            ++row;
+            continue;
+        }
+        i64 run_begin = row;
+        while (row < row_count && matched[row]) {
+            ++row;
+        }
+        runs.emplace_back(run_begin, row - run_begin);
+    }
+    return runs;
+}
+
+void CollectParquetLeaves(const ::parquet::arrow::SchemaField &schema_field, Vector<int> &leaf_idxs) {
+    if (schema_field.is_leaf()) {
+        leaf_idxs.push_back(schema_field.column_index);
+        return;
+    }
+    for (const auto &child : schema_field.children) {
+        CollectParquetLeaves(child, leaf_idxs);
+    }
+}
+
+// Copy a whole array into the column vector if its values have the memory layout of the column, return false otherwise.
+bool ParquetBulkValueHandler(const SharedPtr<arrow::Array> &array, ColumnVector &column_vector) {
+    if (array->null_count() != 0) {
+        return false;
+    }
+    const DataType *data_type = column_vector.data_type().get();
+    const u8 *src = nullptr;
+    switch (data_type->type()) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble: {
+            static const HashMap<LogicalType, ::arrow::Type::type> arrow_types = {{LogicalType::kTinyInt, ::arrow::Type::INT8},
+                                                                                  {LogicalType::kSmallInt, ::arrow::Type::INT16},
+                                                                                  {LogicalType::kInteger, ::arrow::Type::INT32},
+                                                                                  {LogicalType::kBigInt, ::arrow::Type::INT64},
+                                                                                  {LogicalType::kFloat, ::arrow::Type::FLOAT},
+                                                                                  {LogicalType::kDouble, ::arrow::Type::DOUBLE}};
+            if (array->type_id() != arrow_types.at(data_type->type())) {
+                return false;
+            }
+            src = array->data()->GetValues<u8>(1, array->offset() * data_type->Size());
+            break;
+        }
+        case LogicalType::kEmbedding: {
+            static const HashMap<EmbeddingDataType, ::arrow::Type::type> arrow_types = {{EmbeddingDataType::kElemInt8, ::arrow::Type::INT8},
+                                                                                        {EmbeddingDataType::kElemUInt8, ::arrow::Type::UINT8},
+                                                                                        {EmbeddingDataType::kElemInt16, ::arrow::Type::INT16},
+                                                                                        {EmbeddingDataType::kElemInt32, ::arrow::Type::INT32},
+                                                                                        {EmbeddingDataType::kElemInt64, ::arrow::Type::INT64},
+                                                                                        {EmbeddingDataType::kElemFloat, ::arrow::Type::FLOAT},
+                                                                                        {EmbeddingDataType::kElemDouble, ::arrow::Type::DOUBLE}};
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(data_type->type_info().get());
+            auto arrow_type_iter = arrow_types.find(embedding_info->Type());
+            auto list_array = std::dynamic_pointer_cast<arrow::FixedSizeListArray>(array);
+            if (arrow_type_iter == arrow_types.end() || list_array.get() == nullptr ||
+                static_cast<SizeT>(list_array->value_length()) != embedding_info->Dimension()) {
+                return false;
+            }
+            const auto &values = list_array->values();
+            if (values->type_id() != arrow_type_iter->second || values->null_count() != 0) {
+                return false;
+            }
+            SizeT element_size = embedding_info->Size() / embedding_info->Dimension();
+            src = values->data()->GetValues<u8>(1, (values->offset() + list_array->value_offset(0)) * element_size);
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+
+    SizeT value_size = data_type->Size();
+    SizeT tail_index = column_vector.Size();
+    SizeT value_count = array->length();
+    if (tail_index + value_count > column_vector.capacity()) {
+        UnrecoverableError(fmt::format("Parquet array of {} values exceeds the column vector of {}/{}", value_count, tail_index, column_vector.capacity()));
+    }
+    std::memcpy(column_vector.data() + tail_index * value_size, src, value_count * value_size);
+    column_vector.Finalize(tail_index + value_count);
+    return true;
+}
+
+} // namespace
+
+void PhysicalImport::ImportPARQUET(QueryContext *query_context, ImportOperatorState *import_op_state) {
     arrow::MemoryPool *pool = arrow::DefaultMemoryPool();
     SharedPtr<arrow::RandomAccessFile> file;
 
     file = arrow::ReadableFile::Open(file_path_, pool).ValueOrDie();
     UniquePtr<arrow::ParquetFileReader> arrow_reader;
 
-    SharedPtr<arrow::Table> table;
     auto status = parquet::OpenFile(file, pool, &arrow_reader);
     if (!status.ok()) {
         RecoverableError(Status::FileNotFound(file_path_));
     }
-    status = arrow_reader->ReadTable(&table);
-    if (!status.ok()) {
-        RecoverableError(Status::ImportFileFormatError(status.ToString()));
-    }
-
-    row_count = table->num_rows();
-    SizeT col_count = table->num_columns();
-    if (col_count != table_entry_->ColumnCount()) {
-        RecoverableError(Status::ColumnCountMismatch(fmt::format("Column count mismatch: {} != {}", col_count, table_entry_->ColumnCount())));
+    // the column chunks of a row group are decoded concurrently
+    arrow_reader->set_use_threads(true);
+
+    // Columns of the file are matched to the table columns by name, only the matched columns are read. A file whose column names
+    // differ from the table is matched by position.
+    SizeT column_count = table_entry_->ColumnCount();
+    const auto &schema_fields = arrow_reader->manifest().schema_fields;
+    Vector<SizeT> file_fields(column_count);
+    bool match_by_name = true;
+    for (SizeT column_idx = 0; column_idx < column_count && match_by_name; ++column_idx) {
+        const String &column_name = table_entry_->GetColumnDefByID(column_idx)->name();
+        auto iter = std::find_if(schema_fields.begin(), schema_fields.end(), [&](const auto &schema_field) {
+            return schema_field.field->name() == column_name;
+        });
+        match_by_name = iter != schema_fields.end();
+        file_fields[column_idx] = iter - schema_fields.begin();
+    }
+    if (!match_by_name) {
+        if (schema_fields.size() != column_count) {
+            RecoverableError(
+                Status::ColumnCountMismatch(fmt::format("Column count mismatch: {} != {}", schema_fields.size(), column_count)));
+        }
+        std::iota(file_fields.begin(), file_fields.end(), 0);
+    }
+    Vector<int> read_leaf_idxs;
+    Vector<int> column_leaf_idxs(column_count, -1);
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        const auto &schema_field = schema_fields[file_fields[column_idx]];
+        if (schema_field.is_leaf()) {
+            column_leaf_idxs[column_idx] = schema_field.column_index;
+        }
+        CollectParquetLeaves(schema_field, read_leaf_idxs);
     }
+    Vector<ParquetColumnRange> ranges = ParseParquetFilter(table_entry_, filter_);
 
-    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
+    // Row groups are decoded on this thread and cut into blocks, the blocks are converted on the copy thread pool.
+    Txn *txn = query_context->GetTxn();
+    ImportBlockWriter block_writer(table_entry_, txn);
+    // chunks of the rows not submitted yet
+    Vector<Vector<SharedPtr<arrow::Array>>> pending_chunks(column_count);
+    i64 pending_row_count = 0;
+    auto submit_block = [&](i64 block_row_count) {
+        auto block_columns = MakeShared<Vector<SharedPtr<arrow::ChunkedArray>>>();
+        for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+            auto pending_column = MakeShared<arrow::ChunkedArray>(std::move(pending_chunks[column_idx]));
+            block_columns->push_back(pending_column->Slice(0, block_row_count));
+            pending_chunks[column_idx] = pending_column->Slice(block_row_count)->chunks();
+        }
+        pending_row_count -= block_row_count;
+        block_writer.Submit([this, block_columns, block_row_count](Vector<ColumnVector> &column_vectors) {
+            ParquetBlockHandler(*block_columns, column_vectors);
+            return static_cast<SizeT>(block_row_count);
+        });
+    };
+
+    auto file_metadata = arrow_reader->parquet_reader()->metadata();
+    int row_group_count = arrow_reader->num_row_groups();
+    for (int row_group_idx = 0; row_group_idx < row_group_count; ++row_group_idx) {
+        if (!ranges.empty() && !ParquetRowGroupMayMatch(*file_metadata->RowGroup(row_group_idx), ranges, column_leaf_idxs)) {
+            LOG_DEBUG(fmt::format("Skip row group {} of {} by filter {}", row_group_idx, file_path_, filter_));
+            continue;
+        }
+        SharedPtr<arrow::Table> table;
+        status = arrow_reader->ReadRowGroup(row_group_idx, read_leaf_idxs, &table);
+        if (!status.ok()) {
+            RecoverableError(Status::ImportFileFormatError(status.ToString()));
+        }
+        Vector<SharedPtr<arrow::ChunkedArray>> columns;
+        for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+            SharedPtr<arrow::ChunkedArray> column = match_by_name ? table->GetColumnByName(table_entry_->GetColumnDefByID(column_idx)->name())
+                                                                  : table->column(column_idx);
+            if (column.get() == nullptr) {
+                RecoverableError(Status::ImportFileFormatError(
+                    fmt::format("Column {} isn't found in parquet file", table_entry_->GetColumnDefByID(column_idx)->name())));
+            }
+            columns.push_back(std::move(column));
+        }
 
-    Vector<ColumnVector> column_vectors;
-    for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-        auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-        column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
-    }
-
-    Vector<i64> chunk_idxs(table_entry_->ColumnCount(), 0);
-    Vector<i64> value_idxs(table_entry_->ColumnCount(), 0);
-    for (SizeT i = 0; i < row_count; ++i) {
-        for (SizeT column_idx = 0; column_idx < table_entry_->ColumnCount(); ++column_idx) {
-            SharedPtr<arrow::ChunkedArray> column = table->column(column_idx);
-            auto &column_vector = column_vectors[column_idx];
-            auto array = column->chunk(chunk_idxs[column_idx]);
-            try {
-                ParquetValueHandler(array, column_vector, value_idxs[column_idx]);
-            } catch (const RecoverableException &e) {
-                column_vectors.clear();
-                std::move(*block_entry).Cleanup();
-                std::move(*segment_entry).Cleanup();
-                throw;
-            }
-            if (++value_idxs[column_idx] >= array->length()) {
-                ++chunk_idxs[column_idx];
-                value_idxs[column_idx] = 0;
-            }
-        }
-
-        block_entry->IncreaseRowCount(1);
-        if (block_entry->GetAvailableCapacity() <= 0) {
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-            if (segment_entry->Room() <= 0) {
-                SaveSegmentData(table_entry_, txn, segment_entry);
-                segment_id = Catalog::GetNextSegmentID(table_entry_);
-                segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
+        i64 row_count = table->num_rows();
+        Vector<Pair<i64, i64>> runs =
+            ranges.empty() ? Vector<Pair<i64, i64>>{{0, row_count}} : ParquetMatchedRows(columns, ranges, row_count);
+        for (const auto &[run_begin, run_length] : runs) {
+            if (run_length == 0) {
+                continue;
             }
-            block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-            column_vectors.clear();
-            for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-                auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-                column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
+            for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+                for (const auto &chunk : columns[column_idx]->Slice(run_begin, run_length)->chunks()) {
+                    pending_chunks[column_idx].push_back(chunk);
+                }
             }
+            pending_row_count += run_length;
+        }
+        while (pending_row_count >= DEFAULT_BLOCK_CAPACITY) {
+            submit_block(DEFAULT_BLOCK_CAPACITY);
         }
     }
-
-    if (block_entry->row_count() > 0) {
-        segment_entry->AppendBlockEntry(std::move(block_entry));
-    }
-    if (segment_entry->row_count() > 0) {
-        SaveSegmentData(table_entry_, txn, segment_entry);
+    if (pending_row_count > 0) {
+        submit_block(pending_row_count);
     }
+    SizeT row_count = block_writer.Finish();
 
     auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
     import_op_state->result_msg_ = std::move(result_msg);
 }
 
+void PhysicalImport::ParquetBlockHandler(const Vector<SharedPtr<arrow::ChunkedArray>> &block_columns, Vector<ColumnVector> &column_vectors) {
+    for (SizeT column_idx = 0; column_idx < block_columns.size(); ++column_idx) {
+        auto &column_vector = column_vectors[column_idx];
+        for (const auto &chunk : block_columns[column_idx]->chunks()) {
+            if (ParquetBulkValueHandler(chunk, column_vector)) {
+                continue;
+            }
+            for (i64 value_idx = 0; value_idx < chunk->length(); ++value_idx) {
+                ParquetValueHandler(chunk, column_vector, value_idx);
+            }
+        }
+    }
+}
+
 template <typename IndexType, typename IndexArray, typename DataType, typename DataArray>
 void ParquetSparseValueHandler(const SparseInfo *sparse_info,
                                SharedPtr<IndexArray> index_array,
@@ -2106,4 +2544,108 @@ void PhysicalImport::SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPt
     txn->Import(table_entry, std::move(segment_entry));
 }
 
+ImportBlockWriter::ImportBlockWriter(TableEntry *table_entry, Txn *txn)
+    : table_entry_(table_entry), txn_(txn), thread_pool_(InfinityContext::instance().GetCopyThreadPool()),
+      max_pending_(2 * thread_pool_.size()) {}
+
+ImportBlockWriter::~ImportBlockWriter() {
+    if (!finished_) {
+        Abort();
+    }
+}
+
+void ImportBlockWriter::Submit(FillBlockFunc fill) {
+    if (open_segments_.empty() || static_cast<SizeT>(next_block_id_) * DEFAULT_BLOCK_CAPACITY >= open_segments_.back()->row_capacity()) {
+        u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
+        open_segments_.emplace_back(SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn_));
+        next_block_id_ = 0;
+    }
+    SegmentEntry *segment_entry = open_segments_.back().get();
+    BlockID block_id = next_block_id_++;
+    auto block_future = thread_pool_.push(
+        [this, segment_entry, block_id, fill = std::move(fill)](int) { return BuildBlock(segment_entry, block_id, fill); });
+    pending_blocks_.push_back(PendingBlock{segment_entry, block_id, std::move(block_future)});
+
+    while (pending_blocks_.size() > max_pending_) {
+        AppendOldestBlock();
+    }
+}
+
+SizeT ImportBlockWriter::Finish() {
+    while (!pending_blocks_.empty()) {
+        AppendOldestBlock();
+    }
+    // only the last segment may be not full
+    for (auto &segment_entry : open_segments_) {
+        if (segment_entry->row_count() == 0) {
+            std::move(*segment_entry).Cleanup();
+        } else {
+            LOG_DEBUG(fmt::format("Last segment {} saved, total rows: {}", segment_entry->segment_id(), row_count_));
+            txn_->Import(table_entry_, std::move(segment_entry));
+        }
+    }
+    open_segments_.clear();
+    finished_ = true;
+    return row_count_;
+}
+
+UniquePtr<BlockEntry> ImportBlockWriter::BuildBlock(SegmentEntry *segment_entry, BlockID block_id, const FillBlockFunc &fill) {
+    SizeT column_count = table_entry_->ColumnCount();
+    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry, block_id, 0, column_count, txn_);
+    try {
+        Vector<ColumnVector> column_vectors;
+        column_vectors.reserve(column_count);
+        for (SizeT i = 0; i < column_count; ++i) {
+            auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
+            column_vectors.emplace_back(block_column_entry->GetColumnVector(txn_->buffer_mgr()));
+        }
+        SizeT row_count = fill(column_vectors);
+        block_entry->IncreaseRowCount(row_count);
+    } catch (...) {
+        std::move(*block_entry).Cleanup();
+        throw;
+    }
+    // write the block files on the worker too, the segment doesn't need to be flushed again when it is imported
+    block_entry->FlushForImport();
+    return block_entry;
+}
+
+void ImportBlockWriter::AppendOldestBlock() {
+    PendingBlock pending_block = std::move(pending_blocks_.front());
+    pending_blocks_.pop_front();
+
+    UniquePtr<BlockEntry> block_entry = pending_block.block_future_.get();
+    row_count_ += block_entry->row_count();
+    LOG_DEBUG(fmt::format("Block {} saved, total rows: {}", block_entry->block_id(), row_count_));
+
+    SegmentEntry *segment_entry = pending_block.segment_entry_;
+    segment_entry->AppendBlockEntry(std::move(block_entry));
+    if (static_cast<SizeT>(pending_block.block_id_ + 1) * DEFAULT_BLOCK_CAPACITY >= segment_entry->row_capacity()) {
+        // blocks are appended in order, the full segment is the oldest open one
+        LOG_DEBUG(fmt::format("Segment {} saved, total rows: {}", segment_entry->segment_id(), row_count_));
+        txn_->Import(table_entry_, std::move(open_segments_.front()));
+        open_segments_.pop_front();
+    }
+}
+
+void ImportBlockWriter::Abort() {
+    for (auto &pending_block : pending_blocks_) {
+        try {
+            UniquePtr<BlockEntry> block_entry = pending_block.block_future_.get();
+            std::move(*block_entry).Cleanup();
+        } catch (...) {
+            // the failed block has been cleaned up by the worker
+        }
+    }
+    pending_blocks_.clear();
+    for (auto &segment_entry : open_segments_) {
+        try {
+            std::move(*segment_entry).Cleanup();
+        } catch (const std::exception &e) {
+            LOG_ERROR(fmt::format("Cleanup segment {} of the failed import: {}", segment_entry->segment_id(), e.what()));
+        }
+    }
+    open_segments_.clear();
+}
+
 } // namespace infinity
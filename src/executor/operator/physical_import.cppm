@@ -14,6 +14,9 @@
 
 module;
 
+#include <functional>
+#include <future>
+
 export module physical_import;
 
 import stl;
@@ -40,27 +43,74 @@ import logger;
 
 namespace infinity {
 
+// Builds the blocks of the imported segments on the copy thread pool. Blocks are filled concurrently and appended to their
+// segment in file order by the thread reading the file, at most `max_pending_` blocks are in flight at the same time.
+// Everything not imported yet is cleaned up if the writer is destroyed before `Finish`.
+class ImportBlockWriter {
+public:
+    // Append the rows of one block to the column vectors on a worker thread, return the row count.
+    using FillBlockFunc = std::function<SizeT(Vector<ColumnVector> &column_vectors)>;
+
+    ImportBlockWriter(TableEntry *table_entry, Txn *txn);
+
+    ~ImportBlockWriter();
+
+    // All blocks but the last one are expected to be filled to DEFAULT_BLOCK_CAPACITY rows.
+    void Submit(FillBlockFunc fill);
+
+    // Wait for the blocks in flight and import the segments into the txn, return the imported row count.
+    SizeT Finish();
+
+private:
+    struct PendingBlock {
+        SegmentEntry *segment_entry_{};
+        BlockID block_id_{};
+        std::future<UniquePtr<BlockEntry>> block_future_{};
+    };
+
+    UniquePtr<BlockEntry> BuildBlock(SegmentEntry *segment_entry, BlockID block_id, const FillBlockFunc &fill);
+
+    void AppendOldestBlock();
+
+    void Abort();
+
+private:
+    TableEntry *const table_entry_{};
+    Txn *const txn_{};
+    ThreadPool &thread_pool_;
+    const SizeT max_pending_{};
+
+    Deque<PendingBlock> pending_blocks_{};
+    // segments not imported yet, new blocks go to the last one
+    Deque<SharedPtr<SegmentEntry>> open_segments_{};
+    BlockID next_block_id_{};
+    SizeT row_count_{};
+    bool finished_{false};
+};
+
+// Cells of the csv rows of one block, copied out of the parser buffer to be converted on a worker thread.
+struct CSVBlockRows {
+    String data_{};
+    // offset in data_ and length of every cell
+    Vector<Pair<SizeT, SizeT>> cells_{};
+    // index of the first cell of every row in cells_
+    Vector<SizeT> row_begins_{};
+};
+
 class ZxvParserCtx {
 public:
     ZsvParser parser_;
     SizeT row_count_{};
     SharedPtr<String> err_msg_{};
     TableEntry *const table_entry_{};
-    Txn *const txn_{};
-    SharedPtr<SegmentEntry> segment_entry_{};
-    UniquePtr<BlockEntry> block_entry_{};
-    Vector<ColumnVector> column_vectors_{};
+    ImportBlockWriter *const block_writer_{};
+    SharedPtr<CSVBlockRows> block_rows_{};
     const char delimiter_{};
 
 public:
-    ZxvParserCtx(TableEntry *table_entry,
-                 Txn *txn,
-                 SharedPtr<SegmentEntry> segment_entry,
-                 UniquePtr<BlockEntry> block_entry,
-                 Vector<ColumnVector> &&column_vectors,
-                 char delimiter)
-        : row_count_(0), err_msg_(nullptr), table_entry_(table_entry), txn_(txn), segment_entry_(segment_entry), block_entry_(std::move(block_entry)),
-          column_vectors_(std::move(column_vectors)), delimiter_(delimiter) {}
+    ZxvParserCtx(TableEntry *table_entry, ImportBlockWriter *block_writer, char delimiter)
+        : row_count_(0), err_msg_(nullptr), table_entry_(table_entry), block_writer_(block_writer), block_rows_(MakeShared<CSVBlockRows>()),
+          delimiter_(delimiter) {}
 };
 
 export class PhysicalImport : public PhysicalOperator {
@@ -71,9 +121,10 @@ public:
                             bool header,
                             char delimiter,
                             CopyFileType type,
+                            String filter,
                             SharedPtr<Vector<LoadMeta>> load_metas)
         : PhysicalOperator(PhysicalOperatorType::kImport, nullptr, nullptr, id, load_metas), table_entry_(table_entry), file_type_(type),
-          file_path_(std::move(file_path)), header_(header), delimiter_(delimiter) {}
+          file_path_(std::move(file_path)), header_(header), delimiter_(delimiter), filter_(std::move(filter)) {}
 
     ~PhysicalImport() override = default;
 
@@ -117,6 +168,8 @@ public:
 
     inline char delimiter() const { return delimiter_; }
 
+    inline const String &filter() const { return filter_; }
+
     static void SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry);
 
 private:
@@ -124,8 +177,16 @@ private:
 
     static void CSVRowHandler(void *);
 
+    // hand the buffered csv rows to the block writer
+    static void SubmitCSVRows(ZxvParserCtx *parser_context);
+
+    static SizeT CSVBlockHandler(const TableEntry *table_entry, const CSVBlockRows &block_rows, Vector<ColumnVector> &column_vectors);
+
     void JSONLRowHandler(const nlohmann::json &line_json, Vector<ColumnVector> &column_vectors);
 
+    // convert the columns of one block of a parquet file, whole arrays are copied if their layout matches the column
+    void ParquetBlockHandler(const Vector<SharedPtr<arrow::ChunkedArray>> &block_columns, Vector<ColumnVector> &column_vectors);
+
     void ParquetValueHandler(const SharedPtr<arrow::Array> &array, ColumnVector &column_vector, u64 value_idx);
 
 private:
@@ -137,6 +198,8 @@ private:
     String file_path_{};
     bool header_{false};
     char delimiter_{','};
+    // predicate on the columns of a parquet file
+    String filter_{};
 };
 
 export SharedPtr<ConstantExpr> BuildConstantExprFromJson(const nlohmann::json &json_object);
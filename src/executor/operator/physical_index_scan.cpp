@@ -36,6 +36,7 @@ import segment_index_entry;
 import chunk_index_entry;
 import secondary_index_in_mem;
 import segment_entry;
+import block_entry;
 import fast_rough_filter;
 import bitmask;
 import filter_value_type_classification;
@@ -47,7 +48,7 @@ PhysicalIndexScan::PhysicalIndexScan(u64 id,
                                      SharedPtr<BaseExpression> index_filter_qualified,
                                      HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                                      Vector<FilterExecuteElem> &&filter_execute_command,
-                                     UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                                     SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                                      SharedPtr<Vector<LoadMeta>> load_metas,
                                      bool add_row_id)
     : PhysicalOperator(PhysicalOperatorType::kIndexScan, nullptr, nullptr, id, load_metas), base_table_ref_(std::move(base_table_ref)),
@@ -114,188 +115,180 @@ template <typename ColumnValueType>
 struct TrunkReaderT final : public TrunkReader<ColumnValueType> {
     using KeyType = ConvertToOrderedType<ColumnValueType>;
     static constexpr u32 data_pair_size = sizeof(KeyType) + sizeof(u32);
+    static constexpr u32 part_capacity = 8192;
     const u32 segment_row_count_;
     SharedPtr<ChunkIndexEntry> chunk_index_entry_;
-    u32 begin_pos_ = 0;
-    u32 end_pos_ = 0;
+    // [begin, end) positions in the sorted (key, offset) array of the chunk, one run for every matched interval
+    Vector<Pair<u32, u32>> result_runs_;
+    // bitmap index: [begin, end) key ids in the dictionary, one run for every matched interval
+    BufferHandle index_handle_;
+    const SecondaryIndexDictionary<KeyType> *dictionary_ = nullptr;
+    Vector<Pair<u32, u32>> key_runs_;
+    // the index part being read
+    u32 part_id_ = std::numeric_limits<u32>::max();
+    BufferHandle part_handle_;
+    const char *part_data_ = nullptr;
     TrunkReaderT(const u32 segment_row_count, const SharedPtr<ChunkIndexEntry> &chunk_index_entry)
         : segment_row_count_(segment_row_count), chunk_index_entry_(chunk_index_entry) {}
     u32 GetResultCnt(const FilterIntervalRangeT<ColumnValueType> &interval_range) override {
         static_assert(std::is_same_v<KeyType, typename FilterIntervalRangeT<ColumnValueType>::T>);
-        BufferHandle index_handle_head = chunk_index_entry_->GetIndex();
-        auto index = static_cast<const SecondaryIndexData *>(index_handle_head.GetData());
-        u32 index_data_num = index->GetChunkRowCount();
-        auto [begin_val, end_val] = interval_range.GetRange();
-        // 1. search PGM and get approximate search range
-        // result:
-        //    1. size_t pos_;         ///< The approximate position of the key.
-        //    2. size_t lower_bound_; ///< The lower bound of the range.
-        //    3. size_t upper_bound_; ///< The upper bound of the range.
+        index_handle_ = chunk_index_entry_->GetIndex();
+        auto index = static_cast<const SecondaryIndexData *>(index_handle_.GetData());
+        if (dictionary_ = static_cast<const SecondaryIndexDictionary<KeyType> *>(index->GetDictionary()); dictionary_) {
+            return GetResultCntByDictionary(interval_range);
+        }
+        const u32 index_data_num = index->GetChunkRowCount();
+        // The intervals are sorted and disjoint, so every interval is searched after the end of the previous one and the chunk is
+        // walked once for the whole list, e.g. an IN-list of 10k keys.
+        // PGM gives the approximate position of the interval begin, the exact position is found by galloping from there.
         // NOTICE: PGM return a range [lower_bound_, upper_bound_) which must include **one** key when the key exists
         // NOTICE: but the range may not include the complete [start, end] range
-        auto [begin_approx_pos, begin_lower, begin_upper] = index->SearchPGM(&begin_val);
-        auto [end_approx_pos, end_lower, end_upper] = index->SearchPGM(&end_val);
-        u32 begin_pos = begin_lower;
-        u32 end_pos = std::min<u32>(end_upper, index_data_num - 1);
-        if (end_pos < begin_pos) {
-            return 0;
-        }
-        const auto column_data_type = chunk_index_entry_->segment_index_entry_->table_index_entry()->column_def()->type();
-        const auto index_part_num = chunk_index_entry_->GetPartNum();
-        // 2. find the exact range
-        // 2.1 find the exact begin_pos which is the first position that index_key >= begin_val
-        u32 begin_part_id = begin_pos / 8192;
-        u32 begin_part_offset = begin_pos % 8192;
-        auto index_handle_b = chunk_index_entry_->GetIndexPartAt(begin_part_id);
-        auto index_data_b = index_handle_b.GetData();
-        auto index_key_b_ptr = [&index_data_b](u32 i) -> KeyType {
-            KeyType key = {};
-            std::memcpy(&key, static_cast<const char *>(index_data_b) + i * data_pair_size, sizeof(KeyType));
-            return key;
-        };
-        auto begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
-        if (index_key_b_ptr(begin_part_offset) < begin_val) {
-            // search forward
-            while (index_key_b_ptr(begin_part_offset) < begin_val) {
-                if (++begin_part_offset == begin_part_size) {
-                    if (++begin_part_id >= index_part_num) {
-                        // nothing found
-                        return 0;
-                    }
-                    index_handle_b = chunk_index_entry_->GetIndexPartAt(begin_part_id);
-                    index_data_b = index_handle_b.GetData();
-                    begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
-                    begin_part_offset = 0;
-                }
-            }
-        } else {
-            // search backward
-            auto test_begin_part_id = begin_part_id;
-            auto test_begin_part_offset = begin_part_offset;
-            while (index_key_b_ptr(test_begin_part_offset) >= begin_val) {
-                // keep valid begin_pos
-                begin_part_id = test_begin_part_id;
-                begin_part_offset = test_begin_part_offset;
-                if (test_begin_part_offset-- == 0) {
-                    if (test_begin_part_id-- == 0) {
-                        // left bound is the leftmost
-                        break;
-                    }
-                    index_handle_b = chunk_index_entry_->GetIndexPartAt(test_begin_part_id);
-                    index_data_b = index_handle_b.GetData();
-                    begin_part_size = chunk_index_entry_->GetPartRowCount(test_begin_part_id);
-                    test_begin_part_offset = begin_part_size - 1;
-                }
-            }
-            // recover valid pointers
-            index_handle_b = chunk_index_entry_->GetIndexPartAt(begin_part_id);
-            index_data_b = index_handle_b.GetData();
-            begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
-        }
-        // update begin_pos
-        begin_pos = begin_part_id * 8192 + begin_part_offset;
-        // 2.2 find the exact end_pos which is the first position that index_key > end_val (or the position past the end)
-        u32 end_part_id = end_pos / 8192;
-        u32 end_part_offset = end_pos % 8192;
-        auto index_handle_e = chunk_index_entry_->GetIndexPartAt(end_part_id);
-        auto index_data_e = index_handle_e.GetData();
-        auto index_key_e_ptr = [&index_data_e](u32 i) -> KeyType {
-            KeyType key = {};
-            std::memcpy(&key, static_cast<const char *>(index_data_e) + i * data_pair_size, sizeof(KeyType));
-            return key;
-        };
-        auto end_part_size = chunk_index_entry_->GetPartRowCount(end_part_id);
-        if (index_key_e_ptr(end_part_offset) <= end_val) {
-            // search forward
-            while (index_key_e_ptr(end_part_offset) <= end_val) {
-                if (++end_part_offset == end_part_size) {
-                    if (++end_part_id >= index_part_num) {
-                        // right bound is the rightmost
-                        // recover end_part_id and keep end_part_offset
-                        // they will be used to calculate end_pos
-                        --end_part_id;
-                        break;
-                    }
-                    index_handle_e = chunk_index_entry_->GetIndexPartAt(end_part_id);
-                    index_data_e = index_handle_e.GetData();
-                    end_part_size = chunk_index_entry_->GetPartRowCount(end_part_id);
-                    end_part_offset = 0;
-                }
+        result_runs_.clear();
+        u32 result_size = 0;
+        u32 search_from = 0;
+        for (const auto &[begin_val, end_val] : interval_range.GetRanges()) {
+            if (search_from >= index_data_num) {
+                break;
             }
-        } else {
-            // search backward
-            auto test_end_part_id = end_part_id;
-            auto test_end_part_offset = end_part_offset;
-            while (index_key_e_ptr(test_end_part_offset) > end_val) {
-                end_part_id = test_end_part_id;
-                end_part_offset = test_end_part_offset;
-                if (test_end_part_offset-- == 0) {
-                    if (test_end_part_id-- == 0) {
-                        // nothing found
-                        return 0;
-                    }
-                    index_handle_e = chunk_index_entry_->GetIndexPartAt(test_end_part_id);
-                    index_data_e = index_handle_e.GetData();
-                    // no need to update end_part_size
-                    test_end_part_offset = chunk_index_entry_->GetPartRowCount(test_end_part_id) - 1;
-                }
+            const u32 approx_pos = index->SearchPGM(&begin_val).pos_;
+            // first position that index_key >= begin_val
+            const u32 begin_pos = Search<false>(begin_val, search_from, index_data_num, approx_pos);
+            // first position that index_key > end_val (or the position past the end)
+            const u32 end_pos = Search<true>(end_val, begin_pos, index_data_num, begin_pos);
+            if (begin_pos < end_pos) {
+                result_runs_.emplace_back(begin_pos, end_pos);
+                result_size += end_pos - begin_pos;
             }
-            // does not need to recover valid values like index_handle_e, index_data_e, index_key_e_ptr, end_part_size
+            search_from = end_pos;
         }
-        // update end_pos
-        end_pos = end_part_id * 8192 + end_part_offset;
-        // 3. now we know result size
-        if (end_pos <= begin_pos) {
-            // nothing found
-            return 0;
-        }
-        // have result
-        begin_pos_ = begin_pos;
-        end_pos_ = end_pos;
-        const u32 result_size = end_pos - begin_pos;
         return result_size;
     }
     void OutPut(std::variant<Vector<u32>, Bitmask> &selected_rows_) override {
-        const u32 begin_pos = begin_pos_;
-        const u32 end_pos = end_pos_;
-        const u32 result_size = end_pos - begin_pos;
-        u32 begin_part_id = begin_pos / 8192;
-        u32 begin_part_offset = begin_pos % 8192;
-        auto index_handle_b = chunk_index_entry_->GetIndexPartAt(begin_part_id);
-        auto index_data_b = index_handle_b.GetData();
-        auto index_offset_b_ptr = [&index_data_b](const u32 i) -> u32 {
-            u32 result = 0;
-            std::memcpy(&result, static_cast<const char *>(index_data_b) + i * data_pair_size + sizeof(KeyType), sizeof(u32));
-            return result;
-        };
-        auto begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
-        // output result
         std::visit(Overload{[&](Vector<u32> &selected_rows) {
-                                for (u32 i = 0; i < result_size; ++i) {
-                                    if (begin_part_offset == begin_part_size) {
-                                        index_handle_b = chunk_index_entry_->GetIndexPartAt(++begin_part_id);
-                                        index_data_b = index_handle_b.GetData();
-                                        begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
-                                        begin_part_offset = 0;
+                                for (const auto &[begin_pos, end_pos] : result_runs_) {
+                                    for (u32 pos = begin_pos; pos < end_pos; ++pos) {
+                                        selected_rows.push_back(OffsetAt(pos));
                                     }
-                                    selected_rows.push_back(index_offset_b_ptr(begin_part_offset));
-                                    ++begin_part_offset;
                                 }
                             },
                             [&](Bitmask &bitmask) {
-                                for (u32 i = 0; i < result_size; ++i) {
-                                    if (begin_part_offset == begin_part_size) {
-                                        index_handle_b = chunk_index_entry_->GetIndexPartAt(++begin_part_id);
-                                        index_data_b = index_handle_b.GetData();
-                                        begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
-                                        begin_part_offset = 0;
+                                if (dictionary_) {
+                                    return OutPutByDictionary(bitmask);
+                                }
+                                for (const auto &[begin_pos, end_pos] : result_runs_) {
+                                    for (u32 pos = begin_pos; pos < end_pos; ++pos) {
+                                        bitmask.SetTrue(OffsetAt(pos));
                                     }
-                                    bitmask.SetTrue(index_offset_b_ptr(begin_part_offset));
-                                    ++begin_part_offset;
                                 }
                             }},
                    selected_rows_);
     }
+
+private:
+    // the dictionary gives the exact positions of the rows of every key, no need to search the (key, offset) array
+    u32 GetResultCntByDictionary(const FilterIntervalRangeT<ColumnValueType> &interval_range) {
+        const auto &keys = dictionary_->keys_;
+        const auto &key_begin = dictionary_->key_begin_;
+        result_runs_.clear();
+        key_runs_.clear();
+        u32 result_size = 0;
+        auto search_from = keys.begin();
+        for (const auto &[begin_val, end_val] : interval_range.GetRanges()) {
+            const auto key_lo = std::lower_bound(search_from, keys.end(), begin_val);
+            const auto key_hi = std::upper_bound(key_lo, keys.end(), end_val);
+            if (key_lo < key_hi) {
+                const u32 lo = key_lo - keys.begin();
+                const u32 hi = key_hi - keys.begin();
+                key_runs_.emplace_back(lo, hi);
+                result_runs_.emplace_back(key_begin[lo], key_begin[hi]);
+                result_size += key_begin[hi] - key_begin[lo];
+            }
+            search_from = key_hi;
+        }
+        return result_size;
+    }
+    // rows of the frequent keys are merged word by word, others are read from the (key, offset) array
+    void OutPutByDictionary(Bitmask &bitmask) {
+        u64 *bitmask_data = bitmask.GetData();
+        const u32 word_count = std::min<u32>(dictionary_->bitmap_word_count_, (bitmask.count() + 63) / 64);
+        for (const auto &[key_lo, key_hi] : key_runs_) {
+            for (u32 key_id = key_lo; key_id < key_hi; ++key_id) {
+                if (const u32 bitmap_id = dictionary_->bitmap_id_[key_id]; bitmap_id != SecondaryIndexDictionary<KeyType>::kNoBitmap) {
+                    const u64 *bitmap_data = dictionary_->bitmaps_[bitmap_id].data();
+                    for (u32 i = 0; i < word_count; ++i) {
+                        bitmask_data[i] |= bitmap_data[i];
+                    }
+                    continue;
+                }
+                for (u32 pos = dictionary_->key_begin_[key_id]; pos < dictionary_->key_begin_[key_id + 1]; ++pos) {
+                    bitmask.SetTrue(OffsetAt(pos));
+                }
+            }
+        }
+    }
+
+    const char *PairAt(const u32 pos) {
+        if (const u32 part_id = pos / part_capacity; part_id != part_id_) {
+            part_handle_ = chunk_index_entry_->GetIndexPartAt(part_id);
+            part_data_ = static_cast<const char *>(part_handle_.GetData());
+            part_id_ = part_id;
+        }
+        return part_data_ + (pos % part_capacity) * data_pair_size;
+    }
+    KeyType KeyAt(const u32 pos) {
+        KeyType key = {};
+        std::memcpy(&key, PairAt(pos), sizeof(KeyType));
+        return key;
+    }
+    u32 OffsetAt(const u32 pos) {
+        u32 offset = 0;
+        std::memcpy(&offset, PairAt(pos) + sizeof(KeyType), sizeof(u32));
+        return offset;
+    }
+    // first position in [from, count) whose key > val (upper) or >= val (!upper), count if there is none
+    // gallop from hint to bracket the position, then binary search in the bracket
+    template <bool upper>
+    u32 Search(const KeyType val, const u32 from, const u32 count, const u32 hint) {
+        auto before = [&](const u32 pos) -> bool {
+            if constexpr (upper) {
+                return KeyAt(pos) <= val;
+            } else {
+                return KeyAt(pos) < val;
+            }
+        };
+        u64 lo = from;
+        u64 hi = count;
+        const u64 start = std::clamp<u64>(hint, lo, hi);
+        if (start < hi and before(start)) {
+            lo = start + 1;
+            for (u64 step = 1; start + step < hi; step *= 2) {
+                if (before(start + step)) {
+                    lo = start + step + 1;
+                } else {
+                    hi = start + step;
+                    break;
+                }
+            }
+        } else {
+            hi = start;
+            for (u64 step = 1; start >= lo + step; step *= 2) {
+                if (before(start - step)) {
+                    lo = start - step + 1;
+                    break;
+                }
+                hi = start - step;
+            }
+        }
+        while (lo < hi) {
+            const u64 mid = lo + (hi - lo) / 2;
+            if (before(mid)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
 };
 
 template <typename ColumnValueType>
@@ -307,8 +300,7 @@ struct TrunkReaderM final : public TrunkReader<ColumnValueType> {
     TrunkReaderM(const u32 segment_row_count, const SharedPtr<SecondaryIndexInMem> &memory_secondary_index)
         : segment_row_count_(segment_row_count), memory_secondary_index_(memory_secondary_index) {}
     u32 GetResultCnt(const FilterIntervalRangeT<ColumnValueType> &interval_range) override {
-        auto [begin_val, end_val] = interval_range.GetRange();
-        Tuple<u32, KeyType, KeyType> arg_tuple = {segment_row_count_, begin_val, end_val};
+        Tuple<u32, const Vector<Pair<KeyType, KeyType>> *> arg_tuple = {segment_row_count_, &interval_range.GetRanges()};
         result_cache_ = memory_secondary_index_->RangeQuery(&arg_tuple);
         return result_cache_.first;
     }
@@ -517,7 +509,11 @@ struct FilterResult {
                    interval_range_variant);
     }
 
-    inline void Output(Vector<UniquePtr<DataBlock>> &output_data_blocks, SegmentID segment_id, const DeleteFilter &delete_filter) const {
+    // skipped_blocks: blocks of the segment rejected by their FastRoughFilter, indexed by block id
+    inline void Output(Vector<UniquePtr<DataBlock>> &output_data_blocks,
+                       SegmentID segment_id,
+                       const DeleteFilter &delete_filter,
+                       const Vector<bool> &skipped_blocks) const {
         const u32 block_capacity = DEFAULT_BLOCK_CAPACITY;
         const u32 selected_row_num = SelectedNum(); // before delete filter
         u32 output_rows = 0;
@@ -540,6 +536,12 @@ struct FilterResult {
         append_data_block();
         // 2. output
         // delete_filter: return false if the row is deleted
+        auto row_filter = [&](u32 segment_offset) -> bool {
+            if (const SizeT block_id = segment_offset / block_capacity; block_id < skipped_blocks.size() and skipped_blocks[block_id]) {
+                return false;
+            }
+            return delete_filter(segment_offset);
+        };
         std::visit(Overload{[&](const Bitmask &bitmask) {
                                 u32 output_block_row_id = 0;
                                 DataBlock *output_block_ptr = output_data_blocks.back().get();
@@ -547,8 +549,8 @@ struct FilterResult {
                                 const u32 segment_row_count = SegmentRowCount();
                                 for (u32 segment_offset = 0; segment_offset < segment_row_count; ++segment_offset) {
                                     if (bitmask.IsTrue(segment_offset)) {
-                                        if (!delete_filter(segment_offset)) {
-                                            // deleted
+                                        if (!row_filter(segment_offset)) {
+                                            // deleted or skipped
                                             ++invalid_rows;
                                             continue;
                                         }
@@ -574,8 +576,8 @@ struct FilterResult {
                                 u32 output_block_row_id = 0;
                                 DataBlock *output_block_ptr = output_data_blocks.back().get();
                                 for (u32 segment_offset : selected_rows) {
-                                    if (!delete_filter(segment_offset)) {
-                                        // deleted
+                                    if (!row_filter(segment_offset)) {
+                                        // deleted or skipped
                                         ++invalid_rows;
                                         continue;
                                     }
@@ -723,10 +725,23 @@ void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOp
 
     // prepare filter for deleted rows
     DeleteFilter delete_filter(segment_entry, begin_ts, segment_entry->row_count(begin_ts));
+    // the index result is intersected with the FastRoughFilter of the blocks
+    Vector<bool> skipped_blocks;
+    if (fast_rough_filter_evaluator_) {
+        for (BlockEntry *block_entry : segment_block_index_.at(segment_id).block_map_) {
+            if (!fast_rough_filter_evaluator_->Evaluate(begin_ts, *block_entry->GetFastRoughFilter())) {
+                const BlockID block_id = block_entry->block_id();
+                if (skipped_blocks.size() <= block_id) {
+                    skipped_blocks.resize(block_id + 1, false);
+                }
+                skipped_blocks[block_id] = true;
+            }
+        }
+    }
     // output
     const auto result =
         SolveSecondaryIndexFilterInner(filter_execute_command_, column_index_map_, segment_id, segment_row_count, segment_row_actual_count, txn);
-    result.Output(output_data_blocks, segment_id, delete_filter);
+    result.Output(output_data_blocks, segment_id, delete_filter, skipped_blocks);
 
     LOG_TRACE(fmt::format("IndexScan: job number: {}, segment_ids.size(): {}, finished", next_idx, segment_ids.size()));
     // update next_idx
@@ -31,6 +31,14 @@ import data_block;
 import third_party;
 import expression_evaluator;
 import base_expression;
+import value_expression;
+import cast_expression;
+import expression_type;
+import value;
+import logical_type;
+import integer_cast;
+import float_cast;
+import column_vector;
 import default_values;
 import status;
 import infinity_exception;
@@ -40,6 +48,68 @@ import column_def;
 
 namespace infinity {
 
+namespace {
+
+template <typename TargetType, typename TargetValue>
+bool CastLiteral(const Value &value, TargetValue make_value, Value &result) {
+    TargetType target{};
+    bool success = false;
+    switch (value.type().type()) {
+        case LogicalType::kBigInt: {
+            success = IntegerTryCastToFixlen::Run(value.GetValue<BigIntT>(), target);
+            break;
+        }
+        case LogicalType::kDouble: {
+            success = FloatTryCastToFixlen::Run(value.GetValue<DoubleT>(), target);
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+    if (success) {
+        result = make_value(target);
+    }
+    return success;
+}
+
+// The binder parses integer literals as BigInt and float literals as Double, and wraps them in a cast to the column type.
+// Such a literal is cast here with the same cast as the cast function; false leaves the cast, and its error, to the evaluator.
+bool CastNumericLiteral(BaseExpression &expr, Value &result) {
+    if (expr.type() != ExpressionType::kCast || expr.arguments()[0]->type() != ExpressionType::kValue) {
+        return false;
+    }
+    const Value &value = static_cast<const ValueExpression *>(expr.arguments()[0].get())->GetValue();
+    if (value.type() == expr.Type()) {
+        return false;
+    }
+    switch (expr.Type().type()) {
+        case LogicalType::kTinyInt: {
+            return CastLiteral<TinyIntT>(value, Value::MakeTinyInt, result);
+        }
+        case LogicalType::kSmallInt: {
+            return CastLiteral<SmallIntT>(value, Value::MakeSmallInt, result);
+        }
+        case LogicalType::kInteger: {
+            return CastLiteral<IntegerT>(value, Value::MakeInt, result);
+        }
+        case LogicalType::kBigInt: {
+            return CastLiteral<BigIntT>(value, Value::MakeBigInt, result);
+        }
+        case LogicalType::kFloat: {
+            return CastLiteral<FloatT>(value, Value::MakeFloat, result);
+        }
+        case LogicalType::kDouble: {
+            return CastLiteral<DoubleT>(value, Value::MakeDouble, result);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace
+
 void PhysicalInsert::Init() {}
 
 bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operator_state) {
@@ -63,19 +133,34 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
 
     SharedPtr<DataBlock> output_block = DataBlock::Make();
     output_block->Init(output_types);
-    SharedPtr<DataBlock> output_block_tmp = DataBlock::Make();
-    output_block_tmp->Init(output_types);
+    SharedPtr<DataBlock> output_block_tmp = nullptr;
 
     ExpressionEvaluator evaluator;
     evaluator.Init(nullptr);
-    // Each cell's expression of a column may differ. So we have to evaluate each cell instead of column here.
-    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
-        for (SizeT expr_idx = 0; expr_idx < column_count; ++expr_idx) {
+    // Fill the block column by column. Literals, which is what the clients send, are written straight into the column,
+    // numeric literals cast to the column type are cast here, other expressions are evaluated cell by cell since each
+    // cell's expression of a column may differ.
+    Value cast_value = Value::MakeNull();
+    for (SizeT expr_idx = 0; expr_idx < column_count; ++expr_idx) {
+        SharedPtr<ColumnVector> &column_vector = output_block->column_vectors[expr_idx];
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
             const SharedPtr<BaseExpression> &expr = value_list_[row_idx][expr_idx];
+            if (expr->type() == ExpressionType::kValue && expr->Type() == *column_vector->data_type()) {
+                static_cast<ValueExpression *>(expr.get())->AppendToChunk(column_vector);
+                continue;
+            }
+            if (expr->Type() == *column_vector->data_type() && CastNumericLiteral(*expr, cast_value)) {
+                column_vector->AppendValue(cast_value);
+                continue;
+            }
+            if (output_block_tmp.get() == nullptr) {
+                output_block_tmp = DataBlock::Make();
+                output_block_tmp->Init(output_types);
+            }
             SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
             evaluator.Execute(expr, expr_state, output_block_tmp->column_vectors[expr_idx]);
+            column_vector->AppendWith(*output_block_tmp->column_vectors[expr_idx]);
         }
-        output_block->AppendWith(output_block_tmp);
     }
     output_block->Finalize();
 
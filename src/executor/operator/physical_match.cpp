@@ -66,6 +66,7 @@ import analyzer_pool;
 import bitmask;
 import segment_entry;
 import knn_filter;
+import column_gatherer;
 
 namespace infinity {
 
@@ -357,7 +358,7 @@ bool PhysicalMatch::ExecuteInnerHomebrewed(QueryContext *query_context, Operator
     TimeDurationType output_info_duration = begin_output_time - finish_query_time;
     LOG_DEBUG(fmt::format("PhysicalMatch Part 4: Output stat info time: {} ms", output_info_duration.count()));
     // 4 populate result DataBlock
-    // 4.1 prepare first output_data_block
+    // 4.1 output data blocks hold at most DEFAULT_BLOCK_CAPACITY rows
     auto &output_data_blocks = operator_state->data_block_array_;
     auto OutputTypesPtr = GetOutputTypes();
     Vector<SharedPtr<DataType>> &OutputTypes = *OutputTypesPtr;
@@ -366,40 +367,31 @@ bool PhysicalMatch::ExecuteInnerHomebrewed(QueryContext *query_context, Operator
         data_block->Init(OutputTypes);
         output_data_blocks.emplace_back(std::move(data_block));
     };
-    append_data_block();
     // 4.2 output
     {
-        Vector<SizeT> &column_ids = base_table_ref_->column_ids_;
-        SizeT column_n = column_ids.size();
+        ColumnGatherer gatherer(base_table_ref_->block_index_.get(), query_context->storage()->buffer_manager(), base_table_ref_->column_ids_);
+        SizeT column_n = base_table_ref_->column_ids_.size();
         u32 block_capacity = DEFAULT_BLOCK_CAPACITY;
-        u32 output_block_row_id = 0;
-        DataBlock *output_block_ptr = output_data_blocks.back().get();
-        for (u32 output_id = 0; output_id < result_count; ++output_id) {
-            if (output_block_row_id == block_capacity) {
-                output_block_ptr->Finalize();
-                append_data_block();
-                output_block_ptr = output_data_blocks.back().get();
-                output_block_row_id = 0;
+        for (u32 output_begin = 0; output_begin < result_count; output_begin += block_capacity) {
+            u32 output_end = std::min(output_begin + block_capacity, result_count);
+            append_data_block();
+            DataBlock *output_block_ptr = output_data_blocks.back().get();
+            Vector<ColumnVector *> output_columns;
+            for (SizeT column_id = 0; column_id < column_n; ++column_id) {
+                output_columns.push_back(output_block_ptr->column_vectors[column_id].get());
             }
-            const RowID &row_id = row_id_result[output_id];
-            u32 segment_id = row_id.segment_id_;
-            u32 segment_offset = row_id.segment_offset_;
-            u16 block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
-            u16 block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
-            const BlockEntry *block_entry = base_table_ref_->block_index_->GetBlockEntry(segment_id, block_id);
-            assert(block_entry != nullptr);
-            SizeT column_id = 0;
-            for (; column_id < column_n; ++column_id) {
-                BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(column_ids[column_id]);
-                ColumnVector column_vector = block_column_ptr->GetConstColumnVector(query_context->storage()->buffer_manager());
-                output_block_ptr->column_vectors[column_id]->AppendWith(column_vector, block_offset, 1);
+            gatherer.Gather(row_id_result + output_begin, output_end - output_begin, output_columns);
+            for (u32 output_id = output_begin; output_id < output_end; ++output_id) {
+                Value v = Value::MakeFloat(score_result[output_id]);
+                output_block_ptr->column_vectors[column_n]->AppendValue(v);
+                output_block_ptr->column_vectors[column_n + 1]->AppendWith(row_id_result[output_id], 1);
             }
-            Value v = Value::MakeFloat(score_result[output_id]);
-            output_block_ptr->column_vectors[column_id++]->AppendValue(v);
-            output_block_ptr->column_vectors[column_id]->AppendWith(row_id, 1);
-            ++output_block_row_id;
+            output_block_ptr->Finalize();
+        }
+        if (output_data_blocks.empty()) {
+            append_data_block();
+            output_data_blocks.back()->Finalize();
         }
-        output_block_ptr->Finalize();
     }
 
     operator_state->SetComplete();
@@ -63,6 +63,8 @@ import block_entry;
 import segment_entry;
 import abstract_hnsw;
 import physical_match_tensor_scan;
+import simd_init;
+import simd_functions;
 
 namespace infinity {
 
@@ -315,6 +317,79 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataType(QueryContext *query_contex
     }
 }
 
+// The f16 / bf16 column data is compared with the f32 queries directly instead of being converted block by block
+template <typename ColumnDataType>
+HalfBatchDistanceFuncType GetHalfBatchDistanceFunc(KnnDistanceType distance_type) {
+    static_assert(IsAnyOf<ColumnDataType, Float16T, BFloat16T>);
+    constexpr bool is_bf16 = std::is_same_v<ColumnDataType, BFloat16T>;
+    const auto &simd_functions = GetSIMD_FUNCTIONS();
+    switch (distance_type) {
+        case KnnDistanceType::kL2: {
+            return is_bf16 ? simd_functions.BF16L2Batch_func_ptr_ : simd_functions.F16L2Batch_func_ptr_;
+        }
+        case KnnDistanceType::kInnerProduct: {
+            return is_bf16 ? simd_functions.BF16IPBatch_func_ptr_ : simd_functions.F16IPBatch_func_ptr_;
+        }
+        case KnnDistanceType::kCosine: {
+            return is_bf16 ? simd_functions.BF16CosBatch_func_ptr_ : simd_functions.F16CosBatch_func_ptr_;
+        }
+        default: {
+            Status status = Status::NotSupport(fmt::format("Not implemented KNN distance: {}", KnnExpression::KnnDistanceType2Str(distance_type)));
+            RecoverableError(std::move(status));
+        }
+    }
+    return nullptr;
+}
+
+String KnnFilterStrategyToString(KnnFilterStrategy strategy) {
+    switch (strategy) {
+        case KnnFilterStrategy::kTraverse: {
+            return "traverse";
+        }
+        case KnnFilterStrategy::kEnlargedEf: {
+            return "enlarged ef";
+        }
+        case KnnFilterStrategy::kTwoHop: {
+            return "two hop";
+        }
+        case KnnFilterStrategy::kBruteForce: {
+            return "brute force";
+        }
+    }
+    return "invalid";
+}
+
+KnnFilterStrategy ChooseKnnFilterStrategy(SizeT passed_row_count, SizeT row_count) {
+    if (passed_row_count >= row_count) {
+        return KnnFilterStrategy::kTraverse;
+    }
+    if (passed_row_count <= HNSW_FILTER_BRUTE_FORCE_ROWS) {
+        // computing the distances of a few rows is cheaper than walking the graph around them
+        return KnnFilterStrategy::kBruteForce;
+    }
+    f64 selectivity = static_cast<f64>(passed_row_count) / row_count;
+    if (selectivity < HNSW_FILTER_TWO_HOP_SELECTIVITY) {
+        // the passing vertices are too sparse to stay connected through the passing neighbors only
+        return KnnFilterStrategy::kTwoHop;
+    }
+    return KnnFilterStrategy::kEnlargedEf;
+}
+
+Map<SegmentID, KnnFilterDecision> PhysicalKnnScan::FilterDecisions() const {
+    std::unique_lock lock(filter_decision_mutex_);
+    return filter_decisions_;
+}
+
+void PhysicalKnnScan::ClearFilterDecisions() {
+    std::unique_lock lock(filter_decision_mutex_);
+    filter_decisions_.clear();
+}
+
+void PhysicalKnnScan::AddFilterDecision(SegmentID segment_id, const KnnFilterDecision &decision) {
+    std::unique_lock lock(filter_decision_mutex_);
+    filter_decisions_[segment_id] = decision;
+}
+
 TableEntry *PhysicalKnnScan::table_collection_ptr() const { return base_table_ref_->table_entry_ptr_; }
 
 String PhysicalKnnScan::TableAlias() const { return base_table_ref_->alias_; }
@@ -475,6 +550,10 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
         // brute force
         // TODO: now will try to finish all block scan job in the task
         UniquePtr<QueryDataType[]> buffer_ptr_for_cast;
+        [[maybe_unused]] HalfBatchDistanceFuncType half_dist_func = nullptr;
+        if constexpr (IsAnyOf<ColumnDataType, Float16T, BFloat16T>) {
+            half_dist_func = GetHalfBatchDistanceFunc<ColumnDataType>(knn_scan_shared_data->knn_distance_type_);
+        }
         do {
             BlockColumnEntry *block_column_entry = knn_scan_shared_data->block_column_entries_->at(block_column_idx);
             const BlockEntry *block_entry = block_column_entry->block_entry();
@@ -492,6 +571,9 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                 auto data = reinterpret_cast<const ColumnDataType *>(column_vector.data());
                 if constexpr (std::is_same_v<ColumnDataType, QueryDataType>) {
                     merge_heap->Search(knn_query_ptr, data, embedding_dim, dist_func->dist_func_, row_count, segment_id, block_id, bitmask);
+                } else if constexpr (IsAnyOf<ColumnDataType, Float16T, BFloat16T>) {
+                    const auto *half_data = reinterpret_cast<const u16 *>(data);
+                    merge_heap->SearchBatch(knn_query_ptr, half_data, embedding_dim, half_dist_func, row_count, segment_id, block_id, bitmask);
                 } else {
                     if (!buffer_ptr_for_cast) {
                         buffer_ptr_for_cast = MakeUniqueForOverwrite<QueryDataType[]>(DEFAULT_BLOCK_CAPACITY * embedding_dim);
@@ -615,6 +697,17 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                         String error_message = "Invalid data type";
                         UnrecoverableError(error_message);
                     } else {
+                        KnnFilterStrategy filter_strategy = KnnFilterStrategy::kTraverse;
+                        SizeT passed_row_count = segment_entry->row_count();
+                        SizeT segment_row_count = segment_entry->row_count();
+                        if (!common_query_filter_->AlwaysTrue()) {
+                            passed_row_count = common_query_filter_->filter_result_row_count_.at(segment_id);
+                            if (use_bitmask) {
+                                filter_strategy = ChooseKnnFilterStrategy(passed_row_count, segment_row_count);
+                            }
+                            AddFilterDecision(segment_id, KnnFilterDecision{filter_strategy, passed_row_count, segment_row_count});
+                        }
+
                         auto hnsw_search = [&](auto *hnsw_index, bool with_lock) {
                             bool rerank = false;
                             for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
@@ -625,6 +718,19 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                     rerank = true;
                                 }
                             }
+                            SizeT search_k = knn_scan_shared_data->topk_;
+                            using HnswIndex = std::remove_pointer_t<decltype(hnsw_index)>;
+                            if constexpr (HnswIndex::NeedRerank) {
+                                // the distances of the quantized index are approximate, rerank more candidates with the column data
+                                rerank = true;
+                                search_k *= HnswIndex::RerankFactor;
+                            }
+                            if (filter_strategy == KnnFilterStrategy::kEnlargedEf) {
+                                // only `passed_row_count / segment_row_count` of the vertices visited are kept, search more of them
+                                SizeT ef = std::max(hnsw_index->GetEf(), search_k);
+                                SizeT enlarged_ef = ef * segment_row_count / std::max(passed_row_count, SizeT(1));
+                                search_k = std::max(search_k, std::min(enlarged_ef, HNSW_FILTER_MAX_EF));
+                            }
 
                             i64 result_n = -1;
                             for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
@@ -634,27 +740,40 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                 SizeT result_n1 = 0;
                                 UniquePtr<DistanceDataType[]> d_ptr = nullptr;
                                 UniquePtr<SegmentOffset[]> l_ptr = nullptr;
-                                if (use_bitmask) {
+                                if (use_bitmask && filter_strategy == KnnFilterStrategy::kTwoHop) {
+                                    BitmaskFilter<SegmentOffset> filter(bitmask);
+                                    if (with_lock) {
+                                        std::tie(result_n1, d_ptr, l_ptr) =
+                                            hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, true, true>(query,
+                                                                                                                     search_k,
+                                                                                                                     filter);
+                                    } else {
+                                        std::tie(result_n1, d_ptr, l_ptr) =
+                                            hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, false, true>(query,
+                                                                                                                      search_k,
+                                                                                                                      filter);
+                                    }
+                                } else if (use_bitmask) {
                                     BitmaskFilter<SegmentOffset> filter(bitmask);
                                     if (with_lock) {
                                         std::tie(result_n1, d_ptr, l_ptr) =
                                             hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, true>(query,
-                                                                                                               knn_scan_shared_data->topk_,
+                                                                                                               search_k,
                                                                                                                filter);
                                     } else {
                                         std::tie(result_n1, d_ptr, l_ptr) =
                                             hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, false>(query,
-                                                                                                                knn_scan_shared_data->topk_,
+                                                                                                                search_k,
                                                                                                                 filter);
                                     }
                                 } else {
                                     SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
                                     if (!with_lock) {
-                                        std::tie(result_n1, d_ptr, l_ptr) = hnsw_index->template KnnSearch<false>(query, knn_scan_shared_data->topk_);
+                                        std::tie(result_n1, d_ptr, l_ptr) = hnsw_index->template KnnSearch<false>(query, search_k);
                                     } else {
                                         AppendFilter filter(max_segment_offset);
                                         std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_index->template KnnSearch<AppendFilter, true>(query, knn_scan_shared_data->topk_, filter);
+                                            hnsw_index->template KnnSearch<AppendFilter, true>(query, search_k, filter);
                                     }
                                 }
 
@@ -736,17 +855,43 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                 abstract_hnsw);
                         };
 
-                        auto [chunk_index_entries, memory_hnsw_index] = segment_index_entry->GetHnswIndexSnapshot();
-                        for (auto &chunk_index_entry : chunk_index_entries) {
-                            if (chunk_index_entry->CheckVisible(txn)) {
-                                BufferHandle index_handle = chunk_index_entry->GetIndex();
-                                const auto *abstract_hnsw = reinterpret_cast<const AbstractHnsw *>(index_handle.GetData());
-                                abstract_hnsw_search(*abstract_hnsw, false);
+                        auto brute_force_search = [&] {
+                            // the rows passing the filter are read from the column instead of the index, which covers all the queries
+                            BlockID prev_block_id = -1;
+                            ColumnVector column_vector;
+                            for (SegmentOffset segment_offset = 0; segment_offset < segment_row_count; ++segment_offset) {
+                                if (!bitmask.IsTrue(segment_offset)) {
+                                    continue;
+                                }
+                                BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
+                                BlockOffset block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
+                                if (block_id != prev_block_id) {
+                                    prev_block_id = block_id;
+                                    BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
+                                    BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(knn_column_id);
+                                    column_vector = block_column_entry->GetConstColumnVector(buffer_mgr);
+                                }
+                                const auto *data = reinterpret_cast<const ColumnDataType *>(column_vector.data());
+                                data += block_offset * embedding_dim;
+                                merge_heap->Search(knn_query_ptr, data, embedding_dim, dist_func->dist_func_, segment_id, segment_offset);
+                            }
+                        };
+
+                        if (filter_strategy == KnnFilterStrategy::kBruteForce) {
+                            brute_force_search();
+                        } else {
+                            auto [chunk_index_entries, memory_hnsw_index] = segment_index_entry->GetHnswIndexSnapshot();
+                            for (auto &chunk_index_entry : chunk_index_entries) {
+                                if (chunk_index_entry->CheckVisible(txn)) {
+                                    BufferHandle index_handle = chunk_index_entry->GetIndex();
+                                    const auto *abstract_hnsw = reinterpret_cast<const AbstractHnsw *>(index_handle.GetData());
+                                    abstract_hnsw_search(*abstract_hnsw, false);
+                                }
+                            }
+                            if (memory_hnsw_index.get() != nullptr) {
+                                const AbstractHnsw &abstract_hnsw = memory_hnsw_index->get();
+                                abstract_hnsw_search(abstract_hnsw, true);
                             }
-                        }
-                        if (memory_hnsw_index.get() != nullptr) {
-                            const AbstractHnsw &abstract_hnsw = memory_hnsw_index->get();
-                            abstract_hnsw_search(abstract_hnsw, true);
                         }
                     }
                     break;
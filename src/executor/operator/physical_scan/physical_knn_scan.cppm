@@ -33,6 +33,24 @@ import physical_filter_scan_base;
 
 namespace infinity {
 
+// How the hnsw index of a segment is searched under a filter, chosen by the number of the rows passing the filter
+export enum class KnnFilterStrategy : i8 {
+    kTraverse,   // no row is filtered out
+    kEnlargedEf, // traverse the graph with the ef enlarged by the selectivity
+    kTwoHop,     // traverse the graph, expanding the neighbors of the filtered out vertices to keep the passing ones connected
+    kBruteForce, // skip the graph, compute the distances of all the passing rows
+};
+
+export String KnnFilterStrategyToString(KnnFilterStrategy strategy);
+
+export KnnFilterStrategy ChooseKnnFilterStrategy(SizeT passed_row_count, SizeT row_count);
+
+export struct KnnFilterDecision {
+    KnnFilterStrategy strategy_{KnnFilterStrategy::kTraverse};
+    SizeT passed_row_count_{};
+    SizeT row_count_{};
+};
+
 export class PhysicalKnnScan final : public PhysicalFilterScanBase {
 public:
     explicit PhysicalKnnScan(u64 id,
@@ -77,9 +95,17 @@ public:
 
     inline bool IsKnnMinHeap() const { return knn_expression_->IsKnnMinHeap(); }
 
+    // The filter strategies of the segments chosen by the last execution, empty before the operator is executed
+    Map<SegmentID, KnnFilterDecision> FilterDecisions() const;
+
+    // Called when an execution of the operator is set up, so that the decisions of a previous execution are not reported
+    void ClearFilterDecisions();
+
 private:
     SizeT GetColumnID() const;
 
+    void AddFilterDecision(SegmentID segment_id, const KnnFilterDecision &decision);
+
 public:
     SharedPtr<KnnExpression> knn_expression_{};
     SharedPtr<void> real_knn_query_embedding_holder_{};
@@ -92,11 +118,15 @@ public:
     u64 knn_table_index_{};
 
     Vector<Pair<u32, u32>> block_parallel_options_;
-    u32 block_column_entries_size_ = 0; // need this value because block_column_entries_ will be moved into KnnScanSharedData
+    u32 block_column_entries_size_ = 0; // block_column_entries_ is copied into KnnScanSharedData for each execution
     u32 index_entries_size_ = 0;
     UniquePtr<Vector<BlockColumnEntry *>> block_column_entries_{};
     UniquePtr<Vector<SegmentIndexEntry *>> index_entries_{};
 
+private:
+    mutable std::mutex filter_decision_mutex_{};
+    Map<SegmentID, KnnFilterDecision> filter_decisions_{};
+
 private:
     void InitBlockParallelOption();
 
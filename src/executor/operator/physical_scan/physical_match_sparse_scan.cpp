@@ -61,6 +61,7 @@ import bmp_util;
 import knn_filter;
 import segment_entry;
 import abstract_bmp;
+import infinity_context;
 
 namespace infinity {
 
@@ -465,8 +466,15 @@ void PhysicalMatchSparseScan::ExecuteInnerT(DistFunc *dist_func,
         if (!has_some_result)
             break;
 
-        auto bmp_search = [&](AbstractBMP index, SizeT query_id, bool with_lock, const auto &filter) {
-            auto query = get_ele(query_vector, query_id);
+        Vector<SparseVecRef<typename DistFunc::DataT, typename DistFunc::IndexT>> queries;
+        queries.reserve(query_n);
+        for (SizeT query_id = 0; query_id < query_n; ++query_id) {
+            queries.push_back(get_ele(query_vector, query_id));
+        }
+        BmpSearchOptions options = BMPUtil::ParseBmpSearchOptions(match_sparse_expr_->opt_params_);
+        options.thread_pool_ = &InfinityContext::instance().GetSparseSearchThreadPool();
+
+        auto bmp_search = [&](AbstractBMP index, bool with_lock, const auto &filter) {
             std::visit(
                 [&](auto &&index) {
                     using T = std::decay_t<decltype(index)>;
@@ -476,14 +484,16 @@ void PhysicalMatchSparseScan::ExecuteInnerT(DistFunc *dist_func,
                         using IndexT = std::decay_t<decltype(*index)>;
                         if constexpr (std::is_same_v<typename IndexT::DataT, typename DistFunc::DataT> &&
                                       std::is_same_v<typename IndexT::IdxT, typename DistFunc::IndexT>) {
-                            BmpSearchOptions options = BMPUtil::ParseBmpSearchOptions(match_sparse_expr_->opt_params_);
                             options.use_lock_ = with_lock;
-                            auto [doc_ids, scores] = index->SearchKnn(query, topn, options, filter);
-                            SizeT res_n = doc_ids.size();
-                            for (SizeT i = 0; i < res_n; ++i) {
-                                RowID row_id(segment_id, doc_ids[i]);
-                                ResultType d = scores[i];
-                                merge_heap->Search(query_id, &d, &row_id, 1);
+                            auto results = index->SearchKnnBatch(queries, topn, options, filter);
+                            for (SizeT query_id = 0; query_id < query_n; ++query_id) {
+                                const auto &[doc_ids, scores] = results[query_id];
+                                SizeT res_n = doc_ids.size();
+                                for (SizeT i = 0; i < res_n; ++i) {
+                                    RowID row_id(segment_id, doc_ids[i]);
+                                    ResultType d = scores[i];
+                                    merge_heap->Search(query_id, &d, &row_id, 1);
+                                }
                             }
                         } else {
                             UnrecoverableError("Invalid index type.");
@@ -495,15 +505,13 @@ void PhysicalMatchSparseScan::ExecuteInnerT(DistFunc *dist_func,
 
         auto bmp_scan = [&](const auto &filter) {
             const auto [chunk_index_entries, memory_index_entry] = segment_index_entry->GetBMPIndexSnapshot();
-            for (SizeT query_id = 0; query_id < query_n; ++query_id) {
-                for (auto chunk_index_entry : chunk_index_entries) {
-                    BufferHandle buffer_handle = chunk_index_entry->GetIndex();
-                    const auto *bmp_index = reinterpret_cast<const AbstractBMP *>(buffer_handle.GetData());
-                    bmp_search(*bmp_index, query_id, false, filter);
-                }
-                if (memory_index_entry.get() != nullptr) {
-                    bmp_search(memory_index_entry->get(), query_id, true, filter);
-                }
+            for (auto chunk_index_entry : chunk_index_entries) {
+                BufferHandle buffer_handle = chunk_index_entry->GetIndex();
+                const auto *bmp_index = reinterpret_cast<const AbstractBMP *>(buffer_handle.GetData());
+                bmp_search(*bmp_index, false, filter);
+            }
+            if (memory_index_entry.get() != nullptr) {
+                bmp_search(memory_index_entry->get(), true, filter);
             }
         };
 
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <bit>
 #include <cstdlib>
 #include <memory>
@@ -449,7 +450,6 @@ struct MaxSimOp {
 };
 
 // TensorElemT: bit, QueryElemT: bit (unaligned)
-// TODO: hamming distance?
 template <>
 struct MaxSimOp<bool, bool> {
     static float Score(const char *raw_query_tensor_ptr,
@@ -457,46 +457,17 @@ struct MaxSimOp<bool, bool> {
                        const u32 query_embedding_num,
                        const u32 target_embedding_num,
                        const u32 basic_embedding_dimension) {
-        const auto unit_embedding_bytes = basic_embedding_dimension / 8;
-        if (unit_embedding_bytes % 4 == 0) {
-            if (reinterpret_cast<uintptr_t>(raw_query_tensor_ptr) % alignof(u32) == 0 &&
-                reinterpret_cast<uintptr_t>(raw_target_tensor_ptr) % alignof(u32) == 0) {
-                const auto u32_cnt = unit_embedding_bytes / 4;
-                const auto query_tensor_u32_ptr = reinterpret_cast<const u32 *>(raw_query_tensor_ptr);
-                const auto target_tensor_u32_ptr = reinterpret_cast<const u32 *>(raw_target_tensor_ptr);
-                u32 maxsim_score = 0;
-                for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-                    const auto query_ptr = query_tensor_u32_ptr + query_i * u32_cnt;
-                    auto min_score_i = std::numeric_limits<u32>::max();
-                    for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
-                        const auto target_ptr = target_tensor_u32_ptr + target_j * u32_cnt;
-                        u32 score_ij = 0;
-                        for (u32 k = 0; k < u32_cnt; ++k) {
-                            score_ij += std::popcount(query_ptr[k] ^ target_ptr[k]);
-                        }
-                        min_score_i = std::min(min_score_i, score_ij);
-                    }
-                    maxsim_score += min_score_i;
-                }
-                // hamming distance, higher score means more different
-                return -static_cast<float>(maxsim_score);
-            }
-            // memory allocated by new char[] should be aligned to any basic type
-            LOG_ERROR("MaxSimOp<bool, bool> Score: input tensor is not aligned to int");
-        }
+        const auto hamming_func_ptr = GetSIMD_FUNCTIONS().MaxSimBitHamming_func_ptr_;
         const auto query_tensor_ptr = reinterpret_cast<const u8 *>(raw_query_tensor_ptr);
         const auto target_tensor_ptr = reinterpret_cast<const u8 *>(raw_target_tensor_ptr);
+        const auto unit_embedding_bytes = basic_embedding_dimension / 8;
         u32 maxsim_score = 0;
         for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
             const auto query_ptr = query_tensor_ptr + query_i * unit_embedding_bytes;
             auto min_score_i = std::numeric_limits<u32>::max();
             for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
                 const auto target_ptr = target_tensor_ptr + target_j * unit_embedding_bytes;
-                u32 score_ij = 0;
-                for (u32 k = 0; k < unit_embedding_bytes; ++k) {
-                    score_ij += std::popcount(static_cast<u32>(query_ptr[k] ^ target_ptr[k]));
-                }
-                min_score_i = std::min(min_score_i, score_ij);
+                min_score_i = std::min(min_score_i, hamming_func_ptr(query_ptr, target_ptr, unit_embedding_bytes));
             }
             maxsim_score += min_score_i;
         }
@@ -700,6 +671,60 @@ struct MaxSimOp<TensorElemT, float> {
     }
 };
 
+// 1-bit quantization of the embeddings by the sign of the elements
+template <typename ElemT>
+void QuantizeEmbeddingsToBits(const ElemT *src, u8 *dest, const u32 embedding_num, const u32 basic_embedding_dimension) {
+    const auto unit_embedding_bytes = (basic_embedding_dimension + 7) / 8;
+    if constexpr (std::is_same_v<ElemT, f32>) {
+        const auto f32_to_bits_func_ptr = GetSIMD_FUNCTIONS().MaxSimF32ToBits_func_ptr_;
+        for (u32 i = 0; i < embedding_num; ++i) {
+            f32_to_bits_func_ptr(src + i * basic_embedding_dimension, dest + i * unit_embedding_bytes, basic_embedding_dimension);
+        }
+    } else {
+        std::fill(dest, dest + embedding_num * unit_embedding_bytes, 0);
+        for (u32 i = 0; i < embedding_num; ++i) {
+            for (u32 j = 0; j < basic_embedding_dimension; ++j) {
+                if (static_cast<float>(src[i * basic_embedding_dimension + j]) > 0.0f) {
+                    dest[i * unit_embedding_bytes + j / 8] |= static_cast<u8>(1u << (j % 8));
+                }
+            }
+        }
+    }
+}
+
+// TensorElemT: f32, f64, f16, bf16, QueryElemT: the query embeddings quantized by QuantizeEmbeddingsToBits (unaligned).
+// The target embeddings are quantized in the same way, and scored by the hamming distance like MaxSimOp<bool, bool>.
+// The 1-bit form is not stored: the full precision tensor is read and quantized for each query, so this only saves
+// the float MaxSim computation, not the reads of the tensors.
+template <typename TensorElemT>
+struct BinaryMaxSimOp {
+    static float Score(const char *raw_query_bits_ptr,
+                       const char *raw_target_tensor_ptr,
+                       const u32 query_embedding_num,
+                       const u32 target_embedding_num,
+                       const u32 basic_embedding_dimension) {
+        const auto hamming_func_ptr = GetSIMD_FUNCTIONS().MaxSimBitHamming_func_ptr_;
+        const auto unit_embedding_bytes = (basic_embedding_dimension + 7) / 8;
+        auto target_bits = MakeUniqueForOverwrite<u8[]>(unit_embedding_bytes * target_embedding_num);
+        QuantizeEmbeddingsToBits(reinterpret_cast<const TensorElemT *>(raw_target_tensor_ptr),
+                                 target_bits.get(),
+                                 target_embedding_num,
+                                 basic_embedding_dimension);
+        const auto query_bits_ptr = reinterpret_cast<const u8 *>(raw_query_bits_ptr);
+        u32 maxsim_score = 0;
+        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
+            const auto query_ptr = query_bits_ptr + query_i * unit_embedding_bytes;
+            auto min_score_i = std::numeric_limits<u32>::max();
+            for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
+                const auto target_ptr = target_bits.get() + target_j * unit_embedding_bytes;
+                min_score_i = std::min(min_score_i, hamming_func_ptr(query_ptr, target_ptr, unit_embedding_bytes));
+            }
+            maxsim_score += min_score_i;
+        }
+        return -static_cast<float>(maxsim_score);
+    }
+};
+
 template <typename Op>
 struct CalcutateScoreOfTensorRow {
     static float Execute(ColumnVector &column_vector,
@@ -901,14 +926,16 @@ struct RerankerParameterPack {
     const ColumnID column_id_;
     const BlockIndex *block_index_;
     const MatchTensorExpression &match_tensor_expr_;
+    const u32 binary_candidate_n_;
     RerankerParameterPack(Vector<MatchTensorRerankDoc> &rerank_docs,
                           BufferManager *buffer_mgr,
                           const DataType *column_data_type,
                           const ColumnID column_id,
                           const BlockIndex *block_index,
-                          const MatchTensorExpression &match_tensor_expr)
+                          const MatchTensorExpression &match_tensor_expr,
+                          const u32 binary_candidate_n)
         : rerank_docs_(rerank_docs), buffer_mgr_(buffer_mgr), column_data_type_(column_data_type), column_id_(column_id), block_index_(block_index),
-          match_tensor_expr_(match_tensor_expr) {}
+          match_tensor_expr_(match_tensor_expr), binary_candidate_n_(binary_candidate_n) {}
 };
 
 template <typename CalcutateScoreOfRowOp>
@@ -919,19 +946,55 @@ void GetRerankerScore(Vector<MatchTensorRerankDoc> &rerank_docs,
                       const char *query_tensor_ptr,
                       const u32 query_embedding_num,
                       const u32 basic_embedding_dimension) {
-    for (auto &doc : rerank_docs) {
-        const RowID row_id = doc.row_id_;
+    // the docs are sorted by row id, the column vector of a block is fetched once for all its docs
+    for (SizeT doc_i = 0; doc_i < rerank_docs.size();) {
+        const RowID row_id = rerank_docs[doc_i].row_id_;
         const SegmentID segment_id = row_id.segment_id_;
-        const SegmentOffset segment_offset = row_id.segment_offset_;
-        const BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
-        const BlockOffset block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
+        const BlockID block_id = row_id.segment_offset_ / DEFAULT_BLOCK_CAPACITY;
         BlockColumnEntry *block_column_entry =
             block_index->segment_block_index_.at(segment_id).block_map_.at(block_id)->GetColumnBlockEntry(column_id);
         auto column_vec = block_column_entry->GetConstColumnVector(buffer_mgr);
-        doc.score_ = CalcutateScoreOfRowOp::Execute(column_vec, block_offset, query_tensor_ptr, query_embedding_num, basic_embedding_dimension);
+        for (; doc_i < rerank_docs.size(); ++doc_i) {
+            auto &doc = rerank_docs[doc_i];
+            if (doc.row_id_.segment_id_ != segment_id || doc.row_id_.segment_offset_ / DEFAULT_BLOCK_CAPACITY != block_id) {
+                break;
+            }
+            const BlockOffset block_offset = doc.row_id_.segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+            doc.score_ = CalcutateScoreOfRowOp::Execute(column_vec, block_offset, query_tensor_ptr, query_embedding_num, basic_embedding_dimension);
+        }
     }
 }
 
+// The first stage of the binary-then-float rerank: all the docs are scored with the 1-bit quantized embeddings,
+// only the best `binary_candidate_n_` of them are kept to be scored with the full precision embeddings.
+// Every candidate is still read at full precision, see BinaryMaxSimOp.
+template <typename CalcutateScoreOfRowOp>
+void BinaryRerankFirstStage(RerankerParameterPack &parameter_pack,
+                            const f32 *query_tensor_ptr,
+                            const u32 query_embedding_num,
+                            const u32 basic_embedding_dimension) {
+    const auto unit_embedding_bytes = (basic_embedding_dimension + 7) / 8;
+    auto query_bits = MakeUniqueForOverwrite<u8[]>(unit_embedding_bytes * query_embedding_num);
+    QuantizeEmbeddingsToBits(query_tensor_ptr, query_bits.get(), query_embedding_num, basic_embedding_dimension);
+    auto &rerank_docs = parameter_pack.rerank_docs_;
+    GetRerankerScore<CalcutateScoreOfRowOp>(rerank_docs,
+                                            parameter_pack.buffer_mgr_,
+                                            parameter_pack.column_id_,
+                                            parameter_pack.block_index_,
+                                            reinterpret_cast<const char *>(query_bits.get()),
+                                            query_embedding_num,
+                                            basic_embedding_dimension);
+    const auto keep_end = rerank_docs.begin() + parameter_pack.binary_candidate_n_;
+    std::nth_element(rerank_docs.begin(), keep_end, rerank_docs.end(), [](const MatchTensorRerankDoc &lhs, const MatchTensorRerankDoc &rhs) noexcept {
+        return lhs.score_ > rhs.score_;
+    });
+    rerank_docs.erase(keep_end, rerank_docs.end());
+    // access blocks in order in the second stage
+    std::sort(rerank_docs.begin(), rerank_docs.end(), [](const MatchTensorRerankDoc &lhs, const MatchTensorRerankDoc &rhs) noexcept {
+        return lhs.row_id_ < rhs.row_id_;
+    });
+}
+
 template <template <typename> typename CalcutateScoreOfRow, typename ColumnElemT, typename QueryElemT>
 void RerankerScoreT(RerankerParameterPack &parameter_pack) {
     const char *query_tensor_ptr = parameter_pack.match_tensor_expr_.query_embedding_.ptr;
@@ -939,6 +1002,14 @@ void RerankerScoreT(RerankerParameterPack &parameter_pack) {
     const u32 basic_embedding_dimension = parameter_pack.match_tensor_expr_.tensor_basic_embedding_dimension_;
     switch (parameter_pack.match_tensor_expr_.search_method_) {
         case MatchTensorSearchMethod::kMaxSim: {
+            if constexpr (IsAnyOf<ColumnElemT, f32, f64, Float16T, BFloat16T> && std::is_same_v<QueryElemT, f32>) {
+                if (parameter_pack.binary_candidate_n_ > 0 && parameter_pack.rerank_docs_.size() > parameter_pack.binary_candidate_n_) {
+                    BinaryRerankFirstStage<CalcutateScoreOfRow<BinaryMaxSimOp<ColumnElemT>>>(parameter_pack,
+                                                                                             reinterpret_cast<const f32 *>(query_tensor_ptr),
+                                                                                             query_embedding_num,
+                                                                                             basic_embedding_dimension);
+                }
+            }
             return GetRerankerScore<CalcutateScoreOfRow<MaxSimOp<ColumnElemT, QueryElemT>>>(parameter_pack.rerank_docs_,
                                                                                             parameter_pack.buffer_mgr_,
                                                                                             parameter_pack.column_id_,
@@ -978,11 +1049,12 @@ void CalculateFusionMatchTensorRerankerScores(Vector<MatchTensorRerankDoc> &rera
                                               const DataType *column_data_type,
                                               const ColumnID column_id,
                                               const BlockIndex *block_index,
-                                              MatchTensorExpression &src_match_tensor_expr) {
+                                              MatchTensorExpression &src_match_tensor_expr,
+                                              const u32 binary_candidate_n) {
     const auto column_elem_type = static_cast<const EmbeddingInfo *>(column_data_type->type_info().get())->Type();
     const auto [new_search_ptr, new_search_expr] = GetMatchTensorExprForCalculation(src_match_tensor_expr, column_elem_type);
     const auto *match_tensor_expr_ptr = new_search_expr ? new_search_expr.get() : &src_match_tensor_expr;
-    RerankerParameterPack parameter_pack(rerank_docs, buffer_mgr, column_data_type, column_id, block_index, *match_tensor_expr_ptr);
+    RerankerParameterPack parameter_pack(rerank_docs, buffer_mgr, column_data_type, column_id, block_index, *match_tensor_expr_ptr, binary_candidate_n);
     const auto query_elem_type = parameter_pack.match_tensor_expr_.embedding_data_type_;
     ElemTypeDispatch<ExecuteMatchTensorRerankerTypes, TypeList<>>(parameter_pack, column_elem_type, query_elem_type);
 }
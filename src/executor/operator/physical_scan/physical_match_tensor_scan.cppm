@@ -106,12 +106,14 @@ private:
 
 struct MatchTensorRerankDoc;
 class BufferManager;
+// binary_candidate_n: the docs kept by the first stage of the binary-then-float rerank, 0 to score all the docs in full precision
 export void CalculateFusionMatchTensorRerankerScores(Vector<MatchTensorRerankDoc> &rerank_docs,
                                                      BufferManager *buffer_mgr,
                                                      const DataType *column_data_type,
                                                      ColumnID column_id,
                                                      const BlockIndex *block_index,
-                                                     MatchTensorExpression &src_match_tensor_expr);
+                                                     MatchTensorExpression &src_match_tensor_expr,
+                                                     u32 binary_candidate_n);
 
 // u8, i8, i16, i32 -> i32
 // i64 -> i64
@@ -109,6 +109,11 @@ bool QueueSourceState::GetData() {
         case PhysicalOperatorType::kFusion: {
             auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
             FusionOperatorState *fusion_op_state = (FusionOperatorState *)next_op_state;
+            if (fusion_op_state->input_child_idx_.empty()) {
+                for (u64 fragment_id : child_fragment_ids_) {
+                    fusion_op_state->input_child_idx_.emplace(fragment_id, fusion_op_state->input_child_idx_.size());
+                }
+            }
             fusion_op_state->input_data_blocks_[fragment_data->fragment_id_].push_back(std::move(fragment_data->data_block_));
             fusion_op_state->input_complete_ = completed;
             break;
@@ -58,6 +58,9 @@ export struct OperatorState {
     Status status_{};
     bool empty_source_{false};
 
+    // Entries of the hash table built by the operator, reported by the profiler
+    SizeT hash_table_size_{0};
+
     bool complete_{false};
 
     inline void SetComplete() { complete_ = true; }
@@ -388,6 +391,20 @@ export struct MatchOperatorState : public OperatorState {
 };
 
 // Fusion
+// A row of the inputs of rrf and weighted_sum fusion
+export struct FusionDocScore {
+    RowID row_id_;
+    u64 from_input_data_block_id_;
+    u32 from_block_idx_;
+    u32 from_row_idx_;
+    // the first child the row is merged from and its rank there, to order the rows of the same fusion score
+    SizeT first_child_idx_;
+    SizeT first_rank_;
+    float fusion_score_;
+    Vector<float> child_scores_;
+    Vector<bool> mask_;
+};
+
 export struct FusionOperatorState : public OperatorState {
     inline explicit FusionOperatorState() : OperatorState(PhysicalOperatorType::kFusion) {}
 
@@ -396,6 +413,14 @@ export struct FusionOperatorState : public OperatorState {
     bool input_complete_{false};
     // This is to cache all input data before calculation.
     Map<u64, Vector<UniquePtr<DataBlock>>> input_data_blocks_{};
+    // fragment_id -> index of the child operator
+    Map<u64, SizeT> input_child_idx_{};
+
+    // rrf and weighted_sum merge the input blocks as they arrive
+    Map<u64, SizeT> merged_block_n_{}; // fragment_id -> number of the merged input blocks
+    Map<u64, SizeT> merged_row_n_{};   // fragment_id -> number of the merged input rows
+    Vector<FusionDocScore> rescore_vec_{};
+    HashMap<u64, SizeT> rescore_map_{}; // row_id to index of rescore_vec_
 };
 
 // Compact
@@ -470,7 +495,10 @@ export struct SourceState {
 export struct QueueSourceState : public SourceState {
     inline explicit QueueSourceState() : SourceState(SourceStateType::kQueue) {}
 
-    inline void SetTaskNum(u64 fragment_id, u64 num_tasks) { num_tasks_[fragment_id] = num_tasks; }
+    inline void SetTaskNum(u64 fragment_id, u64 num_tasks) {
+        num_tasks_[fragment_id] = num_tasks;
+        child_fragment_ids_.insert(fragment_id);
+    }
 
     bool GetData();
 
@@ -478,6 +506,8 @@ export struct QueueSourceState : public SourceState {
 
     Map<u64, u64> num_tasks_; // fragment_id -> number of pending tasks
 
+    Set<u64> child_fragment_ids_; // fragment_id of all the child fragments, ascending in the order of the children of the operator
+
 private:
     void MarkCompletedTask(u64 fragment_id);
 };
@@ -29,6 +29,7 @@ import third_party;
 import infinity_exception;
 import block_entry;
 import block_column_entry;
+import column_gatherer;
 import logical_type;
 import internal_types;
 
@@ -71,23 +72,16 @@ void PhysicalOperator::InputLoad(QueryContext *query_context, OperatorState *ope
 
         auto row_column_id = input_block->column_count() - 1;
 
-        for (SizeT j = 0; j < row_count; ++j) {
-            // If late materialization needs to be optional, then this needs to be modified
-            RowID row_id = input_block->GetValue(row_column_id, j).value_.row;
-            u32 segment_id = row_id.segment_id_;
-            u32 segment_offset = row_id.segment_offset_;
-            u16 block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
-            u16 block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
-
-            const BlockEntry *block_entry = table_ref->block_index_->GetBlockEntry(segment_id, block_id);
-            for (SizeT k = 0; k < load_column_count; ++k) {
-                auto binding = load_metas[k].binding_;
-                BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(binding.column_idx);
-
-                ColumnVector column_vector = block_column_ptr->GetConstColumnVector(query_context->storage()->buffer_manager());
-                input_block->column_vectors[load_metas[k].index_]->AppendWith(column_vector, block_offset, 1);
-            }
+        // If late materialization needs to be optional, then this needs to be modified
+        const auto *row_ids = reinterpret_cast<const RowID *>(input_block->column_vectors[row_column_id]->data());
+        Vector<SizeT> column_ids;
+        Vector<ColumnVector *> output_columns;
+        for (SizeT k = 0; k < load_column_count; ++k) {
+            column_ids.push_back(load_metas[k].binding_.column_idx);
+            output_columns.push_back(input_block->column_vectors[load_metas[k].index_].get());
         }
+        ColumnGatherer gatherer(table_ref->block_index_.get(), query_context->storage()->buffer_manager(), std::move(column_ids));
+        gatherer.Gather(row_ids, row_count, output_columns);
     }
 }
 
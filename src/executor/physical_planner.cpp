@@ -549,6 +549,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildImport(const SharedPtr<Logical
                                       logical_import->header(),
                                       logical_import->delimiter(),
                                       logical_import->FileType(),
+                                      logical_import->filter(),
                                       logical_operator->load_metas());
 }
 
@@ -565,6 +566,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExport(const SharedPtr<Logical
                                       logical_export->offset(),
                                       logical_export->limit(),
                                       logical_export->row_limit(),
+                                      logical_export->compression(),
                                       logical_export->column_idx_array(),
                                       logical_export->block_index(),
                                       logical_operator->load_metas());
@@ -862,7 +864,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTableScan(const SharedPtr<Logi
     SharedPtr<LogicalTableScan> logical_table_scan = static_pointer_cast<LogicalTableScan>(logical_operator);
     return MakeUnique<PhysicalTableScan>(logical_operator->node_id(),
                                          logical_table_scan->base_table_ref_,
-                                         std::move(logical_table_scan->fast_rough_filter_evaluator_),
+                                         logical_table_scan->fast_rough_filter_evaluator_,
                                          logical_operator->load_metas(),
                                          logical_table_scan->add_row_id_);
 }
@@ -1125,11 +1127,6 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExplain(const SharedPtr<Logica
 
     UniquePtr<PhysicalExplain> explain_node{nullptr};
     switch (logical_explain->explain_type()) {
-        case ExplainType::kAnalyze: {
-            Status status = Status::NotSupport("Not implement: Explain analyze");
-            RecoverableError(status);
-            break;
-        }
         case ExplainType::kAst:
         case ExplainType::kUnOpt:
         case ExplainType::kOpt: {
@@ -1150,8 +1147,10 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExplain(const SharedPtr<Logica
                                                        logical_operator->load_metas());
             break;
         }
+        case ExplainType::kAnalyze:
         case ExplainType::kFragment:
         case ExplainType::kPipeline: {
+            // The explained plan is kept for the query context to execute or for the fragment builder to explain
             explain_node = MakeUnique<PhysicalExplain>(logical_explain->node_id(),
                                                        logical_explain->explain_type(),
                                                        nullptr,
@@ -0,0 +1,521 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+
+module plan_cache;
+
+import stl;
+import physical_operator;
+import physical_operator_type;
+import select_statement;
+import parsed_expr;
+import column_expr;
+import constant_expr;
+import function_expr;
+import between_expr;
+import in_expr;
+import cast_expr;
+import knn_expr;
+import search_expr;
+import table_reference;
+import base_table_reference;
+import statement_common;
+import internal_types;
+import default_values;
+import session;
+import txn;
+import logical_node;
+import logical_node_type;
+import logical_table_scan;
+import logical_knn_scan;
+import base_table_ref;
+import block_index;
+import table_entry;
+import common_query_filter;
+import base_expression;
+import value_expression;
+import value;
+
+namespace infinity {
+
+namespace {
+
+template <typename T>
+void AppendValue(String &key, const T &value) {
+    key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void AppendString(String &key, const String &str) {
+    AppendValue<u64>(key, str.size());
+    key.append(str);
+}
+
+void AppendCString(String &key, const char *str) {
+    if (str == nullptr) {
+        AppendValue<i64>(key, -1);
+        return;
+    }
+    SizeT length = std::strlen(str);
+    AppendValue<i64>(key, length);
+    key.append(str, length);
+}
+
+template <typename T>
+void AppendArray(String &key, const Vector<T> &array) {
+    AppendValue<u64>(key, array.size());
+    key.append(reinterpret_cast<const char *>(array.data()), array.size() * sizeof(T));
+}
+
+// A parameter is keyed by its index and literal type, unless `param_by_value`
+bool AppendConstant(String &key, const ConstantExpr *expr, Vector<const ConstantExpr *> &parameters, bool param_by_value = false) {
+    AppendValue(key, expr->literal_type_);
+    if (expr->param_index_ > 0) {
+        switch (expr->literal_type_) {
+            case LiteralType::kBoolean:
+            case LiteralType::kInteger:
+            case LiteralType::kDouble:
+            case LiteralType::kString:
+            case LiteralType::kNull: {
+                break;
+            }
+            default: {
+                return false;
+            }
+        }
+        parameters.push_back(expr);
+        AppendValue(key, param_by_value ? i64(0) : expr->param_index_);
+        if (!param_by_value) {
+            return true;
+        }
+    } else {
+        AppendValue<i64>(key, 0);
+    }
+    switch (expr->literal_type_) {
+        case LiteralType::kBoolean: {
+            AppendValue(key, expr->bool_value_);
+            return true;
+        }
+        case LiteralType::kInteger: {
+            AppendValue(key, expr->integer_value_);
+            return true;
+        }
+        case LiteralType::kDouble: {
+            AppendValue(key, expr->double_value_);
+            return true;
+        }
+        case LiteralType::kString: {
+            AppendCString(key, expr->str_value_);
+            return true;
+        }
+        case LiteralType::kDate:
+        case LiteralType::kTime:
+        case LiteralType::kDateTime:
+        case LiteralType::kTimestamp: {
+            AppendCString(key, expr->date_value_);
+            return true;
+        }
+        case LiteralType::kInterval: {
+            AppendValue(key, expr->integer_value_);
+            AppendValue(key, expr->interval_type_);
+            return true;
+        }
+        case LiteralType::kIntegerArray: {
+            AppendArray(key, expr->long_array_);
+            return true;
+        }
+        case LiteralType::kDoubleArray: {
+            AppendArray(key, expr->double_array_);
+            return true;
+        }
+        case LiteralType::kSubArrayArray: {
+            AppendValue<u64>(key, expr->sub_array_array_.size());
+            for (const auto &sub_array : expr->sub_array_array_) {
+                if (!AppendConstant(key, sub_array.get(), parameters)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case LiteralType::kLongSparseArray: {
+            AppendArray(key, expr->long_sparse_array_.first);
+            AppendArray(key, expr->long_sparse_array_.second);
+            return true;
+        }
+        case LiteralType::kDoubleSparseArray: {
+            AppendArray(key, expr->double_sparse_array_.first);
+            AppendArray(key, expr->double_sparse_array_.second);
+            return true;
+        }
+        case LiteralType::kNull:
+        case LiteralType::kEmptyArray: {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AppendExpr(String &key, const ParsedExpr *expr, Vector<const ConstantExpr *> &parameters);
+
+bool AppendExprList(String &key, const Vector<ParsedExpr *> *exprs, Vector<const ConstantExpr *> &parameters) {
+    if (exprs == nullptr) {
+        AppendValue<i64>(key, -1);
+        return true;
+    }
+    AppendValue<i64>(key, exprs->size());
+    for (const auto *expr : *exprs) {
+        if (!AppendExpr(key, expr, parameters)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Expressions which are not handled here (subquery, case, full text and tensor search, fusion) make the statement uncacheable.
+bool AppendExpr(String &key, const ParsedExpr *expr, Vector<const ConstantExpr *> &parameters) {
+    if (expr == nullptr) {
+        AppendValue<i8>(key, -1);
+        return true;
+    }
+    AppendValue(key, expr->type_);
+    AppendString(key, expr->alias_);
+    switch (expr->type_) {
+        case ParsedExprType::kColumn: {
+            const auto *column_expr = static_cast<const ColumnExpr *>(expr);
+            AppendValue<u64>(key, column_expr->names_.size());
+            for (const auto &name : column_expr->names_) {
+                AppendString(key, name);
+            }
+            AppendValue(key, column_expr->star_);
+            AppendValue(key, column_expr->generated_);
+            return true;
+        }
+        case ParsedExprType::kConstant: {
+            return AppendConstant(key, static_cast<const ConstantExpr *>(expr), parameters);
+        }
+        case ParsedExprType::kFunction: {
+            const auto *function_expr = static_cast<const FunctionExpr *>(expr);
+            AppendString(key, function_expr->func_name_);
+            AppendValue(key, function_expr->distinct_);
+            return AppendExprList(key, function_expr->arguments_, parameters);
+        }
+        case ParsedExprType::kBetween: {
+            const auto *between_expr = static_cast<const BetweenExpr *>(expr);
+            return AppendExpr(key, between_expr->value_, parameters) and AppendExpr(key, between_expr->lower_bound_, parameters) and
+                   AppendExpr(key, between_expr->upper_bound_, parameters);
+        }
+        case ParsedExprType::kIn: {
+            const auto *in_expr = static_cast<const InExpr *>(expr);
+            AppendValue(key, in_expr->not_in_);
+            return AppendExpr(key, in_expr->left_, parameters) and AppendExprList(key, in_expr->arguments_, parameters);
+        }
+        case ParsedExprType::kCast: {
+            const auto *cast_expr = static_cast<const CastExpr *>(expr);
+            if (cast_expr->data_type_.type_info().get() != nullptr) {
+                return false;
+            }
+            AppendValue(key, cast_expr->data_type_.type());
+            return AppendExpr(key, cast_expr->expr_, parameters);
+        }
+        case ParsedExprType::kKnn: {
+            const auto *knn_expr = static_cast<const KnnExpr *>(expr);
+            AppendValue(key, knn_expr->embedding_data_type_);
+            AppendValue(key, knn_expr->dimension_);
+            AppendValue(key, knn_expr->distance_type_);
+            AppendValue(key, knn_expr->topn_);
+            AppendValue(key, knn_expr->ignore_index_);
+            AppendString(key, knn_expr->index_name_);
+            if (knn_expr->opt_params_ != nullptr) {
+                AppendValue<u64>(key, knn_expr->opt_params_->size());
+                for (const auto *opt_param : *knn_expr->opt_params_) {
+                    AppendString(key, opt_param->param_name_);
+                    AppendString(key, opt_param->param_value_);
+                }
+            } else {
+                AppendValue<i64>(key, -1);
+            }
+            SizeT embedding_size = EmbeddingType::EmbeddingSize(knn_expr->embedding_data_type_, knn_expr->dimension_);
+            AppendValue<u64>(key, embedding_size);
+            key.append(static_cast<const char *>(knn_expr->embedding_data_ptr_), embedding_size);
+            return AppendExpr(key, knn_expr->column_expr_, parameters);
+        }
+        case ParsedExprType::kSearch: {
+            const auto *search_expr = static_cast<const SearchExpr *>(expr);
+            if (!search_expr->fusion_exprs_.empty()) {
+                return false;
+            }
+            AppendValue<u64>(key, search_expr->match_exprs_.size());
+            for (const auto *match_expr : search_expr->match_exprs_) {
+                if (match_expr->type_ != ParsedExprType::kKnn or !AppendExpr(key, match_expr, parameters)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+bool CacheableOperator(const PhysicalOperator *physical_operator) {
+    if (physical_operator == nullptr) {
+        return true;
+    }
+    // Operators of which the logical nodes only refer to the txn by the snapshots handled in `BindSnapshot`
+    switch (physical_operator->operator_type()) {
+        case PhysicalOperatorType::kTableScan:
+        case PhysicalOperatorType::kKnnScan:
+        case PhysicalOperatorType::kMergeKnn:
+        case PhysicalOperatorType::kFilter:
+        case PhysicalOperatorType::kProjection:
+        case PhysicalOperatorType::kTop:
+        case PhysicalOperatorType::kMergeTop: {
+            return CacheableOperator(physical_operator->left()) and CacheableOperator(physical_operator->right());
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+template <typename Func>
+void VisitScans(const SharedPtr<LogicalNode> &logical_node, const Func &func) {
+    if (logical_node.get() == nullptr) {
+        return;
+    }
+    switch (logical_node->operator_type()) {
+        case LogicalNodeType::kTableScan: {
+            func(static_cast<LogicalTableScan *>(logical_node.get())->base_table_ref_.get(), nullptr);
+            break;
+        }
+        case LogicalNodeType::kKnnScan: {
+            auto *knn_scan = static_cast<LogicalKnnScan *>(logical_node.get());
+            func(knn_scan->base_table_ref_.get(), knn_scan->common_query_filter_.get());
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    VisitScans(logical_node->left_node(), func);
+    VisitScans(logical_node->right_node(), func);
+}
+
+// LIMIT and OFFSET are checked when the statement is bound, a parameter of them is keyed by its value
+bool AppendLimitExpr(String &key, const ParsedExpr *expr, Vector<const ConstantExpr *> &parameters) {
+    if (expr != nullptr and expr->type_ == ParsedExprType::kConstant) {
+        AppendValue(key, expr->type_);
+        AppendString(key, expr->alias_);
+        return AppendConstant(key, static_cast<const ConstantExpr *>(expr), parameters, true);
+    }
+    return AppendExpr(key, expr, parameters);
+}
+
+bool AppendSelectStatement(String &key, const SelectStatement *select_statement, const String &schema_name, Vector<const ConstantExpr *> &parameters) {
+    if (select_statement->table_ref_ == nullptr or select_statement->table_ref_->type_ != TableRefType::kTable or
+        select_statement->nested_select_ != nullptr or (select_statement->with_exprs_ != nullptr and !select_statement->with_exprs_->empty())) {
+        return false;
+    }
+    const auto *table_reference = static_cast<const TableReference *>(select_statement->table_ref_);
+    AppendString(key, schema_name);
+    AppendString(key, table_reference->db_name_);
+    AppendString(key, table_reference->table_name_);
+    if (table_reference->alias_ != nullptr) {
+        if (table_reference->alias_->column_alias_array_ != nullptr) {
+            return false;
+        }
+        AppendCString(key, table_reference->alias_->alias_);
+    } else {
+        AppendCString(key, nullptr);
+    }
+
+    if (!AppendExprList(key, select_statement->select_list_, parameters)) {
+        return false;
+    }
+    AppendValue(key, select_statement->select_distinct_);
+    if (!AppendExpr(key, select_statement->search_expr_, parameters) or !AppendExpr(key, select_statement->where_expr_, parameters) or
+        !AppendExprList(key, select_statement->group_by_list_, parameters) or !AppendExpr(key, select_statement->having_expr_, parameters)) {
+        return false;
+    }
+    if (select_statement->order_by_list != nullptr) {
+        AppendValue<u64>(key, select_statement->order_by_list->size());
+        for (const auto *order_by_expr : *select_statement->order_by_list) {
+            AppendValue(key, order_by_expr->type_);
+            if (!AppendExpr(key, order_by_expr->expr_, parameters)) {
+                return false;
+            }
+        }
+    } else {
+        AppendValue<i64>(key, -1);
+    }
+    return AppendLimitExpr(key, select_statement->limit_expr_, parameters) and AppendLimitExpr(key, select_statement->offset_expr_, parameters);
+}
+
+// The value the binder makes of a parameter, see `AppendConstant` for the literal types of a parameter
+Value ParameterValue(const ConstantExpr *expr) {
+    switch (expr->literal_type_) {
+        case LiteralType::kBoolean: {
+            return Value::MakeBool(expr->bool_value_);
+        }
+        case LiteralType::kInteger: {
+            return Value::MakeBigInt(expr->integer_value_);
+        }
+        case LiteralType::kDouble: {
+            return Value::MakeDouble(expr->double_value_);
+        }
+        case LiteralType::kString: {
+            return Value::MakeVarchar(expr->str_value_);
+        }
+        default: {
+            return Value::MakeNull();
+        }
+    }
+}
+
+} // namespace
+
+UniquePtr<CachedPlan> PlanCache::Take(const String &key, u64 version) {
+    std::unique_lock lock(mtx_);
+    if (version != version_) {
+        return nullptr;
+    }
+    auto iter = plan_map_.find(key);
+    if (iter == plan_map_.end()) {
+        return nullptr;
+    }
+    auto plan_iter = iter->second;
+    plan_map_.erase(iter);
+    UniquePtr<CachedPlan> plan = std::move(*plan_iter);
+    plans_.erase(plan_iter);
+    ++hit_count_;
+    return plan;
+}
+
+void PlanCache::Put(UniquePtr<CachedPlan> plan, u64 current_version) {
+    // plans are destroyed after the lock is released
+    Vector<UniquePtr<CachedPlan>> dropped_plans;
+    std::unique_lock lock(mtx_);
+    if (plan->version_ != current_version or plan->version_ < version_) {
+        dropped_plans.push_back(std::move(plan));
+        return;
+    }
+    if (plan->version_ > version_) {
+        // data changed, none of the cached plans can be used any more
+        for (auto &cached_plan : plans_) {
+            dropped_plans.push_back(std::move(cached_plan));
+        }
+        plans_.clear();
+        plan_map_.clear();
+        version_ = plan->version_;
+    }
+
+    String key = plan->key_;
+    plans_.push_front(std::move(plan));
+    plan_map_.emplace(std::move(key), plans_.begin());
+    if (plans_.size() > DEFAULT_PLAN_CACHE_CAPACITY) {
+        dropped_plans.push_back(Evict(std::prev(plans_.end())));
+    }
+}
+
+void PlanCache::Clear() {
+    List<UniquePtr<CachedPlan>> plans;
+    std::unique_lock lock(mtx_);
+    plans.swap(plans_);
+    plan_map_.clear();
+    version_ = 0;
+}
+
+SizeT PlanCache::size() {
+    std::unique_lock lock(mtx_);
+    return plans_.size();
+}
+
+UniquePtr<CachedPlan> PlanCache::Evict(List<UniquePtr<CachedPlan>>::iterator plan_iter) {
+    auto [begin, end] = plan_map_.equal_range((*plan_iter)->key_);
+    for (auto iter = begin; iter != end; ++iter) {
+        if (iter->second == plan_iter) {
+            plan_map_.erase(iter);
+            break;
+        }
+    }
+    UniquePtr<CachedPlan> plan = std::move(*plan_iter);
+    plans_.erase(plan_iter);
+    return plan;
+}
+
+bool PlanCache::MakeKey(const SelectStatement *select_statement, BaseSession *session, String &key, Vector<const ConstantExpr *> &parameters) {
+    key.clear();
+    parameters.clear();
+    // session variables which change how a statement is planned or executed
+    AppendValue(key, session->GetProfile());
+    if (!AppendSelectStatement(key, select_statement, session->current_database(), parameters)) {
+        key.clear();
+        parameters.clear();
+        return false;
+    }
+    return true;
+}
+
+bool PlanCache::Cacheable(const Vector<UniquePtr<PhysicalOperator>> &physical_plans, const Vector<SharedPtr<BaseExpression>> &parameter_exprs) {
+    for (const auto &parameter_expr : parameter_exprs) {
+        if (static_cast<const ValueExpression *>(parameter_expr.get())->used_by_plan_) {
+            return false;
+        }
+    }
+    for (const auto &physical_plan : physical_plans) {
+        if (!CacheableOperator(physical_plan.get())) {
+            return false;
+        }
+    }
+    return !physical_plans.empty();
+}
+
+void PlanCache::BindParameters(const Vector<SharedPtr<BaseExpression>> &parameter_exprs, const Vector<const ConstantExpr *> &parameters) {
+    for (const auto &parameter_expr : parameter_exprs) {
+        auto *value_expr = static_cast<ValueExpression *>(parameter_expr.get());
+        for (const auto *parameter : parameters) {
+            if (parameter->param_index_ == value_expr->param_index_) {
+                value_expr->SetValue(ParameterValue(parameter));
+                break;
+            }
+        }
+    }
+}
+
+void PlanCache::BindSnapshot(const Vector<SharedPtr<LogicalNode>> &logical_plans, Txn *txn) {
+    for (const auto &logical_plan : logical_plans) {
+        VisitScans(logical_plan, [&](BaseTableRef *base_table_ref, CommonQueryFilter *common_query_filter) {
+            base_table_ref->block_index_ = base_table_ref->table_entry_ptr_->GetBlockIndex(txn);
+            if (common_query_filter != nullptr) {
+                common_query_filter->Reset(txn->BeginTS());
+            }
+        });
+    }
+}
+
+void PlanCache::ReleaseSnapshot(const Vector<SharedPtr<LogicalNode>> &logical_plans) {
+    for (const auto &logical_plan : logical_plans) {
+        VisitScans(logical_plan, [&](BaseTableRef *base_table_ref, CommonQueryFilter *common_query_filter) {
+            base_table_ref->block_index_ = MakeShared<BlockIndex>();
+            if (common_query_filter != nullptr) {
+                common_query_filter->Reset(common_query_filter->begin_ts_);
+            }
+        });
+    }
+}
+
+} // namespace infinity
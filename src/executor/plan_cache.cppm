@@ -0,0 +1,107 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module plan_cache;
+
+import stl;
+import singleton;
+import logical_node;
+import physical_operator;
+import select_statement;
+import session;
+import txn;
+import base_expression;
+import constant_expr;
+
+namespace infinity {
+
+// Optimized logical plan of a SELECT statement kept for the next execution of the same statement.
+export struct CachedPlan {
+    String key_{};
+    // commit version of the txn manager when the plan was built
+    u64 version_{};
+    u64 max_node_id_{};
+    Vector<SharedPtr<LogicalNode>> logical_plans_{};
+    // value expressions bound from the parameters of a prepared statement, set to the parameter values of each execution
+    Vector<SharedPtr<BaseExpression>> parameters_{};
+};
+
+/*
+    Cache of optimized logical plans shared by all front ends (SQL, thrift, http and embedded), keyed by the exact content of
+    the statement and the session state it is planned with. A parameter of a prepared statement is keyed by its index and
+    literal type instead of its value, so the executions of a prepared statement with different values share one plan.
+
+    Invalidation rules:
+    - Only the bound and optimized logical plan is kept. The snapshot of the txn (block index, filter results) is dropped by
+      `ReleaseSnapshot` before the plan is cached, taken again by `BindSnapshot` for each txn, and the physical operators are
+      built again from the logical plan for each execution. Nothing of an execution is kept in the cache.
+    - A plan is only built and reused at a catalog version with no catalog change committing, and only while no database, table
+      or index was created or dropped since then. Data commits, compaction and index optimization keep the cached plans, the
+      segments and deletes they change are read by `BindSnapshot` for each txn.
+    - Plans are checked out by `Take` and returned by `Put` after execution, a plan is never used by two queries at the same time.
+    - Only plans made of operators listed in `Cacheable` are kept.
+    - A plan in which the optimizer used the value of a parameter, e.g. to build an index or min-max filter, is not kept.
+      The other parameters are only read when the plan is executed, `BindParameters` sets them before each execution.
+      Parameters of LIMIT and OFFSET are checked when the statement is bound, so they are keyed by their values.
+*/
+export class PlanCache : public Singleton<PlanCache> {
+public:
+    // Return a plan of `key` built at `version`, nullptr if there is none.
+    UniquePtr<CachedPlan> Take(const String &key, u64 version);
+
+    // Keep the plan if it is still valid at `current_version`
+    void Put(UniquePtr<CachedPlan> plan, u64 current_version);
+
+    void Clear();
+
+    SizeT size();
+
+    u64 hit_count() const { return hit_count_.load(); }
+
+    // Encode every part of the statement and of the session state which affects the plan into `key`, and collect the
+    // parameters of the statement into `parameters`. Return false if the statement can't be cached
+    static bool MakeKey(const SelectStatement *select_statement, BaseSession *session, String &key, Vector<const ConstantExpr *> &parameters);
+
+    static bool Cacheable(const Vector<UniquePtr<PhysicalOperator>> &physical_plans, const Vector<SharedPtr<BaseExpression>> &parameter_exprs);
+
+    // Set the parameter values of this execution into the parameter expressions of a cached plan
+    static void BindParameters(const Vector<SharedPtr<BaseExpression>> &parameter_exprs, const Vector<const ConstantExpr *> &parameters);
+
+    // Take the table snapshot of `txn` into the table references and filters of a cached plan
+    static void BindSnapshot(const Vector<SharedPtr<LogicalNode>> &logical_plans, Txn *txn);
+
+    // Drop the table snapshot of the txn which executed the plan, so that a cached plan refers to no block or index entry
+    static void ReleaseSnapshot(const Vector<SharedPtr<LogicalNode>> &logical_plans);
+
+private:
+    friend class Singleton;
+
+    PlanCache() = default;
+
+    // called when lock held, the evicted plan is returned to be destroyed after the lock is released
+    UniquePtr<CachedPlan> Evict(List<UniquePtr<CachedPlan>>::iterator iter);
+
+private:
+    std::mutex mtx_{};
+    u64 version_{};
+    // most recently used plan in the front
+    List<UniquePtr<CachedPlan>> plans_{};
+    MultiMap<String, List<UniquePtr<CachedPlan>>::iterator> plan_map_{};
+
+    Atomic<u64> hit_count_{0};
+};
+
+} // namespace infinity
@@ -40,6 +40,14 @@ public:
 
     const Value &GetValue() const { return value_; }
 
+    // Bind the value of the next execution of a cached plan, it has the type of the value the plan was built with
+    void SetValue(Value value) { value_ = std::move(value); }
+
+    // 1-based index of the prepared statement parameter bound into this value, 0 for a literal of the statement
+    i64 param_index_{};
+    // Set when the optimizer built a part of the plan from the value, the plan can't be executed with another value
+    bool used_by_plan_{false};
+
 private:
     Value value_;
 };
@@ -224,6 +224,35 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig* default
             UnrecoverableError(status.message());
         }
 
+        // Thrift server type
+        String thrift_server_type = String(THRIFT_SERVER_TYPE_POOL);
+        UniquePtr<StringOption> thrift_server_type_option = MakeUnique<StringOption>(THRIFT_SERVER_TYPE_OPTION_NAME, thrift_server_type);
+        status = global_options_.AddOption(std::move(thrift_server_type_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Thrift IO threads
+        i64 thrift_io_threads = DEFAULT_THRIFT_IO_THREADS;
+        UniquePtr<IntegerOption> thrift_io_threads_option =
+            MakeUnique<IntegerOption>(THRIFT_IO_THREADS_OPTION_NAME, thrift_io_threads, MAX_THRIFT_IO_THREADS, MIN_THRIFT_IO_THREADS);
+        status = global_options_.AddOption(std::move(thrift_io_threads_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Thrift max frame size
+        i64 thrift_max_frame_size = DEFAULT_THRIFT_MAX_FRAME_SIZE;
+        UniquePtr<IntegerOption> thrift_max_frame_size_option =
+            MakeUnique<IntegerOption>(THRIFT_MAX_FRAME_SIZE_OPTION_NAME, thrift_max_frame_size, MAX_THRIFT_MAX_FRAME_SIZE, MIN_THRIFT_MAX_FRAME_SIZE);
+        status = global_options_.AddOption(std::move(thrift_max_frame_size_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Log file name
         String log_filename = "infinity.log";
         UniquePtr<StringOption> log_file_name_option = MakeUnique<StringOption>(LOG_FILENAME_OPTION_NAME, log_filename);
@@ -340,6 +369,26 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig* default
             UnrecoverableError(status.message());
         }
 
+        // Compaction IO Limit
+        i64 compaction_io_limit = DEFAULT_COMPACTION_IO_LIMIT;
+        UniquePtr<IntegerOption> compaction_io_limit_option =
+            MakeUnique<IntegerOption>(COMPACTION_IO_LIMIT_OPTION_NAME, compaction_io_limit, MAX_COMPACTION_IO_LIMIT, MIN_COMPACTION_IO_LIMIT);
+        status = global_options_.AddOption(std::move(compaction_io_limit_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Append Stream Count
+        i64 append_stream_count = DEFAULT_APPEND_STREAM_COUNT;
+        UniquePtr<IntegerOption> append_stream_count_option =
+            MakeUnique<IntegerOption>(APPEND_STREAM_COUNT_OPTION_NAME, append_stream_count, MAX_APPEND_STREAM_COUNT, MIN_APPEND_STREAM_COUNT);
+        status = global_options_.AddOption(std::move(append_stream_count_option));
+        if(!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Buffer Manager Size
         i64 buffer_manager_size = DEFAULT_BUFFER_MANAGER_SIZE;
         UniquePtr<IntegerOption> buffer_manager_size_option =
@@ -758,6 +807,71 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig* default
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kThriftServerType: {
+                            // Thrift server type
+                            String thrift_server_type = String(THRIFT_SERVER_TYPE_POOL);
+                            if (elem.second.is_string()) {
+                                thrift_server_type = elem.second.value_or(thrift_server_type);
+                            } else {
+                                return Status::InvalidConfig("'thrift_server_type' field isn't string.");
+                            }
+                            ToLower(thrift_server_type);
+                            if (thrift_server_type != THRIFT_SERVER_TYPE_POOL && thrift_server_type != THRIFT_SERVER_TYPE_NON_BLOCK &&
+                                thrift_server_type != THRIFT_SERVER_TYPE_THREADED) {
+                                return Status::InvalidConfig(fmt::format("Invalid thrift server type: {}", thrift_server_type));
+                            }
+
+                            UniquePtr<StringOption> thrift_server_type_option = MakeUnique<StringOption>(THRIFT_SERVER_TYPE_OPTION_NAME, thrift_server_type);
+                            Status status = global_options_.AddOption(std::move(thrift_server_type_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kThriftIOThreads: {
+                            // Thrift IO threads
+                            i64 thrift_io_threads = DEFAULT_THRIFT_IO_THREADS;
+                            if (elem.second.is_integer()) {
+                                thrift_io_threads = elem.second.value_or(thrift_io_threads);
+                            } else {
+                                return Status::InvalidConfig("'thrift_io_threads' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> thrift_io_threads_option =
+                                MakeUnique<IntegerOption>(THRIFT_IO_THREADS_OPTION_NAME, thrift_io_threads, MAX_THRIFT_IO_THREADS, MIN_THRIFT_IO_THREADS);
+                            if (!thrift_io_threads_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid thrift io threads: {}", thrift_io_threads));
+                            }
+
+                            Status status = global_options_.AddOption(std::move(thrift_io_threads_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kThriftMaxFrameSize: {
+                            // Thrift max frame size
+                            i64 thrift_max_frame_size = DEFAULT_THRIFT_MAX_FRAME_SIZE;
+                            if (elem.second.is_integer()) {
+                                thrift_max_frame_size = elem.second.value_or(thrift_max_frame_size);
+                            } else {
+                                return Status::InvalidConfig("'thrift_max_frame_size' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> thrift_max_frame_size_option = MakeUnique<IntegerOption>(THRIFT_MAX_FRAME_SIZE_OPTION_NAME,
+                                                                                                                thrift_max_frame_size,
+                                                                                                                MAX_THRIFT_MAX_FRAME_SIZE,
+                                                                                                                MIN_THRIFT_MAX_FRAME_SIZE);
+                            if (!thrift_max_frame_size_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid thrift max frame size: {}", thrift_max_frame_size));
+                            }
+
+                            Status status = global_options_.AddOption(std::move(thrift_max_frame_size_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'network' field", var_name));
                         }
@@ -813,6 +927,38 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig* default
                         UnrecoverableError(status.message());
                     }
                 }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kThriftServerType) == nullptr) {
+                    // Thrift server type
+                    String thrift_server_type = String(THRIFT_SERVER_TYPE_POOL);
+                    UniquePtr<StringOption> thrift_server_type_option = MakeUnique<StringOption>(THRIFT_SERVER_TYPE_OPTION_NAME, thrift_server_type);
+                    Status status = global_options_.AddOption(std::move(thrift_server_type_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kThriftIOThreads) == nullptr) {
+                    // Thrift IO threads
+                    i64 thrift_io_threads = DEFAULT_THRIFT_IO_THREADS;
+                    UniquePtr<IntegerOption> thrift_io_threads_option =
+                        MakeUnique<IntegerOption>(THRIFT_IO_THREADS_OPTION_NAME, thrift_io_threads, MAX_THRIFT_IO_THREADS, MIN_THRIFT_IO_THREADS);
+                    Status status = global_options_.AddOption(std::move(thrift_io_threads_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kThriftMaxFrameSize) == nullptr) {
+                    // Thrift max frame size
+                    i64 thrift_max_frame_size = DEFAULT_THRIFT_MAX_FRAME_SIZE;
+                    UniquePtr<IntegerOption> thrift_max_frame_size_option =
+                        MakeUnique<IntegerOption>(THRIFT_MAX_FRAME_SIZE_OPTION_NAME, thrift_max_frame_size, MAX_THRIFT_MAX_FRAME_SIZE, MIN_THRIFT_MAX_FRAME_SIZE);
+                    Status status = global_options_.AddOption(std::move(thrift_max_frame_size_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
             } else {
                 return Status::InvalidConfig("No 'network' section in configure file.");
             }
@@ -1158,6 +1304,46 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig* default
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kCompactionIOLimit: {
+                            // Compaction IO Limit
+                            i64 compaction_io_limit = DEFAULT_COMPACTION_IO_LIMIT;
+                            if(elem.second.is_integer()) {
+                                compaction_io_limit = elem.second.value_or(compaction_io_limit);
+                            } else {
+                                return Status::InvalidConfig("'compaction_io_limit' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> compaction_io_limit_option =
+                                MakeUnique<IntegerOption>(COMPACTION_IO_LIMIT_OPTION_NAME, compaction_io_limit, MAX_COMPACTION_IO_LIMIT, MIN_COMPACTION_IO_LIMIT);
+                            if (!compaction_io_limit_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid compaction io limit: {}", compaction_io_limit));
+                            }
+                            Status status = global_options_.AddOption(std::move(compaction_io_limit_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kAppendStreamCount: {
+                            // Append Stream Count
+                            i64 append_stream_count = DEFAULT_APPEND_STREAM_COUNT;
+                            if(elem.second.is_integer()) {
+                                append_stream_count = elem.second.value_or(append_stream_count);
+                            } else {
+                                return Status::InvalidConfig("'append_stream_count' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> append_stream_count_option =
+                                MakeUnique<IntegerOption>(APPEND_STREAM_COUNT_OPTION_NAME, append_stream_count, MAX_APPEND_STREAM_COUNT, MIN_APPEND_STREAM_COUNT);
+                            if (!append_stream_count_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid append stream count: {}", append_stream_count));
+                            }
+                            Status status = global_options_.AddOption(std::move(append_stream_count_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'storage' field", var_name));
                         }
@@ -1218,6 +1404,28 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig* default
                     }
                 }
 
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactionIOLimit) == nullptr) {
+                    // Compaction IO Limit
+                    i64 compaction_io_limit = DEFAULT_COMPACTION_IO_LIMIT;
+                    UniquePtr<IntegerOption> compaction_io_limit_option =
+                        MakeUnique<IntegerOption>(COMPACTION_IO_LIMIT_OPTION_NAME, compaction_io_limit, MAX_COMPACTION_IO_LIMIT, MIN_COMPACTION_IO_LIMIT);
+                    Status status = global_options_.AddOption(std::move(compaction_io_limit_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kAppendStreamCount) == nullptr) {
+                    // Append Stream Count
+                    i64 append_stream_count = DEFAULT_APPEND_STREAM_COUNT;
+                    UniquePtr<IntegerOption> append_stream_count_option =
+                        MakeUnique<IntegerOption>(APPEND_STREAM_COUNT_OPTION_NAME, append_stream_count, MAX_APPEND_STREAM_COUNT, MIN_APPEND_STREAM_COUNT);
+                    Status status = global_options_.AddOption(std::move(append_stream_count_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
             } else {
                 return Status::InvalidConfig("No 'storage' section in configure file.");
             }
@@ -1777,6 +1985,21 @@ i64 Config::ConnectionPoolSize() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kConnectionPoolSize);
 }
 
+String Config::ThriftServerType() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetStringValue(GlobalOptionIndex::kThriftServerType);
+}
+
+i64 Config::ThriftIOThreads() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kThriftIOThreads);
+}
+
+i64 Config::ThriftMaxFrameSize() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kThriftMaxFrameSize);
+}
+
 // Log
 String Config::LogFileName() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -1870,6 +2093,28 @@ void Config::SetCompactInterval(i64 interval) {
     return ;
 }
 
+i64 Config::CompactionIOLimit() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kCompactionIOLimit);
+}
+
+void Config::SetCompactionIOLimit(i64 limit) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    BaseOption *base_option = global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactionIOLimit);
+    if (base_option->data_type_ != BaseOptionDataType::kInteger) {
+        String error_message = "Attempt to set non-integer value to compaction io limit";
+        UnrecoverableError(error_message);
+    }
+    IntegerOption *compaction_io_limit_option = static_cast<IntegerOption *>(base_option);
+    compaction_io_limit_option->value_ = limit;
+    return ;
+}
+
+i64 Config::AppendStreamCount() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kAppendStreamCount);
+}
+
 i64 Config::OptimizeIndexInterval() {
     std::lock_guard<std::mutex> guard(mutex_);
     return global_options_.GetIntegerValue(GlobalOptionIndex::kOptimizeIndexInterval);
@@ -2018,6 +2263,9 @@ void Config::PrintAll() {
     fmt::print(" - http port: {}\n", HTTPPort());
     fmt::print(" - rpc client port: {}\n", ClientPort());
     fmt::print(" - connection pool size: {}\n", ConnectionPoolSize());
+    fmt::print(" - thrift server type: {}\n", ThriftServerType());
+    fmt::print(" - thrift io threads: {}\n", ThriftIOThreads());
+    fmt::print(" - thrift max frame size: {}\n", ThriftMaxFrameSize());
 
     // Log
     fmt::print(" - log_filename: {}\n", LogFileName());
@@ -2034,6 +2282,8 @@ void Config::PrintAll() {
     fmt::print(" - compact_interval: {}\n", Utility::FormatTimeInfo(CompactInterval()));
     fmt::print(" - optimize_index_interval: {}\n", Utility::FormatTimeInfo(OptimizeIndexInterval()));
     fmt::print(" - memindex_capacity: {}\n", Utility::FormatByteSize(MemIndexCapacity()));
+    fmt::print(" - compaction_io_limit: {}\n", Utility::FormatByteSize(CompactionIOLimit()));
+    fmt::print(" - append_stream_count: {}\n", AppendStreamCount());
 
     // Buffer manager
     fmt::print(" - buffer_manager_size: {}\n", Utility::FormatByteSize(BufferManagerSize()));
@@ -62,6 +62,9 @@ public:
     i64 HTTPPort();
     i64 ClientPort();
     i64 ConnectionPoolSize();
+    String ThriftServerType();
+    i64 ThriftIOThreads();
+    i64 ThriftMaxFrameSize();
 
     // Log
     String LogFileName();
@@ -88,6 +91,13 @@ public:
 
     i64 MemIndexCapacity();
 
+    // Bytes per second rewritten by compaction, 0 means no limit
+    i64 CompactionIOLimit();
+    void SetCompactionIOLimit(i64);
+
+    // Number of unsealed segments of a new table, each one is appended to by its own stream of txns
+    i64 AppendStreamCount();
+
     // Persistence
     String PersistenceDir();
     i64 PersistenceObjectSizeLimit();
@@ -860,6 +860,26 @@ QueryResult Infinity::Insert(const String &db_name, const String &table_name, Ve
     return result;
 }
 
+QueryResult
+Infinity::InsertColumns(const String &db_name, const String &table_name, Vector<String> column_names, const Vector<SharedPtr<ColumnVector>> &columns) {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager(),
+                            InfinityContext::instance().persistence_manager());
+    String schema_name = db_name;
+    ToLower(schema_name);
+    String lower_table_name = table_name;
+    ToLower(lower_table_name);
+    for (String &column_name : column_names) {
+        ToLower(column_name);
+    }
+    QueryResult result = query_context_ptr->InsertColumns(schema_name, lower_table_name, column_names, columns);
+    return result;
+}
+
 QueryResult Infinity::Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options) {
 
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
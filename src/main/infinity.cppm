@@ -32,6 +32,7 @@ import create_index_info;
 import update_statement;
 import explain_statement;
 import command_statement;
+import column_vector;
 
 namespace infinity {
 
@@ -138,6 +139,8 @@ public:
 
     QueryResult Insert(const String &db_name, const String &table_name, Vector<String> *columns, Vector<Vector<ParsedExpr *> *> *values);
 
+    QueryResult InsertColumns(const String &db_name, const String &table_name, Vector<String> column_names, const Vector<SharedPtr<ColumnVector>> &columns);
+
     QueryResult Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options);
 
     QueryResult Export(const String &db_name, const String &table_name, Vector<ParsedExpr *> *columns, const String &path, ExportOptions export_options);
@@ -60,12 +60,17 @@ void InfinityContext::Init(const SharedPtr<String> &config_path, bool m_flag, De
             persistence_manager_ = MakeUnique<PersistenceManager>(persistence_dir, config_->DataDir(), (SizeT)persistence_object_size_limit);
         }
 
-        storage_ = MakeUnique<Storage>(config_.get());
-        storage_->Init();
-
+        // The wal replay and memory index recovery of the storage init run on the append thread pool
         inverting_thread_pool_.resize(config_->CPULimit());
         commiting_thread_pool_.resize(config_->CPULimit());
         hnsw_build_thread_pool_.resize(config_->CPULimit());
+        copy_thread_pool_.resize(config_->CPULimit());
+        append_thread_pool_.resize(config_->CPULimit());
+        sparse_search_thread_pool_.resize(config_->CPULimit());
+
+        storage_ = MakeUnique<Storage>(config_.get());
+        storage_->Init();
+
         initialized_ = true;
     }
 }
@@ -45,6 +45,9 @@ public:
     [[nodiscard]] inline ThreadPool &GetFulltextInvertingThreadPool() { return inverting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetFulltextCommitingThreadPool() { return commiting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetHnswBuildThreadPool() { return hnsw_build_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetCopyThreadPool() { return copy_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetAppendThreadPool() { return append_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetSparseSearchThreadPool() { return sparse_search_thread_pool_; }
     [[nodiscard]] inline bool &MaintenanceMode() { return maintenance_mode_; }
 
     void Init(const SharedPtr<String> &config_path, bool m_flag = false, DefaultConfig *default_config = nullptr);
@@ -69,6 +72,15 @@ private:
     // For hnsw index
     ThreadPool hnsw_build_thread_pool_{4};
 
+    // For converting the data of import and export
+    ThreadPool copy_thread_pool_{4};
+
+    // For the appends of the append streams of the tables, and the wal replay of the tables on startup
+    ThreadPool append_thread_pool_{4};
+
+    // For the block ranges and the queries of the sparse (bmp) index search
+    ThreadPool sparse_search_thread_pool_{4};
+
     bool initialized_{false};
     bool maintenance_mode_{false};
 };
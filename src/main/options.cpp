@@ -38,6 +38,9 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(HTTP_PORT_OPTION_NAME)] = GlobalOptionIndex::kHTTPPort;
     name2index_[String(CLIENT_PORT_OPTION_NAME)] = GlobalOptionIndex::kClientPort;
     name2index_[String(CONNECTION_POOL_SIZE_OPTION_NAME)] = GlobalOptionIndex::kConnectionPoolSize;
+    name2index_[String(THRIFT_SERVER_TYPE_OPTION_NAME)] = GlobalOptionIndex::kThriftServerType;
+    name2index_[String(THRIFT_IO_THREADS_OPTION_NAME)] = GlobalOptionIndex::kThriftIOThreads;
+    name2index_[String(THRIFT_MAX_FRAME_SIZE_OPTION_NAME)] = GlobalOptionIndex::kThriftMaxFrameSize;
     name2index_[String(LOG_FILENAME_OPTION_NAME)] = GlobalOptionIndex::kLogFileName;
 
     name2index_[String(LOG_DIR_OPTION_NAME)] = GlobalOptionIndex::kLogDir;
@@ -51,6 +54,8 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(COMPACT_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kCompactInterval;
     name2index_[String(OPTIMIZE_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kOptimizeIndexInterval;
     name2index_[String(MEM_INDEX_CAPACITY_OPTION_NAME)] = GlobalOptionIndex::kMemIndexCapacity;
+    name2index_[String(COMPACTION_IO_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kCompactionIOLimit;
+    name2index_[String(APPEND_STREAM_COUNT_OPTION_NAME)] = GlobalOptionIndex::kAppendStreamCount;
 
     name2index_[String(PERSISTENCE_DIR_OPTION_NAME)] = GlobalOptionIndex::kPersistenceDir;
     name2index_[String(PERSISTENCE_OBJECT_SIZE_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kPersistenceObjectSizeLimit;
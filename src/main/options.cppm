@@ -146,7 +146,12 @@ export enum class GlobalOptionIndex {
     kPersistenceDir = 31,
     kPersistenceObjectSizeLimit = 32,
     kMemIndexMemoryQuota = 33,
-    kInvalid = 34,
+    kCompactionIOLimit = 34,
+    kAppendStreamCount = 35,
+    kThriftIOThreads = 36,
+    kThriftMaxFrameSize = 37,
+    kThriftServerType = 38,
+    kInvalid = 39,
 };
 
 export struct GlobalOptions {
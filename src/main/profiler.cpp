@@ -130,7 +130,24 @@ String OptimizerProfiler::ToString(SizeT intent) const {
     return result;
 }
 
-void TaskProfiler::StartOperator(const PhysicalOperator *op) {
+ProfileCounters &ThreadProfileCounters() {
+    static thread_local ProfileCounters counters;
+    return counters;
+}
+
+namespace {
+
+u64 FinalizedRowCount(const Vector<UniquePtr<DataBlock>> &data_blocks) {
+    u64 row_count = 0;
+    for (const auto &data_block : data_blocks) {
+        row_count += data_block->Finalized() ? data_block->row_count() : 0;
+    }
+    return row_count;
+}
+
+} // namespace
+
+void TaskProfiler::StartOperator(const PhysicalOperator *op, const OperatorState *operator_state) {
     if (!enable_) {
         return;
     }
@@ -139,8 +156,12 @@ void TaskProfiler::StartOperator(const PhysicalOperator *op) {
         UnrecoverableError(error_message);
     }
     active_operator_ = op;
+    // The input is counted before the operator consumes it
+    active_input_rows_ = operator_state->prev_op_state_ != nullptr ? FinalizedRowCount(operator_state->prev_op_state_->data_block_array_) : 0;
+    active_begin_counters_ = ThreadProfileCounters();
     profiler_.Begin();
 }
+
 void TaskProfiler::StopOperator(const OperatorState *operator_state) {
     if (!enable_) {
         return;
@@ -150,26 +171,25 @@ void TaskProfiler::StopOperator(const OperatorState *operator_state) {
         UnrecoverableError(error_message);
     }
     profiler_.End();
+    ProfileCounters counters = ThreadProfileCounters() - active_begin_counters_;
 
-    uint64_t input_rows{};
-    if(operator_state->prev_op_state_ != nullptr) {
-        SizeT input_data_block_count = operator_state->prev_op_state_->data_block_array_.size();
-        for(SizeT block_id = 0; block_id < input_data_block_count; ++ block_id) {
-            DataBlock* input_data_block = operator_state->prev_op_state_->data_block_array_[block_id].get();
-            input_rows += input_data_block->Finalized() ? input_data_block->row_count() : 0;
-        }
-    }
-
-    uint64_t output_rows{};
-    uint64_t output_data_size{};
-    SizeT output_data_block_count = operator_state->data_block_array_.size();
-    for(SizeT block_id = 0; block_id < output_data_block_count; ++ block_id) {
-        DataBlock* output_data_block = operator_state->data_block_array_[block_id].get();
+    u64 output_rows{};
+    u64 output_data_size{};
+    for (const auto &output_data_block : operator_state->data_block_array_) {
         output_data_size += output_data_block->Finalized() ? output_data_block->GetSizeInBytes() : 0;
         output_rows += output_data_block->Finalized() ? output_data_block->row_count() : 0;
     }
 
-    OperatorInformation info(active_operator_->GetName(), profiler_.GetBegin(), profiler_.GetEnd(), profiler_.Elapsed(), input_rows, output_data_size, output_rows);
+    OperatorInformation info(active_operator_->GetName(),
+                             active_operator_->node_id(),
+                             profiler_.GetBegin(),
+                             profiler_.GetEnd(),
+                             profiler_.Elapsed(),
+                             active_input_rows_,
+                             output_data_size,
+                             output_rows,
+                             operator_state->hash_table_size_,
+                             counters);
 
     timings_.push_back(std::move(info));
     active_operator_ = nullptr;
@@ -347,6 +367,12 @@ nlohmann::json QueryProfiler::Serialize(const QueryProfiler *profiler) {
                     json_info["input_rows"] = op.input_rows_;
                     json_info["output_rows"] = op.output_rows_;
                     json_info["output_data_size"] = op.output_data_size_;
+                    json_info["hash_table_size"] = op.hash_table_size_;
+                    json_info["buffer_hits"] = op.counters_.buffer_hits_;
+                    json_info["buffer_misses"] = op.counters_.buffer_misses_;
+                    json_info["bytes_read"] = op.counters_.bytes_read_;
+                    json_info["hnsw_hops"] = op.counters_.hnsw_hops_;
+                    json_info["posting_blocks_decoded"] = op.counters_.posting_blocks_decoded_;
                     json_operators["infos"].push_back(json_info);
                 }
                 times ++;
@@ -378,4 +404,25 @@ nlohmann::json QueryProfiler::Serialize(const QueryProfiler *profiler) {
     return json;
 }
 
+HashMap<u64, OperatorProfile> QueryProfiler::GetOperatorProfiles() const {
+    HashMap<u64, OperatorProfile> operator_profiles;
+    for (const auto &[fragment_id, tasks] : records_) {
+        for (const auto &[task_id, task_profilers] : tasks) {
+            for (const auto &task_profiler : task_profilers) {
+                for (const auto &op : task_profiler.timings_) {
+                    OperatorProfile &profile = operator_profiles[op.operator_id_];
+                    ++profile.execute_n_;
+                    profile.elapsed_ += op.elapsed_;
+                    profile.input_rows_ += op.input_rows_;
+                    profile.output_rows_ += op.output_rows_;
+                    profile.output_data_size_ += op.output_data_size_;
+                    profile.hash_table_size_ = std::max(profile.hash_table_size_, op.hash_table_size_);
+                    profile.counters_ += op.counters_;
+                }
+            }
+        }
+    }
+    return operator_profiles;
+}
+
 } // namespace infinity
@@ -88,45 +88,77 @@ export enum class QueryPhase : i8 {
     kInvalid,
 };
 
-struct OperatorInformation {
-    OperatorInformation() = default;
-
-    OperatorInformation(const OperatorInformation& other)
-        : name_(other.name_), start_(other.start_), end_(other.end_), elapsed_(other.elapsed_), input_rows_(other.input_rows_),
-          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_) {
-
+// Work counted by the storage and index code on the thread which does it. The task profiler takes the difference of the counters
+// around each operator execution, so the work is attributed to the operator running on the thread.
+export struct ProfileCounters {
+    u64 buffer_hits_{};
+    u64 buffer_misses_{};
+    u64 bytes_read_{};
+    u64 hnsw_hops_{};
+    u64 posting_blocks_decoded_{};
+
+    ProfileCounters &operator+=(const ProfileCounters &other) {
+        buffer_hits_ += other.buffer_hits_;
+        buffer_misses_ += other.buffer_misses_;
+        bytes_read_ += other.bytes_read_;
+        hnsw_hops_ += other.hnsw_hops_;
+        posting_blocks_decoded_ += other.posting_blocks_decoded_;
+        return *this;
     }
 
-    OperatorInformation(OperatorInformation&& other)
-        : name_(std::move(other.name_)), start_(other.start_), end_(other.end_), elapsed_(other.elapsed_), input_rows_(other.input_rows_),
-          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_) {
+    ProfileCounters operator-(const ProfileCounters &other) const {
+        ProfileCounters res;
+        res.buffer_hits_ = buffer_hits_ - other.buffer_hits_;
+        res.buffer_misses_ = buffer_misses_ - other.buffer_misses_;
+        res.bytes_read_ = bytes_read_ - other.bytes_read_;
+        res.hnsw_hops_ = hnsw_hops_ - other.hnsw_hops_;
+        res.posting_blocks_decoded_ = posting_blocks_decoded_ - other.posting_blocks_decoded_;
+        return res;
     }
+};
 
-    OperatorInformation(String name, i64 start, i64 end, i64 elapsed, u16 input_rows, i32 output_data_size, u16 output_rows)
-        : name_(std::move(name)), start_(start), end_(end), elapsed_(elapsed), input_rows_(input_rows), output_data_size_(output_data_size), output_rows_(output_rows) {
-    }
+// The counters of the current thread
+export ProfileCounters &ThreadProfileCounters();
 
-    OperatorInformation& operator=(OperatorInformation&& other) {
-        if (this != &other) {
-            name_ = std::move(other.name_);
-            start_ = std::move(other.start_);
-            end_ = std::move(other.end_);
-            elapsed_ = other.elapsed_;
-            input_rows_ = other.input_rows_;
-            output_rows_ = other.output_rows_;
-            output_data_size_ = other.output_data_size_;
-        }
-        return *this;
-    }
+struct OperatorInformation {
+    OperatorInformation() = default;
+
+    OperatorInformation(String name,
+                        u64 operator_id,
+                        i64 start,
+                        i64 end,
+                        i64 elapsed,
+                        u64 input_rows,
+                        u64 output_data_size,
+                        u64 output_rows,
+                        SizeT hash_table_size,
+                        const ProfileCounters &counters)
+        : name_(std::move(name)), operator_id_(operator_id), start_(start), end_(end), elapsed_(elapsed), input_rows_(input_rows),
+          output_data_size_(output_data_size), output_rows_(output_rows), hash_table_size_(hash_table_size), counters_(counters) {}
 
     String name_ {};
+    u64 operator_id_ {};
 
     i64 start_ {};
     i64 end_ {};
     i64 elapsed_{};
-    u16 input_rows_ {};
-    i32 output_data_size_ {};
-    u16 output_rows_ {};
+    u64 input_rows_ {};
+    u64 output_data_size_ {};
+    u64 output_rows_ {};
+    SizeT hash_table_size_ {};
+    ProfileCounters counters_ {};
+};
+
+// The executions of an operator in all the tasks of a query summed up, output by EXPLAIN ANALYZE
+export struct OperatorProfile {
+    SizeT execute_n_{};
+    i64 elapsed_{};
+    u64 input_rows_{};
+    u64 output_rows_{};
+    u64 output_data_size_{};
+    // the largest hash table built by the operator
+    SizeT hash_table_size_{};
+    ProfileCounters counters_{};
 };
 
 export struct TaskBinding {
@@ -172,9 +204,9 @@ public:
         }
     }
 
-    void StartOperator(const PhysicalOperator *op);
+    void StartOperator(const PhysicalOperator *op, const OperatorState *operator_state);
 
-    void StopOperator(const OperatorState *output_state);
+    void StopOperator(const OperatorState *operator_state);
 
 
     TaskBinding binding_;
@@ -185,6 +217,8 @@ private:
 
     BaseProfiler profiler_;
     const PhysicalOperator *active_operator_ = nullptr;
+    u64 active_input_rows_{};
+    ProfileCounters active_begin_counters_{};
 };
 
 export class QueryProfiler {
@@ -213,6 +247,9 @@ public:
 
     static nlohmann::json Serialize(const QueryProfiler *profiler);
 
+    // The profile of each operator by the operator id
+    HashMap<u64, OperatorProfile> GetOperatorProfiles() const;
+
 private:
     bool enable_ {};
 
@@ -57,6 +57,26 @@ import show_statement;
 import admin_statement;
 import admin_executor;
 import persistence_manager;
+import plan_cache;
+import select_statement;
+import txn_manager;
+import explain_statement;
+import physical_explain;
+import physical_operator_type;
+import explain_physical_plan;
+import data_table;
+import defer_op;
+import column_def;
+import data_type;
+import column_vector;
+import table_def;
+import table_entry;
+import table_entry_type;
+import cast_expression;
+import cast_function;
+import bound_cast_func;
+import constant_expr;
+import default_values;
 
 namespace infinity {
 
@@ -135,6 +155,19 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *base_statement) {
     UniquePtr<Notifier> notifier{};
 
     query_id_ = session_ptr_->query_count();
+
+    // A SELECT running in its own txn can reuse the logical plan of the same statement if the catalog has not changed since the plan was built.
+    // See PlanCache for the invalidation rules.
+    PlanCache &plan_cache = PlanCache::instance();
+    UniquePtr<CachedPlan> cached_plan{};
+    String plan_key{};
+    Vector<const ConstantExpr *> plan_parameters{};
+    Optional<u64> plan_version{};
+    parameter_exprs_.clear();
+    if (base_statement->type_ == StatementType::kSelect and session_ptr_->GetTxn() == nullptr and
+        PlanCache::MakeKey(static_cast<const SelectStatement *>(base_statement), session_ptr_, plan_key, plan_parameters)) {
+        plan_version = storage_->txn_manager()->catalog_version();
+    }
 //    ProfilerStart("Query");
 //    BaseProfiler profiler;
 //    profiler.Begin();
@@ -168,33 +201,60 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *base_statement) {
 //                        base_statement->ToString()));
         RecordQueryProfiler(base_statement->type_);
 
-        // Build unoptimized logical plan for each SQL base_statement.
-        StartProfile(QueryPhase::kLogicalPlan);
-        SharedPtr<BindContext> bind_context;
-        auto status = logical_planner_->Build(base_statement, bind_context);
-        // FIXME
-        if (!status.ok()) {
-            RecoverableError(status);
+        if (plan_version.has_value() and storage_->txn_manager()->catalog_version() == plan_version) {
+            cached_plan = plan_cache.Take(plan_key, *plan_version);
         }
+        if (cached_plan.get() != nullptr) {
+            logical_plans = std::move(cached_plan->logical_plans_);
+            current_max_node_id_ = cached_plan->max_node_id_;
+            PlanCache::BindParameters(cached_plan->parameters_, plan_parameters);
+            PlanCache::BindSnapshot(logical_plans, session_ptr_->GetTxn());
+        } else {
+            // Build unoptimized logical plan for each SQL base_statement.
+            StartProfile(QueryPhase::kLogicalPlan);
+            SharedPtr<BindContext> bind_context;
+            auto status = logical_planner_->Build(base_statement, bind_context);
+            // FIXME
+            if (!status.ok()) {
+                RecoverableError(status);
+            }
 
-        current_max_node_id_ = bind_context->GetNewLogicalNodeId();
-        logical_plans = logical_planner_->LogicalPlans();
-        StopProfile(QueryPhase::kLogicalPlan);
-//        LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
-        // Apply optimized rule to the logical plan
-        StartProfile(QueryPhase::kOptimizer);
-        for (auto &logical_plan : logical_plans) {
-            optimizer_->optimize(logical_plan, base_statement->type_);
+            current_max_node_id_ = bind_context->GetNewLogicalNodeId();
+            logical_plans = logical_planner_->LogicalPlans();
+            StopProfile(QueryPhase::kLogicalPlan);
+//            LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
+            // Apply optimized rule to the logical plan
+            StartProfile(QueryPhase::kOptimizer);
+            for (auto &logical_plan : logical_plans) {
+                optimizer_->optimize(logical_plan, base_statement->type_);
+            }
+            StopProfile(QueryPhase::kOptimizer);
         }
-        StopProfile(QueryPhase::kOptimizer);
 
-        // Build physical plan
+        // Build physical plan, also for a cached logical plan: the physical operators refer to the snapshot of this txn
+        u64 logical_max_node_id = current_max_node_id_;
         StartProfile(QueryPhase::kPhysicalPlan);
         for (auto &logical_plan : logical_plans) {
             auto physical_plan = physical_planner_->BuildPhysicalOperator(logical_plan);
             physical_plans.push_back(std::move(physical_plan));
         }
         StopProfile(QueryPhase::kPhysicalPlan);
+
+        if (cached_plan.get() == nullptr and plan_version.has_value() and PlanCache::Cacheable(physical_plans, parameter_exprs_)) {
+            cached_plan = MakeUnique<CachedPlan>();
+            cached_plan->key_ = std::move(plan_key);
+            cached_plan->version_ = *plan_version;
+            cached_plan->max_node_id_ = logical_max_node_id;
+            cached_plan->parameters_ = std::move(parameter_exprs_);
+        }
+        parameter_exprs_.clear();
+
+        if (base_statement->type_ == StatementType::kExplain and physical_plans.back()->operator_type() == PhysicalOperatorType::kExplain) {
+            auto *explain_op = static_cast<PhysicalExplain *>(physical_plans.back().get());
+            if (explain_op->explain_type() == ExplainType::kAnalyze) {
+                AnalyzePlan(explain_op, static_cast<const ExplainStatement *>(base_statement)->statement_);
+            }
+        }
 //        LOG_WARN(fmt::format("Before pipeline cost: {}", profiler.ElapsedToString()));
         StartProfile(QueryPhase::kPipelineBuild);
         // Fragment Builder, only for test now.
@@ -222,6 +282,17 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *base_statement) {
         this->CommitTxn();
         StopProfile(QueryPhase::kCommit);
 
+        if (cached_plan.get() != nullptr) {
+            // The physical operators and fragments hold the snapshot of this txn, only the logical plan is kept
+            plan_fragment.reset();
+            physical_plans.clear();
+            PlanCache::ReleaseSnapshot(logical_plans);
+            cached_plan->logical_plans_ = std::move(logical_plans);
+            if (auto current_version = storage_->txn_manager()->catalog_version(); current_version.has_value()) {
+                plan_cache.Put(std::move(cached_plan), *current_version);
+            }
+        }
+
     } catch (RecoverableException &e) {
 
         StopProfile();
@@ -269,6 +340,179 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *base_statement) {
     return query_result;
 }
 
+QueryResult QueryContext::DescribeStatement(const BaseStatement *base_statement) {
+    QueryResult query_result;
+    bool own_txn = session_ptr_->GetTxn() == nullptr;
+    try {
+        this->BeginTxn(base_statement);
+
+        SharedPtr<BindContext> bind_context;
+        auto status = logical_planner_->Build(base_statement, bind_context);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+
+        const SharedPtr<LogicalNode> &logical_plan = logical_planner_->LogicalPlans().back();
+        SharedPtr<Vector<String>> output_names = logical_plan->GetOutputNames();
+        SharedPtr<Vector<SharedPtr<DataType>>> output_types = logical_plan->GetOutputTypes();
+        Vector<SharedPtr<ColumnDef>> column_defs;
+        column_defs.reserve(output_names->size());
+        for (SizeT idx = 0; idx < output_names->size(); ++idx) {
+            column_defs.emplace_back(MakeShared<ColumnDef>(idx, (*output_types)[idx], (*output_names)[idx], std::set<ConstraintType>()));
+        }
+        query_result.result_table_ = DataTable::MakeResultTable(column_defs);
+        parameter_exprs_.clear();
+
+        // Nothing is run, the txn only gives the snapshot the statement is bound with
+        if (own_txn) {
+            this->RollbackTxn();
+        }
+    } catch (RecoverableException &e) {
+        if (own_txn) {
+            this->RollbackTxn();
+        }
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(e.ErrorCode(), e.what());
+    }
+    return query_result;
+}
+
+QueryResult QueryContext::InsertColumns(const String &db_name,
+                                        const String &table_name,
+                                        const Vector<String> &column_names,
+                                        const Vector<SharedPtr<ColumnVector>> &columns) {
+    QueryResult query_result;
+    CreateQueryProfiler();
+    query_id_ = session_ptr_->query_count();
+    // Recorded and profiled like the INSERT statement it stands for
+    if (global_config_->RecordRunningQuery()) {
+        String query_text = fmt::format("INSERT INTO {}.{} ({}) columns", db_name, table_name, fmt::join(column_names, ", "));
+        LOG_DEBUG(fmt::format("Record running query: {}", query_text));
+        session_manager_->AddQueryRecord(session_ptr_->session_id(), query_id_, StatementType2Str(StatementType::kInsert), query_text);
+    }
+    try {
+        this->BeginTxn(nullptr);
+        RecordQueryProfiler(StatementType::kInsert);
+        StartProfile(QueryPhase::kExecution);
+        Txn *txn = session_ptr_->GetTxn();
+        auto [table_entry, status] = txn->GetTableByName(db_name, table_name);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        if (table_entry->EntryType() == TableEntryType::kCollectionEntry) {
+            Status status = Status::NotSupport("Currently, collection isn't supported.");
+            RecoverableError(status);
+        }
+        if (column_names.size() != columns.size()) {
+            Status status =
+                Status::ColumnCountMismatch(fmt::format("{} column names are given, but {} columns are sent", column_names.size(), columns.size()));
+            RecoverableError(status);
+        }
+        SizeT row_count = columns.empty() ? 0 : columns[0]->Size();
+        if (row_count == 0) {
+            RecoverableError(Status::InsertWithoutValues());
+        }
+        if (row_count > INSERT_BATCH_ROW_LIMIT) {
+            Status status = Status::NotSupport("Insert batch row limit shouldn't more than 8192.");
+            RecoverableError(status);
+        }
+
+        // Arrange the given columns in the order of the table columns
+        SizeT table_column_count = table_entry->ColumnCount();
+        Vector<SharedPtr<ColumnVector>> input_columns(table_column_count);
+        for (SizeT idx = 0; idx < columns.size(); ++idx) {
+            if (columns[idx]->Size() != row_count) {
+                Status status = Status::ColumnCountMismatch(
+                    fmt::format("Column {} has {} rows, but column {} has {} rows", column_names[idx], columns[idx]->Size(), column_names[0], row_count));
+                RecoverableError(status);
+            }
+            SizeT column_id = table_entry->GetColumnIdByName(column_names[idx]);
+            if (input_columns[column_id].get() != nullptr) {
+                RecoverableError(Status::DuplicateColumnName(column_names[idx]));
+            }
+            input_columns[column_id] = columns[idx];
+        }
+
+        Vector<SharedPtr<DataType>> column_types;
+        column_types.reserve(table_column_count);
+        for (SizeT column_id = 0; column_id < table_column_count; ++column_id) {
+            column_types.emplace_back(table_entry->GetColumnDefByID(column_id)->column_type_);
+        }
+        SharedPtr<DataBlock> input_block = DataBlock::Make();
+        input_block->Init(column_types);
+        CastParameters cast_parameters;
+        for (SizeT column_id = 0; column_id < table_column_count; ++column_id) {
+            const ColumnDef *column_def = table_entry->GetColumnDefByID(column_id);
+            const SharedPtr<ColumnVector> &input_column = input_columns[column_id];
+            SharedPtr<ColumnVector> &column_vector = input_block->column_vectors[column_id];
+            if (input_column.get() == nullptr) {
+                if (!column_def->has_default_value()) {
+                    Status status = Status::SyntaxError(
+                        fmt::format("INSERT: Table column count ({}) and input value count mismatch ({})", table_column_count, columns.size()));
+                    RecoverableError(status);
+                }
+                auto const_expr = dynamic_cast<ConstantExpr *>(column_def->default_expr_.get());
+                for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                    column_vector->AppendByConstantExpr(const_expr);
+                }
+            } else if (*input_column->data_type() == *column_def->column_type_) {
+                column_vector->AppendWith(*input_column);
+            } else {
+                // The same cast the planner puts on an inserted value of another type, run once for the whole column
+                if (!CastExpression::CanCast(*input_column->data_type(), *column_def->column_type_)) {
+                    Status status = Status::NotSupportedTypeConversion(input_column->data_type()->ToString(), column_def->column_type_->ToString());
+                    RecoverableError(status);
+                }
+                BoundCastFunc cast = CastFunction::GetBoundFunc(*input_column->data_type(), *column_def->column_type_);
+                cast.function(input_column, column_vector, row_count, cast_parameters);
+            }
+        }
+        input_block->Finalize();
+
+        status = txn->Append(table_entry, input_block);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        StopProfile(QueryPhase::kExecution);
+
+        StartProfile(QueryPhase::kCommit);
+        this->CommitTxn();
+        StopProfile(QueryPhase::kCommit);
+
+        Vector<SharedPtr<ColumnDef>> column_defs;
+        SharedPtr<TableDef> result_table_def_ptr = MakeShared<TableDef>(MakeShared<String>("default_db"), MakeShared<String>("Tables"), column_defs);
+        query_result.result_table_ = MakeShared<DataTable>(result_table_def_ptr, TableType::kDataTable);
+        query_result.result_table_->SetResultMsg(MakeUnique<String>(fmt::format("INSERTED {} Rows", row_count)));
+        query_result.root_operator_type_ = LogicalNodeType::kInsert;
+    } catch (RecoverableException &e) {
+
+        StopProfile();
+        StartProfile(QueryPhase::kRollback);
+        this->RollbackTxn();
+        StopProfile(QueryPhase::kRollback);
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(e.ErrorCode(), e.what());
+
+    } catch (ParserException &e) {
+
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(ErrorCode::kParserError, e.what());
+
+    } catch (UnrecoverableException &e) {
+        printf("UnrecoverableException %s\n", e.what());
+        LOG_CRITICAL(e.what());
+        raise(SIGUSR1);
+    }
+    session_ptr_->IncreaseQueryCount();
+    session_manager_->IncreaseQueryCount();
+
+    if (global_config_->RecordRunningQuery()) {
+        LOG_DEBUG(fmt::format("Remove the query string from running query container: insert into {}.{}", db_name, table_name));
+        session_manager_->RemoveQueryRecord(session_ptr_->session_id());
+    }
+    return query_result;
+}
+
 bool QueryContext::ExecuteBGStatement(BaseStatement *base_statement, BGQueryState &state) {
     QueryResult query_result;
     try {
@@ -337,6 +581,30 @@ QueryResult QueryContext::HandleAdminStatement(const AdminStatement* admin_state
     return AdminExecutor::Execute(this, admin_statement);
 }
 
+void QueryContext::AnalyzePlan(PhysicalExplain *explain_op, const BaseStatement *explained_statement) {
+    analyze_profiler_ = MakeShared<QueryProfiler>(true);
+    DeferFn reset_profiler([&]() { analyze_profiler_.reset(); });
+
+    Vector<PhysicalOperator *> physical_plan_ptrs{explain_op->left()};
+    SharedPtr<PlanFragment> plan_fragment = fragment_builder_->BuildFragment(physical_plan_ptrs);
+    auto notifier = MakeUnique<Notifier>();
+    FragmentContext::BuildTask(this, nullptr, plan_fragment.get(), notifier.get());
+
+    BaseProfiler execution_profiler("Execution");
+    execution_profiler.Begin();
+    scheduler_->Schedule(plan_fragment.get(), explained_statement);
+    SharedPtr<DataTable> result_table = plan_fragment->GetResult();
+    execution_profiler.End();
+
+    HashMap<u64, OperatorProfile> operator_profiles = analyze_profiler_->GetOperatorProfiles();
+    auto texts_ptr = MakeShared<Vector<SharedPtr<String>>>();
+    ExplainPhysicalPlan::Explain(explain_op->left(), texts_ptr, true, 0, &operator_profiles);
+    SizeT result_row_count = result_table.get() != nullptr ? result_table->row_count() : 0;
+    texts_ptr->emplace_back(
+        MakeShared<String>(fmt::format("Execution time: {}, result rows: {}", execution_profiler.ElapsedToString(), result_row_count)));
+    explain_op->SetExplainText(texts_ptr);
+}
+
 void QueryContext::BeginTxn(const BaseStatement *base_statement) {
     if (session_ptr_->GetTxn() == nullptr) {
         bool is_checkpoint = base_statement != nullptr && base_statement->type_ == StatementType::kFlush;
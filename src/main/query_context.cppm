@@ -31,6 +31,8 @@ import status;
 import query_result;
 import base_statement;
 import admin_statement;
+import column_vector;
+import base_expression;
 
 export module query_context;
 
@@ -40,6 +42,7 @@ class LogicalPlanner;
 class PhysicalPlanner;
 class FragmentBuilder;
 class TaskScheduler;
+class PhysicalExplain;
 struct BGQueryState;
 
 export class QueryContext {
@@ -70,6 +73,16 @@ public:
 
     QueryResult QueryStatement(const BaseStatement *statement);
 
+    // Bind a select statement without running it, the result table is empty and has the output columns of the statement
+    QueryResult DescribeStatement(const BaseStatement *statement);
+
+    // Insert columns decoded by the client, each column is cast to the type of the table column of its name and
+    // the table columns not given get their default values
+    QueryResult InsertColumns(const String &db_name,
+                              const String &table_name,
+                              const Vector<String> &column_names,
+                              const Vector<SharedPtr<ColumnVector>> &columns);
+
     bool ExecuteBGStatement(BaseStatement *statement, BGQueryState &state);
 
     bool JoinBGStatement(BGQueryState &state, TxnTimeStamp &commit_ts, bool rollback = false);
@@ -82,6 +95,9 @@ public:
 
     [[nodiscard]] inline bool is_enable_profiling() const { return session_ptr_->GetProfile(); }
 
+    // The operators are also profiled when EXPLAIN ANALYZE executes the explained plan
+    [[nodiscard]] inline bool is_enable_operator_profiling() const { return is_enable_profiling() or analyze_profiler_.get() != nullptr; }
+
     [[nodiscard]] inline u64 memory_size_limit() const { return memory_size_limit_; }
 
     [[nodiscard]] inline u64 query_id() const { return query_id_; }
@@ -92,6 +108,9 @@ public:
 
     inline u64 GetNextNodeID() { return ++current_max_node_id_; }
 
+    // Value expressions bound from the parameters of a prepared statement while planning the current statement
+    inline void AddParameterExpression(SharedPtr<BaseExpression> parameter_expr) { parameter_exprs_.push_back(std::move(parameter_expr)); }
+
     void BeginTxn(const BaseStatement *statement = nullptr);
 
     TxnTimeStamp CommitTxn();
@@ -130,7 +149,9 @@ public:
     [[nodiscard]] BaseSession* current_session() const { return session_ptr_; }
 
     void FlushProfiler(TaskProfiler &&profiler) {
-        if(query_profiler_) {
+        if (analyze_profiler_) {
+            analyze_profiler_->Flush(std::move(profiler));
+        } else if(query_profiler_) {
             query_profiler_->Flush(std::move(profiler));
         }
     }
@@ -138,6 +159,9 @@ public:
 private:
     QueryResult HandleAdminStatement(const AdminStatement* admin_statement);
 
+    // Executes the plan explained by EXPLAIN ANALYZE and sets the plan annotated with the profile of each operator as the explain text
+    void AnalyzePlan(PhysicalExplain *explain_op, const BaseStatement *explained_statement);
+
 private:
     inline void CreateQueryProfiler() {
         if (is_enable_profiling()) {
@@ -177,6 +201,7 @@ private:
     UniquePtr<FragmentBuilder> fragment_builder_{};
 
     SharedPtr<QueryProfiler> query_profiler_{};
+    SharedPtr<QueryProfiler> analyze_profiler_{};
 
     Config *global_config_{};
     TaskScheduler *scheduler_{};
@@ -196,6 +221,7 @@ private:
     u64 tenant_id_{0};
     u64 user_id_{0};
     u64 current_max_node_id_{0};
+    Vector<SharedPtr<BaseExpression>> parameter_exprs_{};
 
     u64 cpu_number_limit_{};
     u64 memory_size_limit_{};
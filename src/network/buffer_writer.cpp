@@ -37,26 +37,30 @@ SizeT BufferWriter::size() const {
 }
 
 void BufferWriter::send_string(const String &value, NullTerminator null_terminator) {
-    auto position_in_string = 0u;
+    send_bytes(value.c_str(), value.size());
+
+    if (null_terminator == NullTerminator::kYes) {
+        try_flush(sizeof(char));
+        current_pos_.data_[current_pos_.position_] = NULL_END;
+        current_pos_.increment();
+    }
+}
+
+void BufferWriter::send_bytes(const char *data, SizeT length) {
+    SizeT position = 0;
 
     if (!full()) {
-        position_in_string = static_cast<u32>(std::min(max_capacity() - size(), value.size()));
-        RingBufferIterator::CopyN(value.c_str(), position_in_string, current_pos_);
-        current_pos_.increment(position_in_string);
+        position = std::min(max_capacity() - size(), length);
+        RingBufferIterator::CopyN(data, position, current_pos_);
+        current_pos_.increment(position);
     }
 
-    while (position_in_string < value.size()) {
-        const auto bytes_to_transfer = std::min(max_capacity(), value.size() - position_in_string);
+    while (position < length) {
+        const auto bytes_to_transfer = std::min(max_capacity(), length - position);
         try_flush(bytes_to_transfer);
-        RingBufferIterator::CopyN(value.c_str() + position_in_string, bytes_to_transfer, current_pos_);
+        RingBufferIterator::CopyN(data + position, bytes_to_transfer, current_pos_);
         current_pos_.increment(bytes_to_transfer);
-        position_in_string += bytes_to_transfer;
-    }
-
-    if (null_terminator == NullTerminator::kYes) {
-        try_flush(sizeof(char));
-        current_pos_.data_[current_pos_.position_] = NULL_END;
-        current_pos_.increment();
+        position += bytes_to_transfer;
     }
 }
 
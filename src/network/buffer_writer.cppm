@@ -48,6 +48,8 @@ public:
 
     void send_string(const String &value, NullTerminator null_terminator = NullTerminator::kYes);
 
+    void send_bytes(const char *data, SizeT length);
+
     // 0 means flush whole buffer.
     void flush(SizeT bytes = 0);
 
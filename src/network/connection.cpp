@@ -14,7 +14,13 @@
 
 module;
 
+#include <bit>
 #include <boost/asio/ip/tcp.hpp>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 
 module connection;
 
@@ -39,11 +45,649 @@ import logical_type;
 import embedding_info;
 import sparse_info;
 import data_type;
+import status;
+import sql_parser;
+import parser_result;
+import base_statement;
+import column_vector;
+import parsed_expr;
+import constant_expr;
+import function_expr;
+import between_expr;
+import in_expr;
+import cast_expr;
+import case_expr;
+import subquery_expr;
+import select_statement;
+import insert_statement;
+import update_statement;
+import delete_statement;
+import explain_statement;
+import base_table_reference;
+import subquery_reference;
+import join_reference;
+import cross_product_reference;
 
 namespace infinity {
 
+namespace {
+
+// Type oids of parameters which are bound as typed literals
+constexpr u32 kBoolOid = 16;
+constexpr u32 kInt8Oid = 20;
+constexpr u32 kInt2Oid = 21;
+constexpr u32 kInt4Oid = 23;
+constexpr u32 kFloat4Oid = 700;
+constexpr u32 kFloat8Oid = 701;
+constexpr u32 kTextOid = 25;
+
+template <typename T>
+T FromBigEndian(const String &bytes) {
+    T value{};
+    std::memcpy(&value, bytes.data(), sizeof(T));
+    if constexpr (std::endian::native == std::endian::little) {
+        auto *ptr = reinterpret_cast<char *>(&value);
+        std::reverse(ptr, ptr + sizeof(T));
+    }
+    return value;
+}
+
+template <typename T>
+void AppendBigEndian(String &values, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if constexpr (std::endian::native == std::endian::little) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    values.append(bytes, sizeof(T));
+}
+
+// Parse the whole text as one integer or one finite floating point number
+template <typename T>
+bool ParseNumber(const String &text, T &value) {
+    const char *begin = text.data();
+    const char *end = text.data() + text.size();
+    if (begin != end and *begin == '+') {
+        ++begin;
+    }
+    auto [ptr, ec] = std::from_chars(begin, end, value);
+    if (ec != std::errc() or ptr != end) {
+        return false;
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::isfinite(value);
+    }
+    return true;
+}
+
+String QuoteString(const String &text) {
+    String literal = "'";
+    for (char c : text) {
+        if (c == '\'') {
+            literal.push_back('\'');
+        }
+        literal.push_back(c);
+    }
+    literal.push_back('\'');
+    return literal;
+}
+
+// The same as the limit of the parameter count in a Bind message
+constexpr SizeT kMaxParameterCount = 65535;
+
+// Index of the $n placeholder starting at `idx`, `idx` is moved to its last digit
+Status ReadParameterIndex(const String &query, SizeT &idx, SizeT &param_idx) {
+    param_idx = 0;
+    while (idx + 1 < query.size() and std::isdigit(query[idx + 1])) {
+        param_idx = param_idx * 10 + (query[++idx] - '0');
+        if (param_idx > kMaxParameterCount) {
+            return Status::SyntaxError(fmt::format("Parameter index exceeds {}", kMaxParameterCount));
+        }
+    }
+    if (param_idx == 0) {
+        return Status::SyntaxError("There is no parameter $0");
+    }
+    return Status::OK();
+}
+
+// Highest $n placeholder of the query, placeholders in quoted strings and identifiers are not counted
+Status CountParameters(const String &query, SizeT &param_count) {
+    param_count = 0;
+    char quote = 0;
+    for (SizeT idx = 0; idx < query.size(); ++idx) {
+        char c = query[idx];
+        if (quote != 0) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '\'' or c == '"') {
+            quote = c;
+        } else if (c == '$' and idx + 1 < query.size() and std::isdigit(query[idx + 1])) {
+            SizeT param_idx = 0;
+            if (Status status = ReadParameterIndex(query, idx, param_idx); !status.ok()) {
+                return status;
+            }
+            param_count = std::max(param_count, param_idx);
+        }
+    }
+    return Status::OK();
+}
+
+Status BindParameters(const String &query, const Vector<String> &literals, String &bound_query) {
+    bound_query.clear();
+    bound_query.reserve(query.size());
+    char quote = 0;
+    for (SizeT idx = 0; idx < query.size(); ++idx) {
+        char c = query[idx];
+        if (quote != 0) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '\'' or c == '"') {
+            quote = c;
+        } else if (c == '$' and idx + 1 < query.size() and std::isdigit(query[idx + 1])) {
+            SizeT param_idx = 0;
+            if (Status status = ReadParameterIndex(query, idx, param_idx); !status.ok()) {
+                return status;
+            }
+            if (param_idx > literals.size()) {
+                return Status::SyntaxError(fmt::format("There is no parameter ${}, {} parameters are bound", param_idx, literals.size()));
+            }
+            bound_query += literals[param_idx - 1];
+            continue;
+        }
+        bound_query.push_back(c);
+    }
+    return Status::OK();
+}
+
+UniquePtr<ConstantExpr> MakeStringConstant(const String &text) {
+    auto constant = MakeUnique<ConstantExpr>(LiteralType::kString);
+    constant->str_value_ = strdup(text.c_str());
+    return constant;
+}
+
+// The literal a parameter is bound as
+Status ParameterToConstant(u32 param_type, PGFormatCode format, const Optional<String> &value, UniquePtr<ConstantExpr> &constant) {
+    if (!value.has_value()) {
+        constant = MakeUnique<ConstantExpr>(LiteralType::kNull);
+        return Status::OK();
+    }
+    const String &bytes = value.value();
+    auto make_integer = [&](i64 integer_value) {
+        constant = MakeUnique<ConstantExpr>(LiteralType::kInteger);
+        constant->integer_value_ = integer_value;
+    };
+    auto make_double = [&](f64 double_value) {
+        constant = MakeUnique<ConstantExpr>(LiteralType::kDouble);
+        constant->double_value_ = double_value;
+    };
+    auto make_bool = [&](bool bool_value) {
+        constant = MakeUnique<ConstantExpr>(LiteralType::kBoolean);
+        constant->bool_value_ = bool_value;
+    };
+    if (format == PGFormatCode::kBinary) {
+        auto check_size = [&](SizeT expected_size) {
+            return bytes.size() == expected_size ? Status::OK()
+                                                 : Status::InvalidParameterValue("parameter", fmt::format("{} bytes", bytes.size()), fmt::format("{} bytes", expected_size));
+        };
+        Status status;
+        switch (param_type) {
+            case kBoolOid: {
+                if (status = check_size(sizeof(u8)); status.ok()) {
+                    make_bool(bytes[0] != 0);
+                }
+                return status;
+            }
+            case kInt2Oid: {
+                if (status = check_size(sizeof(i16)); status.ok()) {
+                    make_integer(FromBigEndian<i16>(bytes));
+                }
+                return status;
+            }
+            case kInt4Oid: {
+                if (status = check_size(sizeof(i32)); status.ok()) {
+                    make_integer(FromBigEndian<i32>(bytes));
+                }
+                return status;
+            }
+            case kInt8Oid: {
+                if (status = check_size(sizeof(i64)); status.ok()) {
+                    make_integer(FromBigEndian<i64>(bytes));
+                }
+                return status;
+            }
+            case kFloat4Oid: {
+                if (status = check_size(sizeof(f32)); status.ok()) {
+                    make_double(std::bit_cast<f32>(FromBigEndian<u32>(bytes)));
+                }
+                return status;
+            }
+            case kFloat8Oid: {
+                if (status = check_size(sizeof(f64)); status.ok()) {
+                    make_double(std::bit_cast<f64>(FromBigEndian<u64>(bytes)));
+                }
+                return status;
+            }
+            case 0:
+            case kTextOid: {
+                constant = MakeStringConstant(bytes);
+                return Status::OK();
+            }
+            default: {
+                return Status::NotSupport(fmt::format("Binary parameter of type oid {}", param_type));
+            }
+        }
+    }
+
+    switch (param_type) {
+        case kBoolOid: {
+            if (bytes == "t" or bytes == "true" or bytes == "1") {
+                make_bool(true);
+            } else if (bytes == "f" or bytes == "false" or bytes == "0") {
+                make_bool(false);
+            } else {
+                return Status::InvalidParameterValue("parameter", bytes, "boolean");
+            }
+            return Status::OK();
+        }
+        case kInt2Oid:
+        case kInt4Oid:
+        case kInt8Oid: {
+            i64 integer_value{};
+            if (!ParseNumber(bytes, integer_value)) {
+                return Status::InvalidParameterValue("parameter", bytes, "integer");
+            }
+            make_integer(integer_value);
+            return Status::OK();
+        }
+        case kFloat4Oid:
+        case kFloat8Oid: {
+            f64 double_value{};
+            if (!ParseNumber(bytes, double_value)) {
+                return Status::InvalidParameterValue("parameter", bytes, "number");
+            }
+            make_double(double_value);
+            return Status::OK();
+        }
+        default: {
+            // Text and parameters of unspecified type are bound as strings, the binder casts them to the type they are used as
+            constant = MakeStringConstant(bytes);
+            return Status::OK();
+        }
+    }
+}
+
+// SQL text of a parameter, for a statement of which the parameters are bound into the query text
+String ConstantToLiteral(const ConstantExpr &constant) {
+    switch (constant.literal_type_) {
+        case LiteralType::kBoolean: {
+            return constant.bool_value_ ? "true" : "false";
+        }
+        case LiteralType::kInteger: {
+            return std::to_string(constant.integer_value_);
+        }
+        case LiteralType::kDouble: {
+            return fmt::format("{}", constant.double_value_);
+        }
+        case LiteralType::kString: {
+            return QuoteString(constant.str_value_);
+        }
+        default: {
+            return "NULL";
+        }
+    }
+}
+
+// Write the value of a parameter into its placeholder in the parsed statement
+void SetPlaceholder(ConstantExpr &placeholder, const ConstantExpr &value) {
+    if (placeholder.literal_type_ == LiteralType::kString) {
+        free(placeholder.str_value_);
+        placeholder.str_value_ = nullptr;
+    }
+    placeholder.literal_type_ = value.literal_type_;
+    placeholder.bool_value_ = value.bool_value_;
+    placeholder.integer_value_ = value.integer_value_;
+    placeholder.double_value_ = value.double_value_;
+    if (value.literal_type_ == LiteralType::kString) {
+        placeholder.str_value_ = strdup(value.str_value_);
+    }
+}
+
+// Find the placeholders of the parameters in the expressions of a statement, a placeholder is a string literal of
+// `marker` followed by the parameter index. Return false for a statement of which the expressions are not searched.
+class PlaceholderCollector {
+public:
+    PlaceholderCollector(const String &marker, Vector<ConstantExpr *> &placeholders) : marker_(marker), placeholders_(placeholders) {}
+
+    bool Collect(BaseStatement *statement) {
+        if (statement == nullptr) {
+            return true;
+        }
+        switch (statement->Type()) {
+            case StatementType::kSelect: {
+                return CollectSelect(static_cast<SelectStatement *>(statement));
+            }
+            case StatementType::kInsert: {
+                auto *insert_statement = static_cast<InsertStatement *>(statement);
+                if (insert_statement->values_ != nullptr) {
+                    for (auto *values : *insert_statement->values_) {
+                        CollectList(values);
+                    }
+                }
+                return CollectSelect(insert_statement->select_);
+            }
+            case StatementType::kUpdate: {
+                auto *update_statement = static_cast<UpdateStatement *>(statement);
+                CollectExpr(update_statement->where_expr_);
+                if (update_statement->update_expr_array_ != nullptr) {
+                    for (auto *update_expr : *update_statement->update_expr_array_) {
+                        CollectExpr(update_expr->value);
+                    }
+                }
+                return true;
+            }
+            case StatementType::kDelete: {
+                CollectExpr(static_cast<DeleteStatement *>(statement)->where_expr_);
+                return true;
+            }
+            case StatementType::kExplain: {
+                return Collect(static_cast<ExplainStatement *>(statement)->statement_);
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
+private:
+    bool CollectSelect(SelectStatement *select_statement) {
+        if (select_statement == nullptr) {
+            return true;
+        }
+        if (!CollectTableRef(select_statement->table_ref_)) {
+            return false;
+        }
+        CollectList(select_statement->select_list_);
+        CollectExpr(select_statement->search_expr_);
+        CollectExpr(select_statement->where_expr_);
+        CollectList(select_statement->group_by_list_);
+        CollectExpr(select_statement->having_expr_);
+        if (select_statement->order_by_list != nullptr) {
+            for (auto *order_by_expr : *select_statement->order_by_list) {
+                CollectExpr(order_by_expr->expr_);
+            }
+        }
+        CollectExpr(select_statement->limit_expr_);
+        CollectExpr(select_statement->offset_expr_);
+        if (select_statement->with_exprs_ != nullptr) {
+            for (auto *with_expr : *select_statement->with_exprs_) {
+                if (!Collect(with_expr->select_)) {
+                    return false;
+                }
+            }
+        }
+        return CollectSelect(select_statement->nested_select_);
+    }
+
+    bool CollectTableRef(BaseTableReference *table_ref) {
+        if (table_ref == nullptr) {
+            return true;
+        }
+        switch (table_ref->type_) {
+            case TableRefType::kTable:
+            case TableRefType::kDummy: {
+                return true;
+            }
+            case TableRefType::kSubquery: {
+                return CollectSelect(static_cast<SubqueryReference *>(table_ref)->select_statement_);
+            }
+            case TableRefType::kJoin: {
+                auto *join_ref = static_cast<JoinReference *>(table_ref);
+                CollectExpr(join_ref->condition_);
+                return CollectTableRef(join_ref->left_) and CollectTableRef(join_ref->right_);
+            }
+            case TableRefType::kCrossProduct: {
+                for (auto *child_ref : static_cast<CrossProductReference *>(table_ref)->tables_) {
+                    if (!CollectTableRef(child_ref)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
+    void CollectList(Vector<ParsedExpr *> *exprs) {
+        if (exprs == nullptr) {
+            return;
+        }
+        for (auto *expr : *exprs) {
+            CollectExpr(expr);
+        }
+    }
+
+    void CollectExpr(ParsedExpr *expr) {
+        if (expr == nullptr) {
+            return;
+        }
+        switch (expr->type_) {
+            case ParsedExprType::kConstant: {
+                auto *constant_expr = static_cast<ConstantExpr *>(expr);
+                if (constant_expr->literal_type_ == LiteralType::kString and std::strncmp(constant_expr->str_value_, marker_.c_str(), marker_.size()) == 0) {
+                    constant_expr->param_index_ = std::atoll(constant_expr->str_value_ + marker_.size());
+                    placeholders_.push_back(constant_expr);
+                }
+                break;
+            }
+            case ParsedExprType::kFunction: {
+                CollectList(static_cast<FunctionExpr *>(expr)->arguments_);
+                break;
+            }
+            case ParsedExprType::kBetween: {
+                auto *between_expr = static_cast<BetweenExpr *>(expr);
+                CollectExpr(between_expr->value_);
+                CollectExpr(between_expr->lower_bound_);
+                CollectExpr(between_expr->upper_bound_);
+                break;
+            }
+            case ParsedExprType::kIn: {
+                auto *in_expr = static_cast<InExpr *>(expr);
+                CollectExpr(in_expr->left_);
+                CollectList(in_expr->arguments_);
+                break;
+            }
+            case ParsedExprType::kCast: {
+                CollectExpr(static_cast<CastExpr *>(expr)->expr_);
+                break;
+            }
+            case ParsedExprType::kCase: {
+                auto *case_expr = static_cast<CaseExpr *>(expr);
+                CollectExpr(case_expr->expr_);
+                if (case_expr->case_check_array_ != nullptr) {
+                    for (auto *when_then : *case_expr->case_check_array_) {
+                        CollectExpr(when_then->when_);
+                        CollectExpr(when_then->then_);
+                    }
+                }
+                CollectExpr(case_expr->else_expr_);
+                break;
+            }
+            case ParsedExprType::kSubquery: {
+                auto *subquery_expr = static_cast<SubqueryExpr *>(expr);
+                CollectExpr(subquery_expr->left_);
+                CollectSelect(subquery_expr->select_);
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+
+    const String &marker_;
+    Vector<ConstantExpr *> &placeholders_;
+};
+
+Status BindInText(const PGPreparedStatement &statement, const Vector<UniquePtr<ConstantExpr>> &params, String &bound_query) {
+    if (statement.param_count_ == 0) {
+        bound_query = statement.query_;
+        return Status::OK();
+    }
+    Vector<String> literals;
+    literals.reserve(params.size());
+    for (const auto &param : params) {
+        literals.push_back(ConstantToLiteral(*param));
+    }
+    return BindParameters(statement.query_, literals, bound_query);
+}
+
+// Replace the parameters by placeholder literals, the statement binds its parameters in the query text if a parameter is
+// not found in the expressions of the parsed placeholder query
+void PreparePlaceholders(SQLParser *parser, PGPreparedStatement &statement) {
+    if (statement.param_count_ == 0) {
+        statement.placeholder_query_ = statement.query_;
+        return;
+    }
+    // a marker which is not in the query, so every occurrence of it is a placeholder
+    statement.marker_ = "$param";
+    while (statement.query_.find(statement.marker_) != String::npos) {
+        statement.marker_.push_back('$');
+    }
+    Vector<String> literals;
+    literals.reserve(statement.param_count_);
+    for (SizeT idx = 1; idx <= statement.param_count_; ++idx) {
+        literals.push_back(QuoteString(fmt::format("{}{}", statement.marker_, idx)));
+    }
+    statement.bind_in_text_ = true;
+    if (!BindParameters(statement.query_, literals, statement.placeholder_query_).ok()) {
+        return;
+    }
+    SizeT occurrence_count = 0;
+    for (SizeT pos = statement.placeholder_query_.find(statement.marker_); pos != String::npos;
+         pos = statement.placeholder_query_.find(statement.marker_, pos + 1)) {
+        ++occurrence_count;
+    }
+
+    auto parsed_result = MakeUnique<ParserResult>();
+    parser->Parse(statement.placeholder_query_, parsed_result.get());
+    if (parsed_result->IsError() or parsed_result->statements_ptr_->size() != 1) {
+        return;
+    }
+    BaseStatement *base_statement = parsed_result->statements_ptr_->at(0);
+    Vector<ConstantExpr *> placeholders;
+    PlaceholderCollector collector(statement.marker_, placeholders);
+    if (!collector.Collect(base_statement) or placeholders.size() != occurrence_count) {
+        return;
+    }
+    statement.bind_in_text_ = false;
+    if (base_statement->Type() == StatementType::kSelect) {
+        // Planning doesn't modify a select statement, keep it for the executions
+        statement.parsed_result_ = std::move(parsed_result);
+        statement.placeholders_ = std::move(placeholders);
+    }
+}
+
+// Result columns which are sent in binary format if the client asks for it, the others are always sent as text
+bool SupportBinaryFormat(LogicalType type);
+
+// Format of each result column from the result formats of a Bind message
+Vector<PGFormatCode> ResultColumnFormats(const Vector<PGFormatCode> &result_formats, const DataTable &result_table) {
+    SizeT column_count = result_table.ColumnCount();
+    Vector<PGFormatCode> column_formats(column_count, PGFormatCode::kText);
+    for (SizeT idx = 0; idx < column_count; ++idx) {
+        PGFormatCode format = PGFormatCode::kText;
+        if (result_formats.size() == 1) {
+            format = result_formats[0];
+        } else if (idx < result_formats.size()) {
+            format = result_formats[idx];
+        }
+        if (format == PGFormatCode::kBinary and SupportBinaryFormat(result_table.GetColumnTypeById(idx)->type())) {
+            column_formats[idx] = PGFormatCode::kBinary;
+        }
+    }
+    return column_formats;
+}
+
+bool SupportBinaryFormat(LogicalType type) {
+    switch (type) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat16:
+        case LogicalType::kBFloat16:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kVarchar: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void AppendBinaryValue(const ColumnVector &column_vector, SizeT row_idx, String &values) {
+    switch (column_vector.data_type()->type()) {
+        case LogicalType::kBoolean: {
+            values.push_back(column_vector.buffer_->GetCompactBit(row_idx) ? 1 : 0);
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            values.push_back(reinterpret_cast<const TinyIntT *>(column_vector.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            AppendBigEndian(values, reinterpret_cast<const SmallIntT *>(column_vector.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kInteger: {
+            AppendBigEndian(values, reinterpret_cast<const IntegerT *>(column_vector.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            AppendBigEndian(values, reinterpret_cast<const BigIntT *>(column_vector.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kFloat16: {
+            f32 value = static_cast<f32>(reinterpret_cast<const Float16T *>(column_vector.data())[row_idx]);
+            AppendBigEndian(values, std::bit_cast<u32>(value));
+            break;
+        }
+        case LogicalType::kBFloat16: {
+            f32 value = static_cast<f32>(reinterpret_cast<const BFloat16T *>(column_vector.data())[row_idx]);
+            AppendBigEndian(values, std::bit_cast<u32>(value));
+            break;
+        }
+        case LogicalType::kFloat: {
+            AppendBigEndian(values, std::bit_cast<u32>(reinterpret_cast<const FloatT *>(column_vector.data())[row_idx]));
+            break;
+        }
+        case LogicalType::kDouble: {
+            AppendBigEndian(values, std::bit_cast<u64>(reinterpret_cast<const DoubleT *>(column_vector.data())[row_idx]));
+            break;
+        }
+        case LogicalType::kVarchar: {
+            values += column_vector.ToString(row_idx);
+            break;
+        }
+        default: {
+            String error_message = "Unexpected binary format column type";
+            UnrecoverableError(error_message);
+        }
+    }
+}
+
+} // namespace
+
 Connection::Connection(boost::asio::io_service &io_service)
-    : socket_(MakeShared<boost::asio::ip::tcp::socket>(io_service)), pg_handler_(MakeShared<PGProtocolHandler>(socket())) {}
+    : socket_(MakeShared<boost::asio::ip::tcp::socket>(io_service)), pg_handler_(MakeShared<PGProtocolHandler>(socket())),
+      parser_(MakeUnique<SQLParser>()) {}
 
 Connection::~Connection() {
     if (session_ == nullptr) {
@@ -117,21 +761,36 @@ void Connection::HandleRequest() {
                             InfinityContext::instance().session_manager(),
                             InfinityContext::instance().persistence_manager());
 
+    if (ignore_till_sync_ and cmd_type != PGMessageType::kSyncCommand and cmd_type != PGMessageType::kTerminateCommand) {
+        LOG_TRACE("Skip extended query message after error");
+        pg_handler_->SkipMessageBody();
+        return;
+    }
+
     switch (cmd_type) {
         case PGMessageType::kBindCommand: {
-            LOG_TRACE("BindCommand");
+            HandleBind();
             break;
         }
         case PGMessageType::kDescribeCommand: {
-            LOG_TRACE("DescribeCommand");
+            HandleDescribe(query_context_ptr.get());
             break;
         }
         case PGMessageType::kExecuteCommand: {
-            LOG_TRACE("ExecuteCommand");
+            HandleExecute(query_context_ptr.get());
             break;
         }
         case PGMessageType::kParseCommand: {
-            LOG_TRACE("ParseCommand");
+            HandleParse();
+            break;
+        }
+        case PGMessageType::kCloseCommand: {
+            HandleClose();
+            break;
+        }
+        case PGMessageType::kFlushCommand: {
+            pg_handler_->SkipMessageBody();
+            pg_handler_->Flush();
             break;
         }
         case PGMessageType::kSimpleQueryCommand: {
@@ -139,7 +798,7 @@ void Connection::HandleRequest() {
             break;
         }
         case PGMessageType::kSyncCommand: {
-            LOG_TRACE("SyncCommand");
+            HandleSync();
             break;
         }
         case PGMessageType::kTerminateCommand: {
@@ -174,7 +833,303 @@ void Connection::HandlerSimpleQuery(QueryContext *query_context) {
     pg_handler_->send_ready_for_query();
 }
 
-void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
+void Connection::HandleParse() {
+    PGParseMessage message = pg_handler_->ReadParseMessage();
+    LOG_TRACE(fmt::format("Parse: {} {}", message.statement_name_, message.query_));
+
+    if (!message.statement_name_.empty() and prepared_statements_.contains(message.statement_name_)) {
+        HandleExtendedQueryError(fmt::format("Prepared statement {} already exists", message.statement_name_));
+        return;
+    }
+
+    auto statement = MakeShared<PGPreparedStatement>();
+    if (Status status = CountParameters(message.query_, statement->param_count_); !status.ok()) {
+        HandleExtendedQueryError(status.message());
+        return;
+    }
+    statement->param_types_ = std::move(message.param_types_);
+    statement->param_types_.resize(std::max(statement->param_types_.size(), statement->param_count_), 0);
+    statement->query_ = std::move(message.query_);
+    PreparePlaceholders(parser_.get(), *statement);
+    prepared_statements_[message.statement_name_] = std::move(statement);
+
+    pg_handler_->SendParseComplete();
+}
+
+void Connection::HandleBind() {
+    PGBindMessage message = pg_handler_->ReadBindMessage();
+    LOG_TRACE(fmt::format("Bind: {} {}", message.portal_name_, message.statement_name_));
+
+    auto iter = prepared_statements_.find(message.statement_name_);
+    if (iter == prepared_statements_.end()) {
+        HandleExtendedQueryError(fmt::format("Prepared statement {} does not exist", message.statement_name_));
+        return;
+    }
+    const SharedPtr<PGPreparedStatement> &statement = iter->second;
+    if (message.param_values_.size() != statement->param_count_) {
+        HandleExtendedQueryError(
+            fmt::format("Bind message supplies {} parameters, but prepared statement requires {}", message.param_values_.size(), statement->param_count_));
+        return;
+    }
+
+    auto portal = MakeUnique<PGPortal>();
+    portal->statement_ = statement;
+    portal->params_.resize(message.param_values_.size());
+    for (SizeT idx = 0; idx < message.param_values_.size(); ++idx) {
+        PGFormatCode format = PGFormatCode::kText;
+        if (message.param_formats_.size() == 1) {
+            format = message.param_formats_[0];
+        } else if (idx < message.param_formats_.size()) {
+            format = message.param_formats_[idx];
+        }
+        Status status = ParameterToConstant(statement->param_types_[idx], format, message.param_values_[idx], portal->params_[idx]);
+        if (!status.ok()) {
+            HandleExtendedQueryError(status.message());
+            return;
+        }
+    }
+    portal->result_formats_ = std::move(message.result_formats_);
+    portals_[message.portal_name_] = std::move(portal);
+
+    pg_handler_->SendBindComplete();
+}
+
+void Connection::HandleDescribe(QueryContext *query_context) {
+    PGDescribeMessage message = pg_handler_->ReadDescribeMessage();
+    LOG_TRACE(fmt::format("Describe: {} {}", static_cast<char>(message.object_type_), message.name_));
+
+    if (message.object_type_ == PGObjectType::kStatement) {
+        auto iter = prepared_statements_.find(message.name_);
+        if (iter == prepared_statements_.end()) {
+            HandleExtendedQueryError(fmt::format("Prepared statement {} does not exist", message.name_));
+            return;
+        }
+        PGPreparedStatement &statement = *iter->second;
+        // Unspecified parameter types are described as text.
+        Vector<u32> param_types = statement.param_types_;
+        for (auto &param_type : param_types) {
+            if (param_type == 0) {
+                param_type = kTextOid;
+            }
+        }
+        pg_handler_->SendParameterDescription(param_types);
+
+        // The parameter values are unknown, the statement is planned with NULL parameters to describe its result columns.
+        // A statement which fails to plan this way is described as returning no rows, its error is reported by Execute.
+        Vector<UniquePtr<ConstantExpr>> params(statement.param_count_);
+        for (auto &param : params) {
+            param = MakeUnique<ConstantExpr>(LiteralType::kNull);
+        }
+        StatementType statement_type = StatementType::kInvalidStmt;
+        QueryResult description = DescribePreparedStatement(query_context, statement, params, statement_type);
+        if (!description.IsOk() or description.result_table_.get() == nullptr) {
+            pg_handler_->SendNoData();
+            return;
+        }
+        SendTableDescription(description.result_table_);
+        return;
+    }
+
+    auto iter = portals_.find(message.name_);
+    if (iter == portals_.end()) {
+        HandleExtendedQueryError(fmt::format("Portal {} does not exist", message.name_));
+        return;
+    }
+    PGPortal &portal = *iter->second;
+    if (portal.result_.get() != nullptr) {
+        // The portal is already run by an Execute, describe its result
+        if (portal.result_->result_table_.get() == nullptr) {
+            pg_handler_->SendNoData();
+            return;
+        }
+        SendTableDescription(portal.result_->result_table_, portal.column_formats_);
+        return;
+    }
+
+    // The portal runs on Execute, a select is only planned here
+    StatementType statement_type = StatementType::kInvalidStmt;
+    QueryResult description = DescribePreparedStatement(query_context, *portal.statement_, portal.params_, statement_type);
+    if (!description.IsOk()) {
+        HandleExtendedQueryError(description.status_.message());
+        return;
+    }
+    if (statement_type == StatementType::kShow or statement_type == StatementType::kExplain) {
+        // Their columns are only known when they run, they only read so they are run here and Execute sends the result
+        RunPortal(query_context, portal);
+        if (!portal.result_->IsOk()) {
+            HandleExtendedQueryError(portal.result_->status_.message());
+            return;
+        }
+        description.result_table_ = portal.result_->result_table_;
+    }
+    if (description.result_table_.get() == nullptr) {
+        pg_handler_->SendNoData();
+        return;
+    }
+    SendTableDescription(description.result_table_, ResultColumnFormats(portal.result_formats_, *description.result_table_));
+}
+
+void Connection::HandleExecute(QueryContext *query_context) {
+    PGExecuteMessage message = pg_handler_->ReadExecuteMessage();
+    LOG_TRACE(fmt::format("Execute: {} {}", message.portal_name_, message.max_rows_));
+
+    auto iter = portals_.find(message.portal_name_);
+    if (iter == portals_.end()) {
+        HandleExtendedQueryError(fmt::format("Portal {} does not exist", message.portal_name_));
+        return;
+    }
+    PGPortal &portal = *iter->second;
+    RunPortal(query_context, portal);
+    if (!portal.result_->IsOk()) {
+        HandleExtendedQueryError(portal.result_->status_.message());
+        return;
+    }
+    if (portal.result_->result_table_.get() == nullptr) {
+        pg_handler_->SendComplete("OK");
+        return;
+    }
+
+    SizeT max_rows = message.max_rows_ > 0 ? message.max_rows_ : 0;
+    if (SendRows(portal.result_->result_table_, portal.column_formats_, portal.block_idx_, portal.row_idx_, max_rows)) {
+        SendComplete(*portal.result_);
+    } else {
+        pg_handler_->SendPortalSuspended();
+    }
+}
+
+void Connection::HandleClose() {
+    PGCloseMessage message = pg_handler_->ReadCloseMessage();
+    LOG_TRACE(fmt::format("Close: {} {}", static_cast<char>(message.object_type_), message.name_));
+
+    if (message.object_type_ == PGObjectType::kStatement) {
+        prepared_statements_.erase(message.name_);
+    } else {
+        portals_.erase(message.name_);
+    }
+    pg_handler_->SendCloseComplete();
+}
+
+void Connection::HandleSync() {
+    pg_handler_->SkipMessageBody();
+    // Each statement runs in its own transaction, so all portals end at Sync.
+    portals_.clear();
+    ignore_till_sync_ = false;
+    pg_handler_->send_ready_for_query();
+}
+
+void Connection::HandleExtendedQueryError(const String &error_message) {
+    HashMap<PGMessageType, String> error_message_map;
+    error_message_map[PGMessageType::kHumanReadableError] = error_message;
+    LOG_ERROR(error_message);
+    pg_handler_->send_error_response(error_message_map);
+    ignore_till_sync_ = true;
+}
+
+Status Connection::BindStatement(PGPreparedStatement &statement,
+                                 const Vector<UniquePtr<ConstantExpr>> &params,
+                                 UniquePtr<ParserResult> &parsed_result,
+                                 const BaseStatement *&base_statement) {
+    String query;
+    if (statement.bind_in_text_) {
+        if (Status status = BindInText(statement, params, query); !status.ok()) {
+            return status;
+        }
+        if (statement.parsed_result_.get() != nullptr and statement.parsed_query_ == query) {
+            base_statement = statement.parsed_result_->statements_ptr_->at(0);
+            return Status::OK();
+        }
+    } else if (statement.parsed_result_.get() != nullptr) {
+        for (ConstantExpr *placeholder : statement.placeholders_) {
+            SetPlaceholder(*placeholder, *params[placeholder->param_index_ - 1]);
+        }
+        base_statement = statement.parsed_result_->statements_ptr_->at(0);
+        return Status::OK();
+    } else {
+        query = statement.placeholder_query_;
+    }
+
+    parsed_result = MakeUnique<ParserResult>();
+    parser_->Parse(query, parsed_result.get());
+    if (parsed_result->IsError()) {
+        return Status::InvalidCommand(parsed_result->error_message_);
+    }
+    if (parsed_result->statements_ptr_->size() != 1) {
+        return Status::NotSupport("Only support single statement.");
+    }
+
+    BaseStatement *parsed_statement = parsed_result->statements_ptr_->at(0);
+    Vector<ConstantExpr *> placeholders;
+    if (!statement.bind_in_text_ and statement.param_count_ > 0) {
+        PlaceholderCollector collector(statement.marker_, placeholders);
+        collector.Collect(parsed_statement);
+        for (ConstantExpr *placeholder : placeholders) {
+            SetPlaceholder(*placeholder, *params[placeholder->param_index_ - 1]);
+        }
+    }
+    base_statement = parsed_statement;
+    if (parsed_statement->Type() == StatementType::kSelect) {
+        // Planning doesn't modify a select statement, keep it for the next execution
+        statement.parsed_query_ = std::move(query);
+        statement.parsed_result_ = std::move(parsed_result);
+        statement.placeholders_ = std::move(placeholders);
+    }
+    return Status::OK();
+}
+
+QueryResult Connection::RunPreparedStatement(QueryContext *query_context, PGPreparedStatement &statement, const Vector<UniquePtr<ConstantExpr>> &params) {
+    UniquePtr<ParserResult> parsed_result;
+    const BaseStatement *base_statement = nullptr;
+    if (Status status = BindStatement(statement, params, parsed_result, base_statement); !status.ok()) {
+        QueryResult query_result;
+        query_result.result_table_ = nullptr;
+        query_result.status_ = status;
+        return query_result;
+    }
+    if (base_statement->Type() == StatementType::kAdmin) {
+        String bound_query;
+        if (Status status = BindInText(statement, params, bound_query); !status.ok()) {
+            QueryResult query_result;
+            query_result.result_table_ = nullptr;
+            query_result.status_ = status;
+            return query_result;
+        }
+        return query_context->Query(bound_query);
+    }
+    return query_context->QueryStatement(base_statement);
+}
+
+QueryResult Connection::DescribePreparedStatement(QueryContext *query_context,
+                                                  PGPreparedStatement &statement,
+                                                  const Vector<UniquePtr<ConstantExpr>> &params,
+                                                  StatementType &statement_type) {
+    QueryResult query_result;
+    query_result.result_table_ = nullptr;
+    UniquePtr<ParserResult> parsed_result;
+    const BaseStatement *base_statement = nullptr;
+    if (Status status = BindStatement(statement, params, parsed_result, base_statement); !status.ok()) {
+        query_result.status_ = status;
+        return query_result;
+    }
+    statement_type = base_statement->Type();
+    if (statement_type != StatementType::kSelect) {
+        return query_result;
+    }
+    return query_context->DescribeStatement(base_statement);
+}
+
+void Connection::RunPortal(QueryContext *query_context, PGPortal &portal) {
+    if (portal.result_.get() != nullptr) {
+        return;
+    }
+    portal.result_ = MakeUnique<QueryResult>(RunPreparedStatement(query_context, *portal.statement_, portal.params_));
+    if (!portal.result_->IsOk() or portal.result_->result_table_.get() == nullptr) {
+        return;
+    }
+
+    portal.column_formats_ = ResultColumnFormats(portal.result_formats_, *portal.result_->result_table_);
+}
+
+void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table, const Vector<PGFormatCode> &column_formats) {
     u32 column_name_length_sum = 0;
     SizeT column_count = result_table->ColumnCount();
     for (SizeT idx = 0; idx < column_count; ++idx) {
@@ -376,34 +1331,58 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
             }
         }
 
-        pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width);
+        PGFormatCode format = idx < column_formats.size() ? column_formats[idx] : PGFormatCode::kText;
+        pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width, format);
     }
 }
 
 void Connection::SendQueryResponse(const QueryResult &query_result) {
+    SizeT block_idx = 0;
+    SizeT row_idx = 0;
+    SendRows(query_result.result_table_, {}, block_idx, row_idx, 0);
+    SendComplete(query_result);
+}
 
-    const SharedPtr<DataTable> &result_table = query_result.result_table_;
+bool Connection::SendRows(const SharedPtr<DataTable> &result_table,
+                          const Vector<PGFormatCode> &column_formats,
+                          SizeT &block_idx,
+                          SizeT &row_idx,
+                          SizeT max_rows) {
     SizeT column_count = result_table->ColumnCount();
-    auto values_as_strings = Vector<Optional<String>>(column_count);
     SizeT block_count = result_table->DataBlockCount();
-    for (SizeT idx = 0; idx < block_count; ++idx) {
-        auto block = result_table->GetDataBlockById(idx);
-        SizeT row_count = block->row_count();
+    SizeT sent_rows = 0;
 
-        for (SizeT row_id = 0; row_id < row_count; ++row_id) {
-            SizeT string_length_sum = 0;
+    // reused by all rows, the row is encoded first and then copied into the send buffer
+    Vector<i32> value_lengths(column_count);
+    String values;
 
-            // iterate each column_vector of the block
+    for (; block_idx < block_count; ++block_idx, row_idx = 0) {
+        const auto &block = result_table->GetDataBlockById(block_idx);
+        SizeT row_count = block->row_count();
+
+        for (; row_idx < row_count; ++row_idx) {
+            if (max_rows > 0 and sent_rows == max_rows) {
+                return false;
+            }
+            values.clear();
             for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-                auto &column_vector = block->column_vectors[column_id];
-                const String string_value = column_vector->ToString(row_id);
-                values_as_strings[column_id] = string_value;
-                string_length_sum += string_value.size();
+                const ColumnVector &column_vector = *block->column_vectors[column_id];
+                SizeT value_start = values.size();
+                if (column_id < column_formats.size() and column_formats[column_id] == PGFormatCode::kBinary) {
+                    AppendBinaryValue(column_vector, row_idx, values);
+                } else {
+                    values += column_vector.ToString(row_idx);
+                }
+                value_lengths[column_id] = values.size() - value_start;
             }
-            pg_handler_->SendData(values_as_strings, string_length_sum);
+            pg_handler_->SendDataRow(value_lengths, values);
+            ++sent_rows;
         }
     }
+    return true;
+}
 
+void Connection::SendComplete(const QueryResult &query_result) {
     String message;
     switch (query_result.root_operator_type_) {
         case LogicalNodeType::kInsert: {
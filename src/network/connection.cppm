@@ -23,9 +23,51 @@ import pg_protocol_handler;
 import query_context;
 import data_table;
 import query_result;
+import pg_message;
+import sql_parser;
+import parser_result;
+import column_vector;
+import status;
+import base_statement;
+import constant_expr;
 
 namespace infinity {
 
+// Statement created by a Parse message of the extended query protocol.
+// The $n parameters are replaced by placeholder literals and the values of a Bind are written into the parsed placeholders,
+// so a SELECT is parsed once and planned with the same query whatever its parameters are. Parameters in positions which
+// are not expressions are bound into the query text instead.
+struct PGPreparedStatement {
+    String query_{};
+    Vector<u32> param_types_{};
+    // highest $n in the query
+    SizeT param_count_{};
+
+    // query with the placeholder literal `marker_<n>` for each $n
+    String placeholder_query_{};
+    String marker_{};
+    // the parameters are bound into the query text, the parsed select is reused while the bound query doesn't change
+    bool bind_in_text_{false};
+
+    String parsed_query_{};
+    UniquePtr<ParserResult> parsed_result_{};
+    // placeholders of the parameters in the kept parsed select
+    Vector<ConstantExpr *> placeholders_{};
+};
+
+// Portal created by a Bind message, the query runs on the first Execute of the portal
+struct PGPortal {
+    SharedPtr<PGPreparedStatement> statement_{};
+    Vector<UniquePtr<ConstantExpr>> params_{};
+    Vector<PGFormatCode> result_formats_{};
+
+    UniquePtr<QueryResult> result_{};
+    // format of each result column, resolved when the result is available
+    Vector<PGFormatCode> column_formats_{};
+    SizeT block_idx_{};
+    SizeT row_idx_{};
+};
+
 export class Connection {
 public:
     explicit Connection(boost::asio::io_service &io_service);
@@ -52,10 +94,47 @@ private:
 
     void HandlerSimpleQuery(QueryContext *query_context);
 
-    void SendTableDescription(const SharedPtr<DataTable> &result_table);
+    void HandleParse();
+
+    void HandleBind();
+
+    void HandleDescribe(QueryContext *query_context);
+
+    void HandleExecute(QueryContext *query_context);
+
+    void HandleClose();
+
+    void HandleSync();
+
+    // Report an error of an extended query message, the following messages are skipped until Sync
+    void HandleExtendedQueryError(const String &error_message);
+
+    // Parse a prepared statement with the parameters bound into it, a select is kept in the statement for the next execution
+    Status BindStatement(PGPreparedStatement &statement,
+                         const Vector<UniquePtr<ConstantExpr>> &params,
+                         UniquePtr<ParserResult> &parsed_result,
+                         const BaseStatement *&base_statement);
+
+    QueryResult RunPreparedStatement(QueryContext *query_context, PGPreparedStatement &statement, const Vector<UniquePtr<ConstantExpr>> &params);
+
+    // Result columns of the prepared statement without running it, the result table is empty.
+    // Only a select is described, the result table is null for the other statements.
+    QueryResult DescribePreparedStatement(QueryContext *query_context,
+                                          PGPreparedStatement &statement,
+                                          const Vector<UniquePtr<ConstantExpr>> &params,
+                                          StatementType &statement_type);
+
+    void RunPortal(QueryContext *query_context, PGPortal &portal);
+
+    void SendTableDescription(const SharedPtr<DataTable> &result_table, const Vector<PGFormatCode> &column_formats = {});
 
     void SendQueryResponse(const QueryResult &query_result);
 
+    // Send at most `max_rows` rows (0 for all) from the cursor, return false if rows remain
+    bool SendRows(const SharedPtr<DataTable> &result_table, const Vector<PGFormatCode> &column_formats, SizeT &block_idx, SizeT &row_idx, SizeT max_rows);
+
+    void SendComplete(const QueryResult &query_result);
+
     void HandleError(const char* error_message);
 
 private:
@@ -65,6 +144,12 @@ private:
 
     bool terminate_connection_ = false;
 
+    // extended query protocol state
+    bool ignore_till_sync_ = false;
+    UniquePtr<SQLParser> parser_{};
+    HashMap<String, SharedPtr<PGPreparedStatement>> prepared_statements_{};
+    HashMap<String, UniquePtr<PGPortal>> portals_{};
+
     SharedPtr<RemoteSession> session_{};
 };
 
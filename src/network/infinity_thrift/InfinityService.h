@@ -53,6 +53,7 @@ class InfinityServiceIf {
   virtual void DropIndex(CommonResponse& _return, const DropIndexRequest& request) = 0;
   virtual void ShowIndex(ShowIndexResponse& _return, const ShowIndexRequest& request) = 0;
   virtual void Optimize(CommonResponse& _return, const OptimizeRequest& request) = 0;
+  virtual void CloseCursor(CommonResponse& _return, const CloseCursorRequest& request) = 0;
 };
 
 class InfinityServiceIfFactory {
@@ -175,6 +176,9 @@ class InfinityServiceNull : virtual public InfinityServiceIf {
   void Optimize(CommonResponse& /* _return */, const OptimizeRequest& /* request */) override {
     return;
   }
+  void CloseCursor(CommonResponse& /* _return */, const CloseCursorRequest& /* request */) override {
+    return;
+  }
 };
 
 typedef struct _InfinityService_Connect_args__isset {
@@ -3401,6 +3405,110 @@ class InfinityService_Optimize_presult {
 
 };
 
+typedef struct _InfinityService_CloseCursor_args__isset {
+  _InfinityService_CloseCursor_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_CloseCursor_args__isset;
+
+class InfinityService_CloseCursor_args {
+ public:
+
+  InfinityService_CloseCursor_args(const InfinityService_CloseCursor_args&);
+  InfinityService_CloseCursor_args& operator=(const InfinityService_CloseCursor_args&);
+  InfinityService_CloseCursor_args() noexcept {
+  }
+
+  virtual ~InfinityService_CloseCursor_args() noexcept;
+  CloseCursorRequest request;
+
+  _InfinityService_CloseCursor_args__isset __isset;
+
+  void __set_request(const CloseCursorRequest& val);
+
+  bool operator == (const InfinityService_CloseCursor_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_CloseCursor_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_CloseCursor_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_CloseCursor_pargs {
+ public:
+
+
+  virtual ~InfinityService_CloseCursor_pargs() noexcept;
+  const CloseCursorRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_CloseCursor_result__isset {
+  _InfinityService_CloseCursor_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_CloseCursor_result__isset;
+
+class InfinityService_CloseCursor_result {
+ public:
+
+  InfinityService_CloseCursor_result(const InfinityService_CloseCursor_result&);
+  InfinityService_CloseCursor_result& operator=(const InfinityService_CloseCursor_result&);
+  InfinityService_CloseCursor_result() noexcept {
+  }
+
+  virtual ~InfinityService_CloseCursor_result() noexcept;
+  CommonResponse success;
+
+  _InfinityService_CloseCursor_result__isset __isset;
+
+  void __set_success(const CommonResponse& val);
+
+  bool operator == (const InfinityService_CloseCursor_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_CloseCursor_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_CloseCursor_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_CloseCursor_presult__isset {
+  _InfinityService_CloseCursor_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_CloseCursor_presult__isset;
+
+class InfinityService_CloseCursor_presult {
+ public:
+
+
+  virtual ~InfinityService_CloseCursor_presult() noexcept;
+  CommonResponse* success;
+
+  _InfinityService_CloseCursor_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class InfinityServiceClient : virtual public InfinityServiceIf {
  public:
   InfinityServiceClient(std::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -3519,6 +3627,9 @@ class InfinityServiceClient : virtual public InfinityServiceIf {
   void Optimize(CommonResponse& _return, const OptimizeRequest& request) override;
   void send_Optimize(const OptimizeRequest& request);
   void recv_Optimize(CommonResponse& _return);
+  void CloseCursor(CommonResponse& _return, const CloseCursorRequest& request) override;
+  void send_CloseCursor(const CloseCursorRequest& request);
+  void recv_CloseCursor(CommonResponse& _return);
  protected:
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -3565,6 +3676,7 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_DropIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ShowIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Optimize(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_CloseCursor(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   InfinityServiceProcessor(::std::shared_ptr<InfinityServiceIf> iface) :
     iface_(iface) {
@@ -3599,6 +3711,7 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["DropIndex"] = &InfinityServiceProcessor::process_DropIndex;
     processMap_["ShowIndex"] = &InfinityServiceProcessor::process_ShowIndex;
     processMap_["Optimize"] = &InfinityServiceProcessor::process_Optimize;
+    processMap_["CloseCursor"] = &InfinityServiceProcessor::process_CloseCursor;
   }
 
   virtual ~InfinityServiceProcessor() {}
@@ -3937,6 +4050,16 @@ class InfinityServiceMultiface : virtual public InfinityServiceIf {
     return;
   }
 
+  void CloseCursor(CommonResponse& _return, const CloseCursorRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->CloseCursor(_return, request);
+    }
+    ifaces_[i]->CloseCursor(_return, request);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -4062,6 +4185,9 @@ class InfinityServiceConcurrentClient : virtual public InfinityServiceIf {
   void Optimize(CommonResponse& _return, const OptimizeRequest& request) override;
   int32_t send_Optimize(const OptimizeRequest& request);
   void recv_Optimize(CommonResponse& _return, const int32_t seqid);
+  void CloseCursor(CommonResponse& _return, const CloseCursorRequest& request) override;
+  int32_t send_CloseCursor(const CloseCursorRequest& request);
+  void recv_CloseCursor(CommonResponse& _return, const int32_t seqid);
  protected:
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -395,7 +395,8 @@ int _kIndexTypeValues[] = {
   IndexType::BMP,
   IndexType::Secondary,
   IndexType::EMVB,
-  IndexType::DiskAnn
+  IndexType::DiskAnn,
+  IndexType::Bitmap
 };
 const char* _kIndexTypeNames[] = {
   "IVFFlat",
@@ -404,9 +405,10 @@ const char* _kIndexTypeNames[] = {
   "BMP",
   "Secondary",
   "EMVB",
-  "DiskAnn"
+  "DiskAnn",
+  "Bitmap"
 };
-const std::map<int, const char*> _IndexType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(7, _kIndexTypeValues, _kIndexTypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
+const std::map<int, const char*> _IndexType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(8, _kIndexTypeValues, _kIndexTypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
 
 std::ostream& operator<<(std::ostream& out, const IndexType::type& val) {
   std::map<int, const char*>::const_iterator it = _IndexType_VALUES_TO_NAMES.find(val);
@@ -9874,6 +9876,10 @@ void InsertRequest::__set_fields(const std::vector<Field> & val) {
 void InsertRequest::__set_session_id(const int64_t val) {
   this->session_id = val;
 }
+
+void InsertRequest::__set_column_fields(const std::vector<ColumnField> & val) {
+  this->column_fields = val;
+}
 std::ostream& operator<<(std::ostream& out, const InsertRequest& obj)
 {
   obj.printTo(out);
@@ -9966,6 +9972,26 @@ uint32_t InsertRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->column_fields.clear();
+            uint32_t _size466;
+            ::apache::thrift::protocol::TType _etype469;
+            xfer += iprot->readListBegin(_etype469, _size466);
+            this->column_fields.resize(_size466);
+            uint32_t _i470;
+            for (_i470 = 0; _i470 < _size466; ++_i470)
+            {
+              xfer += this->column_fields[_i470].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.column_fields = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -10019,6 +10045,18 @@ uint32_t InsertRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
   xfer += oprot->writeI64(this->session_id);
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("column_fields", ::apache::thrift::protocol::T_LIST, 6);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->column_fields.size()));
+    std::vector<ColumnField> ::const_iterator _iter471;
+    for (_iter471 = this->column_fields.begin(); _iter471 != this->column_fields.end(); ++_iter471)
+    {
+      xfer += (*_iter471).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -10031,6 +10069,7 @@ void swap(InsertRequest &a, InsertRequest &b) {
   swap(a.column_names, b.column_names);
   swap(a.fields, b.fields);
   swap(a.session_id, b.session_id);
+  swap(a.column_fields, b.column_fields);
   swap(a.__isset, b.__isset);
 }
 
@@ -10040,6 +10079,7 @@ InsertRequest::InsertRequest(const InsertRequest& other377) {
   column_names = other377.column_names;
   fields = other377.fields;
   session_id = other377.session_id;
+  column_fields = other377.column_fields;
   __isset = other377.__isset;
 }
 InsertRequest& InsertRequest::operator=(const InsertRequest& other378) {
@@ -10048,6 +10088,7 @@ InsertRequest& InsertRequest::operator=(const InsertRequest& other378) {
   column_names = other378.column_names;
   fields = other378.fields;
   session_id = other378.session_id;
+  column_fields = other378.column_fields;
   __isset = other378.__isset;
   return *this;
 }
@@ -10059,6 +10100,7 @@ void InsertRequest::printTo(std::ostream& out) const {
   out << ", " << "column_names=" << to_string(column_names);
   out << ", " << "fields=" << to_string(fields);
   out << ", " << "session_id=" << to_string(session_id);
+  out << ", " << "column_fields=" << to_string(column_fields);
   out << ")";
 }
 
@@ -11081,6 +11123,16 @@ void SelectRequest::__set_order_by_list(const std::vector<OrderByExpr> & val) {
   this->order_by_list = val;
 __isset.order_by_list = true;
 }
+
+void SelectRequest::__set_arrow_stream(const bool val) {
+  this->arrow_stream = val;
+__isset.arrow_stream = true;
+}
+
+void SelectRequest::__set_cursor_id(const int64_t val) {
+  this->cursor_id = val;
+__isset.cursor_id = true;
+}
 std::ostream& operator<<(std::ostream& out, const SelectRequest& obj)
 {
   obj.printTo(out);
@@ -11233,6 +11285,22 @@ uint32_t SelectRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 12:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->arrow_stream);
+          this->__isset.arrow_stream = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 13:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->cursor_id);
+          this->__isset.cursor_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -11325,6 +11393,16 @@ uint32_t SelectRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
     }
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.arrow_stream) {
+    xfer += oprot->writeFieldBegin("arrow_stream", ::apache::thrift::protocol::T_BOOL, 12);
+    xfer += oprot->writeBool(this->arrow_stream);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.cursor_id) {
+    xfer += oprot->writeFieldBegin("cursor_id", ::apache::thrift::protocol::T_I64, 13);
+    xfer += oprot->writeI64(this->cursor_id);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -11343,6 +11421,8 @@ void swap(SelectRequest &a, SelectRequest &b) {
   swap(a.limit_expr, b.limit_expr);
   swap(a.offset_expr, b.offset_expr);
   swap(a.order_by_list, b.order_by_list);
+  swap(a.arrow_stream, b.arrow_stream);
+  swap(a.cursor_id, b.cursor_id);
   swap(a.__isset, b.__isset);
 }
 
@@ -11358,6 +11438,8 @@ SelectRequest::SelectRequest(const SelectRequest& other442) {
   limit_expr = other442.limit_expr;
   offset_expr = other442.offset_expr;
   order_by_list = other442.order_by_list;
+  arrow_stream = other442.arrow_stream;
+  cursor_id = other442.cursor_id;
   __isset = other442.__isset;
 }
 SelectRequest& SelectRequest::operator=(const SelectRequest& other443) {
@@ -11372,6 +11454,8 @@ SelectRequest& SelectRequest::operator=(const SelectRequest& other443) {
   limit_expr = other443.limit_expr;
   offset_expr = other443.offset_expr;
   order_by_list = other443.order_by_list;
+  arrow_stream = other443.arrow_stream;
+  cursor_id = other443.cursor_id;
   __isset = other443.__isset;
   return *this;
 }
@@ -11389,6 +11473,8 @@ void SelectRequest::printTo(std::ostream& out) const {
   out << ", " << "limit_expr="; (__isset.limit_expr ? (out << to_string(limit_expr)) : (out << "<null>"));
   out << ", " << "offset_expr="; (__isset.offset_expr ? (out << to_string(offset_expr)) : (out << "<null>"));
   out << ", " << "order_by_list="; (__isset.order_by_list ? (out << to_string(order_by_list)) : (out << "<null>"));
+  out << ", " << "arrow_stream="; (__isset.arrow_stream ? (out << to_string(arrow_stream)) : (out << "<null>"));
+  out << ", " << "cursor_id="; (__isset.cursor_id ? (out << to_string(cursor_id)) : (out << "<null>"));
   out << ")";
 }
 
@@ -11412,6 +11498,16 @@ void SelectResponse::__set_column_defs(const std::vector<ColumnDef> & val) {
 void SelectResponse::__set_column_fields(const std::vector<ColumnField> & val) {
   this->column_fields = val;
 }
+
+void SelectResponse::__set_cursor_id(const int64_t val) {
+  this->cursor_id = val;
+__isset.cursor_id = true;
+}
+
+void SelectResponse::__set_arrow_batch(const std::string& val) {
+  this->arrow_batch = val;
+__isset.arrow_batch = true;
+}
 std::ostream& operator<<(std::ostream& out, const SelectResponse& obj)
 {
   obj.printTo(out);
@@ -11496,6 +11592,22 @@ uint32_t SelectResponse::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->cursor_id);
+          this->__isset.cursor_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->arrow_batch);
+          this->__isset.arrow_batch = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -11545,6 +11657,16 @@ uint32_t SelectResponse::write(::apache::thrift::protocol::TProtocol* oprot) con
   }
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.cursor_id) {
+    xfer += oprot->writeFieldBegin("cursor_id", ::apache::thrift::protocol::T_I64, 5);
+    xfer += oprot->writeI64(this->cursor_id);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.arrow_batch) {
+    xfer += oprot->writeFieldBegin("arrow_batch", ::apache::thrift::protocol::T_STRING, 6);
+    xfer += oprot->writeBinary(this->arrow_batch);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -11556,6 +11678,8 @@ void swap(SelectResponse &a, SelectResponse &b) {
   swap(a.error_msg, b.error_msg);
   swap(a.column_defs, b.column_defs);
   swap(a.column_fields, b.column_fields);
+  swap(a.cursor_id, b.cursor_id);
+  swap(a.arrow_batch, b.arrow_batch);
   swap(a.__isset, b.__isset);
 }
 
@@ -11564,6 +11688,8 @@ SelectResponse::SelectResponse(const SelectResponse& other456) {
   error_msg = other456.error_msg;
   column_defs = other456.column_defs;
   column_fields = other456.column_fields;
+  cursor_id = other456.cursor_id;
+  arrow_batch = other456.arrow_batch;
   __isset = other456.__isset;
 }
 SelectResponse& SelectResponse::operator=(const SelectResponse& other457) {
@@ -11571,6 +11697,8 @@ SelectResponse& SelectResponse::operator=(const SelectResponse& other457) {
   error_msg = other457.error_msg;
   column_defs = other457.column_defs;
   column_fields = other457.column_fields;
+  cursor_id = other457.cursor_id;
+  arrow_batch = other457.arrow_batch;
   __isset = other457.__isset;
   return *this;
 }
@@ -11581,6 +11709,8 @@ void SelectResponse::printTo(std::ostream& out) const {
   out << ", " << "error_msg=" << to_string(error_msg);
   out << ", " << "column_defs=" << to_string(column_defs);
   out << ", " << "column_fields=" << to_string(column_fields);
+  out << ", " << "cursor_id="; (__isset.cursor_id ? (out << to_string(cursor_id)) : (out << "<null>"));
+  out << ", " << "arrow_batch="; (__isset.arrow_batch ? (out << to_string(arrow_batch)) : (out << "<null>"));
   out << ")";
 }
 
@@ -13596,4 +13726,116 @@ void ShowBlockColumnResponse::printTo(std::ostream& out) const {
   out << ")";
 }
 
+
+CloseCursorRequest::~CloseCursorRequest() noexcept {
+}
+
+
+void CloseCursorRequest::__set_session_id(const int64_t val) {
+  this->session_id = val;
+}
+
+void CloseCursorRequest::__set_cursor_id(const int64_t val) {
+  this->cursor_id = val;
+}
+std::ostream& operator<<(std::ostream& out, const CloseCursorRequest& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t CloseCursorRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->session_id);
+          this->__isset.session_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->cursor_id);
+          this->__isset.cursor_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t CloseCursorRequest::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("CloseCursorRequest");
+
+  xfer += oprot->writeFieldBegin("session_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->session_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("cursor_id", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->cursor_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(CloseCursorRequest &a, CloseCursorRequest &b) {
+  using ::std::swap;
+  swap(a.session_id, b.session_id);
+  swap(a.cursor_id, b.cursor_id);
+  swap(a.__isset, b.__isset);
+}
+
+CloseCursorRequest::CloseCursorRequest(const CloseCursorRequest& other486) noexcept {
+  session_id = other486.session_id;
+  cursor_id = other486.cursor_id;
+  __isset = other486.__isset;
+}
+CloseCursorRequest& CloseCursorRequest::operator=(const CloseCursorRequest& other487) noexcept {
+  session_id = other487.session_id;
+  cursor_id = other487.cursor_id;
+  __isset = other487.__isset;
+  return *this;
+}
+void CloseCursorRequest::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "CloseCursorRequest(";
+  out << "session_id=" << to_string(session_id);
+  out << ", " << "cursor_id=" << to_string(cursor_id);
+  out << ")";
+}
+
 } // namespace
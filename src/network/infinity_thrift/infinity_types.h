@@ -203,7 +203,8 @@ struct IndexType {
     BMP = 3,
     Secondary = 4,
     EMVB = 5,
-    DiskAnn = 6
+    DiskAnn = 6,
+    Bitmap = 7
   };
 };
 
@@ -383,6 +384,8 @@ class ShowBlockColumnRequest;
 
 class ShowBlockColumnResponse;
 
+class CloseCursorRequest;
+
 typedef struct _Property__isset {
   _Property__isset() : key(false), value(false) {}
   bool key :1;
@@ -3996,12 +3999,13 @@ void swap(DropTableRequest &a, DropTableRequest &b);
 std::ostream& operator<<(std::ostream& out, const DropTableRequest& obj);
 
 typedef struct _InsertRequest__isset {
-  _InsertRequest__isset() : db_name(false), table_name(false), column_names(true), fields(true), session_id(false) {}
+  _InsertRequest__isset() : db_name(false), table_name(false), column_names(true), fields(true), session_id(false), column_fields(true) {}
   bool db_name :1;
   bool table_name :1;
   bool column_names :1;
   bool fields :1;
   bool session_id :1;
+  bool column_fields :1;
 } _InsertRequest__isset;
 
 class InsertRequest : public virtual ::apache::thrift::TBase {
@@ -4023,6 +4027,7 @@ class InsertRequest : public virtual ::apache::thrift::TBase {
   std::vector<std::string>  column_names;
   std::vector<Field>  fields;
   int64_t session_id;
+  std::vector<ColumnField>  column_fields;
 
   _InsertRequest__isset __isset;
 
@@ -4036,6 +4041,8 @@ class InsertRequest : public virtual ::apache::thrift::TBase {
 
   void __set_session_id(const int64_t val);
 
+  void __set_column_fields(const std::vector<ColumnField> & val);
+
   bool operator == (const InsertRequest & rhs) const
   {
     if (!(db_name == rhs.db_name))
@@ -4048,6 +4055,8 @@ class InsertRequest : public virtual ::apache::thrift::TBase {
       return false;
     if (!(session_id == rhs.session_id))
       return false;
+    if (!(column_fields == rhs.column_fields))
+      return false;
     return true;
   }
   bool operator != (const InsertRequest &rhs) const {
@@ -4410,7 +4419,7 @@ void swap(ExplainResponse &a, ExplainResponse &b);
 std::ostream& operator<<(std::ostream& out, const ExplainResponse& obj);
 
 typedef struct _SelectRequest__isset {
-  _SelectRequest__isset() : session_id(false), db_name(false), table_name(false), select_list(true), search_expr(false), where_expr(false), group_by_list(true), having_expr(false), limit_expr(false), offset_expr(false), order_by_list(true) {}
+  _SelectRequest__isset() : session_id(false), db_name(false), table_name(false), select_list(true), search_expr(false), where_expr(false), group_by_list(true), having_expr(false), limit_expr(false), offset_expr(false), order_by_list(true), arrow_stream(true), cursor_id(false) {}
   bool session_id :1;
   bool db_name :1;
   bool table_name :1;
@@ -4422,6 +4431,8 @@ typedef struct _SelectRequest__isset {
   bool limit_expr :1;
   bool offset_expr :1;
   bool order_by_list :1;
+  bool arrow_stream :1;
+  bool cursor_id :1;
 } _SelectRequest__isset;
 
 class SelectRequest : public virtual ::apache::thrift::TBase {
@@ -4432,7 +4443,9 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
   SelectRequest() noexcept
                 : session_id(0),
                   db_name(),
-                  table_name() {
+                  table_name(),
+                  arrow_stream(false),
+                  cursor_id(0) {
 
 
 
@@ -4451,6 +4464,8 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
   ParsedExpr offset_expr;
   std::vector<OrderByExpr>  order_by_list;
 
+  bool arrow_stream;
+  int64_t cursor_id;
   _SelectRequest__isset __isset;
 
   void __set_session_id(const int64_t val);
@@ -4475,6 +4490,10 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
 
   void __set_order_by_list(const std::vector<OrderByExpr> & val);
 
+  void __set_arrow_stream(const bool val);
+
+  void __set_cursor_id(const int64_t val);
+
   bool operator == (const SelectRequest & rhs) const
   {
     if (!(session_id == rhs.session_id))
@@ -4513,6 +4532,14 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
       return false;
     else if (__isset.order_by_list && !(order_by_list == rhs.order_by_list))
       return false;
+    if (__isset.arrow_stream != rhs.__isset.arrow_stream)
+      return false;
+    else if (__isset.arrow_stream && !(arrow_stream == rhs.arrow_stream))
+      return false;
+    if (__isset.cursor_id != rhs.__isset.cursor_id)
+      return false;
+    else if (__isset.cursor_id && !(cursor_id == rhs.cursor_id))
+      return false;
     return true;
   }
   bool operator != (const SelectRequest &rhs) const {
@@ -4532,11 +4559,13 @@ void swap(SelectRequest &a, SelectRequest &b);
 std::ostream& operator<<(std::ostream& out, const SelectRequest& obj);
 
 typedef struct _SelectResponse__isset {
-  _SelectResponse__isset() : error_code(false), error_msg(false), column_defs(true), column_fields(true) {}
+  _SelectResponse__isset() : error_code(false), error_msg(false), column_defs(true), column_fields(true), cursor_id(false), arrow_batch(false) {}
   bool error_code :1;
   bool error_msg :1;
   bool column_defs :1;
   bool column_fields :1;
+  bool cursor_id :1;
+  bool arrow_batch :1;
 } _SelectResponse__isset;
 
 class SelectResponse : public virtual ::apache::thrift::TBase {
@@ -4546,7 +4575,8 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
   SelectResponse& operator=(const SelectResponse&);
   SelectResponse() noexcept
                  : error_code(0),
-                   error_msg() {
+                   error_msg(),
+                  cursor_id(0) {
 
 
   }
@@ -4557,6 +4587,8 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
   std::vector<ColumnDef>  column_defs;
   std::vector<ColumnField>  column_fields;
 
+  int64_t cursor_id;
+  std::string arrow_batch;
   _SelectResponse__isset __isset;
 
   void __set_error_code(const int64_t val);
@@ -4567,6 +4599,10 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
 
   void __set_column_fields(const std::vector<ColumnField> & val);
 
+  void __set_cursor_id(const int64_t val);
+
+  void __set_arrow_batch(const std::string& val);
+
   bool operator == (const SelectResponse & rhs) const
   {
     if (!(error_code == rhs.error_code))
@@ -4577,6 +4613,14 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
       return false;
     if (!(column_fields == rhs.column_fields))
       return false;
+    if (__isset.cursor_id != rhs.__isset.cursor_id)
+      return false;
+    else if (__isset.cursor_id && !(cursor_id == rhs.cursor_id))
+      return false;
+    if (__isset.arrow_batch != rhs.__isset.arrow_batch)
+      return false;
+    else if (__isset.arrow_batch && !(arrow_batch == rhs.arrow_batch))
+      return false;
     return true;
   }
   bool operator != (const SelectResponse &rhs) const {
@@ -5409,6 +5453,56 @@ void swap(ShowBlockColumnResponse &a, ShowBlockColumnResponse &b);
 
 std::ostream& operator<<(std::ostream& out, const ShowBlockColumnResponse& obj);
 
+typedef struct _CloseCursorRequest__isset {
+  _CloseCursorRequest__isset() : session_id(false), cursor_id(false) {}
+  bool session_id :1;
+  bool cursor_id :1;
+} _CloseCursorRequest__isset;
+
+class CloseCursorRequest : public virtual ::apache::thrift::TBase {
+ public:
+
+  CloseCursorRequest(const CloseCursorRequest&) noexcept;
+  CloseCursorRequest& operator=(const CloseCursorRequest&) noexcept;
+  CloseCursorRequest() noexcept
+                     : session_id(0),
+                       cursor_id(0) {
+  }
+
+  virtual ~CloseCursorRequest() noexcept;
+  int64_t session_id;
+  int64_t cursor_id;
+
+  _CloseCursorRequest__isset __isset;
+
+  void __set_session_id(const int64_t val);
+
+  void __set_cursor_id(const int64_t val);
+
+  bool operator == (const CloseCursorRequest & rhs) const
+  {
+    if (!(session_id == rhs.session_id))
+      return false;
+    if (!(cursor_id == rhs.cursor_id))
+      return false;
+    return true;
+  }
+  bool operator != (const CloseCursorRequest &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const CloseCursorRequest & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(CloseCursorRequest &a, CloseCursorRequest &b);
+
+std::ostream& operator<<(std::ostream& out, const CloseCursorRequest& obj);
+
 } // namespace
 
 #endif
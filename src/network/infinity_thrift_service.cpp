@@ -14,10 +14,18 @@
 
 module;
 
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <string>
 #include <vector>
 
+#include <arrow/array/util.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+
 module infinity_thrift_service;
 
 import third_party;
@@ -62,6 +70,8 @@ import extra_ddl_info;
 
 import column_vector;
 import query_result;
+import data_table;
+import arrow_array_builder;
 
 namespace infinity {
 
@@ -80,6 +90,8 @@ ClientVersions::ClientVersions() {
     client_version_map_[12] = String("0.3.0.dev3");
     client_version_map_[13] = String("0.3.0.dev4");
     client_version_map_[14] = String("0.3.0.dev5");
+    client_version_map_[15] = String("0.3.0.dev6");
+    client_version_map_[16] = String("0.3.0.dev7");
 }
 
 Pair<const char*, Status> ClientVersions::GetVersionByIndex(i64 version_index) {
@@ -93,6 +105,9 @@ Pair<const char*, Status> ClientVersions::GetVersionByIndex(i64 version_index) {
 std::mutex InfinityThriftService::infinity_session_map_mutex_;
 HashMap<u64, SharedPtr<Infinity>> InfinityThriftService::infinity_session_map_;
 ClientVersions InfinityThriftService::client_version_;
+std::mutex InfinityThriftService::arrow_cursor_map_mutex_;
+HashMap<i64, SharedPtr<ArrowSelectCursor>> InfinityThriftService::arrow_cursor_map_;
+i64 InfinityThriftService::next_arrow_cursor_id_ = 0;
 
 void InfinityThriftService::Connect(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::ConnectRequest& request) {
     i64 request_client_version = request.client_version;
@@ -126,6 +141,7 @@ void InfinityThriftService::Connect(infinity_thrift_rpc::CommonResponse &respons
 }
 
 void InfinityThriftService::Disconnect(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::CommonRequest &request) {
+    RemoveArrowCursors(request.session_id);
     auto status = GetAndRemoveSessionID(request.session_id);
     if (status.ok()) {
         response.__set_error_code((i64)(status.code()));
@@ -279,11 +295,23 @@ void InfinityThriftService::Insert(infinity_thrift_rpc::CommonResponse &response
         return;
     }
 
-    if (request.fields.empty()) {
+    if (request.fields.empty() && request.column_fields.empty()) {
         ProcessStatus(response, Status::InsertWithoutValues());
         return;
     }
 
+    if (!request.column_fields.empty()) {
+        Vector<SharedPtr<ColumnVector>> column_vectors;
+        Status column_status = GetColumnVectorsFromColumnFields(request.column_fields, column_vectors);
+        if (!column_status.ok()) {
+            ProcessStatus(response, column_status);
+            return;
+        }
+        auto result = infinity->InsertColumns(request.db_name, request.table_name, request.column_names, column_vectors);
+        ProcessQueryResult(response, result);
+        return;
+    }
+
     auto columns = new Vector<String>();
     columns->reserve(request.column_names.size());
     for (auto &column : request.column_names) {
@@ -445,6 +473,12 @@ void InfinityThriftService::Select(infinity_thrift_rpc::SelectResponse &response
         return;
     }
 
+    // continuation of an arrow_stream select
+    if (request.__isset.cursor_id) {
+        FetchArrowBatch(response, request.session_id, request.cursor_id);
+        return;
+    }
+
     // auto end1 = std::chrono::steady_clock::now();
     //
     // phase_1_duration_ += end1 - start1;
@@ -581,7 +615,15 @@ void InfinityThriftService::Select(infinity_thrift_rpc::SelectResponse &response
     //
     // auto start4 = std::chrono::steady_clock::now();
 
-    if (result.IsOk()) {
+    if (result.IsOk() and request.__isset.arrow_stream and request.arrow_stream) {
+        i64 cursor_id = 0;
+        Status status = OpenArrowCursor(request.session_id, result.result_table_, cursor_id);
+        if (!status.ok()) {
+            ProcessStatus(response, status);
+            return;
+        }
+        FetchArrowBatch(response, request.session_id, cursor_id);
+    } else if (result.IsOk()) {
         auto &columns = response.column_fields;
         columns.resize(result.result_table_->ColumnCount());
         ProcessDataBlocks(result, response, columns);
@@ -835,6 +877,18 @@ void InfinityThriftService::Optimize(infinity_thrift_rpc::CommonResponse& respon
     ProcessQueryResult(response, result);
 }
 
+void InfinityThriftService::CloseCursor(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::CloseCursorRequest &request) {
+    auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
+    if (!infinity_status.ok()) {
+        ProcessStatus(response, infinity_status);
+        return;
+    }
+
+    // a drained, expired or unknown cursor is already gone, closing it is not an error
+    CloseArrowCursor(request.session_id, request.cursor_id);
+    response.__set_error_code((i64)(ErrorCode::kOk));
+}
+
 void InfinityThriftService::ListDatabase(infinity_thrift_rpc::ListDatabaseResponse &response,
                                          const infinity_thrift_rpc::ListDatabaseRequest &request) {
     auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
@@ -1434,6 +1488,212 @@ Status InfinityThriftService::GetAndRemoveSessionID(i64 session_id) {
     return Status::OK();
 }
 
+namespace {
+
+i64 ArrowCursorClockMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+Status InfinityThriftService::OpenArrowCursor(i64 session_id, const SharedPtr<DataTable> &result_table, i64 &cursor_id) {
+    SizeT column_count = result_table->ColumnCount();
+    Vector<SharedPtr<arrow::Field>> fields;
+    fields.reserve(column_count);
+    for (SizeT col_idx = 0; col_idx < column_count; ++col_idx) {
+        SharedPtr<DataType> column_type = result_table->GetColumnTypeById(col_idx);
+        switch (column_type->type()) {
+            case LogicalType::kBoolean:
+            case LogicalType::kTinyInt:
+            case LogicalType::kSmallInt:
+            case LogicalType::kInteger:
+            case LogicalType::kBigInt:
+            case LogicalType::kFloat16:
+            case LogicalType::kBFloat16:
+            case LogicalType::kFloat:
+            case LogicalType::kDouble:
+            case LogicalType::kDate:
+            case LogicalType::kTime:
+            case LogicalType::kDateTime:
+            case LogicalType::kTimestamp:
+            case LogicalType::kVarchar:
+            case LogicalType::kSparse:
+            case LogicalType::kEmbedding:
+            case LogicalType::kTensor:
+            case LogicalType::kTensorArray: {
+                break;
+            }
+            default: {
+                return Status::NotSupport(fmt::format("Arrow stream of {} column: {}", column_type->ToString(), result_table->GetColumnNameById(col_idx)));
+            }
+        }
+        fields.emplace_back(::arrow::field(result_table->GetColumnNameById(col_idx), GetArrowType(column_type)));
+    }
+
+    auto cursor = MakeShared<ArrowSelectCursor>();
+    cursor->session_id_ = session_id;
+    cursor->result_table_ = result_table;
+    cursor->schema_ = ::arrow::schema(std::move(fields));
+    cursor->last_access_ms_ = ArrowCursorClockMs();
+
+    std::lock_guard<std::mutex> lock(arrow_cursor_map_mutex_);
+    ExpireArrowCursors(cursor->last_access_ms_);
+    LimitArrowCursors(session_id);
+    cursor_id = ++next_arrow_cursor_id_;
+    arrow_cursor_map_.emplace(cursor_id, std::move(cursor));
+    LOG_TRACE(fmt::format("THRIFT: Open arrow cursor {} of session {}, {} blocks", cursor_id, session_id, result_table->DataBlockCount()));
+    return Status::OK();
+}
+
+// Serialize the next data block of the cursor as an arrow IPC stream (schema + one record batch).
+// The cursor is marked in use while the batch is built, so a concurrent fetch of the same cursor fails instead of racing,
+// and a close or disconnect meanwhile still finds the cursor and drops it.
+// cursor_id in the response is 0 once the last batch is sent.
+void InfinityThriftService::FetchArrowBatch(infinity_thrift_rpc::SelectResponse &response, i64 session_id, i64 cursor_id) {
+    SharedPtr<ArrowSelectCursor> cursor;
+    {
+        std::lock_guard<std::mutex> lock(arrow_cursor_map_mutex_);
+        ExpireArrowCursors(ArrowCursorClockMs());
+        auto iter = arrow_cursor_map_.find(cursor_id);
+        if (iter == arrow_cursor_map_.end() or iter->second->session_id_ != session_id) {
+            ProcessStatus(response, Status::DataNotExist(fmt::format("Arrow cursor {} of session {}", cursor_id, session_id)));
+            return;
+        }
+        if (iter->second->in_use_) {
+            ProcessStatus(response, Status::NotSupport(fmt::format("Concurrent fetch of arrow cursor {} of session {}", cursor_id, session_id)));
+            return;
+        }
+        cursor = iter->second;
+        cursor->in_use_ = true;
+    }
+
+    DataTable *result_table = cursor->result_table_.get();
+    SizeT block_count = result_table->DataBlockCount();
+    // skip empty blocks, an empty result still sends one batch so that the client gets the schema
+    while (cursor->next_block_idx_ + 1 < block_count and result_table->GetDataBlockById(cursor->next_block_idx_)->row_count() == 0) {
+        result_table->GetDataBlockById(cursor->next_block_idx_).reset();
+        ++cursor->next_block_idx_;
+    }
+
+    SizeT column_count = result_table->ColumnCount();
+    Vector<SharedPtr<arrow::Array>> arrays;
+    arrays.reserve(column_count);
+    i64 row_count = 0;
+    if (cursor->next_block_idx_ < block_count) {
+        SharedPtr<DataBlock> &data_block = result_table->GetDataBlockById(cursor->next_block_idx_);
+        row_count = data_block->row_count();
+        for (SizeT col_idx = 0; col_idx < column_count; ++col_idx) {
+            arrays.emplace_back(BuildArrowArray(result_table->GetColumnTypeById(col_idx), *data_block->column_vectors[col_idx]));
+        }
+        // the block is not needed anymore, release it before the next fetch
+        data_block.reset();
+        ++cursor->next_block_idx_;
+    } else {
+        for (SizeT col_idx = 0; col_idx < column_count; ++col_idx) {
+            arrays.emplace_back(::arrow::MakeEmptyArray(cursor->schema_->field(col_idx)->type()).ValueOrDie());
+        }
+    }
+    SharedPtr<arrow::RecordBatch> batch = arrow::RecordBatch::Make(cursor->schema_, row_count, std::move(arrays));
+
+    Status status;
+    String batch_data;
+    auto sink = ::arrow::io::BufferOutputStream::Create().ValueOrDie();
+    auto writer_result = ::arrow::ipc::MakeStreamWriter(sink, cursor->schema_);
+    if (!writer_result.ok()) {
+        status = Status::IOError(writer_result.status().ToString());
+    } else if (auto arrow_status = writer_result.ValueOrDie()->WriteRecordBatch(*batch); !arrow_status.ok()) {
+        status = Status::IOError(arrow_status.ToString());
+    } else if (arrow_status = writer_result.ValueOrDie()->Close(); !arrow_status.ok()) {
+        status = Status::IOError(arrow_status.ToString());
+    } else {
+        batch_data = sink->Finish().ValueOrDie()->ToString();
+    }
+
+    bool drained = cursor->next_block_idx_ >= block_count;
+    {
+        std::lock_guard<std::mutex> lock(arrow_cursor_map_mutex_);
+        auto iter = arrow_cursor_map_.find(cursor_id);
+        if (iter == arrow_cursor_map_.end() or iter->second != cursor) {
+            // closed, or its session disconnected, while the batch was built
+            ProcessStatus(response, Status::DataNotExist(fmt::format("Arrow cursor {} of session {}", cursor_id, session_id)));
+            return;
+        }
+        if (!status.ok() or drained) {
+            arrow_cursor_map_.erase(iter);
+        } else {
+            cursor->in_use_ = false;
+            cursor->last_access_ms_ = ArrowCursorClockMs();
+        }
+    }
+    if (!status.ok()) {
+        ProcessStatus(response, status);
+        return;
+    }
+
+    response.__set_arrow_batch(std::move(batch_data));
+    if (drained) {
+        response.__set_cursor_id(0);
+        LOG_TRACE(fmt::format("THRIFT: Arrow cursor {} of session {} is drained", cursor_id, session_id));
+    } else {
+        response.__set_cursor_id(cursor_id);
+    }
+    response.__set_error_code((i64)(ErrorCode::kOk));
+}
+
+void InfinityThriftService::RemoveArrowCursors(i64 session_id) {
+    std::lock_guard<std::mutex> lock(arrow_cursor_map_mutex_);
+    ExpireArrowCursors(ArrowCursorClockMs());
+    for (auto iter = arrow_cursor_map_.begin(); iter != arrow_cursor_map_.end();) {
+        if (iter->second->session_id_ == session_id) {
+            iter = arrow_cursor_map_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void InfinityThriftService::CloseArrowCursor(i64 session_id, i64 cursor_id) {
+    std::lock_guard<std::mutex> lock(arrow_cursor_map_mutex_);
+    auto iter = arrow_cursor_map_.find(cursor_id);
+    if (iter != arrow_cursor_map_.end() and iter->second->session_id_ == session_id) {
+        arrow_cursor_map_.erase(iter);
+        LOG_TRACE(fmt::format("THRIFT: Close arrow cursor {} of session {}", cursor_id, session_id));
+    }
+}
+
+// Drop the cursors of all sessions which are idle for longer than the timeout, a cursor in use is not idle
+void InfinityThriftService::ExpireArrowCursors(i64 now_ms) {
+    for (auto iter = arrow_cursor_map_.begin(); iter != arrow_cursor_map_.end();) {
+        const ArrowSelectCursor &cursor = *iter->second;
+        if (!cursor.in_use_ and now_ms - cursor.last_access_ms_ > arrow_cursor_idle_timeout_ms_) {
+            LOG_TRACE(fmt::format("THRIFT: Arrow cursor {} of session {} expired", iter->first, cursor.session_id_));
+            iter = arrow_cursor_map_.erase(iter);
+            continue;
+        }
+        ++iter;
+    }
+}
+
+// Make room for one more cursor of the session by dropping its least recently used cursor which is not in use
+void InfinityThriftService::LimitArrowCursors(i64 session_id) {
+    SizeT session_cursor_count = 0;
+    auto lru_iter = arrow_cursor_map_.end();
+    for (auto iter = arrow_cursor_map_.begin(); iter != arrow_cursor_map_.end(); ++iter) {
+        const ArrowSelectCursor &cursor = *iter->second;
+        if (cursor.session_id_ != session_id) {
+            continue;
+        }
+        ++session_cursor_count;
+        if (!cursor.in_use_ and (lru_iter == arrow_cursor_map_.end() or cursor.last_access_ms_ < lru_iter->second->last_access_ms_)) {
+            lru_iter = iter;
+        }
+    }
+    if (session_cursor_count >= arrow_cursor_session_limit_ and lru_iter != arrow_cursor_map_.end()) {
+        LOG_TRACE(fmt::format("THRIFT: Session {} has {} arrow cursors, drop cursor {}", session_id, session_cursor_count, lru_iter->first));
+        arrow_cursor_map_.erase(lru_iter);
+    }
+}
+
 Tuple<ColumnDef *, Status> InfinityThriftService::GetColumnDefFromProto(const infinity_thrift_rpc::ColumnDef &column_def) {
     auto column_def_data_type_ptr = GetColumnTypeFromProto(column_def.data_type);
     if (column_def_data_type_ptr->type() == infinity::LogicalType::kInvalid) {
@@ -1589,12 +1849,118 @@ IndexType InfinityThriftService::GetIndexTypeFromProto(const infinity_thrift_rpc
             return IndexType::kBMP;
         case infinity_thrift_rpc::IndexType::DiskAnn:
             return IndexType::kDiskAnn;
+        case infinity_thrift_rpc::IndexType::Bitmap:
+            return IndexType::kBitmap;
         default:
             return IndexType::kInvalid;
     }
     return IndexType::kInvalid;
 }
 
+Status InfinityThriftService::GetColumnVectorsFromColumnFields(const Vector<infinity_thrift_rpc::ColumnField> &column_fields,
+                                                               Vector<SharedPtr<ColumnVector>> &column_vectors) {
+    auto make_column = [](LogicalType logical_type, SizeT row_count) {
+        auto column_vector = MakeShared<ColumnVector>(MakeShared<DataType>(logical_type));
+        auto column_vector_type = (logical_type == LogicalType::kBoolean) ? ColumnVectorType::kCompactBit : ColumnVectorType::kFlat;
+        column_vector->Initialize(column_vector_type, std::max(row_count, SizeT(1)));
+        return column_vector;
+    };
+    // The buffer is the array of the values, as the result columns are sent
+    auto decode_pod = [&](const String &buffer, LogicalType logical_type, SizeT width) -> SharedPtr<ColumnVector> {
+        if (buffer.size() % width != 0) {
+            return nullptr;
+        }
+        SizeT row_count = buffer.size() / width;
+        auto column_vector = make_column(logical_type, row_count);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            column_vector->AppendByPtr(reinterpret_cast<const_ptr_t>(buffer.data() + row_idx * width));
+        }
+        return column_vector;
+    };
+
+    column_vectors.reserve(column_fields.size());
+    for (const auto &column_field : column_fields) {
+        if (column_field.column_vectors.size() != 1) {
+            return Status::NotSupport(fmt::format("Columnar insert expects one buffer per column, got {}", column_field.column_vectors.size()));
+        }
+        const String &buffer = column_field.column_vectors[0];
+        SharedPtr<ColumnVector> column_vector;
+        switch (column_field.column_type) {
+            case infinity_thrift_rpc::ColumnType::ColumnBool: {
+                column_vector = make_column(LogicalType::kBoolean, buffer.size());
+                for (char value : buffer) {
+                    column_vector->AppendValue(Value::MakeBool(value != 0));
+                }
+                break;
+            }
+            case infinity_thrift_rpc::ColumnType::ColumnInt8: {
+                column_vector = decode_pod(buffer, LogicalType::kTinyInt, sizeof(TinyIntT));
+                break;
+            }
+            case infinity_thrift_rpc::ColumnType::ColumnInt16: {
+                column_vector = decode_pod(buffer, LogicalType::kSmallInt, sizeof(SmallIntT));
+                break;
+            }
+            case infinity_thrift_rpc::ColumnType::ColumnInt32: {
+                column_vector = decode_pod(buffer, LogicalType::kInteger, sizeof(IntegerT));
+                break;
+            }
+            case infinity_thrift_rpc::ColumnType::ColumnInt64: {
+                column_vector = decode_pod(buffer, LogicalType::kBigInt, sizeof(BigIntT));
+                break;
+            }
+            case infinity_thrift_rpc::ColumnType::ColumnFloat32: {
+                column_vector = decode_pod(buffer, LogicalType::kFloat, sizeof(FloatT));
+                break;
+            }
+            case infinity_thrift_rpc::ColumnType::ColumnFloat64: {
+                column_vector = decode_pod(buffer, LogicalType::kDouble, sizeof(DoubleT));
+                break;
+            }
+            case infinity_thrift_rpc::ColumnType::ColumnVarchar: {
+                // i32 length followed by the bytes, for every row
+                Vector<std::string_view> values;
+                SizeT offset = 0;
+                bool valid = true;
+                while (offset < buffer.size()) {
+                    i32 length = 0;
+                    if (offset + sizeof(i32) > buffer.size()) {
+                        valid = false;
+                        break;
+                    }
+                    std::memcpy(&length, buffer.data() + offset, sizeof(i32));
+                    offset += sizeof(i32);
+                    if (length < 0 || offset + length > buffer.size()) {
+                        valid = false;
+                        break;
+                    }
+                    values.emplace_back(buffer.data() + offset, length);
+                    offset += length;
+                }
+                if (!valid) {
+                    break;
+                }
+                column_vector = make_column(LogicalType::kVarchar, values.size());
+                for (const auto &value : values) {
+                    column_vector->AppendValue(Value::MakeVarchar(value));
+                }
+                break;
+            }
+            default: {
+                return Status::NotSupport(fmt::format("Columnar insert of column {} isn't supported for its type", column_field.column_name));
+            }
+        }
+        if (column_vector.get() == nullptr || (!column_vectors.empty() && column_vector->Size() != column_vectors[0]->Size())) {
+            return Status::ColumnCountMismatch(fmt::format("Column {} has a malformed buffer or a different row count", column_field.column_name));
+        }
+        column_vectors.push_back(std::move(column_vector));
+    }
+    if (column_vectors.empty() || column_vectors[0]->Size() == 0) {
+        return Status::InsertWithoutValues();
+    }
+    return Status::OK();
+}
+
 ConstantExpr *InfinityThriftService::GetConstantFromProto(Status &status, const infinity_thrift_rpc::ConstantExpr &expr) {
     switch (expr.literal_type) {
         case infinity_thrift_rpc::LiteralType::Boolean: {
@@ -43,6 +43,8 @@ import table_def;
 import internal_types;
 import column_vector;
 import query_result;
+import data_table;
+import third_party;
 
 namespace infinity {
 
@@ -54,16 +56,35 @@ struct ClientVersions {
     Pair<const char*, Status> GetVersionByIndex(i64);
 };
 
+// Result of an arrow_stream select, handed out one data block per fetch
+struct ArrowSelectCursor {
+    i64 session_id_{};
+    SharedPtr<DataTable> result_table_{};
+    SharedPtr<arrow::Schema> schema_{};
+    SizeT next_block_idx_{};
+    i64 last_access_ms_{};
+    // a fetch is building a batch of the cursor, it stays in the map so that it can be closed meanwhile
+    bool in_use_{false};
+};
+
 export class InfinityThriftService final : public infinity_thrift_rpc::InfinityServiceIf {
 private:
     static constexpr std::string_view ErrorMsgHeader = "[THRIFT ERROR]";
-    static constexpr i64 current_version_index_{14}; // 0.3.0.dev5
+    static constexpr i64 current_version_index_{16}; // 0.3.0.dev7
 
     static std::mutex infinity_session_map_mutex_;
     static HashMap<u64, SharedPtr<Infinity>> infinity_session_map_;
 
     static ClientVersions client_version_;
 
+    static std::mutex arrow_cursor_map_mutex_;
+    static HashMap<i64, SharedPtr<ArrowSelectCursor>> arrow_cursor_map_;
+    static i64 next_arrow_cursor_id_;
+    // A cursor the client neither drains nor closes is dropped once it is idle for this long,
+    // and a session opening more cursors than the limit loses its least recently used one
+    static constexpr i64 arrow_cursor_idle_timeout_ms_{300 * 1000};
+    static constexpr SizeT arrow_cursor_session_limit_{16};
+
 public:
     InfinityThriftService() = default;
 
@@ -97,6 +118,8 @@ public:
 
     void Optimize(infinity_thrift_rpc::CommonResponse& response, const infinity_thrift_rpc::OptimizeRequest& request) final;
 
+    void CloseCursor(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::CloseCursorRequest &request) final;
+
     void ListDatabase(infinity_thrift_rpc::ListDatabaseResponse &response, const infinity_thrift_rpc::ListDatabaseRequest &request) final;
 
     void ListTable(infinity_thrift_rpc::ListTableResponse &response, const infinity_thrift_rpc::ListTableRequest &request) final;
@@ -136,6 +159,20 @@ private:
 
     Status GetAndRemoveSessionID(i64 session_id);
 
+    static Status OpenArrowCursor(i64 session_id, const SharedPtr<DataTable> &result_table, i64 &cursor_id);
+
+    static void FetchArrowBatch(infinity_thrift_rpc::SelectResponse &response, i64 session_id, i64 cursor_id);
+
+    static void RemoveArrowCursors(i64 session_id);
+
+    static void CloseArrowCursor(i64 session_id, i64 cursor_id);
+
+    // Called with arrow_cursor_map_mutex_ held
+    static void ExpireArrowCursors(i64 now_ms);
+
+    // Called with arrow_cursor_map_mutex_ held
+    static void LimitArrowCursors(i64 session_id);
+
     static Tuple<ColumnDef *, Status> GetColumnDefFromProto(const infinity_thrift_rpc::ColumnDef &column_def);
 
     static SharedPtr<DataType> GetColumnTypeFromProto(const infinity_thrift_rpc::DataType &type);
@@ -148,6 +185,10 @@ private:
 
     static ConstantExpr *GetConstantFromProto(Status &status, const infinity_thrift_rpc::ConstantExpr &expr);
 
+    // Columnar insert: each column is one buffer in the layout ColumnField uses for results, decoded into a column vector of the sent type
+    static Status GetColumnVectorsFromColumnFields(const Vector<infinity_thrift_rpc::ColumnField> &column_fields,
+                                                   Vector<SharedPtr<ColumnVector>> &column_vectors);
+
     static ColumnExpr *GetColumnExprFromProto(const infinity_thrift_rpc::ColumnExpr &column_expr);
 
     static FunctionExpr *GetFunctionExprFromProto(Status &status, const infinity_thrift_rpc::FunctionExpr &function_expr);
@@ -40,6 +40,12 @@ enum class PGMessageType : unsigned char {
     kRowDescription = 'T',
     kData = 'D',
     kComplete = 'C',
+    kParseComplete = '1',
+    kBindComplete = '2',
+    kCloseComplete = '3',
+    kNoData = 'n',
+    kParameterDescription = 't',
+    kPortalSuspended = 's',
 
     // Errors
     kHumanReadableError = 'M',
@@ -60,6 +66,45 @@ enum class PGMessageType : unsigned char {
     kCloseCommand = 'C',
 };
 
+// Format codes of parameters and result columns in the extended query protocol
+enum class PGFormatCode : i16 {
+    kText = 0,
+    kBinary = 1,
+};
+
+// Target of Describe and Close
+enum class PGObjectType : char {
+    kStatement = 'S',
+    kPortal = 'P',
+};
+
+struct PGParseMessage {
+    String statement_name_{};
+    String query_{};
+    Vector<u32> param_types_{};
+};
+
+struct PGBindMessage {
+    String portal_name_{};
+    String statement_name_{};
+    Vector<PGFormatCode> param_formats_{};
+    Vector<Optional<String>> param_values_{};
+    Vector<PGFormatCode> result_formats_{};
+};
+
+struct PGDescribeMessage {
+    PGObjectType object_type_{PGObjectType::kStatement};
+    String name_{};
+};
+
+using PGCloseMessage = PGDescribeMessage;
+
+struct PGExecuteMessage {
+    String portal_name_{};
+    // 0 means no limit
+    i32 max_rows_{};
+};
+
 enum class TransactionStateType : unsigned char {
     kIDLE = 'I',  // Not in a transaction block
     kBlock = 'T', // In a transaction block
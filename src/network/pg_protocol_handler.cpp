@@ -112,7 +112,7 @@ void PGProtocolHandler::SendDescriptionHeader(u32 total_column_name_length, u32
     buffer_writer_.send_value_u16(column_count);
 }
 
-void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id, u16 width) {
+void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id, u16 width, PGFormatCode format) {
     buffer_writer_.send_string(column_name);
 
     buffer_writer_.send_value_u32(0); // No OID for the table;
@@ -121,36 +121,28 @@ void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id
     buffer_writer_.send_value_u32(object_id); // OID of the type
     buffer_writer_.send_value_u16(width);     // Type width
     buffer_writer_.send_value_i32(-1);        // No modifier
-    buffer_writer_.send_value_i16(0);         // Text format
+    buffer_writer_.send_value_i16(static_cast<i16>(format)); // Text or binary format
 }
 
-void PGProtocolHandler::SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum) {
+void PGProtocolHandler::SendDataRow(const Vector<i32> &value_lengths, const String &values) {
     // https://www.postgresql.org/docs/14/static/protocol-message-formats.html
     buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kData));
 
-    u32 message_size = LENGTH_FIELD_SIZE + sizeof(u16) + values_as_strings.size() * LENGTH_FIELD_SIZE + string_length_sum;
+    u32 message_size = LENGTH_FIELD_SIZE + sizeof(u16) + value_lengths.size() * LENGTH_FIELD_SIZE + values.size();
 
     // Message length field
     buffer_writer_.send_value_u32(message_size);
 
-    u16 column_count = values_as_strings.size();
-
     // Number of columns in row
-    buffer_writer_.send_value_u16(column_count);
-
-    for (u16 idx = 0; idx < column_count; ++idx) {
-        const Optional<String> &value_string = values_as_strings[idx];
-        if (value_string.has_value()) {
-            const String &value_ref = value_string.value();
-
-            // Value string size
-            buffer_writer_.send_value_u32(value_ref.size());
-
-            // Value without terminator
-            buffer_writer_.send_string(value_ref, NullTerminator::kNo);
-        } else {
-            // Null value
-            buffer_writer_.send_value_i32(-1);
+    buffer_writer_.send_value_u16(value_lengths.size());
+
+    SizeT offset = 0;
+    for (i32 value_length : value_lengths) {
+        // Value size, -1 for null value
+        buffer_writer_.send_value_i32(value_length);
+        if (value_length > 0) {
+            buffer_writer_.send_bytes(values.data() + offset, value_length);
+            offset += value_length;
         }
     }
 }
@@ -163,4 +155,113 @@ void PGProtocolHandler::SendComplete(const String &complete_message) {
     buffer_writer_.send_string(complete_message);
 }
 
+PGParseMessage PGProtocolHandler::ReadParseMessage() {
+    PGParseMessage message;
+    buffer_reader_.read_value_u32(); // message length
+    message.statement_name_ = buffer_reader_.read_string();
+    message.query_ = buffer_reader_.read_string();
+    i16 param_count = buffer_reader_.read_value_i16();
+    message.param_types_.reserve(param_count);
+    for (i16 idx = 0; idx < param_count; ++idx) {
+        message.param_types_.push_back(buffer_reader_.read_value_u32());
+    }
+    return message;
+}
+
+PGBindMessage PGProtocolHandler::ReadBindMessage() {
+    PGBindMessage message;
+    buffer_reader_.read_value_u32(); // message length
+    message.portal_name_ = buffer_reader_.read_string();
+    message.statement_name_ = buffer_reader_.read_string();
+
+    i16 format_count = buffer_reader_.read_value_i16();
+    message.param_formats_.reserve(format_count);
+    for (i16 idx = 0; idx < format_count; ++idx) {
+        message.param_formats_.push_back(static_cast<PGFormatCode>(buffer_reader_.read_value_i16()));
+    }
+
+    i16 param_count = buffer_reader_.read_value_i16();
+    message.param_values_.reserve(param_count);
+    for (i16 idx = 0; idx < param_count; ++idx) {
+        i32 value_length = buffer_reader_.read_value_i32();
+        if (value_length < 0) {
+            message.param_values_.emplace_back(None);
+        } else {
+            message.param_values_.emplace_back(buffer_reader_.read_string(value_length, NullTerminator::kNo));
+        }
+    }
+
+    format_count = buffer_reader_.read_value_i16();
+    message.result_formats_.reserve(format_count);
+    for (i16 idx = 0; idx < format_count; ++idx) {
+        message.result_formats_.push_back(static_cast<PGFormatCode>(buffer_reader_.read_value_i16()));
+    }
+    return message;
+}
+
+PGDescribeMessage PGProtocolHandler::ReadDescribeMessage() {
+    PGDescribeMessage message;
+    buffer_reader_.read_value_u32(); // message length
+    message.object_type_ = static_cast<PGObjectType>(buffer_reader_.read_value_i8());
+    message.name_ = buffer_reader_.read_string();
+    return message;
+}
+
+PGCloseMessage PGProtocolHandler::ReadCloseMessage() { return ReadDescribeMessage(); }
+
+PGExecuteMessage PGProtocolHandler::ReadExecuteMessage() {
+    PGExecuteMessage message;
+    buffer_reader_.read_value_u32(); // message length
+    message.portal_name_ = buffer_reader_.read_string();
+    message.max_rows_ = buffer_reader_.read_value_i32();
+    return message;
+}
+
+void PGProtocolHandler::SkipMessageBody() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    if (body_length > 0) {
+        buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    }
+}
+
+void PGProtocolHandler::SendParseComplete() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParseComplete));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendBindComplete() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kBindComplete));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendCloseComplete() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kCloseComplete));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendNoData() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kNoData));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendPortalSuspended() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kPortalSuspended));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendParameterDescription(const Vector<u32> &param_types) {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParameterDescription));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(u16) + param_types.size() * sizeof(u32));
+    buffer_writer_.send_value_u16(param_types.size());
+    for (u32 param_type : param_types) {
+        buffer_writer_.send_value_u32(param_type);
+    }
+}
+
+void PGProtocolHandler::Flush() {
+    if (buffer_writer_.size() > 0) {
+        buffer_writer_.flush();
+    }
+}
+
 } // namespace infinity
@@ -47,11 +47,41 @@ public:
 
     void SendDescriptionHeader(u32 total_column_name_length, u32 column_count);
 
-    void SendDescription(const String &column_name, u32 object_id, u16 width);
+    void SendDescription(const String &column_name, u32 object_id, u16 width, PGFormatCode format = PGFormatCode::kText);
 
-    void SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum);
+    // `values` holds the encoded values back to back, a negative length is a null value
+    void SendDataRow(const Vector<i32> &value_lengths, const String &values);
 
     void SendComplete(const String &complete_message);
+
+    // Extended query protocol
+    PGParseMessage ReadParseMessage();
+
+    PGBindMessage ReadBindMessage();
+
+    PGDescribeMessage ReadDescribeMessage();
+
+    PGCloseMessage ReadCloseMessage();
+
+    PGExecuteMessage ReadExecuteMessage();
+
+    // Consume the body of a message which needs no content, e.g. Sync and Flush, or which is skipped after an error
+    void SkipMessageBody();
+
+    void SendParseComplete();
+
+    void SendBindComplete();
+
+    void SendCloseComplete();
+
+    void SendNoData();
+
+    void SendPortalSuspended();
+
+    void SendParameterDescription(const Vector<u32> &param_types);
+
+    // Messages of the extended protocol are not flushed one by one, only on Sync, Flush or an error
+    void Flush();
     //
     //    pair<String, String> read_parse_packet();
     //    void read_sync_packet();
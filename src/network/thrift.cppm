@@ -15,6 +15,7 @@
 module;
 
 #include <thrift/concurrency/ThreadManager.h>
+#include <thrift/server/TNonblockingServer.h>
 #include <thrift/server/TThreadPoolServer.h>
 #include <thrift/server/TThreadedServer.h>
 #include <thrift/transport/TSocket.h>
@@ -35,6 +36,7 @@ export namespace apache {
             using apache::thrift::server::TThreadedServer;
             using apache::thrift::server::TServer;
             using apache::thrift::server::TThreadPoolServer;
+            using apache::thrift::server::TNonblockingServer;
         }
 
         namespace transport {
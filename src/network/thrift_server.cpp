@@ -105,36 +105,33 @@ void PoolThriftServer::Start() { server->serve(); }
 
 void PoolThriftServer::Shutdown() { server->stop(); }
 
-void NonBlockPoolThriftServer::Init(i32 port_no, i32 pool_size) {
+void NonBlockPoolThriftServer::Init(i32 port_no, i32 pool_size, SizeT io_thread_count, SizeT max_frame_size) {
 
     SharedPtr<ThreadFactory> thread_factory = MakeShared<ThreadFactory>();
-    service_handler_ = MakeShared<InfinityThriftService>();
+    // InfinityThriftService keeps its sessions in static members, one handler is shared by all connections.
+    SharedPtr<InfinityThriftService> service_handler = MakeShared<InfinityThriftService>();
     SharedPtr<infinity_thrift_rpc::InfinityServiceProcessor> service_processor =
-        MakeShared<infinity_thrift_rpc::InfinityServiceProcessor>(service_handler_);
-    SharedPtr<TProtocolFactory> protocol_factory = MakeShared<TBinaryProtocolFactory>();
+        MakeShared<infinity_thrift_rpc::InfinityServiceProcessor>(service_handler);
+    SharedPtr<TBinaryProtocolFactory> protocol_factory = MakeShared<TBinaryProtocolFactory>();
+    protocol_factory->setStrict(true, true);
 
     SharedPtr<ThreadManager> threadManager = ThreadManager::newSimpleThreadManager(pool_size);
     threadManager->threadFactory(thread_factory);
     threadManager->start();
 
-    std::cout << "Non-block API server listen on: 0.0.0.0:" << port_no << ", thread pool: " << pool_size << std::endl;
+    std::cout << "Non-block API server listen on: 0.0.0.0:" << port_no << ", io threads: " << io_thread_count << ", thread pool: " << pool_size
+              << std::endl;
 
     SharedPtr<TNonblockingServerSocket> non_block_socket = MakeShared<TNonblockingServerSocket>(port_no);
 
-    //    server_thread_ = thread_factory->newThread(std::shared_ptr<TServer>(
-    //        new TNonblockingServer(serviceProcessor, protocolFactory, nbSocket1, threadManager)));
-
-    server_thread_ = thread_factory->newThread(MakeShared<TNonblockingServer>(service_processor, protocol_factory, non_block_socket, threadManager));
-
-    //    server = MakeUnique<TThreadPoolServer>(MakeShared<InfinityServiceProcessorFactory>(MakeShared<InfinityServiceCloneFactory>()),
-    //                                           MakeShared<TServerSocket>(port_no),
-    //                                           MakeShared<TBufferedTransportFactory>(),
-    //                                           MakeShared<TBinaryProtocolFactory>(),
-    //                                           threadManager);
+    server_ = MakeShared<TNonblockingServer>(service_processor, protocol_factory, non_block_socket, threadManager);
+    server_->setNumIOThreads(io_thread_count);
+    server_->setMaxFrameSize(max_frame_size);
 }
 
-void NonBlockPoolThriftServer::Start() { server_thread_->start(); }
+// The first io thread runs the event loop in the caller, serve() returns after Shutdown() is called.
+void NonBlockPoolThriftServer::Start() { server_->serve(); }
 
-void NonBlockPoolThriftServer::Shutdown() { server_thread_->join(); }
+void NonBlockPoolThriftServer::Shutdown() { server_->stop(); }
 
 } // namespace infinity
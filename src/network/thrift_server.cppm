@@ -56,14 +56,14 @@ private:
 
 export class NonBlockPoolThriftServer {
 public:
-    void Init(i32 port_no, i32 pool_size);
+    // Only framed clients are served, the frames larger than `max_frame_size` are rejected
+    void Init(i32 port_no, i32 pool_size, SizeT io_thread_count, SizeT max_frame_size);
     void Start();
     void Shutdown();
 
 private:
-    //    UniquePtr<TServer> server{nullptr};
-    SharedPtr<InfinityThriftService> service_handler_{};
-    SharedPtr<apache::thrift::concurrency::Thread> server_thread_{};
+    // Connections are multiplexed on a few event loop (epoll) threads, the worker pool only bounds the number of requests in flight.
+    SharedPtr<apache::thrift::server::TNonblockingServer> server_{nullptr};
 };
 
 } // namespace infinity
@@ -80,6 +80,8 @@ public:
     std::vector<std::shared_ptr<ConstantExpr>> sub_array_array_{};
     std::pair<std::vector<int64_t>, std::vector<int64_t>> long_sparse_array_{};
     std::pair<std::vector<int64_t>, std::vector<double>> double_sparse_array_{};
+    // 1-based index of the $n parameter of a prepared statement bound into this constant, 0 for a literal of the query
+    int64_t param_index_{0};
 };
 
 } // namespace infinity
@@ -771,16 +771,16 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  98
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1291
+#define YYLAST   1241
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  207
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  114
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  477
+#define YYNRULES  478
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  1028
+#define YYNSTATES  1030
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   445
@@ -864,38 +864,38 @@ static const yytype_int16 yyrline[] =
      906,   909,   914,   919,   926,   932,   942,   958,   992,  1005,
     1008,  1015,  1021,  1024,  1027,  1030,  1033,  1036,  1039,  1042,
     1049,  1062,  1066,  1071,  1084,  1097,  1112,  1127,  1142,  1165,
-    1218,  1273,  1324,  1327,  1330,  1339,  1349,  1352,  1356,  1361,
-    1383,  1386,  1391,  1407,  1410,  1414,  1418,  1423,  1429,  1432,
-    1435,  1439,  1443,  1445,  1449,  1451,  1454,  1458,  1461,  1465,
-    1470,  1474,  1477,  1481,  1484,  1488,  1491,  1495,  1498,  1501,
-    1504,  1512,  1515,  1530,  1530,  1532,  1546,  1555,  1560,  1569,
-    1574,  1579,  1585,  1592,  1595,  1599,  1602,  1607,  1619,  1626,
-    1640,  1643,  1646,  1649,  1652,  1655,  1658,  1664,  1668,  1672,
-    1676,  1680,  1687,  1691,  1695,  1699,  1703,  1708,  1712,  1717,
-    1721,  1725,  1731,  1737,  1743,  1754,  1765,  1776,  1788,  1800,
-    1813,  1827,  1838,  1852,  1868,  1885,  1889,  1893,  1897,  1901,
-    1905,  1915,  1919,  1923,  1931,  1942,  1965,  1971,  1976,  1982,
-    1988,  1996,  2002,  2008,  2014,  2020,  2028,  2034,  2040,  2046,
-    2052,  2060,  2066,  2073,  2086,  2090,  2095,  2101,  2108,  2116,
-    2125,  2135,  2145,  2156,  2167,  2179,  2191,  2201,  2212,  2224,
-    2237,  2241,  2246,  2251,  2262,  2266,  2271,  2275,  2302,  2308,
-    2312,  2313,  2314,  2315,  2316,  2318,  2321,  2327,  2330,  2331,
-    2332,  2333,  2334,  2335,  2336,  2337,  2338,  2339,  2341,  2344,
-    2350,  2369,  2414,  2452,  2494,  2540,  2561,  2581,  2599,  2617,
-    2625,  2636,  2642,  2651,  2657,  2669,  2672,  2675,  2678,  2681,
-    2684,  2688,  2692,  2697,  2705,  2713,  2722,  2729,  2736,  2743,
-    2750,  2757,  2765,  2773,  2781,  2789,  2797,  2805,  2813,  2821,
-    2829,  2837,  2845,  2853,  2883,  2891,  2900,  2908,  2917,  2925,
-    2931,  2938,  2944,  2951,  2956,  2963,  2970,  2978,  3002,  3008,
-    3014,  3021,  3029,  3036,  3043,  3048,  3058,  3063,  3068,  3073,
-    3078,  3083,  3088,  3093,  3098,  3103,  3106,  3109,  3113,  3116,
-    3119,  3122,  3126,  3129,  3132,  3136,  3140,  3145,  3150,  3153,
-    3157,  3161,  3168,  3175,  3179,  3186,  3193,  3197,  3201,  3205,
-    3208,  3212,  3216,  3221,  3226,  3230,  3235,  3240,  3246,  3252,
-    3258,  3264,  3270,  3276,  3282,  3288,  3294,  3300,  3306,  3317,
-    3321,  3326,  3356,  3366,  3371,  3376,  3381,  3387,  3391,  3392,
-    3394,  3395,  3397,  3398,  3410,  3418,  3422,  3425,  3429,  3432,
-    3436,  3440,  3445,  3451,  3461,  3469,  3480,  3511
+    1228,  1293,  1348,  1351,  1354,  1363,  1373,  1376,  1380,  1385,
+    1407,  1410,  1415,  1431,  1434,  1438,  1442,  1447,  1453,  1456,
+    1459,  1463,  1467,  1469,  1473,  1475,  1478,  1482,  1485,  1489,
+    1494,  1498,  1501,  1505,  1508,  1512,  1515,  1519,  1522,  1525,
+    1528,  1536,  1539,  1554,  1554,  1556,  1570,  1579,  1584,  1593,
+    1598,  1603,  1609,  1616,  1619,  1623,  1626,  1631,  1643,  1650,
+    1664,  1667,  1670,  1673,  1676,  1679,  1682,  1688,  1692,  1696,
+    1700,  1704,  1711,  1715,  1719,  1723,  1727,  1732,  1736,  1741,
+    1745,  1749,  1755,  1761,  1767,  1778,  1789,  1800,  1812,  1824,
+    1837,  1851,  1862,  1876,  1892,  1909,  1913,  1917,  1921,  1925,
+    1929,  1939,  1943,  1947,  1955,  1966,  1989,  1995,  2000,  2006,
+    2012,  2020,  2026,  2032,  2038,  2044,  2052,  2058,  2064,  2070,
+    2076,  2084,  2090,  2097,  2110,  2114,  2119,  2125,  2132,  2140,
+    2149,  2159,  2169,  2180,  2191,  2203,  2215,  2225,  2236,  2248,
+    2261,  2265,  2270,  2275,  2286,  2290,  2295,  2299,  2326,  2332,
+    2336,  2337,  2338,  2339,  2340,  2342,  2345,  2351,  2354,  2355,
+    2356,  2357,  2358,  2359,  2360,  2361,  2362,  2363,  2365,  2368,
+    2374,  2393,  2438,  2476,  2518,  2564,  2585,  2605,  2623,  2641,
+    2649,  2660,  2666,  2675,  2681,  2693,  2696,  2699,  2702,  2705,
+    2708,  2712,  2716,  2721,  2729,  2737,  2746,  2753,  2760,  2767,
+    2774,  2781,  2789,  2797,  2805,  2813,  2821,  2829,  2837,  2845,
+    2853,  2861,  2869,  2877,  2907,  2915,  2924,  2932,  2941,  2949,
+    2955,  2962,  2968,  2975,  2980,  2987,  2994,  3002,  3026,  3032,
+    3038,  3045,  3053,  3060,  3067,  3072,  3082,  3087,  3092,  3097,
+    3102,  3107,  3112,  3117,  3122,  3127,  3130,  3133,  3137,  3140,
+    3143,  3146,  3150,  3153,  3156,  3160,  3164,  3169,  3174,  3177,
+    3181,  3185,  3192,  3199,  3203,  3210,  3217,  3221,  3225,  3229,
+    3232,  3236,  3240,  3245,  3250,  3254,  3259,  3264,  3270,  3276,
+    3282,  3288,  3294,  3300,  3306,  3312,  3318,  3324,  3330,  3341,
+    3345,  3350,  3380,  3390,  3395,  3400,  3405,  3410,  3429,  3433,
+    3434,  3436,  3437,  3439,  3440,  3452,  3460,  3464,  3467,  3471,
+    3474,  3478,  3482,  3487,  3493,  3503,  3511,  3522,  3555
 };
 #endif
 
@@ -989,7 +989,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-466)
+#define YYTABLE_NINF (-467)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -998,109 +998,109 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     618,   257,    27,   337,    86,    20,    86,   132,   938,   579,
-      70,   403,   139,   239,   250,   -18,   190,   -37,   263,    63,
-    -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,   201,  -531,
-    -531,   271,  -531,  -531,  -531,  -531,  -531,  -531,   195,   195,
-     195,   195,    38,    86,   221,   221,   221,   221,   221,   104,
-     309,    86,   -32,   336,   349,   357,  -531,  -531,  -531,  -531,
-    -531,  -531,  -531,   331,   366,    86,  -531,  -531,  -531,  -531,
-    -531,   367,  -531,   222,   227,  -531,   380,  -531,   210,  -531,
-    -531,   265,  -531,   393,    86,  -531,  -531,  -531,  -531,   -47,
-    -531,   389,   182,  -531,   429,    80,   246,   259,  -531,    67,
-    -531,   438,  -531,  -531,     2,   401,  -531,   410,   411,   469,
-      86,    86,    86,   487,   436,   313,   430,   553,    86,    86,
-      86,   555,   573,   575,   519,   592,   592,   471,    56,    60,
-      82,  -531,  -531,  -531,  -531,  -531,  -531,  -531,   201,  -531,
-    -531,  -531,  -531,  -531,  -531,   329,  -531,  -531,   595,  -531,
-     598,  -531,  -531,   596,   599,  -531,  -531,  -531,    86,   409,
-     250,   592,   606,  -531,  -531,   607,  -531,  -531,  -531,  -531,
-       2,  -531,  -531,  -531,   471,   559,   548,   543,  -531,   -31,
-    -531,   313,  -531,    86,   617,    15,  -531,  -531,  -531,  -531,
-    -531,   558,  -531,   444,   -33,  -531,   471,  -531,  -531,   556,
-     557,   437,  -531,  -531,   397,   513,   439,   441,   288,   647,
-     649,   651,   657,  -531,  -531,   654,   468,   208,   473,   474,
-     587,   587,  -531,    13,   330,    -8,  -531,    -9,   641,  -531,
+     368,   356,    27,   375,    85,    -3,    85,    72,   679,   604,
+      68,   261,   199,   228,   232,   -56,   223,   -40,   265,    51,
+    -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,    49,  -531,
+    -531,   253,  -531,  -531,  -531,  -531,  -531,  -531,   193,   193,
+     193,   193,   -10,    85,   205,   205,   205,   205,   205,    78,
+     282,    85,   -32,   302,   332,   341,  -531,  -531,  -531,  -531,
+    -531,  -531,  -531,   506,   343,    85,  -531,  -531,  -531,  -531,
+    -531,   345,  -531,   194,   255,  -531,   354,  -531,   197,  -531,
+    -531,   239,  -531,   246,    85,  -531,  -531,  -531,  -531,   -16,
+    -531,   339,   245,  -531,   438,   139,   271,   283,  -531,    67,
+    -531,   442,  -531,  -531,     2,   420,  -531,   434,   459,   486,
+      85,    85,    85,   533,   480,   351,   482,   564,    85,    85,
+      85,   565,   567,   568,   505,   571,   571,   488,    60,   100,
+     143,  -531,  -531,  -531,  -531,  -531,  -531,  -531,    49,  -531,
+    -531,  -531,  -531,  -531,  -531,   307,  -531,  -531,   573,  -531,
+     574,  -531,  -531,   572,   576,  -531,  -531,  -531,    85,   380,
+     232,   571,   578,  -531,  -531,   582,  -531,  -531,  -531,  -531,
+       2,  -531,  -531,  -531,   488,   527,   519,   517,  -531,   -31,
+    -531,   351,  -531,    85,   592,    36,  -531,  -531,  -531,  -531,
+    -531,   537,  -531,   406,   -33,  -531,   488,  -531,  -531,   524,
+     526,   407,  -531,  -531,   609,   542,   408,   409,   266,   603,
+     611,   612,   616,  -531,  -531,   618,   426,   241,   436,   437,
+     626,   626,  -531,    16,   404,  -103,  -531,    -2,   667,  -531,
     -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
-    -531,  -531,   475,  -531,  -531,  -531,    31,  -531,  -531,    44,
-    -531,    45,  -531,  -531,  -531,    73,  -531,    76,  -531,  -531,
+    -531,  -531,   422,  -531,  -531,  -531,  -149,  -531,  -531,    77,
+    -531,   112,  -531,  -531,  -531,   118,  -531,   132,  -531,  -531,
     -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
-    -531,  -531,  -531,  -531,   673,   671,  -531,  -531,  -531,  -531,
-    -531,  -531,  -531,   604,   271,  -531,  -531,   147,   680,   477,
-     485,   -45,   471,   471,   622,  -531,   -37,    66,   640,   510,
-    -531,    98,   512,  -531,    86,   471,   575,  -531,     5,   514,
-     516,   125,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
-    -531,  -531,  -531,  -531,   587,   518,   372,   652,   471,   471,
-     -38,   261,  -531,  -531,  -531,  -531,   397,  -531,   727,   533,
-     534,   535,   536,   729,   741,   388,   388,  -531,   540,  -531,
-    -531,  -531,  -531,   549,   112,   668,   471,   749,   471,   471,
-     -13,   561,   -22,   587,   587,   587,   587,   587,   587,   587,
-     587,   587,   587,   587,   587,   587,   587,    21,  -531,   560,
-    -531,   750,  -531,   751,  -531,   752,  -531,   758,   718,   241,
-     566,  -531,   567,   767,  -531,    39,  -531,  -531,     6,   593,
-     569,  -531,    -2,     5,   471,  -531,   201,   765,   648,   574,
-     107,  -531,  -531,  -531,   -37,   774,  -531,  -531,   775,   471,
-     589,  -531,     5,  -531,    40,    40,   471,  -531,   120,   652,
-     623,   578,    -5,   108,   264,  -531,   471,   471,   706,   471,
-     791,    22,   471,   160,   202,   407,  -531,  -531,   592,  -531,
-    -531,  -531,   643,   597,   587,   330,   669,  -531,   656,   656,
-     258,   258,   532,   656,   656,   258,   258,   388,   388,  -531,
-    -531,  -531,  -531,  -531,  -531,   594,  -531,   602,  -531,  -531,
-    -531,   795,   796,  -531,   806,  -531,  -531,   804,  -531,   -37,
-     613,   901,  -531,    96,  -531,   203,   519,   471,  -531,  -531,
-    -531,     5,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
-    -531,  -531,  -531,   610,  -531,  -531,  -531,  -531,  -531,  -531,
-    -531,  -531,  -531,  -531,  -531,  -531,   621,   624,   625,   629,
-     630,   155,   639,   617,   813,    66,   201,   642,  -531,   223,
-     644,   818,   836,   819,   843,  -531,   866,   234,  -531,   235,
-     240,  -531,   677,  -531,   765,   471,  -531,   471,   -40,   117,
-     587,   -48,   675,  -531,  -149,    34,  -531,   878,  -531,   879,
-    -531,  -531,   807,   330,   656,   684,   255,  -531,   587,   890,
-     892,   847,   852,   710,   268,  -531,   897,    12,     6,   845,
-    -531,  -531,  -531,  -531,  -531,  -531,   854,  -531,   911,  -531,
-    -531,  -531,  -531,  -531,  -531,  -531,  -531,   712,   864,  -531,
-     913,   722,   800,   817,   834,   851,   790,   802,  -531,  -531,
-     145,  -531,   799,   617,   276,   733,  -531,  -531,   772,  -531,
-     471,  -531,  -531,  -531,  -531,  -531,  -531,    40,  -531,  -531,
-    -531,   734,     5,     1,  -531,   471,   508,   738,   943,   560,
-     753,   746,   763,   768,   766,   286,  -531,  -531,   372,   945,
-     947,   421,  -531,   806,    43,    96,   901,     6,     6,   769,
-     203,   899,   915,   290,   777,   778,   779,   780,   781,   782,
-     783,   784,   785,   886,   786,   787,   788,   789,   792,   793,
-     794,   797,   798,   801,   887,   803,   805,   808,   809,   810,
-     811,   812,   814,   815,   816,   902,   820,   821,   822,   823,
-     824,   825,   826,   827,   828,   829,   903,   830,   831,   832,
-     833,   835,   837,   838,   839,   840,   841,   907,   842,  -531,
-    -531,    33,  -531,  -531,  -531,   292,  -531,   806,   998,   297,
-    -531,  -531,  -531,     5,  -531,   545,   844,   299,   846,    16,
-     848,  -531,  -531,  -531,  -531,  -531,    40,  -531,  -531,  -531,
-    -531,  -531,  -531,  -531,  -531,   999,  -531,  -531,  -531,   940,
-     617,  -531,   471,   471,  -531,  -531,  1001,  1003,  1005,  1006,
-    1012,  1016,  1017,  1018,  1033,  1035,   849,  1042,  1044,  1046,
-    1049,  1050,  1051,  1052,  1053,  1054,  1055,   857,  1057,  1058,
-    1059,  1060,  1061,  1062,  1063,  1064,  1065,  1066,   868,  1068,
-    1069,  1070,  1071,  1072,  1073,  1074,  1075,  1076,  1077,   880,
-    1078,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,
-     891,  1089,  -531,  -531,   303,   604,  -531,  -531,  1093,  -531,
-    1094,  1095,  1096,   305,  1097,   471,   310,   896,     5,   900,
-     904,   905,   906,   908,   909,   910,   912,   914,   916,  1098,
-     917,   918,   919,   920,   921,   922,   923,   924,   925,   926,
-    1099,   927,   928,   929,   930,   931,   932,   933,   934,   935,
-     936,  1103,   937,   939,   941,   942,   944,   946,   948,   949,
-     950,   951,  1107,   952,   953,   954,   955,   956,   957,   958,
-     959,   960,   961,  1109,   962,  -531,  -531,   963,   964,   965,
-     325,  -531,   351,     5,  -531,  -531,  -531,  -531,  -531,  -531,
-    -531,  -531,  -531,  -531,  -531,   967,  -531,  -531,  -531,  -531,
-    -531,  -531,  -531,  -531,  -531,  -531,   969,  -531,  -531,  -531,
-    -531,  -531,  -531,  -531,  -531,  -531,  -531,   970,  -531,  -531,
-    -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,   971,  -531,
-    -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,   972,
-    -531,  1113,  -531,  1136,   604,  1139,  1141,  1143,  -531,  -531,
-    -531,  -531,  -531,  -531,  -531,  -531,   343,   973,  -531,   974,
-    1159,   505,   604,  1161,  1138,   975,   -25,   525,  1169,  -531,
-    -531,   977,  -531,  -531,  1140,  1142,  -531,  1174,  -531,  1130,
-     -23,  -531,   982,  -531,  -531,  1144,  1145,  -531,  1182,  -531,
-     987,   988,  1186,   604,   989,  -531,   604,  -531
+    -531,  -531,  -531,  -531,   632,   634,  -531,  -531,  -531,  -531,
+    -531,  -531,  -531,   559,   253,  -531,  -531,    43,   635,   440,
+     445,   -55,   488,   488,   581,  -531,   -40,    30,   596,   462,
+    -531,    18,   464,  -531,    85,   488,   568,  -531,   304,   465,
+     467,   125,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
+    -531,  -531,  -531,  -531,   626,   469,   735,   584,   488,   488,
+     141,   164,  -531,  -531,  -531,  -531,   609,  -531,   658,   471,
+     473,   477,   478,   676,   677,   353,   353,  -531,   479,  -531,
+    -531,  -531,  -531,   484,  -101,   621,   488,   685,   488,   488,
+     -36,   489,   -26,   626,   626,   626,   626,   626,   626,   626,
+     626,   626,   626,   626,   626,   626,   626,    21,  -531,   503,
+    -531,   697,  -531,   698,  -531,   699,  -531,   701,   662,   461,
+     510,  -531,   507,   707,  -531,    39,  -531,  -531,    11,   546,
+     521,  -531,    42,   304,   488,  -531,    49,   844,   599,   530,
+      73,  -531,  -531,  -531,   -40,   729,  -531,  -531,   730,   488,
+     534,  -531,   304,  -531,    40,    40,   488,  -531,    97,   584,
+     579,   538,     0,   109,   249,  -531,   488,   488,   680,   488,
+     753,    22,   488,    98,   138,   536,  -531,  -531,   571,  -531,
+    -531,  -531,   614,   561,   626,   404,   640,  -531,   463,   463,
+      94,    94,   722,   463,   463,    94,    94,   353,   353,  -531,
+    -531,  -531,  -531,  -531,  -531,   566,  -531,   577,  -531,  -531,
+    -531,   765,   771,  -531,   779,  -531,  -531,   778,  -531,   -40,
+     583,   633,  -531,    56,  -531,   209,   505,   488,  -531,  -531,
+    -531,   304,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
+    -531,  -531,  -531,   586,  -531,  -531,  -531,  -531,  -531,  -531,
+    -531,  -531,  -531,  -531,  -531,  -531,   588,   590,   591,   598,
+     601,   218,   602,   592,   772,    30,    49,   606,  -531,   171,
+     605,   800,   805,   806,   809,   811,  -531,   818,   237,  -531,
+     238,   267,  -531,   624,  -531,   844,   488,  -531,   488,   103,
+     131,   626,   -67,   623,  -531,   -47,    45,  -531,   825,  -531,
+     826,  -531,  -531,   751,   404,   463,   630,   272,  -531,   626,
+     827,   829,   782,   794,   654,   276,  -531,   840,    12,    11,
+     789,  -531,  -531,  -531,  -531,  -531,  -531,   790,  -531,   847,
+    -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,   646,   798,
+    -531,   848,   331,   801,   879,   896,   913,   725,   728,  -531,
+    -531,   201,  -531,   736,   592,   281,   656,  -531,  -531,   704,
+    -531,   488,  -531,  -531,  -531,  -531,  -531,  -531,  -531,    40,
+    -531,  -531,  -531,   672,   304,   120,  -531,   488,   645,   670,
+     872,   503,   678,   686,   687,   681,   688,   294,  -531,  -531,
+     735,   873,   874,   137,  -531,   779,   159,    56,   633,    11,
+      11,   696,   209,   832,   842,   295,   700,   705,   706,   716,
+     718,   719,   720,   746,   754,   788,   756,   757,   760,   761,
+     770,   774,   775,   776,   777,   787,   808,   791,   792,   793,
+     804,   810,   816,   817,   819,   820,   821,   865,   822,   823,
+     824,   828,   830,   831,   833,   834,   835,   836,   883,   837,
+     838,   839,   841,   843,   845,   846,   849,   850,   851,   890,
+     852,  -531,  -531,    33,  -531,  -531,  -531,   299,  -531,   779,
+     899,   300,  -531,  -531,  -531,   304,  -531,   549,   853,   309,
+     854,    13,   855,  -531,  -531,  -531,  -531,  -531,    40,  -531,
+    -531,  -531,  -531,  -531,  -531,  -531,  -531,   897,  -531,  -531,
+    -531,   929,   592,  -531,   488,   488,  -531,  -531,   898,   903,
+     906,   993,  1004,  1007,  1008,  1010,  1017,  1024,   856,  1025,
+    1026,  1031,  1039,  1041,  1043,  1046,  1047,  1056,  1057,   859,
+    1059,  1060,  1061,  1062,  1063,  1064,  1065,  1066,  1067,  1068,
+     870,  1070,  1071,  1072,  1073,  1074,  1075,  1076,  1077,  1078,
+    1079,   881,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,
+    1089,  1090,   892,  1092,  -531,  -531,   319,   559,  -531,  -531,
+    1095,  -531,  1096,  1097,  1098,   321,  1099,   488,   323,   901,
+     304,   902,   905,   907,   908,   909,   910,   911,   912,   914,
+     915,  1102,   916,   917,   918,   919,   920,   921,   922,   923,
+     924,   925,  1109,   926,   927,   928,   930,   931,   932,   933,
+     934,   935,   936,  1125,   937,   938,   939,   940,   941,   942,
+     943,   944,   945,   946,  1143,   948,   949,   950,   951,   952,
+     953,   954,   955,   956,   957,  1154,   959,  -531,  -531,   958,
+     960,   961,   325,  -531,   424,   304,  -531,  -531,  -531,  -531,
+    -531,  -531,  -531,  -531,  -531,  -531,  -531,   962,  -531,  -531,
+    -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,   963,  -531,
+    -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,   965,
+    -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
+     966,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,
+    -531,   967,  -531,  1166,  -531,  1167,   559,  1168,  1169,  1170,
+    -531,  -531,  -531,  -531,  -531,  -531,  -531,  -531,   338,   968,
+    -531,   970,  1171,   508,   559,  1172,  1175,   978,   -19,   515,
+    1176,  -531,  -531,   979,  -531,  -531,  1141,  1142,  -531,  1179,
+    -531,  1052,   -18,  -531,   985,  -531,  -531,  1145,  1146,  -531,
+    1186,  -531,   989,   990,  1188,   559,   991,  -531,   559,  -531
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1109,10 +1109,10 @@ static const yytype_int16 yypact[] =
 static const yytype_int16 yydefact[] =
 {
      214,     0,     0,     0,     0,     0,     0,     0,   149,     0,
-       0,     0,     0,     0,     0,     0,     0,   214,     0,   463,
+       0,     0,     0,     0,     0,     0,     0,   214,     0,   464,
        3,     5,    10,    12,    13,    11,     6,     7,     9,   163,
-     162,     0,     8,    14,    15,    16,    17,    18,   461,   461,
-     461,   461,   461,     0,   459,   459,   459,   459,   459,   207,
+     162,     0,     8,    14,    15,    16,    17,    18,   462,   462,
+     462,   462,   462,     0,   460,   460,   460,   460,   460,   207,
        0,     0,     0,     0,     0,     0,   143,   147,   144,   145,
      146,   148,   142,   214,     0,     0,   228,   229,   227,   233,
      237,     0,   234,     0,     0,   230,     0,   232,     0,   255,
@@ -1126,8 +1126,8 @@ static const yytype_int16 yydefact[] =
        0,   231,   256,     0,     0,   259,   258,   283,     0,     0,
        0,     0,     0,   300,   284,     0,   167,   166,     4,   198,
        0,   164,   165,   185,     0,     0,   182,     0,    31,     0,
-      32,   140,   464,     0,     0,   214,   458,   154,   156,   155,
-     157,     0,   208,     0,   192,   151,     0,   136,   457,     0,
+      32,   140,   465,     0,     0,   214,   459,   154,   156,   155,
+     157,     0,   208,     0,   192,   151,     0,   136,   458,     0,
        0,   392,   396,   399,   400,     0,     0,     0,     0,     0,
        0,     0,     0,   397,   398,     0,     0,     0,     0,     0,
        0,     0,   394,     0,   214,     0,   304,   309,   310,   324,
@@ -1136,8 +1136,8 @@ static const yytype_int16 yydefact[] =
      419,     0,   411,   408,   429,     0,   430,     0,   406,   270,
      272,   271,   268,   269,   275,   277,   276,   273,   274,   280,
      282,   281,   278,   279,     0,     0,   246,   245,   251,   241,
-     242,   236,   260,   467,     0,   216,   267,   301,   285,     0,
-       0,   188,     0,     0,   184,   460,   214,     0,     0,     0,
+     242,   236,   260,   468,     0,   216,   267,   301,   285,     0,
+       0,   188,     0,     0,   184,   461,   214,     0,     0,     0,
      134,     0,     0,   138,     0,     0,     0,   150,   191,     0,
        0,     0,   438,   437,   440,   439,   442,   441,   444,   443,
      446,   445,   448,   447,     0,     0,   358,   214,     0,     0,
@@ -1161,90 +1161,90 @@ static const yytype_int16 yydefact[] =
      177,   183,    43,    46,    47,    44,    45,    48,    49,    65,
       50,    52,    51,    68,    55,    56,    57,    53,    54,    58,
       59,    60,    61,    62,    63,    64,     0,     0,     0,     0,
-       0,   467,     0,     0,   469,     0,    35,     0,   135,     0,
-       0,     0,     0,     0,     0,   453,     0,     0,   449,     0,
-       0,   354,     0,   388,     0,     0,   381,     0,     0,     0,
-       0,     0,     0,   392,     0,     0,   341,     0,   343,     0,
-     428,   427,     0,   214,   375,     0,     0,   356,     0,     0,
-       0,   253,   249,   472,     0,   470,   287,     0,     0,     0,
-     221,   222,   223,   224,   220,   225,     0,   210,     0,   205,
-     347,   345,   348,   346,   349,   350,   351,   189,   196,   176,
-       0,     0,     0,     0,     0,     0,     0,     0,   127,   128,
-     131,   124,   131,     0,     0,     0,    33,    38,   477,   306,
-       0,   455,   454,   452,   451,   456,   161,     0,   159,   355,
-     389,     0,   385,     0,   384,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   390,   379,   378,     0,
-       0,     0,   466,     0,     0,   212,   202,     0,     0,   209,
-       0,     0,   194,     0,     0,     0,     0,     0,     0,     0,
+       0,   468,     0,     0,   470,     0,    35,     0,   135,     0,
+       0,     0,     0,     0,     0,     0,   453,     0,     0,   449,
+       0,     0,   354,     0,   388,     0,     0,   381,     0,     0,
+       0,     0,     0,     0,   392,     0,     0,   341,     0,   343,
+       0,   428,   427,     0,   214,   375,     0,     0,   356,     0,
+       0,     0,   253,   249,   473,     0,   471,   287,     0,     0,
+       0,   221,   222,   223,   224,   220,   225,     0,   210,     0,
+     205,   347,   345,   348,   346,   349,   350,   351,   189,   196,
+     176,     0,     0,     0,     0,     0,     0,     0,     0,   127,
+     128,   131,   124,   131,     0,     0,     0,    33,    38,   478,
+     306,     0,   457,   455,   454,   452,   451,   456,   161,     0,
+     159,   355,   389,     0,   385,     0,   384,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   390,   379,
+     378,     0,     0,     0,   467,     0,     0,   212,   202,     0,
+       0,   209,     0,     0,   194,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   129,
-     126,     0,   125,    42,    41,     0,   133,     0,     0,     0,
-     450,   387,   382,   386,   373,     0,     0,     0,     0,     0,
-       0,   412,   414,   413,   342,   344,     0,   391,   380,   254,
-     250,   473,   475,   474,   471,     0,   288,   206,   218,     0,
-       0,   352,     0,     0,   172,    67,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   129,   126,     0,   125,    42,    41,     0,   133,     0,
+       0,     0,   450,   387,   382,   386,   373,     0,     0,     0,
+       0,     0,     0,   412,   414,   413,   342,   344,     0,   391,
+     380,   254,   250,   474,   476,   475,   472,     0,   288,   206,
+     218,     0,     0,   352,     0,     0,   172,    67,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   130,   132,     0,   467,   307,   432,     0,   339,
-       0,     0,     0,     0,   289,     0,     0,   195,   193,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   130,   132,     0,   468,   307,   432,
+       0,   339,     0,     0,     0,     0,   289,     0,     0,   195,
+     193,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   468,   476,     0,     0,     0,
-       0,   160,     0,   219,   211,    66,    72,    73,    70,    71,
-      74,    75,    76,    77,    78,     0,    69,   105,   106,   103,
-     104,   107,   108,   109,   110,   111,     0,   102,    83,    84,
-      81,    82,    85,    86,    87,    88,    89,     0,    80,   116,
-     117,   114,   115,   118,   119,   120,   121,   122,     0,   113,
-      94,    95,    92,    93,    96,    97,    98,    99,   100,     0,
-      91,     0,   340,     0,   467,     0,     0,     0,   291,   290,
-     296,    79,   112,    90,   123,   101,     0,   329,   338,     0,
-     297,   292,   467,     0,     0,     0,   467,     0,     0,   293,
-     334,     0,   328,   330,     0,     0,   337,     0,   298,   294,
-     467,   336,     0,   299,   295,     0,     0,   333,     0,   332,
-       0,     0,     0,   467,     0,   335,   467,   331
+       0,     0,     0,     0,     0,     0,     0,   469,   477,     0,
+       0,     0,     0,   160,     0,   219,   211,    66,    72,    73,
+      70,    71,    74,    75,    76,    77,    78,     0,    69,   105,
+     106,   103,   104,   107,   108,   109,   110,   111,     0,   102,
+      83,    84,    81,    82,    85,    86,    87,    88,    89,     0,
+      80,   116,   117,   114,   115,   118,   119,   120,   121,   122,
+       0,   113,    94,    95,    92,    93,    96,    97,    98,    99,
+     100,     0,    91,     0,   340,     0,   468,     0,     0,     0,
+     291,   290,   296,    79,   112,    90,   123,   101,     0,   329,
+     338,     0,   297,   292,   468,     0,     0,     0,   468,     0,
+       0,   293,   334,     0,   328,   330,     0,     0,   337,     0,
+     298,   294,   468,   336,     0,   299,   295,     0,     0,   333,
+       0,   332,     0,     0,     0,   468,     0,   335,   468,   331
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -531,  -531,  -531,  1100,  -531,  1129,  -531,   658,  -531,   646,
-    -531,   576,   572,  -531,  -519,  1132,  1134,  1020,  -531,  -531,
-    1135,  -531,   898,  1146,  1147,   -59,  1185,   -14,   966,  1036,
-     -63,  -531,  -531,   708,  -531,  -531,  -531,  -531,  -531,  -531,
-    -186,  -531,  -531,  -531,  -531,   615,   -73,     7,   542,  -531,
-    -531,  1048,  -531,  -531,  1148,  1149,  1150,  1151,  1152,  -531,
-    -172,  -531,   860,  -196,  -190,  -531,  -479,  -472,  -468,  -466,
-    -455,  -451,   547,  -531,  -531,  -531,  -531,  -531,  -531,   888,
-    -531,  -531,   850,   488,  -218,  -531,  -531,  -531,   570,  -531,
-    -531,  -531,  -531,   571,   853,   855,   -98,  -531,  -531,  -531,
-    -531,  1007,  -419,   586,  -119,   270,   378,  -531,  -531,  -530,
-    -531,   489,   562,  -531
+    -531,  -531,  -531,  1100,  -531,  1131,  -531,   660,  -531,   641,
+    -531,   580,   575,  -531,  -524,  1134,  1137,  1021,  -531,  -531,
+    1140,  -531,   900,  1144,  1147,   -58,  1187,   -14,   947,  1035,
+     -15,  -531,  -531,   711,  -531,  -531,  -531,  -531,  -531,  -531,
+    -186,  -531,  -531,  -531,  -531,   620,  -104,     7,   544,  -531,
+    -531,  1053,  -531,  -531,  1149,  1151,  1152,  1153,  1155,  -531,
+    -172,  -531,   861,  -196,  -190,  -531,  -479,  -478,  -468,  -466,
+    -451,  -450,   547,  -531,  -531,  -531,  -531,  -531,  -531,   891,
+    -531,  -531,   781,   487,  -219,  -531,  -531,  -531,   585,  -531,
+    -531,  -531,  -531,   587,   857,   858,  -327,  -531,  -531,  -531,
+    -531,  1009,  -419,   589,  -119,   366,   414,  -531,  -531,  -530,
+    -531,   490,   558,  -531
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
        0,    18,    19,    20,   131,    21,   410,   411,   412,   531,
-     620,   621,   733,   413,   301,    22,    23,   185,    24,    63,
+     621,   622,   735,   413,   301,    22,    23,   185,    24,    63,
       25,   194,   195,    26,    27,    28,    29,    30,   106,   171,
      107,   176,   400,   401,   500,   294,   405,   174,   399,   496,
-     197,   774,   672,   104,   490,   491,   492,   493,   599,    31,
-      92,    93,   494,   596,    32,    33,    34,    35,    36,    37,
-     225,   420,   226,   227,   228,   995,   229,   230,   231,   232,
-     233,   234,   606,   607,   235,   236,   237,   238,   239,   331,
-     240,   241,   242,   243,   244,   750,   245,   246,   247,   248,
+     197,   776,   674,   104,   490,   491,   492,   493,   600,    31,
+      92,    93,   494,   597,    32,    33,    34,    35,    36,    37,
+     225,   420,   226,   227,   228,   997,   229,   230,   231,   232,
+     233,   234,   607,   608,   235,   236,   237,   238,   239,   331,
+     240,   241,   242,   243,   244,   752,   245,   246,   247,   248,
      249,   250,   251,   252,   351,   352,   253,   254,   255,   256,
-     257,   258,   547,   548,   199,   117,   109,   100,   114,   391,
-     626,   584,   585,   416
+     257,   258,   548,   549,   199,   117,   109,   100,   114,   391,
+     627,   585,   586,   416
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1252,270 +1252,260 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     308,   622,   291,    97,   138,   350,   549,   200,   307,    49,
-     105,    50,   330,    52,   624,   326,   600,   158,   347,   348,
-      90,   347,   348,   601,   472,   563,   296,   602,   354,   603,
-     345,   346,   101,   398,   102,   196,   103,   202,   203,   204,
-     604,   172,   286,    14,   605,   644,   125,   126,   357,   302,
-     115,   329,   554,   456,   377,   390,   649,   390,   124,   259,
-      43,   260,   261,   264,   453,   265,   266,  -462,   487,   407,
-     498,   499,   145,   765,     1,   766,     2,     3,     4,     5,
-       6,     7,     8,     9,   488,   269,   742,   270,   271,    49,
-      10,   157,    11,    12,    13,    14,   402,   403,    51,   597,
-      84,  1004,  -465,  1015,   735,   358,   359,   290,   457,   422,
-     541,   542,   108,   358,   359,   358,   359,   179,   180,   181,
-     262,   543,   544,   545,   267,   188,   189,   190,   201,   202,
-     203,   204,   432,   433,   326,   209,   210,   211,  1005,   428,
-    1016,   212,    88,   454,   358,   359,   272,    14,   358,   359,
-      94,   358,   359,   598,   358,   359,   122,   647,   358,   359,
-     356,   474,   451,   452,    17,   283,   213,   214,   215,   127,
+     308,   623,   291,    97,   350,   138,   550,   200,   307,   625,
+     105,    50,   330,    52,    49,   326,   601,   602,   347,   348,
+      90,   347,   348,   398,   472,   564,   296,   603,   354,   604,
+     345,   346,   101,   407,   102,   196,   103,   202,   203,   204,
+      14,   453,   286,   541,   605,   606,   125,   126,   158,   456,
+     115,   378,   358,   359,  -466,   357,   379,   555,   124,   598,
+      43,   390,   390,   259,   108,   260,   261,  -463,   487,   101,
+     302,   102,   145,   103,     1,    51,     2,     3,     4,     5,
+       6,     7,     8,     9,   488,   393,   358,   359,    49,   172,
+      10,   157,    11,    12,    13,   394,   402,   403,    84,   355,
+     737,   447,   356,   264,   457,   265,   266,  1006,  1017,   422,
+     542,   543,    94,   599,   498,   499,    14,   179,   180,   181,
+     454,   544,   545,   546,   262,   188,   189,   190,   201,   202,
+     203,   204,   432,   433,   326,   209,   210,   211,   649,   428,
+     763,   212,   764,   765,  1007,  1018,   269,    14,   270,   271,
+     356,   358,   359,   358,   359,   290,   377,   408,   651,   409,
+     474,    17,   451,   452,   267,   283,   213,   214,   215,   127,
      297,   303,   306,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   358,   359,   393,
-     299,   600,   426,   408,   355,   409,   555,   356,   601,   394,
-     205,   206,   602,   170,   603,   645,    95,   489,   501,   207,
-     353,   208,   223,   349,   665,   604,   349,   473,   222,   605,
-     616,   101,   263,   102,   546,   103,   268,   209,   210,   211,
-     616,   378,   223,   212,    15,   390,   379,   406,   162,   650,
-     558,   559,    89,   561,   380,   382,   565,   539,   273,   381,
-     383,   846,    16,    91,   550,   163,   164,   165,   213,   214,
-     215,   358,   359,    98,   574,   358,   359,    99,    17,   108,
-     358,   359,   617,   384,   618,   619,   386,   731,   385,   105,
-     216,   387,   617,   576,   618,   619,    38,    39,    40,   482,
-     483,   201,   202,   203,   204,   116,    53,    54,    41,    42,
-     417,   402,    55,   418,   217,   906,   218,   122,   219,   534,
-     608,   421,   535,   431,   447,   118,   119,   120,   121,   220,
-     221,   222,   551,   123,   223,   356,   224,   427,   339,   572,
-     340,   341,   342,   201,   202,   203,   204,   843,     1,   128,
-       2,     3,     4,     5,     6,     7,   435,     9,   436,   556,
-     437,   557,   129,   437,    10,   536,    11,    12,    13,   642,
-     130,   643,   566,   205,   206,   567,    44,    45,    46,   144,
-     646,   274,   207,   146,   208,   275,   276,   329,    47,    48,
-     277,   278,   217,   151,   218,   152,   219,   160,   658,   362,
-     209,   210,   211,   976,   147,   148,   212,   977,   978,   149,
-     150,   655,   979,   980,   568,   205,   206,   569,  -466,  -466,
-      14,    14,   570,   571,   207,   552,   208,   110,   111,   112,
-     113,   213,   214,   215,   761,   629,   762,   763,   356,   153,
-     587,   748,   209,   210,   211,   161,   636,   638,   212,   637,
-     637,   575,   639,   216,   988,   356,   159,   430,   166,   743,
-    -466,  -466,   372,   373,   374,   375,   376,   657,   739,   169,
-     356,   167,  1000,   213,   214,   215,  1006,   217,   173,   218,
-     662,   219,   178,   663,   201,   202,   203,   204,   736,   175,
-    1017,   418,   220,   221,   222,   216,   177,   223,   758,   224,
-     182,   356,   775,  1025,   833,   776,  1027,   418,    15,   836,
-     183,   839,   356,   362,   840,   905,   186,   911,   663,   217,
-     637,   218,   914,   219,   184,   418,   201,   202,   203,   204,
-     363,   364,   365,   366,   220,   221,   222,   974,   368,   223,
-     975,   224,    17,   312,   313,   314,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,   992,   205,   206,   993,   746,
-     347,   837,   753,   998,   999,   207,   187,   208,   191,   654,
-      85,    86,    87,   369,   370,   371,   372,   373,   374,   375,
-     376,  1007,  1008,   209,   210,   211,   192,   848,   193,   212,
-     154,   155,   156,   430,   374,   375,   376,   196,   324,   325,
-     201,   202,   203,   204,   768,   769,   198,   207,   279,   208,
-     847,   280,   281,   282,   213,   214,   215,   430,    64,    65,
-     284,    66,   287,   288,   292,   209,   210,   211,   293,   295,
-     300,   212,   304,    67,    68,     1,   216,     2,     3,     4,
-       5,     6,     7,     8,     9,   305,   309,   310,   311,   362,
-     327,    10,   328,    11,    12,    13,   213,   214,   215,   913,
-     217,   332,   218,   333,   219,   334,   363,   364,   365,   366,
-     336,   335,   324,   362,   368,   220,   221,   222,   216,   338,
-     223,   207,   224,   208,   343,   344,   388,   389,   377,   396,
-     363,   364,   365,   366,   390,   578,   395,   397,   368,   209,
-     210,   211,   217,   404,   218,   212,   219,   414,    14,   369,
-     370,   371,   372,   373,   374,   375,   376,   220,   221,   222,
-     744,   415,   223,   419,   224,   424,   360,   425,   361,   429,
-     213,   214,   215,   369,   370,   371,   372,   373,   374,   375,
-     376,   438,    14,   443,   439,   440,   441,   442,    69,    70,
-      71,    72,   216,    73,    74,   444,   445,   448,    75,    76,
-      77,   446,   450,    78,    79,    80,   475,   477,   479,   223,
-      81,    82,   455,   480,   481,    83,   217,   484,   218,   485,
-     219,   495,   362,   486,   497,   533,   532,   537,   538,   454,
-     553,   220,   221,   222,   560,    15,   223,   362,   224,   363,
-     364,   365,   366,   367,   540,   562,   358,   368,   573,   577,
-     579,   581,   582,    16,  -466,  -466,   365,   366,   580,   583,
-     586,   610,  -466,   674,   675,   676,   677,   678,   588,    17,
-     679,   680,   611,   633,   631,   612,   613,   681,   682,   683,
-     614,   615,   369,   370,   371,   372,   373,   374,   375,   376,
-     623,   625,   632,   684,   628,   630,   634,  -466,   370,   371,
-     372,   373,   374,   375,   376,   502,   503,   504,   505,   506,
-     507,   508,   509,   510,   511,   512,   513,   514,   515,   516,
-     517,   518,   635,   519,   520,   521,   522,   523,   524,   640,
-     648,   525,   651,   652,   526,   527,   656,   653,   528,   529,
-     530,   685,   686,   687,   688,   689,   571,   570,   690,   691,
-     659,   661,   660,   664,   667,   692,   693,   694,   696,   697,
-     698,   699,   700,   668,   669,   701,   702,   670,   671,   673,
-     729,   695,   703,   704,   705,   707,   708,   709,   710,   711,
-     730,   731,   712,   713,   737,   738,   741,   745,   706,   714,
-     715,   716,   718,   719,   720,   721,   722,   747,   754,   723,
-     724,   759,   749,   760,   772,   717,   725,   726,   727,   589,
-    -226,   590,   591,   592,   593,   755,   594,   595,   757,   756,
-     770,   773,   728,    56,    57,    58,    59,    60,    61,   786,
-     797,    62,   777,   778,   779,   780,   781,   782,   783,   784,
-     785,   787,   788,   789,   790,   808,   819,   791,   792,   793,
-     830,   835,   794,   795,   845,   844,   796,   849,   798,   850,
-     799,   851,   852,   800,   801,   802,   803,   804,   853,   805,
-     806,   807,   854,   855,   856,   809,   810,   811,   812,   813,
-     814,   815,   816,   817,   818,   820,   821,   822,   823,   857,
-     824,   858,   825,   826,   827,   828,   829,   831,   860,   838,
-     861,   841,   862,   842,   859,   863,   864,   865,   866,   867,
-     868,   869,   870,   871,   872,   873,   874,   875,   876,   877,
+     465,   466,   467,   468,   469,   470,   471,   122,   646,   767,
+     299,   768,   426,   601,   602,   358,   359,   556,   358,   359,
+     205,   206,    88,   170,   603,   744,   604,   272,   501,   207,
+     353,   208,   489,   349,   667,   223,   349,   473,   222,   647,
+     417,   605,   606,   418,   547,   362,   263,   209,   210,   211,
+     329,    89,   223,   212,    15,    91,    53,    54,   406,    95,
+     559,   560,    55,   562,  -467,  -467,   566,   539,   848,   435,
+     652,   436,    16,   437,   551,    99,   358,   359,   213,   214,
+     215,   105,   358,   359,   575,    98,   268,   108,    17,   201,
+     202,   203,   204,   358,   359,   534,   617,   380,   535,   116,
+     216,   122,   381,   577,   358,   359,  -467,  -467,   372,   373,
+     374,   375,   376,   617,   358,   359,   123,   162,   390,   552,
+     567,   402,   356,   568,   217,   128,   218,   908,   219,   273,
+     609,   421,   382,   431,   163,   164,   165,   383,   384,   220,
+     221,   222,   748,   385,   223,   755,   224,   427,   618,   573,
+     619,   620,   386,   733,   557,   129,   558,   387,   437,   845,
+     569,   205,   206,   570,   130,   618,   144,   619,   620,   274,
+     207,   146,   208,   275,   276,   329,   536,   151,   277,   278,
+     644,   339,   645,   340,   341,   342,   147,   148,   209,   210,
+     211,   648,   152,   630,   212,     1,   356,     2,     3,     4,
+       5,     6,     7,     8,     9,    38,    39,    40,   217,   660,
+     218,    10,   219,    11,    12,    13,   159,    41,    42,   213,
+     214,   215,   657,   153,    44,    45,    46,   201,   202,   203,
+     204,   118,   119,   120,   121,   553,    47,    48,    85,    86,
+      87,   216,   676,   677,   678,   679,   680,   149,   150,   681,
+     682,   588,   750,   154,   155,   156,   683,   684,   685,   638,
+     640,   576,   639,   639,   161,   217,   990,   218,    14,   219,
+     160,   745,   686,   110,   111,   112,   113,   358,   359,   741,
+     220,   221,   222,   169,  1002,   223,   978,   224,  1008,   641,
+     979,   980,   356,   166,   659,   981,   982,   356,   664,   205,
+     206,   665,  1019,   738,    14,   167,   418,   173,   207,   178,
+     208,   201,   202,   203,   204,  1027,   760,   777,  1029,   356,
+     778,   835,   838,   175,   418,   356,   209,   210,   211,   482,
+     483,   841,   212,     1,   842,     2,     3,     4,     5,     6,
+       7,   907,     9,   913,   665,   916,   639,   976,   418,    10,
+     977,    11,    12,    13,   177,    15,   182,   213,   214,   215,
+     994,   571,   572,   995,   183,   201,   202,   203,   204,   374,
+     375,   376,   184,    16,   347,   839,  1000,  1001,   186,   216,
+     656,  1009,  1010,   205,   206,   770,   771,   187,   191,    17,
+     192,   193,   207,   196,   208,   198,   279,   280,   281,   850,
+     282,   284,   292,   217,   287,   218,    14,   219,   288,   293,
+     209,   210,   211,   295,   362,   300,   212,   305,   220,   221,
+     222,   304,   849,   223,   309,   224,   310,   332,   311,   327,
+     328,  -467,  -467,   365,   366,   333,   334,   324,   325,  -467,
+     335,   213,   214,   215,   336,   377,   207,   338,   208,   201,
+     202,   203,   204,    64,    65,   388,    66,   343,   344,   390,
+     389,   395,   396,   216,   209,   210,   211,   397,    67,    68,
+     212,   915,   404,   414,  -467,   370,   371,   372,   373,   374,
+     375,   376,   438,   415,    14,   419,   424,   217,   425,   218,
+     429,   219,   439,    15,   440,   213,   214,   215,   441,   442,
+     443,   444,   220,   221,   222,   445,   446,   223,   450,   224,
+     455,   590,  -226,   591,   592,   593,   594,   216,   595,   596,
+     448,   324,   223,   475,   477,   479,   480,    17,   481,   485,
+     207,   484,   208,   486,    56,    57,    58,    59,    60,    61,
+     430,   217,    62,   218,   495,   219,   497,   532,   209,   210,
+     211,   533,   537,   538,   212,   454,   220,   221,   222,   540,
+     554,   223,   360,   224,   361,   312,   313,   314,   315,   316,
+     317,   318,   319,   320,   321,   322,   323,   563,   561,   213,
+     214,   215,   574,    69,    70,    71,    72,   358,    73,    74,
+     578,   582,   580,    75,    76,    77,   362,   583,    78,    79,
+      80,   216,   584,   581,   587,    81,    82,   611,   589,   612,
+      83,   613,   614,   363,   364,   365,   366,   430,   362,   615,
+     626,   368,   616,   624,   632,   217,   631,   218,   629,   219,
+     430,   633,   634,   635,   636,   363,   364,   365,   366,   367,
+     220,   221,   222,   368,   637,   223,   642,   224,   650,   653,
+     654,   655,   658,   572,   571,   661,   369,   370,   371,   372,
+     373,   374,   375,   376,   662,   663,   666,   746,   669,   670,
+     671,   672,   673,   362,   675,   731,   732,   739,   369,   370,
+     371,   372,   373,   374,   375,   376,   362,   740,   733,   747,
+     363,   364,   365,   366,   743,   579,   749,   751,   368,   761,
+     762,   788,   758,   363,   364,   365,   366,   774,   756,   757,
+     759,   368,   687,   688,   689,   690,   691,   772,   775,   692,
+     693,   799,   837,   846,   851,   779,   694,   695,   696,   852,
+     780,   781,   853,   369,   370,   371,   372,   373,   374,   375,
+     376,   782,   697,   783,   784,   785,   369,   370,   371,   372,
+     373,   374,   375,   376,   502,   503,   504,   505,   506,   507,
+     508,   509,   510,   511,   512,   513,   514,   515,   516,   517,
+     518,   786,   519,   520,   521,   522,   523,   524,   810,   787,
+     525,   789,   790,   526,   527,   791,   792,   528,   529,   530,
+     698,   699,   700,   701,   702,   793,   821,   703,   704,   794,
+     795,   796,   797,   832,   705,   706,   707,   709,   710,   711,
+     712,   713,   798,   847,   714,   715,   800,   801,   802,   854,
+     708,   716,   717,   718,   720,   721,   722,   723,   724,   803,
+     855,   725,   726,   856,   857,   804,   858,   719,   727,   728,
+     729,   805,   806,   859,   807,   808,   809,   811,   812,   813,
+     860,   862,   863,   814,   730,   815,   816,   864,   817,   818,
+     819,   820,   822,   823,   824,   865,   825,   866,   826,   867,
+     827,   828,   868,   869,   829,   830,   831,   833,   840,   843,
+     844,   861,   870,   871,   872,   873,   874,   875,   876,   877,
      878,   879,   880,   881,   882,   883,   884,   885,   886,   887,
-     888,   889,   890,   891,   893,   892,   894,   895,   896,   897,
-     898,   899,   900,   901,   902,   904,   903,   907,   908,   909,
-     910,   356,   915,   912,   925,   936,   916,   917,   918,   947,
-     919,   920,   921,   958,   922,   969,   923,   986,   924,   926,
-     927,   928,   929,   930,   931,   932,   933,   934,   935,   937,
-     938,   939,   940,   941,   942,   943,   944,   945,   946,   948,
-     987,   949,  1002,   950,   951,   989,   952,   990,   953,   991,
-     954,   955,   956,   957,   959,   960,   961,   962,   963,   964,
-     965,   966,   967,   968,   970,   997,   972,  1001,   971,   981,
-     973,   982,   983,   984,   985,  1009,   996,  1003,   994,  1010,
-    1013,  1014,  1011,  1018,  1012,  1021,  1019,  1020,  1022,  1024,
-    1023,  1026,   132,   627,   734,   133,   732,   134,   135,   168,
-     641,   298,    96,   666,   423,   609,   289,   767,   285,   136,
-     137,   139,   140,   141,   142,   143,   449,   771,   434,   832,
-     751,   752,   337,   740,     0,   764,   834,     0,     0,     0,
-       0,     0,     0,     0,   476,     0,     0,     0,   478,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     392,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   564
+     888,   889,   890,   891,   892,   893,   894,   895,   896,   897,
+     898,   899,   900,   901,   902,   903,   904,   905,   906,   909,
+     910,   911,   912,  1016,   917,   914,   356,   918,   927,   919,
+     920,   921,   922,   923,   924,   938,   925,   926,   928,   929,
+     930,   931,   932,   933,   934,   935,   936,   937,   939,   940,
+     941,   949,   942,   943,   944,   945,   946,   947,   948,   950,
+     951,   952,   953,   954,   955,   956,   957,   958,   959,   960,
+     961,   962,   963,   964,   965,   966,   967,   968,   969,   970,
+     971,   972,   974,   973,   983,   984,   975,   985,   986,   987,
+     988,   989,   998,   996,   991,   992,   993,   999,  1003,  1004,
+    1005,  1012,  1011,  1013,  1014,  1015,  1020,  1021,  1022,  1023,
+    1024,  1026,  1025,  1028,   132,   628,   643,   133,   736,   168,
+     134,   734,   298,   135,    96,   289,   423,   136,   610,   668,
+     137,   769,   139,   285,   140,   141,   142,   449,   143,   773,
+     834,   434,   565,   766,   337,     0,     0,     0,   742,   836,
+       0,   392,     0,     0,     0,     0,     0,   753,   476,   754,
+       0,   478
 };
 
 static const yytype_int16 yycheck[] =
 {
-     196,   531,   174,    17,    63,   223,   425,   126,   194,     3,
-       8,     4,   208,     6,   533,   205,   495,    64,     5,     6,
-      13,     5,     6,   495,     3,     3,    57,   495,   224,   495,
-     220,   221,    20,    78,    22,    68,    24,     4,     5,     6,
-     495,   104,   161,    80,   495,    85,    78,    79,    57,    34,
-      43,    89,    57,    75,   203,    80,   205,    80,    51,     3,
-      33,     5,     6,     3,    77,     5,     6,     0,    29,     3,
-      72,    73,    65,    30,     7,    32,     9,    10,    11,    12,
-      13,    14,    15,    16,    45,     3,    85,     5,     6,     3,
-      23,    84,    25,    26,    27,    80,   292,   293,    78,     3,
-      30,   126,    64,   126,   623,   153,   154,   170,   130,   305,
-      70,    71,    74,   153,   154,   153,   154,   110,   111,   112,
-      64,    81,    82,    83,    64,   118,   119,   120,     3,     4,
-       5,     6,   328,   329,   324,   102,   103,   104,   163,   311,
-     163,   108,     3,   156,   153,   154,    64,    80,   153,   154,
-     168,   153,   154,    57,   153,   154,   203,   205,   153,   154,
-     205,   379,   358,   359,   201,   158,   133,   134,   135,   201,
+     196,   531,   174,    17,   223,    63,   425,   126,   194,   533,
+       8,     4,   208,     6,     3,   205,   495,   495,     5,     6,
+      13,     5,     6,    78,     3,     3,    57,   495,   224,   495,
+     220,   221,    20,     3,    22,    68,    24,     4,     5,     6,
+      80,    77,   161,     3,   495,   495,    78,    79,    64,    75,
+      43,   200,   153,   154,    64,    57,   205,    57,    51,     3,
+      33,    80,    80,     3,    74,     5,     6,     0,    29,    20,
+      34,    22,    65,    24,     7,    78,     9,    10,    11,    12,
+      13,    14,    15,    16,    45,    42,   153,   154,     3,   104,
+      23,    84,    25,    26,    27,    52,   292,   293,    30,   202,
+     624,   202,   205,     3,   130,     5,     6,   126,   126,   305,
+      70,    71,   168,    57,    72,    73,    80,   110,   111,   112,
+     156,    81,    82,    83,    64,   118,   119,   120,     3,     4,
+       5,     6,   328,   329,   324,   102,   103,   104,   205,   311,
+       3,   108,     5,     6,   163,   163,     3,    80,     5,     6,
+     205,   153,   154,   153,   154,   170,   203,   127,   205,   129,
+     379,   201,   358,   359,    64,   158,   133,   134,   135,   201,
      201,   185,   205,   363,   364,   365,   366,   367,   368,   369,
-     370,   371,   372,   373,   374,   375,   376,   153,   154,    42,
-     183,   670,    67,   127,   202,   129,    88,   205,   670,    52,
-      75,    76,   670,   201,   670,    88,    16,   201,   404,    84,
-     224,    86,   199,   200,   202,   670,   200,   196,   196,   670,
-      75,    20,   166,    22,   184,    24,   166,   102,   103,   104,
-      75,   200,   199,   108,   167,    80,   205,   296,   158,   205,
-     436,   437,     3,   439,   200,   200,   442,   419,   166,   205,
-     205,   770,   185,     3,   426,   175,   176,   177,   133,   134,
-     135,   153,   154,     0,   454,   153,   154,   204,   201,    74,
-     153,   154,   127,   200,   129,   130,   200,   132,   205,     8,
-     155,   205,   127,   455,   129,   130,    29,    30,    31,    48,
-      49,     3,     4,     5,     6,    74,   164,   165,    41,    42,
-     202,   497,   170,   205,   179,   835,   181,   203,   183,   202,
-     496,   304,   205,   327,   202,    45,    46,    47,    48,   194,
-     195,   196,   202,    14,   199,   205,   201,   202,   120,   448,
-     122,   123,   124,     3,     4,     5,     6,   756,     7,     3,
-       9,    10,    11,    12,    13,    14,    85,    16,    87,    85,
-      89,    87,     3,    89,    23,   414,    25,    26,    27,   555,
-       3,   557,   202,    75,    76,   205,    29,    30,    31,     3,
-     560,    42,    84,     6,    86,    46,    47,    89,    41,    42,
-      51,    52,   179,     3,   181,   175,   183,   205,   578,   131,
-     102,   103,   104,    42,   172,   173,   108,    46,    47,   172,
-     173,   573,    51,    52,   202,    75,    76,   205,   150,   151,
-      80,    80,     5,     6,    84,   429,    86,    39,    40,    41,
-      42,   133,   134,   135,     3,   202,     5,     6,   205,   164,
-     489,   649,   102,   103,   104,     6,   202,   202,   108,   205,
-     205,   455,   202,   155,   974,   205,    57,    75,   202,   645,
-     192,   193,   194,   195,   196,   197,   198,   202,   630,    21,
-     205,   202,   992,   133,   134,   135,   996,   179,    67,   181,
-     202,   183,     3,   205,     3,     4,     5,     6,   202,    69,
-    1010,   205,   194,   195,   196,   155,    75,   199,   202,   201,
-       3,   205,   202,  1023,   202,   205,  1026,   205,   167,   202,
-      64,   202,   205,   131,   205,   202,    76,   202,   205,   179,
-     205,   181,   202,   183,   201,   205,     3,     4,     5,     6,
-     148,   149,   150,   151,   194,   195,   196,   202,   156,   199,
-     205,   201,   201,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   202,    75,    76,   205,   647,
-       5,     6,   650,    48,    49,    84,     3,    86,     3,   573,
-     157,   158,   159,   191,   192,   193,   194,   195,   196,   197,
-     198,    46,    47,   102,   103,   104,     3,   773,     3,   108,
-     187,   188,   189,    75,   196,   197,   198,    68,    75,    76,
-       3,     4,     5,     6,   667,   668,     4,    84,     3,    86,
-     772,     3,     6,     4,   133,   134,   135,    75,    29,    30,
-     201,    32,     6,     6,    55,   102,   103,   104,    70,    76,
-       3,   108,    64,    44,    45,     7,   155,     9,    10,    11,
-      12,    13,    14,    15,    16,   191,    80,    80,   201,   131,
-     201,    23,   201,    25,    26,    27,   133,   134,   135,   845,
-     179,     4,   181,     4,   183,     4,   148,   149,   150,   151,
-       6,     4,    75,   131,   156,   194,   195,   196,   155,   201,
-     199,    84,   201,    86,   201,   201,     3,     6,   203,   202,
-     148,   149,   150,   151,    80,   153,     6,   202,   156,   102,
-     103,   104,   179,    71,   181,   108,   183,    57,    80,   191,
-     192,   193,   194,   195,   196,   197,   198,   194,   195,   196,
-     202,   201,   199,   201,   201,   201,    75,   201,    77,   201,
-     133,   134,   135,   191,   192,   193,   194,   195,   196,   197,
-     198,     4,    80,     4,   201,   201,   201,   201,   159,   160,
-     161,   162,   155,   164,   165,     4,   206,    79,   169,   170,
-     171,   202,     3,   174,   175,   176,     6,     6,     6,   199,
-     181,   182,   201,     5,    46,   186,   179,   201,   181,   202,
-     183,   178,   131,     6,   205,   201,   128,     3,     3,   156,
-     202,   194,   195,   196,    78,   167,   199,   131,   201,   148,
-     149,   150,   151,   152,   205,     4,   153,   156,   201,   130,
-     206,     6,     6,   185,   148,   149,   150,   151,   206,     3,
-       6,   201,   156,    91,    92,    93,    94,    95,   205,   201,
-      98,    99,   201,     4,     6,   201,   201,   105,   106,   107,
-     201,   201,   191,   192,   193,   194,   195,   196,   197,   198,
-     201,    28,     6,   121,   202,   201,     3,   191,   192,   193,
-     194,   195,   196,   197,   198,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,     6,   108,   109,   110,   111,   112,   113,   202,
-     205,   116,     4,     4,   119,   120,   202,    80,   123,   124,
-     125,    91,    92,    93,    94,    95,     6,     5,    98,    99,
-      53,   191,    50,     6,    59,   105,   106,   107,    91,    92,
-      93,    94,    95,    59,     3,    98,    99,   205,    54,     6,
-     130,   121,   105,   106,   107,    91,    92,    93,    94,    95,
-     128,   132,    98,    99,   201,   163,   202,   199,   121,   105,
-     106,   107,    91,    92,    93,    94,    95,     4,   202,    98,
-      99,     6,   199,     6,    55,   121,   105,   106,   107,    58,
-      59,    60,    61,    62,    63,   202,    65,    66,   202,   201,
-     201,    56,   121,    35,    36,    37,    38,    39,    40,    93,
-      93,    43,   205,   205,   205,   205,   205,   205,   205,   205,
-     205,   205,   205,   205,   205,    93,    93,   205,   205,   205,
-      93,     3,   205,   205,    64,     6,   205,     6,   205,     6,
-     205,     6,     6,   205,   205,   205,   205,   205,     6,   205,
-     205,   205,     6,     6,     6,   205,   205,   205,   205,   205,
-     205,   205,   205,   205,   205,   205,   205,   205,   205,     6,
-     205,     6,   205,   205,   205,   205,   205,   205,     6,   205,
-       6,   205,     6,   205,   205,     6,     6,     6,     6,     6,
-       6,     6,   205,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,   205,     6,     6,     6,     6,     6,     6,
+     370,   371,   372,   373,   374,   375,   376,   203,    85,    30,
+     183,    32,    67,   672,   672,   153,   154,    88,   153,   154,
+      75,    76,     3,   201,   672,    85,   672,    64,   404,    84,
+     224,    86,   201,   200,   202,   199,   200,   196,   196,    88,
+     202,   672,   672,   205,   184,   131,   166,   102,   103,   104,
+      89,     3,   199,   108,   167,     3,   164,   165,   296,    16,
+     436,   437,   170,   439,   150,   151,   442,   419,   772,    85,
+     205,    87,   185,    89,   426,   204,   153,   154,   133,   134,
+     135,     8,   153,   154,   454,     0,   166,    74,   201,     3,
+       4,     5,     6,   153,   154,   202,    75,   200,   205,    74,
+     155,   203,   205,   455,   153,   154,   192,   193,   194,   195,
+     196,   197,   198,    75,   153,   154,    14,   158,    80,   202,
+     202,   497,   205,   205,   179,     3,   181,   837,   183,   166,
+     496,   304,   200,   327,   175,   176,   177,   205,   200,   194,
+     195,   196,   649,   205,   199,   652,   201,   202,   127,   448,
+     129,   130,   200,   132,    85,     3,    87,   205,    89,   758,
+     202,    75,    76,   205,     3,   127,     3,   129,   130,    42,
+      84,     6,    86,    46,    47,    89,   414,     3,    51,    52,
+     556,   120,   558,   122,   123,   124,   172,   173,   102,   103,
+     104,   561,   175,   202,   108,     7,   205,     9,    10,    11,
+      12,    13,    14,    15,    16,    29,    30,    31,   179,   579,
+     181,    23,   183,    25,    26,    27,    57,    41,    42,   133,
+     134,   135,   574,   164,    29,    30,    31,     3,     4,     5,
+       6,    45,    46,    47,    48,   429,    41,    42,   157,   158,
+     159,   155,    91,    92,    93,    94,    95,   172,   173,    98,
+      99,   489,   651,   187,   188,   189,   105,   106,   107,   202,
+     202,   455,   205,   205,     6,   179,   976,   181,    80,   183,
+     205,   647,   121,    39,    40,    41,    42,   153,   154,   631,
+     194,   195,   196,    21,   994,   199,    42,   201,   998,   202,
+      46,    47,   205,   202,   202,    51,    52,   205,   202,    75,
+      76,   205,  1012,   202,    80,   202,   205,    67,    84,     3,
+      86,     3,     4,     5,     6,  1025,   202,   202,  1028,   205,
+     205,   202,   202,    69,   205,   205,   102,   103,   104,    48,
+      49,   202,   108,     7,   205,     9,    10,    11,    12,    13,
+      14,   202,    16,   202,   205,   202,   205,   202,   205,    23,
+     205,    25,    26,    27,    75,   167,     3,   133,   134,   135,
+     202,     5,     6,   205,    64,     3,     4,     5,     6,   196,
+     197,   198,   201,   185,     5,     6,    48,    49,    76,   155,
+     574,    46,    47,    75,    76,   669,   670,     3,     3,   201,
+       3,     3,    84,    68,    86,     4,     3,     3,     6,   775,
+       4,   201,    55,   179,     6,   181,    80,   183,     6,    70,
+     102,   103,   104,    76,   131,     3,   108,   191,   194,   195,
+     196,    64,   774,   199,    80,   201,    80,     4,   201,   201,
+     201,   148,   149,   150,   151,     4,     4,    75,    76,   156,
+       4,   133,   134,   135,     6,   203,    84,   201,    86,     3,
+       4,     5,     6,    29,    30,     3,    32,   201,   201,    80,
+       6,     6,   202,   155,   102,   103,   104,   202,    44,    45,
+     108,   847,    71,    57,   191,   192,   193,   194,   195,   196,
+     197,   198,     4,   201,    80,   201,   201,   179,   201,   181,
+     201,   183,   201,   167,   201,   133,   134,   135,   201,   201,
+       4,     4,   194,   195,   196,   206,   202,   199,     3,   201,
+     201,    58,    59,    60,    61,    62,    63,   155,    65,    66,
+      79,    75,   199,     6,     6,     6,     5,   201,    46,   202,
+      84,   201,    86,     6,    35,    36,    37,    38,    39,    40,
+      75,   179,    43,   181,   178,   183,   205,   128,   102,   103,
+     104,   201,     3,     3,   108,   156,   194,   195,   196,   205,
+     202,   199,    75,   201,    77,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,     4,    78,   133,
+     134,   135,   201,   159,   160,   161,   162,   153,   164,   165,
+     130,     6,   206,   169,   170,   171,   131,     6,   174,   175,
+     176,   155,     3,   206,     6,   181,   182,   201,   205,   201,
+     186,   201,   201,   148,   149,   150,   151,    75,   131,   201,
+      28,   156,   201,   201,     4,   179,   201,   181,   202,   183,
+      75,     6,     6,     4,     3,   148,   149,   150,   151,   152,
+     194,   195,   196,   156,     6,   199,   202,   201,   205,     4,
+       4,    80,   202,     6,     5,    53,   191,   192,   193,   194,
+     195,   196,   197,   198,    50,   191,     6,   202,    59,    59,
+       3,   205,    54,   131,     6,   130,   128,   201,   191,   192,
+     193,   194,   195,   196,   197,   198,   131,   163,   132,   199,
+     148,   149,   150,   151,   202,   153,     4,   199,   156,     6,
+       6,    93,   201,   148,   149,   150,   151,    55,   202,   202,
+     202,   156,    91,    92,    93,    94,    95,   201,    56,    98,
+      99,    93,     3,     6,     6,   205,   105,   106,   107,     6,
+     205,   205,     6,   191,   192,   193,   194,   195,   196,   197,
+     198,   205,   121,   205,   205,   205,   191,   192,   193,   194,
+     195,   196,   197,   198,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   205,   108,   109,   110,   111,   112,   113,    93,   205,
+     116,   205,   205,   119,   120,   205,   205,   123,   124,   125,
+      91,    92,    93,    94,    95,   205,    93,    98,    99,   205,
+     205,   205,   205,    93,   105,   106,   107,    91,    92,    93,
+      94,    95,   205,    64,    98,    99,   205,   205,   205,     6,
+     121,   105,   106,   107,    91,    92,    93,    94,    95,   205,
+       6,    98,    99,     6,     6,   205,     6,   121,   105,   106,
+     107,   205,   205,     6,   205,   205,   205,   205,   205,   205,
+       6,     6,     6,   205,   121,   205,   205,     6,   205,   205,
+     205,   205,   205,   205,   205,     6,   205,     6,   205,     6,
+     205,   205,     6,     6,   205,   205,   205,   205,   205,   205,
+     205,   205,     6,     6,   205,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,   205,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,     6,   205,     4,     4,     4,
-       4,   205,   202,     6,     6,     6,   202,   202,   202,     6,
-     202,   202,   202,     6,   202,     6,   202,     4,   202,   202,
-     202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+       6,     6,     6,     6,     6,     6,   205,     6,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,   205,     6,     4,
+       4,     4,     4,    51,   202,     6,   205,   202,     6,   202,
+     202,   202,   202,   202,   202,     6,   202,   202,   202,   202,
      202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
-       4,   202,     4,   202,   202,     6,   202,     6,   202,     6,
+     202,     6,   202,   202,   202,   202,   202,   202,   202,   202,
+     202,   202,   202,   202,   202,   202,   202,   202,   202,     6,
      202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
-     202,   202,   202,   202,   202,     6,   202,     6,   205,   202,
-     205,   202,   202,   202,   202,     6,   202,   202,   205,   202,
-       6,    51,    42,   201,    42,     3,    42,    42,   201,     3,
-     202,   202,    63,   535,   622,    63,   620,    63,    63,    99,
-     554,   181,    17,   588,   306,   497,   170,   665,   160,    63,
-      63,    63,    63,    63,    63,    63,   356,   670,   330,   731,
-     650,   650,   215,   637,    -1,   663,   737,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   381,    -1,    -1,    -1,   383,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     284,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   441
+       6,   202,   202,   205,   202,   202,   205,   202,   202,   202,
+       4,     4,   202,   205,     6,     6,     6,     6,     6,     4,
+     202,   202,     6,    42,    42,     6,   201,    42,    42,     3,
+     201,     3,   202,   202,    63,   535,   555,    63,   623,    99,
+      63,   621,   181,    63,    17,   170,   306,    63,   497,   589,
+      63,   667,    63,   160,    63,    63,    63,   356,    63,   672,
+     733,   330,   441,   665,   215,    -1,    -1,    -1,   639,   739,
+      -1,   284,    -1,    -1,    -1,    -1,    -1,   652,   381,   652,
+      -1,   383
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1576,55 +1566,55 @@ static const yytype_int16 yystos[] =
       98,    99,   100,   101,   102,   103,   104,   105,   106,   108,
      109,   110,   111,   112,   113,   116,   119,   120,   123,   124,
      125,   216,   128,   201,   202,   205,   232,     3,     3,   267,
-     205,    70,    71,    81,    82,    83,   184,   309,   310,   309,
-     267,   202,   234,   202,    57,    88,    85,    87,   270,   270,
-      78,   270,     4,     3,   289,   270,   202,   205,   202,   205,
-       5,     6,   311,   201,   271,   234,   267,   130,   153,   206,
-     206,     6,     6,     3,   318,   319,     6,   232,   205,    58,
-      60,    61,    62,    63,    65,    66,   260,     3,    57,   255,
-     273,   274,   275,   276,   277,   278,   279,   280,   247,   240,
-     201,   201,   201,   201,   201,   201,    75,   127,   129,   130,
-     217,   218,   316,   201,   221,    28,   317,   214,   202,   202,
-     201,     6,     6,     4,     3,     6,   202,   205,   202,   202,
-     202,   216,   270,   270,    85,    88,   271,   205,   205,   205,
-     205,     4,     4,    80,   234,   267,   202,   202,   271,    53,
-      50,   191,   202,   205,     6,   202,   252,    59,    59,     3,
-     205,    54,   249,     6,    91,    92,    93,    94,    95,    98,
-      99,   105,   106,   107,   121,    91,    92,    93,    94,    95,
-      98,    99,   105,   106,   107,   121,    91,    92,    93,    94,
+     205,     3,    70,    71,    81,    82,    83,   184,   309,   310,
+     309,   267,   202,   234,   202,    57,    88,    85,    87,   270,
+     270,    78,   270,     4,     3,   289,   270,   202,   205,   202,
+     205,     5,     6,   311,   201,   271,   234,   267,   130,   153,
+     206,   206,     6,     6,     3,   318,   319,     6,   232,   205,
+      58,    60,    61,    62,    63,    65,    66,   260,     3,    57,
+     255,   273,   274,   275,   276,   277,   278,   279,   280,   247,
+     240,   201,   201,   201,   201,   201,   201,    75,   127,   129,
+     130,   217,   218,   316,   201,   221,    28,   317,   214,   202,
+     202,   201,     4,     6,     6,     4,     3,     6,   202,   205,
+     202,   202,   202,   216,   270,   270,    85,    88,   271,   205,
+     205,   205,   205,     4,     4,    80,   234,   267,   202,   202,
+     271,    53,    50,   191,   202,   205,     6,   202,   252,    59,
+      59,     3,   205,    54,   249,     6,    91,    92,    93,    94,
       95,    98,    99,   105,   106,   107,   121,    91,    92,    93,
       94,    95,    98,    99,   105,   106,   107,   121,    91,    92,
-      93,    94,    95,    98,    99,   105,   106,   107,   121,   130,
-     128,   132,   218,   219,   219,   221,   202,   201,   163,   267,
-     310,   202,    85,   270,   202,   199,   303,     4,   291,   199,
-     292,   295,   300,   303,   202,   202,   201,   202,   202,     6,
-       6,     3,     5,     6,   319,    30,    32,   255,   253,   253,
-     201,   279,    55,    56,   248,   202,   205,   205,   205,   205,
-     205,   205,   205,   205,   205,   205,    93,   205,   205,   205,
-     205,   205,   205,   205,   205,   205,   205,    93,   205,   205,
+      93,    94,    95,    98,    99,   105,   106,   107,   121,    91,
+      92,    93,    94,    95,    98,    99,   105,   106,   107,   121,
+      91,    92,    93,    94,    95,    98,    99,   105,   106,   107,
+     121,   130,   128,   132,   218,   219,   219,   221,   202,   201,
+     163,   267,   310,   202,    85,   270,   202,   199,   303,     4,
+     291,   199,   292,   295,   300,   303,   202,   202,   201,   202,
+     202,     6,     6,     3,     5,     6,   319,    30,    32,   255,
+     253,   253,   201,   279,    55,    56,   248,   202,   205,   205,
      205,   205,   205,   205,   205,   205,   205,   205,    93,   205,
      205,   205,   205,   205,   205,   205,   205,   205,   205,    93,
      205,   205,   205,   205,   205,   205,   205,   205,   205,   205,
-      93,   205,   290,   202,   318,     3,   202,     6,   205,   202,
-     205,   205,   205,   309,     6,    64,   221,   267,   270,     6,
-       6,     6,     6,     6,     6,     6,     6,     6,     6,   205,
-       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-     205,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+      93,   205,   205,   205,   205,   205,   205,   205,   205,   205,
+     205,    93,   205,   205,   205,   205,   205,   205,   205,   205,
+     205,   205,    93,   205,   290,   202,   318,     3,   202,     6,
+     205,   202,   205,   205,   205,   309,     6,    64,   221,   267,
+     270,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,   205,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,   205,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,   205,     6,   202,   316,     4,     4,     4,
-       4,   202,     6,   270,   202,   202,   202,   202,   202,   202,
-     202,   202,   202,   202,   202,     6,   202,   202,   202,   202,
-     202,   202,   202,   202,   202,   202,     6,   202,   202,   202,
+       6,     6,     6,   205,     6,     6,     6,     6,     6,     6,
+       6,     6,     6,     6,   205,     6,     6,     6,     6,     6,
+       6,     6,     6,     6,     6,   205,     6,   202,   316,     4,
+       4,     4,     4,   202,     6,   270,   202,   202,   202,   202,
      202,   202,   202,   202,   202,   202,   202,     6,   202,   202,
      202,   202,   202,   202,   202,   202,   202,   202,     6,   202,
      202,   202,   202,   202,   202,   202,   202,   202,   202,     6,
-     202,   205,   202,   205,   202,   205,    42,    46,    47,    51,
-      52,   202,   202,   202,   202,   202,     4,     4,   316,     6,
-       6,     6,   202,   205,   205,   272,   202,     6,    48,    49,
-     316,     6,     4,   202,   126,   163,   316,    46,    47,     6,
-     202,    42,    42,     6,    51,   126,   163,   316,   201,    42,
-      42,     3,   201,   202,     3,   316,   202,   316
+     202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+       6,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+     202,     6,   202,   205,   202,   205,   202,   205,    42,    46,
+      47,    51,    52,   202,   202,   202,   202,   202,     4,     4,
+     316,     6,     6,     6,   202,   205,   205,   272,   202,     6,
+      48,    49,   316,     6,     4,   202,   126,   163,   316,    46,
+      47,     6,   202,    42,    42,     6,    51,   126,   163,   316,
+     201,    42,    42,     3,   201,   202,     3,   316,   202,   316
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1675,9 +1665,9 @@ static const yytype_int16 yyr1[] =
      296,   297,   297,   298,   299,   299,   300,   301,   302,   303,
      303,   304,   305,   305,   306,   307,   307,   308,   308,   308,
      308,   308,   308,   308,   308,   308,   308,   308,   308,   309,
-     309,   310,   310,   310,   310,   310,   310,   311,   312,   312,
-     313,   313,   314,   314,   315,   315,   316,   316,   317,   317,
-     318,   318,   319,   319,   319,   319,   320,   320
+     309,   310,   310,   310,   310,   310,   310,   310,   311,   312,
+     312,   313,   313,   314,   314,   315,   315,   316,   316,   317,
+     317,   318,   318,   319,   319,   319,   319,   320,   320
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1728,9 +1718,9 @@ static const yytype_int8 yyr2[] =
        2,     2,     3,     2,     2,     3,     2,     3,     3,     1,
        1,     2,     2,     3,     2,     2,     3,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     1,
-       3,     2,     2,     1,     2,     2,     2,     1,     2,     0,
-       3,     0,     1,     0,     2,     0,     4,     0,     4,     0,
-       1,     3,     1,     3,     3,     3,     6,     3
+       3,     2,     2,     1,     2,     2,     2,     2,     1,     2,
+       0,     3,     0,     1,     0,     2,     0,     4,     0,     4,
+       0,     1,     3,     1,     3,     3,     3,     6,     3
 };
 
 
@@ -2298,7 +2288,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2302 "parser.cpp"
+#line 2292 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -2306,7 +2296,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2310 "parser.cpp"
+#line 2300 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2320,7 +2310,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2324 "parser.cpp"
+#line 2314 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2334,7 +2324,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2338 "parser.cpp"
+#line 2328 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2345,7 +2335,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2349 "parser.cpp"
+#line 2339 "parser.cpp"
         break;
 
     case YYSYMBOL_default_expr: /* default_expr  */
@@ -2353,7 +2343,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2357 "parser.cpp"
+#line 2347 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2362,7 +2352,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2366 "parser.cpp"
+#line 2356 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2371,7 +2361,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2375 "parser.cpp"
+#line 2365 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2385,7 +2375,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2389 "parser.cpp"
+#line 2379 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2396,7 +2386,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2400 "parser.cpp"
+#line 2390 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2406,7 +2396,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2410 "parser.cpp"
+#line 2400 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2416,7 +2406,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2420 "parser.cpp"
+#line 2410 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2426,7 +2416,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2430 "parser.cpp"
+#line 2420 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2436,7 +2426,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2440 "parser.cpp"
+#line 2430 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2446,7 +2436,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2450 "parser.cpp"
+#line 2440 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2456,7 +2446,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2460 "parser.cpp"
+#line 2450 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2470,7 +2460,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2474 "parser.cpp"
+#line 2464 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2484,7 +2474,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2488 "parser.cpp"
+#line 2478 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2494,7 +2484,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2498 "parser.cpp"
+#line 2488 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2502,7 +2492,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2506 "parser.cpp"
+#line 2496 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2510,7 +2500,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2514 "parser.cpp"
+#line 2504 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2519,7 +2509,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2523 "parser.cpp"
+#line 2513 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2527,7 +2517,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2531 "parser.cpp"
+#line 2521 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2535,7 +2525,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2539 "parser.cpp"
+#line 2529 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2543,7 +2533,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2547 "parser.cpp"
+#line 2537 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2557,7 +2547,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2561 "parser.cpp"
+#line 2551 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2566,7 +2556,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2570 "parser.cpp"
+#line 2560 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2575,7 +2565,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2579 "parser.cpp"
+#line 2569 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2584,7 +2574,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2588 "parser.cpp"
+#line 2578 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2597,7 +2587,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2601 "parser.cpp"
+#line 2591 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2606,7 +2596,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2610 "parser.cpp"
+#line 2600 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2620,7 +2610,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2624 "parser.cpp"
+#line 2614 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2634,7 +2624,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2638 "parser.cpp"
+#line 2628 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2644,7 +2634,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2648 "parser.cpp"
+#line 2638 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2653,7 +2643,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2657 "parser.cpp"
+#line 2647 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2667,7 +2657,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2671 "parser.cpp"
+#line 2661 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array_list: /* expr_array_list  */
@@ -2684,7 +2674,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_list_t));
     }
 }
-#line 2688 "parser.cpp"
+#line 2678 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2692,7 +2682,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2696 "parser.cpp"
+#line 2686 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2700,7 +2690,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2704 "parser.cpp"
+#line 2694 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2708,7 +2698,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2712 "parser.cpp"
+#line 2702 "parser.cpp"
         break;
 
     case YYSYMBOL_extra_match_tensor_option: /* extra_match_tensor_option  */
@@ -2716,7 +2706,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2720 "parser.cpp"
+#line 2710 "parser.cpp"
         break;
 
     case YYSYMBOL_match_tensor_expr: /* match_tensor_expr  */
@@ -2724,7 +2714,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2728 "parser.cpp"
+#line 2718 "parser.cpp"
         break;
 
     case YYSYMBOL_match_vector_expr: /* match_vector_expr  */
@@ -2732,7 +2722,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2736 "parser.cpp"
+#line 2726 "parser.cpp"
         break;
 
     case YYSYMBOL_match_sparse_expr: /* match_sparse_expr  */
@@ -2740,7 +2730,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2744 "parser.cpp"
+#line 2734 "parser.cpp"
         break;
 
     case YYSYMBOL_match_text_expr: /* match_text_expr  */
@@ -2748,7 +2738,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2752 "parser.cpp"
+#line 2742 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2756,7 +2746,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2760 "parser.cpp"
+#line 2750 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2764,7 +2754,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2768 "parser.cpp"
+#line 2758 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search: /* sub_search  */
@@ -2772,7 +2762,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2776 "parser.cpp"
+#line 2766 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -2786,7 +2776,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2790 "parser.cpp"
+#line 2780 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -2794,7 +2784,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2798 "parser.cpp"
+#line 2788 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -2802,7 +2792,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2806 "parser.cpp"
+#line 2796 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -2810,7 +2800,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2814 "parser.cpp"
+#line 2804 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -2818,7 +2808,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2822 "parser.cpp"
+#line 2812 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -2826,7 +2816,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2830 "parser.cpp"
+#line 2820 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -2839,7 +2829,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 2843 "parser.cpp"
+#line 2833 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -2847,7 +2837,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2851 "parser.cpp"
+#line 2841 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -2855,7 +2845,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2859 "parser.cpp"
+#line 2849 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -2863,7 +2853,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2867 "parser.cpp"
+#line 2857 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -2871,7 +2861,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2875 "parser.cpp"
+#line 2865 "parser.cpp"
         break;
 
     case YYSYMBOL_common_array_expr: /* common_array_expr  */
@@ -2879,7 +2869,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2883 "parser.cpp"
+#line 2873 "parser.cpp"
         break;
 
     case YYSYMBOL_common_sparse_array_expr: /* common_sparse_array_expr  */
@@ -2887,7 +2877,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2891 "parser.cpp"
+#line 2881 "parser.cpp"
         break;
 
     case YYSYMBOL_subarray_array_expr: /* subarray_array_expr  */
@@ -2895,7 +2885,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2899 "parser.cpp"
+#line 2889 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_subarray_array_expr: /* unclosed_subarray_array_expr  */
@@ -2903,7 +2893,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2907 "parser.cpp"
+#line 2897 "parser.cpp"
         break;
 
     case YYSYMBOL_sparse_array_expr: /* sparse_array_expr  */
@@ -2911,7 +2901,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2915 "parser.cpp"
+#line 2905 "parser.cpp"
         break;
 
     case YYSYMBOL_long_sparse_array_expr: /* long_sparse_array_expr  */
@@ -2919,7 +2909,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2923 "parser.cpp"
+#line 2913 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_sparse_array_expr: /* unclosed_long_sparse_array_expr  */
@@ -2927,7 +2917,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2931 "parser.cpp"
+#line 2921 "parser.cpp"
         break;
 
     case YYSYMBOL_double_sparse_array_expr: /* double_sparse_array_expr  */
@@ -2935,7 +2925,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2939 "parser.cpp"
+#line 2929 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_sparse_array_expr: /* unclosed_double_sparse_array_expr  */
@@ -2943,7 +2933,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2947 "parser.cpp"
+#line 2937 "parser.cpp"
         break;
 
     case YYSYMBOL_empty_array_expr: /* empty_array_expr  */
@@ -2951,7 +2941,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2955 "parser.cpp"
+#line 2945 "parser.cpp"
         break;
 
     case YYSYMBOL_int_sparse_ele: /* int_sparse_ele  */
@@ -2959,7 +2949,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).int_sparse_ele_t));
 }
-#line 2963 "parser.cpp"
+#line 2953 "parser.cpp"
         break;
 
     case YYSYMBOL_float_sparse_ele: /* float_sparse_ele  */
@@ -2967,7 +2957,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).float_sparse_ele_t));
 }
-#line 2971 "parser.cpp"
+#line 2961 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -2975,7 +2965,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2979 "parser.cpp"
+#line 2969 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -2983,7 +2973,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2987 "parser.cpp"
+#line 2977 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -2991,7 +2981,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2995 "parser.cpp"
+#line 2985 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -2999,7 +2989,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3003 "parser.cpp"
+#line 2993 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -3007,7 +2997,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3011 "parser.cpp"
+#line 3001 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -3015,7 +3005,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 3019 "parser.cpp"
+#line 3009 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -3023,7 +3013,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 3027 "parser.cpp"
+#line 3017 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -3034,7 +3024,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 3038 "parser.cpp"
+#line 3028 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -3048,7 +3038,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 3052 "parser.cpp"
+#line 3042 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_table_properties_list: /* optional_table_properties_list  */
@@ -3062,7 +3052,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 3066 "parser.cpp"
+#line 3056 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info: /* index_info  */
@@ -3073,7 +3063,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_t));
     }
 }
-#line 3077 "parser.cpp"
+#line 3067 "parser.cpp"
         break;
 
       default:
@@ -3181,7 +3171,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 3185 "parser.cpp"
+#line 3175 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -3396,7 +3386,7 @@ yyreduce:
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 3400 "parser.cpp"
+#line 3390 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
@@ -3407,7 +3397,7 @@ yyreduce:
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 3411 "parser.cpp"
+#line 3401 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
@@ -3418,163 +3408,163 @@ yyreduce:
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 3422 "parser.cpp"
+#line 3412 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
 #line 511 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3428 "parser.cpp"
+#line 3418 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
 #line 512 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3434 "parser.cpp"
+#line 3424 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
 #line 513 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3440 "parser.cpp"
+#line 3430 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
 #line 514 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3446 "parser.cpp"
+#line 3436 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
 #line 515 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3452 "parser.cpp"
+#line 3442 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
 #line 516 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3458 "parser.cpp"
+#line 3448 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
 #line 517 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3464 "parser.cpp"
+#line 3454 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
 #line 518 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3470 "parser.cpp"
+#line 3460 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
 #line 519 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3476 "parser.cpp"
+#line 3466 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
 #line 520 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3482 "parser.cpp"
+#line 3472 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
 #line 521 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3488 "parser.cpp"
+#line 3478 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
 #line 522 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3494 "parser.cpp"
+#line 3484 "parser.cpp"
     break;
 
   case 17: /* statement: compact_statement  */
 #line 523 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3500 "parser.cpp"
+#line 3490 "parser.cpp"
     break;
 
   case 18: /* statement: admin_statement  */
 #line 524 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].admin_stmt); }
-#line 3506 "parser.cpp"
+#line 3496 "parser.cpp"
     break;
 
   case 19: /* explainable_statement: create_statement  */
 #line 526 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3512 "parser.cpp"
+#line 3502 "parser.cpp"
     break;
 
   case 20: /* explainable_statement: drop_statement  */
 #line 527 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3518 "parser.cpp"
+#line 3508 "parser.cpp"
     break;
 
   case 21: /* explainable_statement: copy_statement  */
 #line 528 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3524 "parser.cpp"
+#line 3514 "parser.cpp"
     break;
 
   case 22: /* explainable_statement: show_statement  */
 #line 529 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3530 "parser.cpp"
+#line 3520 "parser.cpp"
     break;
 
   case 23: /* explainable_statement: select_statement  */
 #line 530 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3536 "parser.cpp"
+#line 3526 "parser.cpp"
     break;
 
   case 24: /* explainable_statement: delete_statement  */
 #line 531 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3542 "parser.cpp"
+#line 3532 "parser.cpp"
     break;
 
   case 25: /* explainable_statement: update_statement  */
 #line 532 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3548 "parser.cpp"
+#line 3538 "parser.cpp"
     break;
 
   case 26: /* explainable_statement: insert_statement  */
 #line 533 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3554 "parser.cpp"
+#line 3544 "parser.cpp"
     break;
 
   case 27: /* explainable_statement: flush_statement  */
 #line 534 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3560 "parser.cpp"
+#line 3550 "parser.cpp"
     break;
 
   case 28: /* explainable_statement: optimize_statement  */
 #line 535 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3566 "parser.cpp"
+#line 3556 "parser.cpp"
     break;
 
   case 29: /* explainable_statement: command_statement  */
 #line 536 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3572 "parser.cpp"
+#line 3562 "parser.cpp"
     break;
 
   case 30: /* explainable_statement: compact_statement  */
 #line 537 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3578 "parser.cpp"
+#line 3568 "parser.cpp"
     break;
 
   case 31: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
@@ -3594,7 +3584,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3598 "parser.cpp"
+#line 3588 "parser.cpp"
     break;
 
   case 32: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
@@ -3612,7 +3602,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3616 "parser.cpp"
+#line 3606 "parser.cpp"
     break;
 
   case 33: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
@@ -3645,7 +3635,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-5].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3649 "parser.cpp"
+#line 3639 "parser.cpp"
     break;
 
   case 34: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
@@ -3665,7 +3655,7 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3669 "parser.cpp"
+#line 3659 "parser.cpp"
     break;
 
   case 35: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
@@ -3686,7 +3676,7 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 3690 "parser.cpp"
+#line 3680 "parser.cpp"
     break;
 
   case 36: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info  */
@@ -3719,7 +3709,7 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 3723 "parser.cpp"
+#line 3713 "parser.cpp"
     break;
 
   case 37: /* table_element_array: table_element  */
@@ -3728,7 +3718,7 @@ yyreduce:
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 3732 "parser.cpp"
+#line 3722 "parser.cpp"
     break;
 
   case 38: /* table_element_array: table_element_array ',' table_element  */
@@ -3737,7 +3727,7 @@ yyreduce:
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 3741 "parser.cpp"
+#line 3731 "parser.cpp"
     break;
 
   case 39: /* table_element: table_column  */
@@ -3745,7 +3735,7 @@ yyreduce:
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 3749 "parser.cpp"
+#line 3739 "parser.cpp"
     break;
 
   case 40: /* table_element: table_constraint  */
@@ -3753,7 +3743,7 @@ yyreduce:
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 3757 "parser.cpp"
+#line 3747 "parser.cpp"
     break;
 
   case 41: /* table_column: IDENTIFIER column_type with_index_param_list default_expr  */
@@ -3808,7 +3798,7 @@ yyreduce:
     }
     */
 }
-#line 3812 "parser.cpp"
+#line 3802 "parser.cpp"
     break;
 
   case 42: /* table_column: IDENTIFIER column_type column_constraints default_expr  */
@@ -3847,493 +3837,493 @@ yyreduce:
     }
     */
 }
-#line 3851 "parser.cpp"
+#line 3841 "parser.cpp"
     break;
 
   case 43: /* column_type: BOOLEAN  */
 #line 775 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3857 "parser.cpp"
+#line 3847 "parser.cpp"
     break;
 
   case 44: /* column_type: TINYINT  */
 #line 776 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3863 "parser.cpp"
+#line 3853 "parser.cpp"
     break;
 
   case 45: /* column_type: SMALLINT  */
 #line 777 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3869 "parser.cpp"
+#line 3859 "parser.cpp"
     break;
 
   case 46: /* column_type: INTEGER  */
 #line 778 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3875 "parser.cpp"
+#line 3865 "parser.cpp"
     break;
 
   case 47: /* column_type: INT  */
 #line 779 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3881 "parser.cpp"
+#line 3871 "parser.cpp"
     break;
 
   case 48: /* column_type: BIGINT  */
 #line 780 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3887 "parser.cpp"
+#line 3877 "parser.cpp"
     break;
 
   case 49: /* column_type: HUGEINT  */
 #line 781 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3893 "parser.cpp"
+#line 3883 "parser.cpp"
     break;
 
   case 50: /* column_type: FLOAT  */
 #line 782 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3899 "parser.cpp"
+#line 3889 "parser.cpp"
     break;
 
   case 51: /* column_type: REAL  */
 #line 783 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3905 "parser.cpp"
+#line 3895 "parser.cpp"
     break;
 
   case 52: /* column_type: DOUBLE  */
 #line 784 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3911 "parser.cpp"
+#line 3901 "parser.cpp"
     break;
 
   case 53: /* column_type: FLOAT16  */
 #line 785 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat16, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3917 "parser.cpp"
+#line 3907 "parser.cpp"
     break;
 
   case 54: /* column_type: BFLOAT16  */
 #line 786 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBFloat16, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3923 "parser.cpp"
+#line 3913 "parser.cpp"
     break;
 
   case 55: /* column_type: DATE  */
 #line 787 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3929 "parser.cpp"
+#line 3919 "parser.cpp"
     break;
 
   case 56: /* column_type: TIME  */
 #line 788 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3935 "parser.cpp"
+#line 3925 "parser.cpp"
     break;
 
   case 57: /* column_type: DATETIME  */
 #line 789 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3941 "parser.cpp"
+#line 3931 "parser.cpp"
     break;
 
   case 58: /* column_type: TIMESTAMP  */
 #line 790 "parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3947 "parser.cpp"
+#line 3937 "parser.cpp"
     break;
 
   case 59: /* column_type: UUID  */
 #line 791 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3953 "parser.cpp"
+#line 3943 "parser.cpp"
     break;
 
   case 60: /* column_type: POINT  */
 #line 792 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3959 "parser.cpp"
+#line 3949 "parser.cpp"
     break;
 
   case 61: /* column_type: LINE  */
 #line 793 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3965 "parser.cpp"
+#line 3955 "parser.cpp"
     break;
 
   case 62: /* column_type: LSEG  */
 #line 794 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3971 "parser.cpp"
+#line 3961 "parser.cpp"
     break;
 
   case 63: /* column_type: BOX  */
 #line 795 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3977 "parser.cpp"
+#line 3967 "parser.cpp"
     break;
 
   case 64: /* column_type: CIRCLE  */
 #line 798 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3983 "parser.cpp"
+#line 3973 "parser.cpp"
     break;
 
   case 65: /* column_type: VARCHAR  */
 #line 800 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3989 "parser.cpp"
+#line 3979 "parser.cpp"
     break;
 
   case 66: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
 #line 801 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3995 "parser.cpp"
+#line 3985 "parser.cpp"
     break;
 
   case 67: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
 #line 802 "parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4001 "parser.cpp"
+#line 3991 "parser.cpp"
     break;
 
   case 68: /* column_type: DECIMAL  */
 #line 803 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 4007 "parser.cpp"
+#line 3997 "parser.cpp"
     break;
 
   case 69: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
 #line 806 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 4013 "parser.cpp"
+#line 4003 "parser.cpp"
     break;
 
   case 70: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
 #line 807 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 4019 "parser.cpp"
+#line 4009 "parser.cpp"
     break;
 
   case 71: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 808 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4025 "parser.cpp"
+#line 4015 "parser.cpp"
     break;
 
   case 72: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
 #line 809 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4031 "parser.cpp"
+#line 4021 "parser.cpp"
     break;
 
   case 73: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
 #line 810 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4037 "parser.cpp"
+#line 4027 "parser.cpp"
     break;
 
   case 74: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
 #line 811 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4043 "parser.cpp"
+#line 4033 "parser.cpp"
     break;
 
   case 75: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
 #line 812 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4049 "parser.cpp"
+#line 4039 "parser.cpp"
     break;
 
   case 76: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 813 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4055 "parser.cpp"
+#line 4045 "parser.cpp"
     break;
 
   case 77: /* column_type: EMBEDDING '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 814 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat16}; }
-#line 4061 "parser.cpp"
+#line 4051 "parser.cpp"
     break;
 
   case 78: /* column_type: EMBEDDING '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 815 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBFloat16}; }
-#line 4067 "parser.cpp"
+#line 4057 "parser.cpp"
     break;
 
   case 79: /* column_type: EMBEDDING '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 816 "parser.y"
                                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemUInt8}; }
-#line 4073 "parser.cpp"
+#line 4063 "parser.cpp"
     break;
 
   case 80: /* column_type: TENSOR '(' BIT ',' LONG_VALUE ')'  */
 #line 817 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 4079 "parser.cpp"
+#line 4069 "parser.cpp"
     break;
 
   case 81: /* column_type: TENSOR '(' TINYINT ',' LONG_VALUE ')'  */
 #line 818 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 4085 "parser.cpp"
+#line 4075 "parser.cpp"
     break;
 
   case 82: /* column_type: TENSOR '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 819 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4091 "parser.cpp"
+#line 4081 "parser.cpp"
     break;
 
   case 83: /* column_type: TENSOR '(' INTEGER ',' LONG_VALUE ')'  */
 #line 820 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4097 "parser.cpp"
+#line 4087 "parser.cpp"
     break;
 
   case 84: /* column_type: TENSOR '(' INT ',' LONG_VALUE ')'  */
 #line 821 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4103 "parser.cpp"
+#line 4093 "parser.cpp"
     break;
 
   case 85: /* column_type: TENSOR '(' BIGINT ',' LONG_VALUE ')'  */
 #line 822 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4109 "parser.cpp"
+#line 4099 "parser.cpp"
     break;
 
   case 86: /* column_type: TENSOR '(' FLOAT ',' LONG_VALUE ')'  */
 #line 823 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4115 "parser.cpp"
+#line 4105 "parser.cpp"
     break;
 
   case 87: /* column_type: TENSOR '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 824 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4121 "parser.cpp"
+#line 4111 "parser.cpp"
     break;
 
   case 88: /* column_type: TENSOR '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 825 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat16}; }
-#line 4127 "parser.cpp"
+#line 4117 "parser.cpp"
     break;
 
   case 89: /* column_type: TENSOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 826 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemBFloat16}; }
-#line 4133 "parser.cpp"
+#line 4123 "parser.cpp"
     break;
 
   case 90: /* column_type: TENSOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 827 "parser.y"
                                                  { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemUInt8}; }
-#line 4139 "parser.cpp"
+#line 4129 "parser.cpp"
     break;
 
   case 91: /* column_type: TENSORARRAY '(' BIT ',' LONG_VALUE ')'  */
 #line 828 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 4145 "parser.cpp"
+#line 4135 "parser.cpp"
     break;
 
   case 92: /* column_type: TENSORARRAY '(' TINYINT ',' LONG_VALUE ')'  */
 #line 829 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 4151 "parser.cpp"
+#line 4141 "parser.cpp"
     break;
 
   case 93: /* column_type: TENSORARRAY '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 830 "parser.y"
                                               { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4157 "parser.cpp"
+#line 4147 "parser.cpp"
     break;
 
   case 94: /* column_type: TENSORARRAY '(' INTEGER ',' LONG_VALUE ')'  */
 #line 831 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4163 "parser.cpp"
+#line 4153 "parser.cpp"
     break;
 
   case 95: /* column_type: TENSORARRAY '(' INT ',' LONG_VALUE ')'  */
 #line 832 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4169 "parser.cpp"
+#line 4159 "parser.cpp"
     break;
 
   case 96: /* column_type: TENSORARRAY '(' BIGINT ',' LONG_VALUE ')'  */
 #line 833 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4175 "parser.cpp"
+#line 4165 "parser.cpp"
     break;
 
   case 97: /* column_type: TENSORARRAY '(' FLOAT ',' LONG_VALUE ')'  */
 #line 834 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4181 "parser.cpp"
+#line 4171 "parser.cpp"
     break;
 
   case 98: /* column_type: TENSORARRAY '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 835 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4187 "parser.cpp"
+#line 4177 "parser.cpp"
     break;
 
   case 99: /* column_type: TENSORARRAY '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 836 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat16}; }
-#line 4193 "parser.cpp"
+#line 4183 "parser.cpp"
     break;
 
   case 100: /* column_type: TENSORARRAY '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 837 "parser.y"
                                               { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemBFloat16}; }
-#line 4199 "parser.cpp"
+#line 4189 "parser.cpp"
     break;
 
   case 101: /* column_type: TENSORARRAY '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 838 "parser.y"
                                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemUInt8}; }
-#line 4205 "parser.cpp"
+#line 4195 "parser.cpp"
     break;
 
   case 102: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
 #line 839 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 4211 "parser.cpp"
+#line 4201 "parser.cpp"
     break;
 
   case 103: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
 #line 840 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 4217 "parser.cpp"
+#line 4207 "parser.cpp"
     break;
 
   case 104: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 841 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4223 "parser.cpp"
+#line 4213 "parser.cpp"
     break;
 
   case 105: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
 #line 842 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4229 "parser.cpp"
+#line 4219 "parser.cpp"
     break;
 
   case 106: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
 #line 843 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4235 "parser.cpp"
+#line 4225 "parser.cpp"
     break;
 
   case 107: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
 #line 844 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4241 "parser.cpp"
+#line 4231 "parser.cpp"
     break;
 
   case 108: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
 #line 845 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4247 "parser.cpp"
+#line 4237 "parser.cpp"
     break;
 
   case 109: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 846 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4253 "parser.cpp"
+#line 4243 "parser.cpp"
     break;
 
   case 110: /* column_type: VECTOR '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 847 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat16}; }
-#line 4259 "parser.cpp"
+#line 4249 "parser.cpp"
     break;
 
   case 111: /* column_type: VECTOR '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 848 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBFloat16}; }
-#line 4265 "parser.cpp"
+#line 4255 "parser.cpp"
     break;
 
   case 112: /* column_type: VECTOR '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 849 "parser.y"
                                                  { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemUInt8}; }
-#line 4271 "parser.cpp"
+#line 4261 "parser.cpp"
     break;
 
   case 113: /* column_type: SPARSE '(' BIT ',' LONG_VALUE ')'  */
 #line 850 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 4277 "parser.cpp"
+#line 4267 "parser.cpp"
     break;
 
   case 114: /* column_type: SPARSE '(' TINYINT ',' LONG_VALUE ')'  */
 #line 851 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 4283 "parser.cpp"
+#line 4273 "parser.cpp"
     break;
 
   case 115: /* column_type: SPARSE '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 852 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4289 "parser.cpp"
+#line 4279 "parser.cpp"
     break;
 
   case 116: /* column_type: SPARSE '(' INTEGER ',' LONG_VALUE ')'  */
 #line 853 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4295 "parser.cpp"
+#line 4285 "parser.cpp"
     break;
 
   case 117: /* column_type: SPARSE '(' INT ',' LONG_VALUE ')'  */
 #line 854 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4301 "parser.cpp"
+#line 4291 "parser.cpp"
     break;
 
   case 118: /* column_type: SPARSE '(' BIGINT ',' LONG_VALUE ')'  */
 #line 855 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4307 "parser.cpp"
+#line 4297 "parser.cpp"
     break;
 
   case 119: /* column_type: SPARSE '(' FLOAT ',' LONG_VALUE ')'  */
 #line 856 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4313 "parser.cpp"
+#line 4303 "parser.cpp"
     break;
 
   case 120: /* column_type: SPARSE '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 857 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4319 "parser.cpp"
+#line 4309 "parser.cpp"
     break;
 
   case 121: /* column_type: SPARSE '(' FLOAT16 ',' LONG_VALUE ')'  */
 #line 858 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat16}; }
-#line 4325 "parser.cpp"
+#line 4315 "parser.cpp"
     break;
 
   case 122: /* column_type: SPARSE '(' BFLOAT16 ',' LONG_VALUE ')'  */
 #line 859 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemBFloat16}; }
-#line 4331 "parser.cpp"
+#line 4321 "parser.cpp"
     break;
 
   case 123: /* column_type: SPARSE '(' UNSIGNED TINYINT ',' LONG_VALUE ')'  */
 #line 860 "parser.y"
                                                  { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemUInt8}; }
-#line 4337 "parser.cpp"
+#line 4327 "parser.cpp"
     break;
 
   case 124: /* column_constraints: column_constraint  */
@@ -4342,7 +4332,7 @@ yyreduce:
     (yyval.column_constraints_t) = new std::set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 4346 "parser.cpp"
+#line 4336 "parser.cpp"
     break;
 
   case 125: /* column_constraints: column_constraints column_constraint  */
@@ -4356,7 +4346,7 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 4360 "parser.cpp"
+#line 4350 "parser.cpp"
     break;
 
   case 126: /* column_constraint: PRIMARY KEY  */
@@ -4364,7 +4354,7 @@ yyreduce:
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4368 "parser.cpp"
+#line 4358 "parser.cpp"
     break;
 
   case 127: /* column_constraint: UNIQUE  */
@@ -4372,7 +4362,7 @@ yyreduce:
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 4376 "parser.cpp"
+#line 4366 "parser.cpp"
     break;
 
   case 128: /* column_constraint: NULLABLE  */
@@ -4380,7 +4370,7 @@ yyreduce:
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 4384 "parser.cpp"
+#line 4374 "parser.cpp"
     break;
 
   case 129: /* column_constraint: NOT NULLABLE  */
@@ -4388,7 +4378,7 @@ yyreduce:
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 4392 "parser.cpp"
+#line 4382 "parser.cpp"
     break;
 
   case 130: /* default_expr: DEFAULT constant_expr  */
@@ -4396,7 +4386,7 @@ yyreduce:
                                      {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 4400 "parser.cpp"
+#line 4390 "parser.cpp"
     break;
 
   case 131: /* default_expr: %empty  */
@@ -4404,7 +4394,7 @@ yyreduce:
                             {
     (yyval.const_expr_t) = nullptr;
 }
-#line 4408 "parser.cpp"
+#line 4398 "parser.cpp"
     break;
 
   case 132: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
@@ -4414,7 +4404,7 @@ yyreduce:
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4418 "parser.cpp"
+#line 4408 "parser.cpp"
     break;
 
   case 133: /* table_constraint: UNIQUE '(' identifier_array ')'  */
@@ -4424,7 +4414,7 @@ yyreduce:
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 4428 "parser.cpp"
+#line 4418 "parser.cpp"
     break;
 
   case 134: /* identifier_array: IDENTIFIER  */
@@ -4435,7 +4425,7 @@ yyreduce:
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4439 "parser.cpp"
+#line 4429 "parser.cpp"
     break;
 
   case 135: /* identifier_array: identifier_array ',' IDENTIFIER  */
@@ -4446,7 +4436,7 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 4450 "parser.cpp"
+#line 4440 "parser.cpp"
     break;
 
   case 136: /* delete_statement: DELETE FROM table_name where_clause  */
@@ -4463,7 +4453,7 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 4467 "parser.cpp"
+#line 4457 "parser.cpp"
     break;
 
   case 137: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
@@ -4502,7 +4492,7 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-2].identifier_array_t);
     (yyval.insert_stmt)->values_ = (yyvsp[0].expr_array_list_t);
 }
-#line 4506 "parser.cpp"
+#line 4496 "parser.cpp"
     break;
 
   case 138: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
@@ -4519,7 +4509,7 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-1].identifier_array_t);
     (yyval.insert_stmt)->select_ = (yyvsp[0].select_stmt);
 }
-#line 4523 "parser.cpp"
+#line 4513 "parser.cpp"
     break;
 
   case 139: /* optional_identifier_array: '(' identifier_array ')'  */
@@ -4527,7 +4517,7 @@ yyreduce:
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 4531 "parser.cpp"
+#line 4521 "parser.cpp"
     break;
 
   case 140: /* optional_identifier_array: %empty  */
@@ -4535,7 +4525,7 @@ yyreduce:
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 4539 "parser.cpp"
+#line 4529 "parser.cpp"
     break;
 
   case 141: /* explain_statement: EXPLAIN explain_type explainable_statement  */
@@ -4545,7 +4535,7 @@ yyreduce:
     (yyval.explain_stmt)->type_ = (yyvsp[-1].explain_type_t);
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 4549 "parser.cpp"
+#line 4539 "parser.cpp"
     break;
 
   case 142: /* explain_type: ANALYZE  */
@@ -4553,7 +4543,7 @@ yyreduce:
                       {
     (yyval.explain_type_t) = infinity::ExplainType::kAnalyze;
 }
-#line 4557 "parser.cpp"
+#line 4547 "parser.cpp"
     break;
 
   case 143: /* explain_type: AST  */
@@ -4561,7 +4551,7 @@ yyreduce:
       {
     (yyval.explain_type_t) = infinity::ExplainType::kAst;
 }
-#line 4565 "parser.cpp"
+#line 4555 "parser.cpp"
     break;
 
   case 144: /* explain_type: RAW  */
@@ -4569,7 +4559,7 @@ yyreduce:
       {
     (yyval.explain_type_t) = infinity::ExplainType::kUnOpt;
 }
-#line 4573 "parser.cpp"
+#line 4563 "parser.cpp"
     break;
 
   case 145: /* explain_type: LOGICAL  */
@@ -4577,7 +4567,7 @@ yyreduce:
           {
     (yyval.explain_type_t) = infinity::ExplainType::kOpt;
 }
-#line 4581 "parser.cpp"
+#line 4571 "parser.cpp"
     break;
 
   case 146: /* explain_type: PHYSICAL  */
@@ -4585,7 +4575,7 @@ yyreduce:
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4589 "parser.cpp"
+#line 4579 "parser.cpp"
     break;
 
   case 147: /* explain_type: PIPELINE  */
@@ -4593,7 +4583,7 @@ yyreduce:
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPipeline;
 }
-#line 4597 "parser.cpp"
+#line 4587 "parser.cpp"
     break;
 
   case 148: /* explain_type: FRAGMENT  */
@@ -4601,7 +4591,7 @@ yyreduce:
            {
     (yyval.explain_type_t) = infinity::ExplainType::kFragment;
 }
-#line 4605 "parser.cpp"
+#line 4595 "parser.cpp"
     break;
 
   case 149: /* explain_type: %empty  */
@@ -4609,7 +4599,7 @@ yyreduce:
   {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4613 "parser.cpp"
+#line 4603 "parser.cpp"
     break;
 
   case 150: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
@@ -4626,7 +4616,7 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 4630 "parser.cpp"
+#line 4620 "parser.cpp"
     break;
 
   case 151: /* update_expr_array: update_expr  */
@@ -4635,7 +4625,7 @@ yyreduce:
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 4639 "parser.cpp"
+#line 4629 "parser.cpp"
     break;
 
   case 152: /* update_expr_array: update_expr_array ',' update_expr  */
@@ -4644,7 +4634,7 @@ yyreduce:
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 4648 "parser.cpp"
+#line 4638 "parser.cpp"
     break;
 
   case 153: /* update_expr: IDENTIFIER '=' expr  */
@@ -4656,7 +4646,7 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 4660 "parser.cpp"
+#line 4650 "parser.cpp"
     break;
 
   case 154: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
@@ -4672,7 +4662,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 4676 "parser.cpp"
+#line 4666 "parser.cpp"
     break;
 
   case 155: /* drop_statement: DROP COLLECTION if_exists table_name  */
@@ -4690,7 +4680,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4694 "parser.cpp"
+#line 4684 "parser.cpp"
     break;
 
   case 156: /* drop_statement: DROP TABLE if_exists table_name  */
@@ -4708,7 +4698,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4712 "parser.cpp"
+#line 4702 "parser.cpp"
     break;
 
   case 157: /* drop_statement: DROP VIEW if_exists table_name  */
@@ -4726,7 +4716,7 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4730 "parser.cpp"
+#line 4720 "parser.cpp"
     break;
 
   case 158: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
@@ -4749,7 +4739,7 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4753 "parser.cpp"
+#line 4743 "parser.cpp"
     break;
 
   case 159: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
@@ -4802,6 +4792,16 @@ yyreduce:
                 (yyval.copy_stmt)->row_limit_ = option_ptr->row_limit_;
                 break;
             }
+            case infinity::CopyOptionType::kCompression: {
+                (yyval.copy_stmt)->compression_ = option_ptr->compression_;
+                break;
+            }
+            default: {
+                delete option_ptr;
+                delete (yyvsp[-1].copy_option_array);
+                yyerror(&yyloc, scanner, result, "Invalid export option");
+                YYERROR;
+            }
         }
         delete option_ptr;
     }
@@ -4811,7 +4811,7 @@ yyreduce:
     break;
 
   case 160: /* copy_statement: COPY table_name '(' expr_array ')' TO file_path WITH '(' copy_option_list ')'  */
-#line 1218 "parser.y"
+#line 1228 "parser.y"
                                                                                 {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4862,16 +4862,26 @@ yyreduce:
                 (yyval.copy_stmt)->row_limit_ = option_ptr->row_limit_;
                 break;
             }
+            case infinity::CopyOptionType::kCompression: {
+                (yyval.copy_stmt)->compression_ = option_ptr->compression_;
+                break;
+            }
+            default: {
+                delete option_ptr;
+                delete (yyvsp[-1].copy_option_array);
+                yyerror(&yyloc, scanner, result, "Invalid export option");
+                YYERROR;
+            }
         }
         delete option_ptr;
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4871 "parser.cpp"
+#line 4881 "parser.cpp"
     break;
 
   case 161: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
-#line 1273 "parser.y"
+#line 1293 "parser.y"
                                                                {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4908,6 +4918,10 @@ yyreduce:
                 (yyval.copy_stmt)->header_ = option_ptr->header_;
                 break;
             }
+            case infinity::CopyOptionType::kFilter: {
+                (yyval.copy_stmt)->filter_ = option_ptr->filter_;
+                break;
+            }
             default: {
                 delete option_ptr;
                 delete (yyvsp[-1].copy_option_array);
@@ -4919,27 +4933,27 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4923 "parser.cpp"
+#line 4937 "parser.cpp"
     break;
 
   case 162: /* select_statement: select_without_paren  */
-#line 1324 "parser.y"
+#line 1348 "parser.y"
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4931 "parser.cpp"
+#line 4945 "parser.cpp"
     break;
 
   case 163: /* select_statement: select_with_paren  */
-#line 1327 "parser.y"
+#line 1351 "parser.y"
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4939 "parser.cpp"
+#line 4953 "parser.cpp"
     break;
 
   case 164: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
-#line 1330 "parser.y"
+#line 1354 "parser.y"
                                                                      {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4949,11 +4963,11 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4953 "parser.cpp"
+#line 4967 "parser.cpp"
     break;
 
   case 165: /* select_statement: select_statement set_operator select_clause_without_modifier  */
-#line 1339 "parser.y"
+#line 1363 "parser.y"
                                                                {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4963,36 +4977,36 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4967 "parser.cpp"
+#line 4981 "parser.cpp"
     break;
 
   case 166: /* select_with_paren: '(' select_without_paren ')'  */
-#line 1349 "parser.y"
+#line 1373 "parser.y"
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4975 "parser.cpp"
+#line 4989 "parser.cpp"
     break;
 
   case 167: /* select_with_paren: '(' select_with_paren ')'  */
-#line 1352 "parser.y"
+#line 1376 "parser.y"
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4983 "parser.cpp"
+#line 4997 "parser.cpp"
     break;
 
   case 168: /* select_without_paren: with_clause select_clause_with_modifier  */
-#line 1356 "parser.y"
+#line 1380 "parser.y"
                                                               {
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4992 "parser.cpp"
+#line 5006 "parser.cpp"
     break;
 
   case 169: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
-#line 1361 "parser.y"
+#line 1385 "parser.y"
                                                                                                    {
     if((yyvsp[-1].expr_t) == nullptr and (yyvsp[0].expr_t) != nullptr) {
         delete (yyvsp[-3].select_stmt);
@@ -5014,27 +5028,27 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 5018 "parser.cpp"
+#line 5032 "parser.cpp"
     break;
 
   case 170: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
-#line 1383 "parser.y"
+#line 1407 "parser.y"
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5026 "parser.cpp"
+#line 5040 "parser.cpp"
     break;
 
   case 171: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
-#line 1386 "parser.y"
+#line 1410 "parser.y"
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 5034 "parser.cpp"
+#line 5048 "parser.cpp"
     break;
 
   case 172: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
-#line 1391 "parser.y"
+#line 1415 "parser.y"
                                                                                                 {
     (yyval.select_stmt) = new infinity::SelectStatement();
     (yyval.select_stmt)->select_list_ = (yyvsp[-5].expr_array_t);
@@ -5050,245 +5064,245 @@ yyreduce:
         YYERROR;
     }
 }
-#line 5054 "parser.cpp"
+#line 5068 "parser.cpp"
     break;
 
   case 173: /* order_by_clause: ORDER BY order_by_expr_list  */
-#line 1407 "parser.y"
+#line 1431 "parser.y"
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 5062 "parser.cpp"
+#line 5076 "parser.cpp"
     break;
 
   case 174: /* order_by_clause: %empty  */
-#line 1410 "parser.y"
+#line 1434 "parser.y"
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 5070 "parser.cpp"
+#line 5084 "parser.cpp"
     break;
 
   case 175: /* order_by_expr_list: order_by_expr  */
-#line 1414 "parser.y"
+#line 1438 "parser.y"
                                   {
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 5079 "parser.cpp"
+#line 5093 "parser.cpp"
     break;
 
   case 176: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
-#line 1418 "parser.y"
+#line 1442 "parser.y"
                                        {
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 5088 "parser.cpp"
+#line 5102 "parser.cpp"
     break;
 
   case 177: /* order_by_expr: expr order_by_type  */
-#line 1423 "parser.y"
+#line 1447 "parser.y"
                                    {
     (yyval.order_by_expr_t) = new infinity::OrderByExpr();
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 5098 "parser.cpp"
+#line 5112 "parser.cpp"
     break;
 
   case 178: /* order_by_type: ASC  */
-#line 1429 "parser.y"
+#line 1453 "parser.y"
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 5106 "parser.cpp"
+#line 5120 "parser.cpp"
     break;
 
   case 179: /* order_by_type: DESC  */
-#line 1432 "parser.y"
+#line 1456 "parser.y"
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 5114 "parser.cpp"
+#line 5128 "parser.cpp"
     break;
 
   case 180: /* order_by_type: %empty  */
-#line 1435 "parser.y"
+#line 1459 "parser.y"
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 5122 "parser.cpp"
+#line 5136 "parser.cpp"
     break;
 
   case 181: /* limit_expr: LIMIT expr  */
-#line 1439 "parser.y"
+#line 1463 "parser.y"
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5130 "parser.cpp"
+#line 5144 "parser.cpp"
     break;
 
   case 182: /* limit_expr: %empty  */
-#line 1443 "parser.y"
+#line 1467 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 5136 "parser.cpp"
+#line 5150 "parser.cpp"
     break;
 
   case 183: /* offset_expr: OFFSET expr  */
-#line 1445 "parser.y"
+#line 1469 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5144 "parser.cpp"
+#line 5158 "parser.cpp"
     break;
 
   case 184: /* offset_expr: %empty  */
-#line 1449 "parser.y"
+#line 1473 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 5150 "parser.cpp"
+#line 5164 "parser.cpp"
     break;
 
   case 185: /* distinct: DISTINCT  */
-#line 1451 "parser.y"
+#line 1475 "parser.y"
                     {
     (yyval.bool_value) = true;
 }
-#line 5158 "parser.cpp"
+#line 5172 "parser.cpp"
     break;
 
   case 186: /* distinct: %empty  */
-#line 1454 "parser.y"
+#line 1478 "parser.y"
   {
     (yyval.bool_value) = false;
 }
-#line 5166 "parser.cpp"
+#line 5180 "parser.cpp"
     break;
 
   case 187: /* from_clause: FROM table_reference  */
-#line 1458 "parser.y"
+#line 1482 "parser.y"
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 5174 "parser.cpp"
+#line 5188 "parser.cpp"
     break;
 
   case 188: /* from_clause: %empty  */
-#line 1461 "parser.y"
+#line 1485 "parser.y"
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 5182 "parser.cpp"
+#line 5196 "parser.cpp"
     break;
 
   case 189: /* search_clause: SEARCH sub_search_array  */
-#line 1465 "parser.y"
+#line 1489 "parser.y"
                                        {
     infinity::SearchExpr* search_expr = new infinity::SearchExpr();
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 5192 "parser.cpp"
+#line 5206 "parser.cpp"
     break;
 
   case 190: /* search_clause: %empty  */
-#line 1470 "parser.y"
+#line 1494 "parser.y"
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 5200 "parser.cpp"
+#line 5214 "parser.cpp"
     break;
 
   case 191: /* where_clause: WHERE expr  */
-#line 1474 "parser.y"
+#line 1498 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5208 "parser.cpp"
+#line 5222 "parser.cpp"
     break;
 
   case 192: /* where_clause: %empty  */
-#line 1477 "parser.y"
+#line 1501 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 5216 "parser.cpp"
+#line 5230 "parser.cpp"
     break;
 
   case 193: /* having_clause: HAVING expr  */
-#line 1481 "parser.y"
+#line 1505 "parser.y"
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5224 "parser.cpp"
+#line 5238 "parser.cpp"
     break;
 
   case 194: /* having_clause: %empty  */
-#line 1484 "parser.y"
+#line 1508 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 5232 "parser.cpp"
+#line 5246 "parser.cpp"
     break;
 
   case 195: /* group_by_clause: GROUP BY expr_array  */
-#line 1488 "parser.y"
+#line 1512 "parser.y"
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 5240 "parser.cpp"
+#line 5254 "parser.cpp"
     break;
 
   case 196: /* group_by_clause: %empty  */
-#line 1491 "parser.y"
+#line 1515 "parser.y"
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 5248 "parser.cpp"
+#line 5262 "parser.cpp"
     break;
 
   case 197: /* set_operator: UNION  */
-#line 1495 "parser.y"
+#line 1519 "parser.y"
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 5256 "parser.cpp"
+#line 5270 "parser.cpp"
     break;
 
   case 198: /* set_operator: UNION ALL  */
-#line 1498 "parser.y"
+#line 1522 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 5264 "parser.cpp"
+#line 5278 "parser.cpp"
     break;
 
   case 199: /* set_operator: INTERSECT  */
-#line 1501 "parser.y"
+#line 1525 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 5272 "parser.cpp"
+#line 5286 "parser.cpp"
     break;
 
   case 200: /* set_operator: EXCEPT  */
-#line 1504 "parser.y"
+#line 1528 "parser.y"
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 5280 "parser.cpp"
+#line 5294 "parser.cpp"
     break;
 
   case 201: /* table_reference: table_reference_unit  */
-#line 1512 "parser.y"
+#line 1536 "parser.y"
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 5288 "parser.cpp"
+#line 5302 "parser.cpp"
     break;
 
   case 202: /* table_reference: table_reference ',' table_reference_unit  */
-#line 1515 "parser.y"
+#line 1539 "parser.y"
                                            {
     infinity::CrossProductReference* cross_product_ref = nullptr;
     if((yyvsp[-2].table_reference_t)->type_ == infinity::TableRefType::kCrossProduct) {
@@ -5302,11 +5316,11 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 5306 "parser.cpp"
+#line 5320 "parser.cpp"
     break;
 
   case 205: /* table_reference_name: table_name table_alias  */
-#line 1532 "parser.y"
+#line 1556 "parser.y"
                                               {
     infinity::TableReference* table_ref = new infinity::TableReference();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5320,32 +5334,32 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 5324 "parser.cpp"
+#line 5338 "parser.cpp"
     break;
 
   case 206: /* table_reference_name: '(' select_statement ')' table_alias  */
-#line 1546 "parser.y"
+#line 1570 "parser.y"
                                        {
     infinity::SubqueryReference* subquery_reference = new infinity::SubqueryReference();
     subquery_reference->select_statement_ = (yyvsp[-2].select_stmt);
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 5335 "parser.cpp"
+#line 5349 "parser.cpp"
     break;
 
   case 207: /* table_name: IDENTIFIER  */
-#line 1555 "parser.y"
+#line 1579 "parser.y"
                         {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5345 "parser.cpp"
+#line 5359 "parser.cpp"
     break;
 
   case 208: /* table_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1560 "parser.y"
+#line 1584 "parser.y"
                             {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -5353,84 +5367,84 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5357 "parser.cpp"
+#line 5371 "parser.cpp"
     break;
 
   case 209: /* table_alias: AS IDENTIFIER  */
-#line 1569 "parser.y"
+#line 1593 "parser.y"
                             {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5367 "parser.cpp"
+#line 5381 "parser.cpp"
     break;
 
   case 210: /* table_alias: IDENTIFIER  */
-#line 1574 "parser.y"
+#line 1598 "parser.y"
              {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5377 "parser.cpp"
+#line 5391 "parser.cpp"
     break;
 
   case 211: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
-#line 1579 "parser.y"
+#line 1603 "parser.y"
                                          {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[-3].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 5388 "parser.cpp"
+#line 5402 "parser.cpp"
     break;
 
   case 212: /* table_alias: %empty  */
-#line 1585 "parser.y"
+#line 1609 "parser.y"
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 5396 "parser.cpp"
+#line 5410 "parser.cpp"
     break;
 
   case 213: /* with_clause: WITH with_expr_list  */
-#line 1592 "parser.y"
+#line 1616 "parser.y"
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 5404 "parser.cpp"
+#line 5418 "parser.cpp"
     break;
 
   case 214: /* with_clause: %empty  */
-#line 1595 "parser.y"
+#line 1619 "parser.y"
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 5412 "parser.cpp"
+#line 5426 "parser.cpp"
     break;
 
   case 215: /* with_expr_list: with_expr  */
-#line 1599 "parser.y"
+#line 1623 "parser.y"
                           {
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 5421 "parser.cpp"
+#line 5435 "parser.cpp"
     break;
 
   case 216: /* with_expr_list: with_expr_list ',' with_expr  */
-#line 1602 "parser.y"
+#line 1626 "parser.y"
                                  {
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 5430 "parser.cpp"
+#line 5444 "parser.cpp"
     break;
 
   case 217: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
-#line 1607 "parser.y"
+#line 1631 "parser.y"
                                                              {
     (yyval.with_expr_t) = new infinity::WithExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -5438,11 +5452,11 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 5442 "parser.cpp"
+#line 5456 "parser.cpp"
     break;
 
   case 218: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
-#line 1619 "parser.y"
+#line 1643 "parser.y"
                                                                     {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-3].table_reference_t);
@@ -5450,11 +5464,11 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 5454 "parser.cpp"
+#line 5468 "parser.cpp"
     break;
 
   case 219: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
-#line 1626 "parser.y"
+#line 1650 "parser.y"
                                                                    {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-5].table_reference_t);
@@ -5463,102 +5477,102 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 5467 "parser.cpp"
+#line 5481 "parser.cpp"
     break;
 
   case 220: /* join_type: INNER  */
-#line 1640 "parser.y"
+#line 1664 "parser.y"
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 5475 "parser.cpp"
+#line 5489 "parser.cpp"
     break;
 
   case 221: /* join_type: LEFT  */
-#line 1643 "parser.y"
+#line 1667 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 5483 "parser.cpp"
+#line 5497 "parser.cpp"
     break;
 
   case 222: /* join_type: RIGHT  */
-#line 1646 "parser.y"
+#line 1670 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 5491 "parser.cpp"
+#line 5505 "parser.cpp"
     break;
 
   case 223: /* join_type: OUTER  */
-#line 1649 "parser.y"
+#line 1673 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 5499 "parser.cpp"
+#line 5513 "parser.cpp"
     break;
 
   case 224: /* join_type: FULL  */
-#line 1652 "parser.y"
+#line 1676 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 5507 "parser.cpp"
+#line 5521 "parser.cpp"
     break;
 
   case 225: /* join_type: CROSS  */
-#line 1655 "parser.y"
+#line 1679 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 5515 "parser.cpp"
+#line 5529 "parser.cpp"
     break;
 
   case 226: /* join_type: %empty  */
-#line 1658 "parser.y"
+#line 1682 "parser.y"
                 {
 }
-#line 5522 "parser.cpp"
+#line 5536 "parser.cpp"
     break;
 
   case 227: /* show_statement: SHOW DATABASES  */
-#line 1664 "parser.y"
+#line 1688 "parser.y"
                                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 5531 "parser.cpp"
+#line 5545 "parser.cpp"
     break;
 
   case 228: /* show_statement: SHOW TABLES  */
-#line 1668 "parser.y"
+#line 1692 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 5540 "parser.cpp"
+#line 5554 "parser.cpp"
     break;
 
   case 229: /* show_statement: SHOW VIEWS  */
-#line 1672 "parser.y"
+#line 1696 "parser.y"
              {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kViews;
 }
-#line 5549 "parser.cpp"
+#line 5563 "parser.cpp"
     break;
 
   case 230: /* show_statement: SHOW CONFIGS  */
-#line 1676 "parser.y"
+#line 1700 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 5558 "parser.cpp"
+#line 5572 "parser.cpp"
     break;
 
   case 231: /* show_statement: SHOW CONFIG IDENTIFIER  */
-#line 1680 "parser.y"
+#line 1704 "parser.y"
                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfig;
@@ -5566,127 +5580,127 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5570 "parser.cpp"
+#line 5584 "parser.cpp"
     break;
 
   case 232: /* show_statement: SHOW PROFILES  */
-#line 1687 "parser.y"
+#line 1711 "parser.y"
                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 5579 "parser.cpp"
+#line 5593 "parser.cpp"
     break;
 
   case 233: /* show_statement: SHOW BUFFER  */
-#line 1691 "parser.y"
+#line 1715 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBuffer;
 }
-#line 5588 "parser.cpp"
+#line 5602 "parser.cpp"
     break;
 
   case 234: /* show_statement: SHOW MEMINDEX  */
-#line 1695 "parser.y"
+#line 1719 "parser.y"
                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kMemIndex;
 }
-#line 5597 "parser.cpp"
+#line 5611 "parser.cpp"
     break;
 
   case 235: /* show_statement: SHOW QUERIES  */
-#line 1699 "parser.y"
+#line 1723 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kQueries;
 }
-#line 5606 "parser.cpp"
+#line 5620 "parser.cpp"
     break;
 
   case 236: /* show_statement: SHOW QUERY SESSION LONG_VALUE  */
-#line 1703 "parser.y"
+#line 1727 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kQuery;
     (yyval.show_stmt)->session_id_ = (yyvsp[0].long_value);
 }
-#line 5616 "parser.cpp"
+#line 5630 "parser.cpp"
     break;
 
   case 237: /* show_statement: SHOW TRANSACTIONS  */
-#line 1708 "parser.y"
+#line 1732 "parser.y"
                     {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTransactions;
 }
-#line 5625 "parser.cpp"
+#line 5639 "parser.cpp"
     break;
 
   case 238: /* show_statement: SHOW TRANSACTION LONG_VALUE  */
-#line 1712 "parser.y"
+#line 1736 "parser.y"
                               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTransaction;
     (yyval.show_stmt)->txn_id_ = (yyvsp[0].long_value);
 }
-#line 5635 "parser.cpp"
+#line 5649 "parser.cpp"
     break;
 
   case 239: /* show_statement: SHOW SESSION VARIABLES  */
-#line 1717 "parser.y"
+#line 1741 "parser.y"
                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariables;
 }
-#line 5644 "parser.cpp"
+#line 5658 "parser.cpp"
     break;
 
   case 240: /* show_statement: SHOW GLOBAL VARIABLES  */
-#line 1721 "parser.y"
+#line 1745 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariables;
 }
-#line 5653 "parser.cpp"
+#line 5667 "parser.cpp"
     break;
 
   case 241: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
-#line 1725 "parser.y"
+#line 1749 "parser.y"
                                    {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5664 "parser.cpp"
+#line 5678 "parser.cpp"
     break;
 
   case 242: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
-#line 1731 "parser.y"
+#line 1755 "parser.y"
                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5675 "parser.cpp"
+#line 5689 "parser.cpp"
     break;
 
   case 243: /* show_statement: SHOW DATABASE IDENTIFIER  */
-#line 1737 "parser.y"
+#line 1761 "parser.y"
                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabase;
     (yyval.show_stmt)->schema_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5686 "parser.cpp"
+#line 5700 "parser.cpp"
     break;
 
   case 244: /* show_statement: SHOW TABLE table_name  */
-#line 1743 "parser.y"
+#line 1767 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTable;
@@ -5698,11 +5712,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5702 "parser.cpp"
+#line 5716 "parser.cpp"
     break;
 
   case 245: /* show_statement: SHOW TABLE table_name COLUMNS  */
-#line 1754 "parser.y"
+#line 1778 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kColumns;
@@ -5714,11 +5728,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5718 "parser.cpp"
+#line 5732 "parser.cpp"
     break;
 
   case 246: /* show_statement: SHOW TABLE table_name SEGMENTS  */
-#line 1765 "parser.y"
+#line 1789 "parser.y"
                                  {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -5730,11 +5744,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5734 "parser.cpp"
+#line 5748 "parser.cpp"
     break;
 
   case 247: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
-#line 1776 "parser.y"
+#line 1800 "parser.y"
                                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegment;
@@ -5747,11 +5761,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 5751 "parser.cpp"
+#line 5765 "parser.cpp"
     break;
 
   case 248: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
-#line 1788 "parser.y"
+#line 1812 "parser.y"
                                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlocks;
@@ -5764,11 +5778,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[-1].long_value);
     delete (yyvsp[-3].table_name_t);
 }
-#line 5768 "parser.cpp"
+#line 5782 "parser.cpp"
     break;
 
   case 249: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 1800 "parser.y"
+#line 1824 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlock;
@@ -5782,11 +5796,11 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 5786 "parser.cpp"
+#line 5800 "parser.cpp"
     break;
 
   case 250: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
-#line 1813 "parser.y"
+#line 1837 "parser.y"
                                                                               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlockColumn;
@@ -5801,11 +5815,11 @@ yyreduce:
     (yyval.show_stmt)->column_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-6].table_name_t);
 }
-#line 5805 "parser.cpp"
+#line 5819 "parser.cpp"
     break;
 
   case 251: /* show_statement: SHOW TABLE table_name INDEXES  */
-#line 1827 "parser.y"
+#line 1851 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexes;
@@ -5817,11 +5831,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5821 "parser.cpp"
+#line 5835 "parser.cpp"
     break;
 
   case 252: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
-#line 1838 "parser.y"
+#line 1862 "parser.y"
                                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndex;
@@ -5836,11 +5850,11 @@ yyreduce:
     (yyval.show_stmt)->index_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5840 "parser.cpp"
+#line 5854 "parser.cpp"
     break;
 
   case 253: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE  */
-#line 1852 "parser.y"
+#line 1876 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexSegment;
@@ -5857,11 +5871,11 @@ yyreduce:
 
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
 }
-#line 5861 "parser.cpp"
+#line 5875 "parser.cpp"
     break;
 
   case 254: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE CHUNK LONG_VALUE  */
-#line 1868 "parser.y"
+#line 1892 "parser.y"
                                                                              {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexChunk;
@@ -5879,94 +5893,94 @@ yyreduce:
       (yyval.show_stmt)->segment_id_ = (yyvsp[-2].long_value);
       (yyval.show_stmt)->chunk_id_ = (yyvsp[0].long_value);
 }
-#line 5883 "parser.cpp"
+#line 5897 "parser.cpp"
     break;
 
   case 255: /* show_statement: SHOW LOGS  */
-#line 1885 "parser.y"
+#line 1909 "parser.y"
             {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kLogs;
 }
-#line 5892 "parser.cpp"
+#line 5906 "parser.cpp"
     break;
 
   case 256: /* show_statement: SHOW DELTA LOGS  */
-#line 1889 "parser.y"
+#line 1913 "parser.y"
                   {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDeltaLogs;
 }
-#line 5901 "parser.cpp"
+#line 5915 "parser.cpp"
     break;
 
   case 257: /* show_statement: SHOW CATALOGS  */
-#line 1893 "parser.y"
+#line 1917 "parser.y"
                 {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kCatalogs;
 }
-#line 5910 "parser.cpp"
+#line 5924 "parser.cpp"
     break;
 
   case 258: /* show_statement: SHOW PERSISTENCE FILES  */
-#line 1897 "parser.y"
+#line 1921 "parser.y"
                          {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kPersistenceFiles;
 }
-#line 5919 "parser.cpp"
+#line 5933 "parser.cpp"
     break;
 
   case 259: /* show_statement: SHOW PERSISTENCE OBJECTS  */
-#line 1901 "parser.y"
+#line 1925 "parser.y"
                            {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kPersistenceObjects;
 }
-#line 5928 "parser.cpp"
+#line 5942 "parser.cpp"
     break;
 
   case 260: /* show_statement: SHOW PERSISTENCE OBJECT STRING  */
-#line 1905 "parser.y"
+#line 1929 "parser.y"
                                  {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kPersistenceObject;
       (yyval.show_stmt)->file_name_ = (yyvsp[0].str_value);
       free((yyvsp[0].str_value));
 }
-#line 5939 "parser.cpp"
+#line 5953 "parser.cpp"
     break;
 
   case 261: /* flush_statement: FLUSH DATA  */
-#line 1915 "parser.y"
+#line 1939 "parser.y"
                             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 5948 "parser.cpp"
+#line 5962 "parser.cpp"
     break;
 
   case 262: /* flush_statement: FLUSH LOG  */
-#line 1919 "parser.y"
+#line 1943 "parser.y"
             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 5957 "parser.cpp"
+#line 5971 "parser.cpp"
     break;
 
   case 263: /* flush_statement: FLUSH BUFFER  */
-#line 1923 "parser.y"
+#line 1947 "parser.y"
                {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 5966 "parser.cpp"
+#line 5980 "parser.cpp"
     break;
 
   case 264: /* optimize_statement: OPTIMIZE table_name  */
-#line 1931 "parser.y"
+#line 1955 "parser.y"
                                         {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     if((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5977,11 +5991,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5981 "parser.cpp"
+#line 5995 "parser.cpp"
     break;
 
   case 265: /* optimize_statement: OPTIMIZE IDENTIFIER ON table_name with_index_param_list  */
-#line 1942 "parser.y"
+#line 1966 "parser.y"
                                                          {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -6001,54 +6015,54 @@ yyreduce:
     }
     delete (yyvsp[0].with_index_param_list_t);
 }
-#line 6005 "parser.cpp"
+#line 6019 "parser.cpp"
     break;
 
   case 266: /* command_statement: USE IDENTIFIER  */
-#line 1965 "parser.y"
+#line 1989 "parser.y"
                                   {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6016 "parser.cpp"
+#line 6030 "parser.cpp"
     break;
 
   case 267: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
-#line 1971 "parser.y"
+#line 1995 "parser.y"
                                       {
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 6026 "parser.cpp"
+#line 6040 "parser.cpp"
     break;
 
   case 268: /* command_statement: SET SESSION IDENTIFIER ON  */
-#line 1976 "parser.y"
+#line 2000 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 6037 "parser.cpp"
+#line 6051 "parser.cpp"
     break;
 
   case 269: /* command_statement: SET SESSION IDENTIFIER OFF  */
-#line 1982 "parser.y"
+#line 2006 "parser.y"
                              {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 6048 "parser.cpp"
+#line 6062 "parser.cpp"
     break;
 
   case 270: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
-#line 1988 "parser.y"
+#line 2012 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6057,55 +6071,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6061 "parser.cpp"
+#line 6075 "parser.cpp"
     break;
 
   case 271: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
-#line 1996 "parser.y"
+#line 2020 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 6072 "parser.cpp"
+#line 6086 "parser.cpp"
     break;
 
   case 272: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
-#line 2002 "parser.y"
+#line 2026 "parser.y"
                                       {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 6083 "parser.cpp"
+#line 6097 "parser.cpp"
     break;
 
   case 273: /* command_statement: SET GLOBAL IDENTIFIER ON  */
-#line 2008 "parser.y"
+#line 2032 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 6094 "parser.cpp"
+#line 6108 "parser.cpp"
     break;
 
   case 274: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
-#line 2014 "parser.y"
+#line 2038 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 6105 "parser.cpp"
+#line 6119 "parser.cpp"
     break;
 
   case 275: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
-#line 2020 "parser.y"
+#line 2044 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6114,55 +6128,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6118 "parser.cpp"
+#line 6132 "parser.cpp"
     break;
 
   case 276: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
-#line 2028 "parser.y"
+#line 2052 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 6129 "parser.cpp"
+#line 6143 "parser.cpp"
     break;
 
   case 277: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
-#line 2034 "parser.y"
+#line 2058 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 6140 "parser.cpp"
+#line 6154 "parser.cpp"
     break;
 
   case 278: /* command_statement: SET CONFIG IDENTIFIER ON  */
-#line 2040 "parser.y"
+#line 2064 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 6151 "parser.cpp"
+#line 6165 "parser.cpp"
     break;
 
   case 279: /* command_statement: SET CONFIG IDENTIFIER OFF  */
-#line 2046 "parser.y"
+#line 2070 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 6162 "parser.cpp"
+#line 6176 "parser.cpp"
     break;
 
   case 280: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
-#line 2052 "parser.y"
+#line 2076 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6171,33 +6185,33 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 6175 "parser.cpp"
+#line 6189 "parser.cpp"
     break;
 
   case 281: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
-#line 2060 "parser.y"
+#line 2084 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 6186 "parser.cpp"
+#line 6200 "parser.cpp"
     break;
 
   case 282: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
-#line 2066 "parser.y"
+#line 2090 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_shared<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 6197 "parser.cpp"
+#line 6211 "parser.cpp"
     break;
 
   case 283: /* compact_statement: COMPACT TABLE table_name  */
-#line 2073 "parser.y"
+#line 2097 "parser.y"
                                             {
     std::string schema_name;
     if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -6210,41 +6224,41 @@ yyreduce:
     (yyval.compact_stmt) = new infinity::ManualCompactStatement(std::move(schema_name), std::move(table_name));
     delete (yyvsp[0].table_name_t);
 }
-#line 6214 "parser.cpp"
+#line 6228 "parser.cpp"
     break;
 
   case 284: /* admin_statement: ADMIN SHOW CATALOGS  */
-#line 2086 "parser.y"
+#line 2110 "parser.y"
                                      {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListCatalogs;
 }
-#line 6223 "parser.cpp"
+#line 6237 "parser.cpp"
     break;
 
   case 285: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE  */
-#line 2090 "parser.y"
+#line 2114 "parser.y"
                                 {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowCatalog;
      (yyval.admin_stmt)->catalog_file_index_ = (yyvsp[0].long_value);
 }
-#line 6233 "parser.cpp"
+#line 6247 "parser.cpp"
     break;
 
   case 286: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASES  */
-#line 2095 "parser.y"
+#line 2119 "parser.y"
                                                      {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListDatabases;
      (yyval.admin_stmt)->catalog_file_start_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->catalog_file_end_index_ = (yyvsp[-1].long_value);
 }
-#line 6244 "parser.cpp"
+#line 6258 "parser.cpp"
     break;
 
   case 287: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE  */
-#line 2101 "parser.y"
+#line 2125 "parser.y"
                                                                {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowDatabase;
@@ -6252,11 +6266,11 @@ yyreduce:
      (yyval.admin_stmt)->catalog_file_end_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->database_meta_index_ = (yyvsp[0].long_value);
 }
-#line 6256 "parser.cpp"
+#line 6270 "parser.cpp"
     break;
 
   case 288: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLES  */
-#line 2108 "parser.y"
+#line 2132 "parser.y"
                                                                                  {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListTables;
@@ -6265,11 +6279,11 @@ yyreduce:
      (yyval.admin_stmt)->database_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->database_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6269 "parser.cpp"
+#line 6283 "parser.cpp"
     break;
 
   case 289: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE  */
-#line 2116 "parser.y"
+#line 2140 "parser.y"
                                                                                            {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowTable;
@@ -6279,11 +6293,11 @@ yyreduce:
      (yyval.admin_stmt)->database_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[0].long_value);
 }
-#line 6283 "parser.cpp"
+#line 6297 "parser.cpp"
     break;
 
   case 290: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE COLUMNS  */
-#line 2125 "parser.y"
+#line 2149 "parser.y"
                                                                                                               {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowColumn;
@@ -6294,11 +6308,11 @@ yyreduce:
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6298 "parser.cpp"
+#line 6312 "parser.cpp"
     break;
 
   case 291: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENTS  */
-#line 2135 "parser.y"
+#line 2159 "parser.y"
                                                                                                                {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListSegments;
@@ -6309,11 +6323,11 @@ yyreduce:
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6313 "parser.cpp"
+#line 6327 "parser.cpp"
     break;
 
   case 292: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE  */
-#line 2145 "parser.y"
+#line 2169 "parser.y"
                                                                                                                          {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowSegment;
@@ -6325,11 +6339,11 @@ yyreduce:
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->segment_index_ = (yyvsp[0].long_value);
 }
-#line 6329 "parser.cpp"
+#line 6343 "parser.cpp"
     break;
 
   case 293: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCKS  */
-#line 2156 "parser.y"
+#line 2180 "parser.y"
                                                                                                                                 {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListBlocks;
@@ -6341,11 +6355,11 @@ yyreduce:
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-3].long_value);
      (yyval.admin_stmt)->segment_index_ = (yyvsp[-1].long_value);
 }
-#line 6345 "parser.cpp"
+#line 6359 "parser.cpp"
     break;
 
   case 294: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 2167 "parser.y"
+#line 2191 "parser.y"
                                                                                                                                           {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowBlock;
@@ -6358,11 +6372,11 @@ yyreduce:
      (yyval.admin_stmt)->segment_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->block_index_ = (yyvsp[0].long_value);
 }
-#line 6362 "parser.cpp"
+#line 6376 "parser.cpp"
     break;
 
   case 295: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMNS  */
-#line 2179 "parser.y"
+#line 2203 "parser.y"
                                                                                                                                                   {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListColumns;
@@ -6375,11 +6389,11 @@ yyreduce:
      (yyval.admin_stmt)->segment_index_ = (yyvsp[-3].long_value);
      (yyval.admin_stmt)->block_index_ = (yyvsp[-1].long_value);
 }
-#line 6379 "parser.cpp"
+#line 6393 "parser.cpp"
     break;
 
   case 296: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEXES  */
-#line 2191 "parser.y"
+#line 2215 "parser.y"
                                                                                                               {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListIndexes;
@@ -6390,11 +6404,11 @@ yyreduce:
      (yyval.admin_stmt)->table_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6394 "parser.cpp"
+#line 6408 "parser.cpp"
     break;
 
   case 297: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE  */
-#line 2201 "parser.y"
+#line 2225 "parser.y"
                                                                                                                        {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowIndex;
@@ -6406,11 +6420,11 @@ yyreduce:
      (yyval.admin_stmt)->table_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->index_meta_index_ = (yyvsp[0].long_value);
 }
-#line 6410 "parser.cpp"
+#line 6424 "parser.cpp"
     break;
 
   case 298: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE LONG_VALUE SEGMENTS  */
-#line 2212 "parser.y"
+#line 2236 "parser.y"
                                                                                                                                            {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListIndexSegments;
@@ -6423,11 +6437,11 @@ yyreduce:
      (yyval.admin_stmt)->index_meta_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->index_entry_index_ = (yyvsp[-1].long_value);
 }
-#line 6427 "parser.cpp"
+#line 6441 "parser.cpp"
     break;
 
   case 299: /* admin_statement: ADMIN SHOW CATALOG LONG_VALUE LONG_VALUE DATABASE LONG_VALUE LONG_VALUE TABLE LONG_VALUE LONG_VALUE INDEX LONG_VALUE LONG_VALUE SEGMENT LONG_VALUE  */
-#line 2224 "parser.y"
+#line 2248 "parser.y"
                                                                                                                                                      {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowIndexSegment;
@@ -6441,78 +6455,78 @@ yyreduce:
      (yyval.admin_stmt)->index_entry_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->segment_index_ = (yyvsp[0].long_value);
 }
-#line 6445 "parser.cpp"
+#line 6459 "parser.cpp"
     break;
 
   case 300: /* admin_statement: ADMIN SHOW LOGS  */
-#line 2237 "parser.y"
+#line 2261 "parser.y"
                   {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListLogFiles;
 }
-#line 6454 "parser.cpp"
+#line 6468 "parser.cpp"
     break;
 
   case 301: /* admin_statement: ADMIN SHOW LOG LONG_VALUE  */
-#line 2241 "parser.y"
+#line 2265 "parser.y"
                             {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowLogFile;
      (yyval.admin_stmt)->log_file_index_ = (yyvsp[0].long_value);
 }
-#line 6464 "parser.cpp"
+#line 6478 "parser.cpp"
     break;
 
   case 302: /* admin_statement: ADMIN SHOW LOG LONG_VALUE INDEXES  */
-#line 2246 "parser.y"
+#line 2270 "parser.y"
                                     {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kListLogIndexes;
      (yyval.admin_stmt)->log_file_index_ = (yyvsp[-1].long_value);
 }
-#line 6474 "parser.cpp"
+#line 6488 "parser.cpp"
     break;
 
   case 303: /* admin_statement: ADMIN SHOW LOG LONG_VALUE INDEX LONG_VALUE  */
-#line 2251 "parser.y"
+#line 2275 "parser.y"
                                              {
      (yyval.admin_stmt) = new infinity::AdminStatement();
      (yyval.admin_stmt)->admin_type_ = infinity::AdminStmtType::kShowLogIndex;
      (yyval.admin_stmt)->log_file_index_ = (yyvsp[-2].long_value);
      (yyval.admin_stmt)->log_index_in_file_ = (yyvsp[0].long_value);
 }
-#line 6485 "parser.cpp"
+#line 6499 "parser.cpp"
     break;
 
   case 304: /* expr_array: expr_alias  */
-#line 2262 "parser.y"
+#line 2286 "parser.y"
                         {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 6494 "parser.cpp"
+#line 6508 "parser.cpp"
     break;
 
   case 305: /* expr_array: expr_array ',' expr_alias  */
-#line 2266 "parser.y"
+#line 2290 "parser.y"
                             {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 6503 "parser.cpp"
+#line 6517 "parser.cpp"
     break;
 
   case 306: /* expr_array_list: '(' expr_array ')'  */
-#line 2271 "parser.y"
+#line 2295 "parser.y"
                                      {
     (yyval.expr_array_list_t) = new std::vector<std::vector<infinity::ParsedExpr*>*>();
     (yyval.expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
 }
-#line 6512 "parser.cpp"
+#line 6526 "parser.cpp"
     break;
 
   case 307: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
-#line 2275 "parser.y"
+#line 2299 "parser.y"
                                          {
     if(!(yyvsp[-4].expr_array_list_t)->empty() && (yyvsp[-4].expr_array_list_t)->back()->size() != (yyvsp[-1].expr_array_t)->size()) {
         yyerror(&yyloc, scanner, result, "The expr_array in list shall have the same size.");
@@ -6528,73 +6542,73 @@ yyreduce:
     (yyvsp[-4].expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
     (yyval.expr_array_list_t) = (yyvsp[-4].expr_array_list_t);
 }
-#line 6532 "parser.cpp"
+#line 6546 "parser.cpp"
     break;
 
   case 308: /* expr_alias: expr AS IDENTIFIER  */
-#line 2302 "parser.y"
+#line 2326 "parser.y"
                                 {
     (yyval.expr_t) = (yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6543 "parser.cpp"
+#line 6557 "parser.cpp"
     break;
 
   case 309: /* expr_alias: expr  */
-#line 2308 "parser.y"
+#line 2332 "parser.y"
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6551 "parser.cpp"
+#line 6565 "parser.cpp"
     break;
 
   case 315: /* operand: '(' expr ')'  */
-#line 2318 "parser.y"
+#line 2342 "parser.y"
                       {
     (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 6559 "parser.cpp"
+#line 6573 "parser.cpp"
     break;
 
   case 316: /* operand: '(' select_without_paren ')'  */
-#line 2321 "parser.y"
+#line 2345 "parser.y"
                                {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kScalar;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6570 "parser.cpp"
+#line 6584 "parser.cpp"
     break;
 
   case 317: /* operand: constant_expr  */
-#line 2327 "parser.y"
+#line 2351 "parser.y"
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6578 "parser.cpp"
+#line 6592 "parser.cpp"
     break;
 
   case 328: /* extra_match_tensor_option: ',' STRING  */
-#line 2341 "parser.y"
+#line 2365 "parser.y"
                                        {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 6586 "parser.cpp"
+#line 6600 "parser.cpp"
     break;
 
   case 329: /* extra_match_tensor_option: %empty  */
-#line 2344 "parser.y"
+#line 2368 "parser.y"
   {
     (yyval.str_value) = nullptr;
 }
-#line 6594 "parser.cpp"
+#line 6608 "parser.cpp"
     break;
 
   case 330: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING extra_match_tensor_option ')'  */
-#line 2350 "parser.y"
+#line 2374 "parser.y"
                                                                                                                            {
     auto match_tensor_expr = std::make_unique<infinity::MatchTensorExpr>();
     // search column
@@ -6611,11 +6625,11 @@ yyreduce:
     }
     (yyval.expr_t) = match_tensor_expr.release();
 }
-#line 6615 "parser.cpp"
+#line 6629 "parser.cpp"
     break;
 
   case 331: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
-#line 2369 "parser.y"
+#line 2393 "parser.y"
                                                                                                                                                        {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -6660,11 +6674,11 @@ Error1:
 Return1:
     ;
 }
-#line 6664 "parser.cpp"
+#line 6678 "parser.cpp"
     break;
 
   case 332: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' IGNORE INDEX  */
-#line 2414 "parser.y"
+#line 2438 "parser.y"
                                                                                            {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -6702,11 +6716,11 @@ Error2:
 Return2:
     ;
 }
-#line 6706 "parser.cpp"
+#line 6720 "parser.cpp"
     break;
 
   case 333: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 2452 "parser.y"
+#line 2476 "parser.y"
                                                                                                     {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -6748,11 +6762,11 @@ Error3:
 Return3:
     ;
 }
-#line 6752 "parser.cpp"
+#line 6766 "parser.cpp"
     break;
 
   case 334: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ')' with_index_param_list  */
-#line 2494 "parser.y"
+#line 2518 "parser.y"
                                                                                      {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -6795,11 +6809,11 @@ Error4:
 Return4:
     ;
 }
-#line 6799 "parser.cpp"
+#line 6813 "parser.cpp"
     break;
 
   case 335: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE ')' USING INDEX '(' IDENTIFIER ')' with_index_param_list  */
-#line 2540 "parser.y"
+#line 2564 "parser.y"
                                                                                                                                                          {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -6820,11 +6834,11 @@ Return4:
     match_sparse_expr->index_name_ = (yyvsp[-2].str_value);
     free((yyvsp[-2].str_value));
 }
-#line 6824 "parser.cpp"
+#line 6838 "parser.cpp"
     break;
 
   case 336: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE ')' IGNORE INDEX  */
-#line 2561 "parser.y"
+#line 2585 "parser.y"
                                                                                               {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -6844,11 +6858,11 @@ Return4:
 
     match_sparse_expr->ignore_index_ = true;
 }
-#line 6848 "parser.cpp"
+#line 6862 "parser.cpp"
     break;
 
   case 337: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 2581 "parser.y"
+#line 2605 "parser.y"
                                                                                                        {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -6866,11 +6880,11 @@ Return4:
     // topn and options
     match_sparse_expr->SetOptParams((yyvsp[-2].long_value), (yyvsp[0].with_index_param_list_t));
 }
-#line 6870 "parser.cpp"
+#line 6884 "parser.cpp"
     break;
 
   case 338: /* match_sparse_expr: MATCH SPARSE '(' expr ',' common_sparse_array_expr ',' STRING ')' with_index_param_list  */
-#line 2599 "parser.y"
+#line 2623 "parser.y"
                                                                                         {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -6888,11 +6902,11 @@ Return4:
     // topn and options
     match_sparse_expr->SetOptParams(infinity::DEFAULT_MATCH_SPARSE_TOP_N, (yyvsp[0].with_index_param_list_t));
 }
-#line 6892 "parser.cpp"
+#line 6906 "parser.cpp"
     break;
 
   case 339: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ')'  */
-#line 2617 "parser.y"
+#line 2641 "parser.y"
                                                        {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-3].str_value));
@@ -6901,11 +6915,11 @@ Return4:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 6905 "parser.cpp"
+#line 6919 "parser.cpp"
     break;
 
   case 340: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING ')'  */
-#line 2625 "parser.y"
+#line 2649 "parser.y"
                                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-5].str_value));
@@ -6916,22 +6930,22 @@ Return4:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 6920 "parser.cpp"
+#line 6934 "parser.cpp"
     break;
 
   case 341: /* query_expr: QUERY '(' STRING ')'  */
-#line 2636 "parser.y"
+#line 2660 "parser.y"
                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 6931 "parser.cpp"
+#line 6945 "parser.cpp"
     break;
 
   case 342: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
-#line 2642 "parser.y"
+#line 2666 "parser.y"
                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-3].str_value));
@@ -6940,22 +6954,22 @@ Return4:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 6944 "parser.cpp"
+#line 6958 "parser.cpp"
     break;
 
   case 343: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 2651 "parser.y"
+#line 2675 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 6955 "parser.cpp"
+#line 6969 "parser.cpp"
     break;
 
   case 344: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 2657 "parser.y"
+#line 2681 "parser.y"
                                    {
     auto fusion_expr = std::make_unique<infinity::FusionExpr>();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -6967,77 +6981,77 @@ Return4:
     fusion_expr->JobAfterParser();
     (yyval.expr_t) = fusion_expr.release();
 }
-#line 6971 "parser.cpp"
+#line 6985 "parser.cpp"
     break;
 
   case 345: /* sub_search: match_vector_expr  */
-#line 2669 "parser.y"
+#line 2693 "parser.y"
                                {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6979 "parser.cpp"
+#line 6993 "parser.cpp"
     break;
 
   case 346: /* sub_search: match_text_expr  */
-#line 2672 "parser.y"
+#line 2696 "parser.y"
                   {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6987 "parser.cpp"
+#line 7001 "parser.cpp"
     break;
 
   case 347: /* sub_search: match_tensor_expr  */
-#line 2675 "parser.y"
+#line 2699 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6995 "parser.cpp"
+#line 7009 "parser.cpp"
     break;
 
   case 348: /* sub_search: match_sparse_expr  */
-#line 2678 "parser.y"
+#line 2702 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7003 "parser.cpp"
+#line 7017 "parser.cpp"
     break;
 
   case 349: /* sub_search: query_expr  */
-#line 2681 "parser.y"
+#line 2705 "parser.y"
              {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7011 "parser.cpp"
+#line 7025 "parser.cpp"
     break;
 
   case 350: /* sub_search: fusion_expr  */
-#line 2684 "parser.y"
+#line 2708 "parser.y"
               {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 7019 "parser.cpp"
+#line 7033 "parser.cpp"
     break;
 
   case 351: /* sub_search_array: sub_search  */
-#line 2688 "parser.y"
+#line 2712 "parser.y"
                               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 7028 "parser.cpp"
+#line 7042 "parser.cpp"
     break;
 
   case 352: /* sub_search_array: sub_search_array ',' sub_search  */
-#line 2692 "parser.y"
+#line 2716 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 7037 "parser.cpp"
+#line 7051 "parser.cpp"
     break;
 
   case 353: /* function_expr: IDENTIFIER '(' ')'  */
-#line 2697 "parser.y"
+#line 2721 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -7046,11 +7060,11 @@ Return4:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 7050 "parser.cpp"
+#line 7064 "parser.cpp"
     break;
 
   case 354: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 2705 "parser.y"
+#line 2729 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -7059,11 +7073,11 @@ Return4:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 7063 "parser.cpp"
+#line 7077 "parser.cpp"
     break;
 
   case 355: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 2713 "parser.y"
+#line 2737 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -7073,11 +7087,11 @@ Return4:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 7077 "parser.cpp"
+#line 7091 "parser.cpp"
     break;
 
   case 356: /* function_expr: operand IS NOT NULLABLE  */
-#line 2722 "parser.y"
+#line 2746 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -7085,11 +7099,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7089 "parser.cpp"
+#line 7103 "parser.cpp"
     break;
 
   case 357: /* function_expr: operand IS NULLABLE  */
-#line 2729 "parser.y"
+#line 2753 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -7097,11 +7111,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7101 "parser.cpp"
+#line 7115 "parser.cpp"
     break;
 
   case 358: /* function_expr: NOT operand  */
-#line 2736 "parser.y"
+#line 2760 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -7109,11 +7123,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7113 "parser.cpp"
+#line 7127 "parser.cpp"
     break;
 
   case 359: /* function_expr: '-' operand  */
-#line 2743 "parser.y"
+#line 2767 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -7121,11 +7135,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7125 "parser.cpp"
+#line 7139 "parser.cpp"
     break;
 
   case 360: /* function_expr: '+' operand  */
-#line 2750 "parser.y"
+#line 2774 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -7133,11 +7147,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7137 "parser.cpp"
+#line 7151 "parser.cpp"
     break;
 
   case 361: /* function_expr: operand '-' operand  */
-#line 2757 "parser.y"
+#line 2781 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -7146,11 +7160,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7150 "parser.cpp"
+#line 7164 "parser.cpp"
     break;
 
   case 362: /* function_expr: operand '+' operand  */
-#line 2765 "parser.y"
+#line 2789 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -7159,11 +7173,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7163 "parser.cpp"
+#line 7177 "parser.cpp"
     break;
 
   case 363: /* function_expr: operand '*' operand  */
-#line 2773 "parser.y"
+#line 2797 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -7172,11 +7186,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7176 "parser.cpp"
+#line 7190 "parser.cpp"
     break;
 
   case 364: /* function_expr: operand '/' operand  */
-#line 2781 "parser.y"
+#line 2805 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -7185,11 +7199,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7189 "parser.cpp"
+#line 7203 "parser.cpp"
     break;
 
   case 365: /* function_expr: operand '%' operand  */
-#line 2789 "parser.y"
+#line 2813 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -7198,11 +7212,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7202 "parser.cpp"
+#line 7216 "parser.cpp"
     break;
 
   case 366: /* function_expr: operand '=' operand  */
-#line 2797 "parser.y"
+#line 2821 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -7211,11 +7225,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7215 "parser.cpp"
+#line 7229 "parser.cpp"
     break;
 
   case 367: /* function_expr: operand EQUAL operand  */
-#line 2805 "parser.y"
+#line 2829 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -7224,11 +7238,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7228 "parser.cpp"
+#line 7242 "parser.cpp"
     break;
 
   case 368: /* function_expr: operand NOT_EQ operand  */
-#line 2813 "parser.y"
+#line 2837 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -7237,11 +7251,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7241 "parser.cpp"
+#line 7255 "parser.cpp"
     break;
 
   case 369: /* function_expr: operand '<' operand  */
-#line 2821 "parser.y"
+#line 2845 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -7250,11 +7264,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7254 "parser.cpp"
+#line 7268 "parser.cpp"
     break;
 
   case 370: /* function_expr: operand '>' operand  */
-#line 2829 "parser.y"
+#line 2853 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -7263,11 +7277,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7267 "parser.cpp"
+#line 7281 "parser.cpp"
     break;
 
   case 371: /* function_expr: operand LESS_EQ operand  */
-#line 2837 "parser.y"
+#line 2861 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -7276,11 +7290,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7280 "parser.cpp"
+#line 7294 "parser.cpp"
     break;
 
   case 372: /* function_expr: operand GREATER_EQ operand  */
-#line 2845 "parser.y"
+#line 2869 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -7289,11 +7303,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7293 "parser.cpp"
+#line 7307 "parser.cpp"
     break;
 
   case 373: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 2853 "parser.y"
+#line 2877 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -7324,11 +7338,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7328 "parser.cpp"
+#line 7342 "parser.cpp"
     break;
 
   case 374: /* function_expr: operand LIKE operand  */
-#line 2883 "parser.y"
+#line 2907 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -7337,11 +7351,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7341 "parser.cpp"
+#line 7355 "parser.cpp"
     break;
 
   case 375: /* function_expr: operand NOT LIKE operand  */
-#line 2891 "parser.y"
+#line 2915 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -7350,11 +7364,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7354 "parser.cpp"
+#line 7368 "parser.cpp"
     break;
 
   case 376: /* conjunction_expr: expr AND expr  */
-#line 2900 "parser.y"
+#line 2924 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -7363,11 +7377,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7367 "parser.cpp"
+#line 7381 "parser.cpp"
     break;
 
   case 377: /* conjunction_expr: expr OR expr  */
-#line 2908 "parser.y"
+#line 2932 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -7376,11 +7390,11 @@ Return4:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 7380 "parser.cpp"
+#line 7394 "parser.cpp"
     break;
 
   case 378: /* between_expr: operand BETWEEN operand AND operand  */
-#line 2917 "parser.y"
+#line 2941 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -7388,44 +7402,44 @@ Return4:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 7392 "parser.cpp"
+#line 7406 "parser.cpp"
     break;
 
   case 379: /* in_expr: operand IN '(' expr_array ')'  */
-#line 2925 "parser.y"
+#line 2949 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 7403 "parser.cpp"
+#line 7417 "parser.cpp"
     break;
 
   case 380: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 2931 "parser.y"
+#line 2955 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 7414 "parser.cpp"
+#line 7428 "parser.cpp"
     break;
 
   case 381: /* case_expr: CASE expr case_check_array END  */
-#line 2938 "parser.y"
+#line 2962 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 7425 "parser.cpp"
+#line 7439 "parser.cpp"
     break;
 
   case 382: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 2944 "parser.y"
+#line 2968 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -7433,32 +7447,32 @@ Return4:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 7437 "parser.cpp"
+#line 7451 "parser.cpp"
     break;
 
   case 383: /* case_expr: CASE case_check_array END  */
-#line 2951 "parser.y"
+#line 2975 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 7447 "parser.cpp"
+#line 7461 "parser.cpp"
     break;
 
   case 384: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 2956 "parser.y"
+#line 2980 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 7458 "parser.cpp"
+#line 7472 "parser.cpp"
     break;
 
   case 385: /* case_check_array: WHEN expr THEN expr  */
-#line 2963 "parser.y"
+#line 2987 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -7466,11 +7480,11 @@ Return4:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 7470 "parser.cpp"
+#line 7484 "parser.cpp"
     break;
 
   case 386: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 2970 "parser.y"
+#line 2994 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -7478,11 +7492,11 @@ Return4:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 7482 "parser.cpp"
+#line 7496 "parser.cpp"
     break;
 
   case 387: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 2978 "parser.y"
+#line 3002 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -7506,33 +7520,33 @@ Return4:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 7510 "parser.cpp"
+#line 7524 "parser.cpp"
     break;
 
   case 388: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 3002 "parser.y"
+#line 3026 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 7521 "parser.cpp"
+#line 7535 "parser.cpp"
     break;
 
   case 389: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 3008 "parser.y"
+#line 3032 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 7532 "parser.cpp"
+#line 7546 "parser.cpp"
     break;
 
   case 390: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 3014 "parser.y"
+#line 3038 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -7540,11 +7554,11 @@ Return4:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 7544 "parser.cpp"
+#line 7558 "parser.cpp"
     break;
 
   case 391: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 3021 "parser.y"
+#line 3045 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -7552,11 +7566,11 @@ Return4:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 7556 "parser.cpp"
+#line 7570 "parser.cpp"
     break;
 
   case 392: /* column_expr: IDENTIFIER  */
-#line 3029 "parser.y"
+#line 3053 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -7564,11 +7578,11 @@ Return4:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 7568 "parser.cpp"
+#line 7582 "parser.cpp"
     break;
 
   case 393: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 3036 "parser.y"
+#line 3060 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -7576,21 +7590,21 @@ Return4:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 7580 "parser.cpp"
+#line 7594 "parser.cpp"
     break;
 
   case 394: /* column_expr: '*'  */
-#line 3043 "parser.y"
+#line 3067 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 7590 "parser.cpp"
+#line 7604 "parser.cpp"
     break;
 
   case 395: /* column_expr: column_expr '.' '*'  */
-#line 3048 "parser.y"
+#line 3072 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -7600,232 +7614,232 @@ Return4:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 7604 "parser.cpp"
+#line 7618 "parser.cpp"
     break;
 
   case 396: /* constant_expr: STRING  */
-#line 3058 "parser.y"
+#line 3082 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7614 "parser.cpp"
+#line 7628 "parser.cpp"
     break;
 
   case 397: /* constant_expr: TRUE  */
-#line 3063 "parser.y"
+#line 3087 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 7624 "parser.cpp"
+#line 7638 "parser.cpp"
     break;
 
   case 398: /* constant_expr: FALSE  */
-#line 3068 "parser.y"
+#line 3092 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 7634 "parser.cpp"
+#line 7648 "parser.cpp"
     break;
 
   case 399: /* constant_expr: DOUBLE_VALUE  */
-#line 3073 "parser.y"
+#line 3097 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7644 "parser.cpp"
+#line 7658 "parser.cpp"
     break;
 
   case 400: /* constant_expr: LONG_VALUE  */
-#line 3078 "parser.y"
+#line 3102 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7654 "parser.cpp"
+#line 7668 "parser.cpp"
     break;
 
   case 401: /* constant_expr: DATE STRING  */
-#line 3083 "parser.y"
+#line 3107 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7664 "parser.cpp"
+#line 7678 "parser.cpp"
     break;
 
   case 402: /* constant_expr: TIME STRING  */
-#line 3088 "parser.y"
+#line 3112 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7674 "parser.cpp"
+#line 7688 "parser.cpp"
     break;
 
   case 403: /* constant_expr: DATETIME STRING  */
-#line 3093 "parser.y"
+#line 3117 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7684 "parser.cpp"
+#line 7698 "parser.cpp"
     break;
 
   case 404: /* constant_expr: TIMESTAMP STRING  */
-#line 3098 "parser.y"
+#line 3122 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7694 "parser.cpp"
+#line 7708 "parser.cpp"
     break;
 
   case 405: /* constant_expr: INTERVAL interval_expr  */
-#line 3103 "parser.y"
+#line 3127 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7702 "parser.cpp"
+#line 7716 "parser.cpp"
     break;
 
   case 406: /* constant_expr: interval_expr  */
-#line 3106 "parser.y"
+#line 3130 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7710 "parser.cpp"
+#line 7724 "parser.cpp"
     break;
 
   case 407: /* constant_expr: common_array_expr  */
-#line 3109 "parser.y"
+#line 3133 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7718 "parser.cpp"
+#line 7732 "parser.cpp"
     break;
 
   case 408: /* common_array_expr: array_expr  */
-#line 3113 "parser.y"
+#line 3137 "parser.y"
                               {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7726 "parser.cpp"
+#line 7740 "parser.cpp"
     break;
 
   case 409: /* common_array_expr: subarray_array_expr  */
-#line 3116 "parser.y"
+#line 3140 "parser.y"
                       {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7734 "parser.cpp"
+#line 7748 "parser.cpp"
     break;
 
   case 410: /* common_array_expr: sparse_array_expr  */
-#line 3119 "parser.y"
+#line 3143 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7742 "parser.cpp"
+#line 7756 "parser.cpp"
     break;
 
   case 411: /* common_array_expr: empty_array_expr  */
-#line 3122 "parser.y"
+#line 3146 "parser.y"
                    {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7750 "parser.cpp"
+#line 7764 "parser.cpp"
     break;
 
   case 412: /* common_sparse_array_expr: sparse_array_expr  */
-#line 3126 "parser.y"
+#line 3150 "parser.y"
                                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7758 "parser.cpp"
+#line 7772 "parser.cpp"
     break;
 
   case 413: /* common_sparse_array_expr: array_expr  */
-#line 3129 "parser.y"
+#line 3153 "parser.y"
              {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7766 "parser.cpp"
+#line 7780 "parser.cpp"
     break;
 
   case 414: /* common_sparse_array_expr: empty_array_expr  */
-#line 3132 "parser.y"
+#line 3156 "parser.y"
                    {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7774 "parser.cpp"
+#line 7788 "parser.cpp"
     break;
 
   case 415: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
-#line 3136 "parser.y"
+#line 3160 "parser.y"
                                                       {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7782 "parser.cpp"
+#line 7796 "parser.cpp"
     break;
 
   case 416: /* unclosed_subarray_array_expr: '[' common_array_expr  */
-#line 3140 "parser.y"
+#line 3164 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kSubArrayArray);
     const_expr->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = const_expr;
 }
-#line 7792 "parser.cpp"
+#line 7806 "parser.cpp"
     break;
 
   case 417: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
-#line 3145 "parser.y"
+#line 3169 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7801 "parser.cpp"
+#line 7815 "parser.cpp"
     break;
 
   case 418: /* sparse_array_expr: long_sparse_array_expr  */
-#line 3150 "parser.y"
+#line 3174 "parser.y"
                                           {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7809 "parser.cpp"
+#line 7823 "parser.cpp"
     break;
 
   case 419: /* sparse_array_expr: double_sparse_array_expr  */
-#line 3153 "parser.y"
+#line 3177 "parser.y"
                            {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7817 "parser.cpp"
+#line 7831 "parser.cpp"
     break;
 
   case 420: /* long_sparse_array_expr: unclosed_long_sparse_array_expr ']'  */
-#line 3157 "parser.y"
+#line 3181 "parser.y"
                                                             {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7825 "parser.cpp"
+#line 7839 "parser.cpp"
     break;
 
   case 421: /* unclosed_long_sparse_array_expr: '[' int_sparse_ele  */
-#line 3161 "parser.y"
+#line 3185 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kLongSparseArray);
     const_expr->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
@@ -7833,30 +7847,30 @@ Return4:
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7837 "parser.cpp"
+#line 7851 "parser.cpp"
     break;
 
   case 422: /* unclosed_long_sparse_array_expr: unclosed_long_sparse_array_expr ',' int_sparse_ele  */
-#line 3168 "parser.y"
+#line 3192 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->long_sparse_array_.second.emplace_back((yyvsp[0].int_sparse_ele_t)->second);
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7848 "parser.cpp"
+#line 7862 "parser.cpp"
     break;
 
   case 423: /* double_sparse_array_expr: unclosed_double_sparse_array_expr ']'  */
-#line 3175 "parser.y"
+#line 3199 "parser.y"
                                                                 {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7856 "parser.cpp"
+#line 7870 "parser.cpp"
     break;
 
   case 424: /* unclosed_double_sparse_array_expr: '[' float_sparse_ele  */
-#line 3179 "parser.y"
+#line 3203 "parser.y"
                                                         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleSparseArray);
     const_expr->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
@@ -7864,266 +7878,266 @@ Return4:
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7868 "parser.cpp"
+#line 7882 "parser.cpp"
     break;
 
   case 425: /* unclosed_double_sparse_array_expr: unclosed_double_sparse_array_expr ',' float_sparse_ele  */
-#line 3186 "parser.y"
+#line 3210 "parser.y"
                                                          {
     (yyvsp[-2].const_expr_t)->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->double_sparse_array_.second.emplace_back((yyvsp[0].float_sparse_ele_t)->second);
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7879 "parser.cpp"
+#line 7893 "parser.cpp"
     break;
 
   case 426: /* empty_array_expr: '[' ']'  */
-#line 3193 "parser.y"
+#line 3217 "parser.y"
                           {
     (yyval.const_expr_t) = new infinity::ConstantExpr(infinity::LiteralType::kEmptyArray);
 }
-#line 7887 "parser.cpp"
+#line 7901 "parser.cpp"
     break;
 
   case 427: /* int_sparse_ele: LONG_VALUE ':' LONG_VALUE  */
-#line 3197 "parser.y"
+#line 3221 "parser.y"
                                           {
     (yyval.int_sparse_ele_t) = new std::pair<int64_t, int64_t>{(yyvsp[-2].long_value), (yyvsp[0].long_value)};
 }
-#line 7895 "parser.cpp"
+#line 7909 "parser.cpp"
     break;
 
   case 428: /* float_sparse_ele: LONG_VALUE ':' DOUBLE_VALUE  */
-#line 3201 "parser.y"
+#line 3225 "parser.y"
                                               {
     (yyval.float_sparse_ele_t) = new std::pair<int64_t, double>{(yyvsp[-2].long_value), (yyvsp[0].double_value)};
 }
-#line 7903 "parser.cpp"
+#line 7917 "parser.cpp"
     break;
 
   case 429: /* array_expr: long_array_expr  */
-#line 3205 "parser.y"
+#line 3229 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7911 "parser.cpp"
+#line 7925 "parser.cpp"
     break;
 
   case 430: /* array_expr: double_array_expr  */
-#line 3208 "parser.y"
+#line 3232 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 7919 "parser.cpp"
+#line 7933 "parser.cpp"
     break;
 
   case 431: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 3212 "parser.y"
+#line 3236 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7927 "parser.cpp"
+#line 7941 "parser.cpp"
     break;
 
   case 432: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 3216 "parser.y"
+#line 3240 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 7937 "parser.cpp"
+#line 7951 "parser.cpp"
     break;
 
   case 433: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 3221 "parser.y"
+#line 3245 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7946 "parser.cpp"
+#line 7960 "parser.cpp"
     break;
 
   case 434: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 3226 "parser.y"
+#line 3250 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 7954 "parser.cpp"
+#line 7968 "parser.cpp"
     break;
 
   case 435: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 3230 "parser.y"
+#line 3254 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 7964 "parser.cpp"
+#line 7978 "parser.cpp"
     break;
 
   case 436: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 3235 "parser.y"
+#line 3259 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7973 "parser.cpp"
+#line 7987 "parser.cpp"
     break;
 
   case 437: /* interval_expr: LONG_VALUE SECONDS  */
-#line 3240 "parser.y"
+#line 3264 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7984 "parser.cpp"
+#line 7998 "parser.cpp"
     break;
 
   case 438: /* interval_expr: LONG_VALUE SECOND  */
-#line 3246 "parser.y"
+#line 3270 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7995 "parser.cpp"
+#line 8009 "parser.cpp"
     break;
 
   case 439: /* interval_expr: LONG_VALUE MINUTES  */
-#line 3252 "parser.y"
+#line 3276 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8006 "parser.cpp"
+#line 8020 "parser.cpp"
     break;
 
   case 440: /* interval_expr: LONG_VALUE MINUTE  */
-#line 3258 "parser.y"
+#line 3282 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8017 "parser.cpp"
+#line 8031 "parser.cpp"
     break;
 
   case 441: /* interval_expr: LONG_VALUE HOURS  */
-#line 3264 "parser.y"
+#line 3288 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8028 "parser.cpp"
+#line 8042 "parser.cpp"
     break;
 
   case 442: /* interval_expr: LONG_VALUE HOUR  */
-#line 3270 "parser.y"
+#line 3294 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8039 "parser.cpp"
+#line 8053 "parser.cpp"
     break;
 
   case 443: /* interval_expr: LONG_VALUE DAYS  */
-#line 3276 "parser.y"
+#line 3300 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8050 "parser.cpp"
+#line 8064 "parser.cpp"
     break;
 
   case 444: /* interval_expr: LONG_VALUE DAY  */
-#line 3282 "parser.y"
+#line 3306 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8061 "parser.cpp"
+#line 8075 "parser.cpp"
     break;
 
   case 445: /* interval_expr: LONG_VALUE MONTHS  */
-#line 3288 "parser.y"
+#line 3312 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8072 "parser.cpp"
+#line 8086 "parser.cpp"
     break;
 
   case 446: /* interval_expr: LONG_VALUE MONTH  */
-#line 3294 "parser.y"
+#line 3318 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8083 "parser.cpp"
+#line 8097 "parser.cpp"
     break;
 
   case 447: /* interval_expr: LONG_VALUE YEARS  */
-#line 3300 "parser.y"
+#line 3324 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8094 "parser.cpp"
+#line 8108 "parser.cpp"
     break;
 
   case 448: /* interval_expr: LONG_VALUE YEAR  */
-#line 3306 "parser.y"
+#line 3330 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 8105 "parser.cpp"
+#line 8119 "parser.cpp"
     break;
 
   case 449: /* copy_option_list: copy_option  */
-#line 3317 "parser.y"
+#line 3341 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 8114 "parser.cpp"
+#line 8128 "parser.cpp"
     break;
 
   case 450: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 3321 "parser.y"
+#line 3345 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 8123 "parser.cpp"
+#line 8137 "parser.cpp"
     break;
 
   case 451: /* copy_option: FORMAT IDENTIFIER  */
-#line 3326 "parser.y"
+#line 3350 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -8154,11 +8168,11 @@ Return4:
         YYERROR;
     }
 }
-#line 8158 "parser.cpp"
+#line 8172 "parser.cpp"
     break;
 
   case 452: /* copy_option: DELIMITER STRING  */
-#line 3356 "parser.y"
+#line 3380 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -8169,83 +8183,106 @@ Return4:
     }
     free((yyvsp[0].str_value));
 }
-#line 8173 "parser.cpp"
+#line 8187 "parser.cpp"
     break;
 
   case 453: /* copy_option: HEADER  */
-#line 3366 "parser.y"
+#line 3390 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 8183 "parser.cpp"
+#line 8197 "parser.cpp"
     break;
 
   case 454: /* copy_option: OFFSET LONG_VALUE  */
-#line 3371 "parser.y"
+#line 3395 "parser.y"
                     {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kOffset;
     (yyval.copy_option_t)->offset_ = (yyvsp[0].long_value);
 }
-#line 8193 "parser.cpp"
+#line 8207 "parser.cpp"
     break;
 
   case 455: /* copy_option: LIMIT LONG_VALUE  */
-#line 3376 "parser.y"
+#line 3400 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kLimit;
     (yyval.copy_option_t)->limit_ = (yyvsp[0].long_value);
 }
-#line 8203 "parser.cpp"
+#line 8217 "parser.cpp"
     break;
 
   case 456: /* copy_option: ROWLIMIT LONG_VALUE  */
-#line 3381 "parser.y"
+#line 3405 "parser.y"
                       {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kRowLimit;
     (yyval.copy_option_t)->row_limit_ = (yyvsp[0].long_value);
 }
-#line 8213 "parser.cpp"
+#line 8227 "parser.cpp"
     break;
 
-  case 457: /* file_path: STRING  */
-#line 3387 "parser.y"
+  case 457: /* copy_option: IDENTIFIER STRING  */
+#line 3410 "parser.y"
+                    {
+    (yyval.copy_option_t) = new infinity::CopyOption();
+    if (strcasecmp((yyvsp[-1].str_value), "compression") == 0) {
+        (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kCompression;
+        (yyval.copy_option_t)->compression_ = (yyvsp[0].str_value);
+    } else if (strcasecmp((yyvsp[-1].str_value), "filter") == 0) {
+        (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFilter;
+        (yyval.copy_option_t)->filter_ = (yyvsp[0].str_value);
+    } else {
+        free((yyvsp[-1].str_value));
+        free((yyvsp[0].str_value));
+        delete (yyval.copy_option_t);
+        yyerror(&yyloc, scanner, result, "Unknown copy option");
+        YYERROR;
+    }
+    free((yyvsp[-1].str_value));
+    free((yyvsp[0].str_value));
+}
+#line 8250 "parser.cpp"
+    break;
+
+  case 458: /* file_path: STRING  */
+#line 3429 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 8221 "parser.cpp"
+#line 8258 "parser.cpp"
     break;
 
-  case 458: /* if_exists: IF EXISTS  */
-#line 3391 "parser.y"
+  case 459: /* if_exists: IF EXISTS  */
+#line 3433 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 8227 "parser.cpp"
+#line 8264 "parser.cpp"
     break;
 
-  case 459: /* if_exists: %empty  */
-#line 3392 "parser.y"
+  case 460: /* if_exists: %empty  */
+#line 3434 "parser.y"
   { (yyval.bool_value) = false; }
-#line 8233 "parser.cpp"
+#line 8270 "parser.cpp"
     break;
 
-  case 460: /* if_not_exists: IF NOT EXISTS  */
-#line 3394 "parser.y"
+  case 461: /* if_not_exists: IF NOT EXISTS  */
+#line 3436 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 8239 "parser.cpp"
+#line 8276 "parser.cpp"
     break;
 
-  case 461: /* if_not_exists: %empty  */
-#line 3395 "parser.y"
+  case 462: /* if_not_exists: %empty  */
+#line 3437 "parser.y"
   { (yyval.bool_value) = false; }
-#line 8245 "parser.cpp"
+#line 8282 "parser.cpp"
     break;
 
-  case 464: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 3410 "parser.y"
+  case 465: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 3452 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -8254,80 +8291,80 @@ Return4:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 8258 "parser.cpp"
+#line 8295 "parser.cpp"
     break;
 
-  case 465: /* if_not_exists_info: %empty  */
-#line 3418 "parser.y"
+  case 466: /* if_not_exists_info: %empty  */
+#line 3460 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 8266 "parser.cpp"
+#line 8303 "parser.cpp"
     break;
 
-  case 466: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 3422 "parser.y"
+  case 467: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 3464 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 8274 "parser.cpp"
+#line 8311 "parser.cpp"
     break;
 
-  case 467: /* with_index_param_list: %empty  */
-#line 3425 "parser.y"
+  case 468: /* with_index_param_list: %empty  */
+#line 3467 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 8282 "parser.cpp"
+#line 8319 "parser.cpp"
     break;
 
-  case 468: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
-#line 3429 "parser.y"
+  case 469: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
+#line 3471 "parser.y"
                                                                      {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 8290 "parser.cpp"
+#line 8327 "parser.cpp"
     break;
 
-  case 469: /* optional_table_properties_list: %empty  */
-#line 3432 "parser.y"
+  case 470: /* optional_table_properties_list: %empty  */
+#line 3474 "parser.y"
   {
     (yyval.with_index_param_list_t) = nullptr;
 }
-#line 8298 "parser.cpp"
+#line 8335 "parser.cpp"
     break;
 
-  case 470: /* index_param_list: index_param  */
-#line 3436 "parser.y"
+  case 471: /* index_param_list: index_param  */
+#line 3478 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 8307 "parser.cpp"
+#line 8344 "parser.cpp"
     break;
 
-  case 471: /* index_param_list: index_param_list ',' index_param  */
-#line 3440 "parser.y"
+  case 472: /* index_param_list: index_param_list ',' index_param  */
+#line 3482 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 8316 "parser.cpp"
+#line 8353 "parser.cpp"
     break;
 
-  case 472: /* index_param: IDENTIFIER  */
-#line 3445 "parser.y"
+  case 473: /* index_param: IDENTIFIER  */
+#line 3487 "parser.y"
                          {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 8327 "parser.cpp"
+#line 8364 "parser.cpp"
     break;
 
-  case 473: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 3451 "parser.y"
+  case 474: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 3493 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -8338,11 +8375,11 @@ Return4:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 8342 "parser.cpp"
+#line 8379 "parser.cpp"
     break;
 
-  case 474: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 3461 "parser.y"
+  case 475: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 3503 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
@@ -8351,11 +8388,11 @@ Return4:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 8355 "parser.cpp"
+#line 8392 "parser.cpp"
     break;
 
-  case 475: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 3469 "parser.y"
+  case 476: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 3511 "parser.y"
                               {
     ParserHelper::ToLower((yyvsp[-2].str_value));
     (yyval.index_param_t) = new infinity::InitParameter();
@@ -8364,11 +8401,11 @@ Return4:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 8368 "parser.cpp"
+#line 8405 "parser.cpp"
     break;
 
-  case 476: /* index_info: '(' IDENTIFIER ')' USING IDENTIFIER with_index_param_list  */
-#line 3480 "parser.y"
+  case 477: /* index_info: '(' IDENTIFIER ')' USING IDENTIFIER with_index_param_list  */
+#line 3522 "parser.y"
                                                                        {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -8384,6 +8421,8 @@ Return4:
         index_type = infinity::IndexType::kEMVB;
     } else if(strcmp((yyvsp[-1].str_value), "diskann") == 0){
         index_type = infinity::IndexType::kDiskAnn;
+    } else if (strcmp((yyvsp[-1].str_value), "bitmap") == 0) {
+        index_type = infinity::IndexType::kBitmap;
     } else {
         free((yyvsp[-1].str_value));
         free((yyvsp[-4].str_value));
@@ -8400,22 +8439,22 @@ Return4:
     (yyval.index_info_t)->index_param_list_ = (yyvsp[0].with_index_param_list_t);
     free((yyvsp[-4].str_value));
 }
-#line 8404 "parser.cpp"
+#line 8443 "parser.cpp"
     break;
 
-  case 477: /* index_info: '(' IDENTIFIER ')'  */
-#line 3511 "parser.y"
+  case 478: /* index_info: '(' IDENTIFIER ')'  */
+#line 3555 "parser.y"
                      {
     (yyval.index_info_t) = new infinity::IndexInfo();
     (yyval.index_info_t)->index_type_ = infinity::IndexType::kSecondary;
     (yyval.index_info_t)->column_name_ = (yyvsp[-1].str_value);
     free((yyvsp[-1].str_value));
 }
-#line 8415 "parser.cpp"
+#line 8454 "parser.cpp"
     break;
 
 
-#line 8419 "parser.cpp"
+#line 8458 "parser.cpp"
 
       default: break;
     }
@@ -8644,7 +8683,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 3518 "parser.y"
+#line 3562 "parser.y"
 
 
 void
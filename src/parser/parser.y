@@ -1210,6 +1210,16 @@ copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')' {
                 $$->row_limit_ = option_ptr->row_limit_;
                 break;
             }
+            case infinity::CopyOptionType::kCompression: {
+                $$->compression_ = option_ptr->compression_;
+                break;
+            }
+            default: {
+                delete option_ptr;
+                delete $7;
+                yyerror(&yyloc, scanner, result, "Invalid export option");
+                YYERROR;
+            }
         }
         delete option_ptr;
     }
@@ -1265,6 +1275,16 @@ copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')' {
                 $$->row_limit_ = option_ptr->row_limit_;
                 break;
             }
+            case infinity::CopyOptionType::kCompression: {
+                $$->compression_ = option_ptr->compression_;
+                break;
+            }
+            default: {
+                delete option_ptr;
+                delete $10;
+                yyerror(&yyloc, scanner, result, "Invalid export option");
+                YYERROR;
+            }
         }
         delete option_ptr;
     }
@@ -1306,6 +1326,10 @@ copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')' {
                 $$->header_ = option_ptr->header_;
                 break;
             }
+            case infinity::CopyOptionType::kFilter: {
+                $$->filter_ = option_ptr->filter_;
+                break;
+            }
             default: {
                 delete option_ptr;
                 delete $7;
@@ -3383,6 +3407,24 @@ copy_option : FORMAT IDENTIFIER {
     $$->option_type_ = infinity::CopyOptionType::kRowLimit;
     $$->row_limit_ = $2;
 }
+| IDENTIFIER STRING {
+    $$ = new infinity::CopyOption();
+    if (strcasecmp($1, "compression") == 0) {
+        $$->option_type_ = infinity::CopyOptionType::kCompression;
+        $$->compression_ = $2;
+    } else if (strcasecmp($1, "filter") == 0) {
+        $$->option_type_ = infinity::CopyOptionType::kFilter;
+        $$->filter_ = $2;
+    } else {
+        free($1);
+        free($2);
+        delete $$;
+        yyerror(&yyloc, scanner, result, "Unknown copy option");
+        YYERROR;
+    }
+    free($1);
+    free($2);
+}
 
 file_path : STRING {
     $$ = $1;
@@ -3492,6 +3534,8 @@ index_info : '(' IDENTIFIER ')' USING IDENTIFIER with_index_param_list {
         index_type = infinity::IndexType::kEMVB;
     } else if(strcmp($5, "diskann") == 0){
         index_type = infinity::IndexType::kDiskAnn;
+    } else if (strcmp($5, "bitmap") == 0) {
+        index_type = infinity::IndexType::kBitmap;
     } else {
         free($5);
         free($2);
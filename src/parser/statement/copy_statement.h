@@ -27,6 +27,8 @@ enum class CopyOptionType {
     kOffset,
     kLimit,
     kRowLimit,
+    kCompression,
+    kFilter,
 };
 
 struct CopyOption {
@@ -37,6 +39,8 @@ struct CopyOption {
     size_t offset_{0};
     size_t limit_{0};
     size_t row_limit_{0};
+    std::string compression_{};
+    std::string filter_{};
 };
 
 class CopyStatement final : public BaseStatement {
@@ -57,6 +61,12 @@ public:
     size_t offset_{0};
     size_t limit_{0};
     size_t row_limit_{0};
+    // EXPORT compression codec of parquet file
+    std::string compression_{};
+    // IMPORT predicate of parquet file, row groups and rows not matching it are skipped.
+    // It compares numeric columns of the target table with constants, integer values are compared as i64
+    // and floating point values as doubles.
+    std::string filter_{};
 
     // EXPORT columns
     std::vector<ParsedExpr *> *expr_array_{nullptr};
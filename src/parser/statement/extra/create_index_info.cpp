@@ -42,6 +42,9 @@ std::string IndexInfo::IndexTypeToString(IndexType index_type) {
         case IndexType::kDiskAnn: {
             return "DISKANN";
         }
+        case IndexType::kBitmap: {
+            return "BITMAP";
+        }
         case IndexType::kInvalid: {
             ParserError("Invalid conflict type.");
         }
@@ -64,6 +67,8 @@ IndexType IndexInfo::StringToIndexType(const std::string &index_type_str) {
         return IndexType::kBMP;
     } else if (index_type_str == "DISKANN") {
         return IndexType::kDiskAnn;
+    } else if (index_type_str == "BITMAP") {
+        return IndexType::kBitmap;
     } else {
         return IndexType::kInvalid;
     }
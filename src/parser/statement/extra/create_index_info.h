@@ -30,6 +30,7 @@ enum class IndexType {
     kEMVB,
     kInvalid,
     kDiskAnn,
+    kBitmap,
 };
 
 struct IndexInfo {
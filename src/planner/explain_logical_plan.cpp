@@ -2103,6 +2103,10 @@ void ExplainLogicalPlan::Explain(const LogicalImport *import_node, SharedPtr<Vec
         case CopyFileType::kPARQUET: {
             SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: PARQUET", String(intent_size, ' ')));
             result->emplace_back(file_type);
+            if (!import_node->filter().empty()) {
+                SharedPtr<String> filter = MakeShared<String>(fmt::format("{} - filter: {}", String(intent_size, ' '), import_node->filter()));
+                result->emplace_back(filter);
+            }
             break;
         }
         case CopyFileType::kInvalid: {
@@ -2190,6 +2194,11 @@ void ExplainLogicalPlan::Explain(const LogicalExport *export_node, SharedPtr<Vec
         case CopyFileType::kPARQUET : {
             SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: PARQUET", String(intent_size, ' ')));
             result->emplace_back(file_type);
+            if (!export_node->compression().empty()) {
+                SharedPtr<String> compression =
+                    MakeShared<String>(fmt::format("{} - compression: {}", String(intent_size, ' '), export_node->compression()));
+                result->emplace_back(compression);
+            }
             break;
         }
         case CopyFileType::kInvalid: {
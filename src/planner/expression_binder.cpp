@@ -109,7 +109,14 @@ SharedPtr<BaseExpression> ExpressionBinder::Bind(const ParsedExpr &expr, BindCon
 SharedPtr<BaseExpression> ExpressionBinder::BuildExpression(const ParsedExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root) {
     switch (expr.type_) {
         case ParsedExprType::kConstant: {
-            return BuildValueExpr((const ConstantExpr &)expr, bind_context_ptr, depth, root);
+            const auto &constant_expr = (const ConstantExpr &)expr;
+            SharedPtr<BaseExpression> value_expr = BuildValueExpr(constant_expr, bind_context_ptr, depth, root);
+            if (constant_expr.param_index_ > 0 and query_context_ != nullptr) {
+                // A cached plan of the statement gets the parameter values of its next execution through this expression
+                static_cast<ValueExpression *>(value_expr.get())->param_index_ = constant_expr.param_index_;
+                query_context_->AddParameterExpression(value_expr);
+            }
+            return value_expr;
         }
         case ParsedExprType::kColumn: {
             return BuildColExpr((const ColumnExpr &)expr, bind_context_ptr, depth, root);
@@ -71,6 +71,7 @@ import index_ivfflat;
 import index_hnsw;
 import index_diskann;
 import index_secondary;
+import index_bitmap;
 import index_emvb;
 import index_bmp;
 import index_full_text;
@@ -708,6 +709,11 @@ Status LogicalPlanner::BuildCreateIndex(const CreateStatement *statement, Shared
             base_index_ptr = IndexSecondary::Make(index_name, index_filename, {index_info->column_name_});
             break;
         }
+        case IndexType::kBitmap: {
+            IndexBitmap::ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
+            base_index_ptr = IndexBitmap::Make(index_name, index_filename, {index_info->column_name_});
+            break;
+        }
         case IndexType::kEMVB: {
             assert(index_info->index_param_list_ != nullptr);
             IndexEMVB::ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
@@ -1042,6 +1048,11 @@ Status LogicalPlanner::BuildExport(const CopyStatement *statement, SharedPtr<Bin
         }
     }
 
+    if (!statement->compression_.empty() && statement->copy_file_type_ != CopyFileType::kPARQUET) {
+        Status status = Status::NotSupport("Compression is only supported when exporting parquet file");
+        RecoverableError(status);
+    }
+
     SharedPtr<BlockIndex> block_index = table_entry->GetBlockIndex(txn);
 
     SharedPtr<LogicalNode> logical_export = MakeShared<LogicalExport>(bind_context_ptr->GetNewLogicalNodeId(),
@@ -1055,6 +1066,7 @@ Status LogicalPlanner::BuildExport(const CopyStatement *statement, SharedPtr<Bin
                                                                       statement->offset_,
                                                                       statement->limit_,
                                                                       statement->row_limit_,
+                                                                      statement->compression_,
                                                                       column_idx_array,
                                                                       block_index);
 
@@ -1079,12 +1091,18 @@ Status LogicalPlanner::BuildImport(const CopyStatement *statement, SharedPtr<Bin
         RecoverableError(status);
     }
 
+    if (!statement->filter_.empty() && statement->copy_file_type_ != CopyFileType::kPARQUET) {
+        Status status = Status::NotSupport("Filter is only supported when importing parquet file");
+        RecoverableError(status);
+    }
+
     SharedPtr<LogicalNode> logical_import = MakeShared<LogicalImport>(bind_context_ptr->GetNewLogicalNodeId(),
                                                                       table_entry,
                                                                       statement->file_path_,
                                                                       statement->header_,
                                                                       statement->delimiter_,
-                                                                      statement->copy_file_type_);
+                                                                      statement->copy_file_type_,
+                                                                      statement->filter_);
 
     this->logical_plan_ = logical_import;
     return Status::OK();
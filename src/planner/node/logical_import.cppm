@@ -36,9 +36,10 @@ public:
                                   String file_path,
                                   bool header,
                                   char delimiter,
-                                  CopyFileType type)
+                                  CopyFileType type,
+                                  String filter)
         : LogicalNode(node_id, LogicalNodeType::kImport), table_entry_(table_entry), file_type_(type),
-          file_path_(std::move(file_path)), header_(header), delimiter_(delimiter) {}
+          file_path_(std::move(file_path)), header_(header), delimiter_(delimiter), filter_(std::move(filter)) {}
 
     [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
 
@@ -62,12 +63,15 @@ public:
 
     [[nodiscard]] char delimiter() const { return delimiter_; }
 
+    [[nodiscard]] const String &filter() const { return filter_; }
+
 private:
     TableEntry *table_entry_{};
     CopyFileType file_type_{CopyFileType::kInvalid};
     String file_path_{};
     bool header_{false};
     char delimiter_{','};
+    String filter_{};
 };
 
 } // namespace infinity
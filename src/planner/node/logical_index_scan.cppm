@@ -39,7 +39,7 @@ public:
                               SharedPtr<BaseExpression> &&index_filter_qualified,
                               HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                               Vector<FilterExecuteElem> &&filter_execute_command,
-                              UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                              SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                               bool add_row_id = true);
 
     [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
@@ -66,7 +66,7 @@ public:
     // Commands used in PhysicalIndexScan::ExecuteInternal()
     Vector<FilterExecuteElem> filter_execute_command_;
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
 
     bool add_row_id_;
 };
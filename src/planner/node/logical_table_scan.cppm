@@ -51,7 +51,7 @@ public:
 
     SharedPtr<BaseTableRef> base_table_ref_{};
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
 
     bool add_row_id_;
 };
@@ -35,6 +35,7 @@ import scalar_function;
 import scalar_function_set;
 import cast_expression;
 import column_expression;
+import in_expression;
 import value_expression;
 import secondary_index_scan_execute_expression;
 import index_base;
@@ -271,15 +272,18 @@ private:
                     continue;
                 }
                 const IndexBase *index_base = table_index_entry->index_base();
-                if (index_base->index_type_ != IndexType::kSecondary) {
+                if (index_base->index_type_ != IndexType::kSecondary and index_base->index_type_ != IndexType::kBitmap) {
                     continue;
                 }
                 String column_name = index_base->column_name();
                 u64 column_id = table_entry->GetColumnIdByName(column_name);
-                if (candidate_column_index_map_.contains(column_id)) {
-                    LOG_TRACE(fmt::format("InitColumnIndexEntries(): Column {} has multiple secondary indexes. Skipping one.", column_id));
-                } else {
+                if (auto iter = candidate_column_index_map_.find(column_id); iter == candidate_column_index_map_.end()) {
                     candidate_column_index_map_.emplace(column_id, table_index_entry);
+                } else if (index_base->index_type_ == IndexType::kBitmap and iter->second->index_base()->index_type_ == IndexType::kSecondary) {
+                    // the bitmap index answers the same filters with less work
+                    iter->second = table_index_entry;
+                } else {
+                    LOG_TRACE(fmt::format("InitColumnIndexEntries(): Column {} has multiple secondary indexes. Skipping one.", column_id));
                 }
             }
         }
@@ -300,7 +304,8 @@ private:
     inline SharedPtr<BaseExpression> RewriteForIndexScan(const SharedPtr<BaseExpression> &expression) {
         // case 1. expression is a scalar expression containing only one column and the column has a secondary index
         // case 2. expression is an "and" or "or" expression, and each child expression can be applied to the index scan (recursive check)
-        // now we do not support "not" expression in index scan
+        // case 3. expression is "[cast] x IN (value_expression, ...)" and the column x has a secondary index
+        // case 4. expression is a "not" expression, and the expression rewritten by De Morgan's laws can be applied to the index scan
         if (expression->type() == ExpressionType::kFunction) {
             auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
             if (auto const &f_name = function_expression->ScalarFunctionName(); f_name == "AND" or f_name == "OR") {
@@ -325,14 +330,15 @@ private:
                 arguments.emplace_back(std::move(right_arg));
                 return MakeShared<FunctionExpression>(function_expression->func_, std::move(arguments));
             } else if (f_name == "NOT") {
-                LOG_TRACE(fmt::format("Unsupported expression type: In CanApplyIndexScan(), the expression {} is a \"not\" function expression. "
-                                      "Now we do not support not expression in index scan.",
-                                      expression->Name()));
-                return nullptr;
+                // case 4.
+                return RewriteNotForIndexScan(expression->arguments()[0]);
             } else {
                 // case 1.
                 return CheckExprIndexStateAndRewrite(expression, 0);
             }
+        } else if (expression->type() == ExpressionType::kIn) {
+            // case 3.
+            return RewriteInForIndexScan(std::static_pointer_cast<InExpression>(expression));
         } else if (expression->type() == ExpressionType::kValue) {
             LOG_TRACE(fmt::format("Unsupported expression type: In CanApplyIndexScan(), the expression \"{}\" is a value expression. "
                                   "Need to apply the expression rewrite optimizer first.",
@@ -344,6 +350,122 @@ private:
         }
     }
 
+    // case 4. push "not" down to the compare functions:
+    // "not (a and b)" -> "not a or not b", "not (a or b)" -> "not a and not b", "not not a" -> "a",
+    // "not (x < v)" -> "x >= v", ..., "not (x = v)" -> "x < v or x > v"
+    // Both sides are null when x is null, so the rewritten expression keeps the result of the original one.
+    inline SharedPtr<BaseExpression> RewriteNotForIndexScan(const SharedPtr<BaseExpression> &expression) {
+        if (expression->type() != ExpressionType::kFunction) {
+            LOG_TRACE(fmt::format("Unsupported expression type: In RewriteNotForIndexScan(), unsupported expression: {}.", expression->Name()));
+            return nullptr;
+        }
+        auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
+        auto const &f_name = function_expression->ScalarFunctionName();
+        if (f_name == "NOT") {
+            return RewriteForIndexScan(expression->arguments()[0]);
+        }
+        if (f_name == "AND" or f_name == "OR") {
+            auto left_arg = RewriteNotForIndexScan(expression->arguments()[0]);
+            if (!left_arg) {
+                return nullptr;
+            }
+            auto right_arg = RewriteNotForIndexScan(expression->arguments()[1]);
+            if (!right_arg) {
+                return nullptr;
+            }
+            return MakeScalarFunction(f_name == "AND" ? "OR" : "AND", {std::move(left_arg), std::move(right_arg)});
+        }
+        static constexpr std::array<const char *, 4> CompareFunctionNames = {"<", ">", "<=", ">="};
+        static constexpr std::array<const char *, 4> CompareFunctionNamesNegated = {">=", "<=", ">", "<"};
+        SharedPtr<BaseExpression> negated_expression;
+        if (auto name_iter = std::find(CompareFunctionNames.begin(), CompareFunctionNames.end(), f_name); name_iter != CompareFunctionNames.end()) {
+            negated_expression = MakeScalarFunction(CompareFunctionNamesNegated[name_iter - CompareFunctionNames.begin()], expression->arguments());
+        } else if (f_name == "=") {
+            negated_expression = MakeScalarFunction(
+                "OR",
+                {MakeScalarFunction("<", expression->arguments()), MakeScalarFunction(">", expression->arguments())});
+        } else if (f_name == "<>") {
+            negated_expression = MakeScalarFunction("=", expression->arguments());
+        } else {
+            LOG_TRACE(fmt::format("Unsupported expression type: In RewriteNotForIndexScan(), unsupported function: {}.", expression->Name()));
+            return nullptr;
+        }
+        return RewriteForIndexScan(negated_expression);
+    }
+
+    inline SharedPtr<BaseExpression> MakeScalarFunction(const String &function_name, Vector<SharedPtr<BaseExpression>> arguments) {
+        auto function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), function_name);
+        auto scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(function_set_ptr);
+        ScalarFunction func = scalar_function_set_ptr->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(std::move(func), std::move(arguments));
+    }
+
+    inline bool IsIndexedColumn(const SharedPtr<BaseExpression> &expr, u32 depth) const {
+        if (!(expr->Type().CanBuildSecondaryIndex())) {
+            // Unsupported type
+            LOG_TRACE(fmt::format("Expression depth: {}. In IsIndexedColumn(), unsupported column value type {}. Expression: {}.",
+                                  depth,
+                                  expr->Type().ToString(),
+                                  expr->Name()));
+            return false;
+        }
+        auto column_expression = std::static_pointer_cast<ColumnExpression>(expr);
+        auto column_id = column_expression->binding().column_idx;
+        if (candidate_column_index_map_.contains(column_id)) {
+            LOG_TRACE(fmt::format("Expression depth: {}. Column {} has index.", depth, expr->Name()));
+            return true;
+        } else {
+            LOG_TRACE(fmt::format("Expression depth: {}. Column {} does not have a secondary index. Cannot apply index scan.",
+                                  depth,
+                                  expr->Name()));
+            return false;
+        }
+    }
+
+    // case 3. "x IN (v1, v2, ...)" is rewritten into "x = v1 OR x = v2 OR ...". The filter command builder merges the "or"s on the
+    // same column back into one sorted list of keys, which is looked up by a single walk over each index chunk.
+    inline SharedPtr<BaseExpression> RewriteInForIndexScan(const SharedPtr<InExpression> &in_expression) {
+        if (in_expression->in_type() != InType::kIn or in_expression->arguments().empty()) {
+            LOG_TRACE(fmt::format("Unsupported expression type: In RewriteInForIndexScan(), the expression {} is not an \"in\" list.",
+                                  in_expression->Name()));
+            return nullptr;
+        }
+        auto is_column_index = [this](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool { return IsIndexedColumn(expr, depth); };
+        if (!IsValidColumnExpression(in_expression->left_operand(), 1, is_column_index)) {
+            return nullptr;
+        }
+        for (const auto &value_expr : in_expression->arguments()) {
+            if (!IsValueResultExpression(value_expr, 1)) {
+                return nullptr;
+            }
+        }
+        auto *catalog = query_context_->storage()->catalog();
+        auto equal_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(catalog, "="));
+        Vector<SharedPtr<BaseExpression>> equal_expressions;
+        equal_expressions.reserve(in_expression->arguments().size());
+        for (const auto &value_expr : in_expression->arguments()) {
+            Vector<SharedPtr<BaseExpression>> arguments{in_expression->left_operand(), value_expr};
+            ScalarFunction equal_func = equal_function_set_ptr->GetMostMatchFunction(arguments);
+            for (SizeT idx = 0; idx < arguments.size(); ++idx) {
+                arguments[idx] = CastExpression::AddCastToType(arguments[idx], equal_func.parameter_types_[idx]);
+            }
+            equal_expressions.emplace_back(MakeShared<FunctionExpression>(std::move(equal_func), std::move(arguments)));
+        }
+        // combine pairwise so that a long list does not build a deep tree
+        while (equal_expressions.size() > 1) {
+            Vector<SharedPtr<BaseExpression>> combined;
+            combined.reserve((equal_expressions.size() + 1) / 2);
+            for (SizeT i = 0; i + 1 < equal_expressions.size(); i += 2) {
+                combined.emplace_back(MakeScalarFunction("OR", {std::move(equal_expressions[i]), std::move(equal_expressions[i + 1])}));
+            }
+            if (equal_expressions.size() % 2 == 1) {
+                combined.emplace_back(std::move(equal_expressions.back()));
+            }
+            equal_expressions = std::move(combined);
+        }
+        return std::move(equal_expressions.front());
+    }
+
     // case 1. expression needs to be in the form of "[cast] x compare value_expression" and the column x should have a secondary index.
     inline SharedPtr<BaseExpression> CheckExprIndexStateAndRewrite(const SharedPtr<BaseExpression> &expression, u32 sub_expr_depth) {
         // TODO: now do not support "!=" in index scan
@@ -367,27 +489,7 @@ private:
                         UnrecoverableError(error_message);
                         return nullptr;
                     }
-                    auto is_column_index = [&m = candidate_column_index_map_](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool {
-                        if (!(expr->Type().CanBuildSecondaryIndex())) {
-                            // Unsupported type
-                            LOG_TRACE(fmt::format("Expression depth: {}. In is_column_index(), unsupported column value type {}. Expression: {}.",
-                                                  depth,
-                                                  expr->Type().ToString(),
-                                                  expr->Name()));
-                            return false;
-                        }
-                        auto column_expression = std::static_pointer_cast<ColumnExpression>(expr);
-                        auto column_id = column_expression->binding().column_idx;
-                        if (m.contains(column_id)) {
-                            LOG_TRACE(fmt::format("Expression depth: {}. Column {} has index.", depth, expr->Name()));
-                            return true;
-                        } else {
-                            LOG_TRACE(fmt::format("Expression depth: {}. Column {} does not have a secondary index. Cannot apply index scan.",
-                                                  depth,
-                                                  expr->Name()));
-                            return false;
-                        }
-                    };
+                    auto is_column_index = [this](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool { return IsIndexedColumn(expr, depth); };
                     if (HaveLeftColumnAndRightValue(function_expression, sub_expr_depth + 1, is_column_index)) {
                         return expression;
                     } else if (HaveRightColumnAndLeftValue(function_expression, sub_expr_depth + 1, is_column_index)) {
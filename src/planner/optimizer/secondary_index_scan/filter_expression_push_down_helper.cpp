@@ -477,7 +477,26 @@ FilterExpressionPushDownHelper::UnwindCast(SharedPtr<BaseExpression> &cast_expr,
     }
 }
 
+namespace {
+
+// The value is copied into the plan, so the plan is only valid for the values of the prepared statement parameters in it
+void MarkParametersUsedByPlan(const SharedPtr<BaseExpression> &expression) {
+    if (expression->type() == ExpressionType::kValue) {
+        auto *value_expression = static_cast<ValueExpression *>(expression.get());
+        if (value_expression->param_index_ > 0) {
+            value_expression->used_by_plan_ = true;
+        }
+        return;
+    }
+    for (const auto &argument : expression->arguments()) {
+        MarkParametersUsedByPlan(argument);
+    }
+}
+
+} // namespace
+
 Value FilterExpressionPushDownHelper::CalcValueResult(SharedPtr<BaseExpression> &expression) {
+    MarkParametersUsedByPlan(expression);
     if (expression->type() == ExpressionType::kValue) {
         // does not need ExpressionEvaluator
         auto value_expression = std::static_pointer_cast<ValueExpression>(expression);
@@ -158,7 +158,7 @@ private:
         auto &second_last_interval = second_last_elem.GetIntervalRange();
         auto &last_interval = last_elem.GetIntervalRange();
         bool merge_result = std::visit(Overload{
-            []<typename T>(FilterIntervalRangeT<T> &second_last, const FilterIntervalRangeT<T> &last) -> bool { return second_last.MergeAnd(last); },
+            []<typename T>(FilterIntervalRangeT<T> &second_last, FilterIntervalRangeT<T> &last) -> bool { return second_last.MergeAnd(last); },
             []<typename T1, typename T2>
                 requires IncompatibleFilterIntervalRangePair<T1, T2>
             (T1 & x, T2 & y) -> bool {
@@ -178,6 +178,7 @@ private:
 
     // try to compact adjacent elements
     // case 1. one kEmpty range and another range
+    // case 2. two intervals of same ColumnID
     inline bool TryCompactNearbyFilterOr() {
         if (result_.size() < 2) {
             String error_message = "FilterCommandBuilder::TryCompactNearbyFilter(): result size < 2.";
@@ -202,10 +203,23 @@ private:
             second_last_elem = last_elem; // copy
             result_.pop_back();
             return true;
-        } else {
-            // both non-empty
+        }
+        // case 2. two intervals of same ColumnID
+        if (last_elem.GetColumnID() != second_last_elem.GetColumnID()) {
             return false;
         }
+        // same column id, same type
+        std::visit(Overload{[]<typename T>(FilterIntervalRangeT<T> &second_last, const FilterIntervalRangeT<T> &last) { second_last.MergeOr(last); },
+                            []<typename T1, typename T2>
+                                requires IncompatibleFilterIntervalRangePair<T1, T2>
+                            (T1 & x, T2 & y) {
+                                String error_message = "FilterCommandBuilder::TryCompactNearbyFilterOr(): Unreachable branch! Type mismatch.";
+                                UnrecoverableError(error_message);
+                            }},
+                   second_last_elem.GetIntervalRange(),
+                   last_elem.GetIntervalRange());
+        result_.pop_back();
+        return true;
     }
 
 public:
@@ -286,6 +300,13 @@ public:
             }
         }
         if (progress == Progress::kSavedToResult) {
+            // sort the intervals collected by "OR" compaction
+            for (auto &elem : result_) {
+                if (std::holds_alternative<FilterExecuteSingleRange>(elem)) {
+                    std::visit(Overload{[]<typename T>(FilterIntervalRangeT<T> &interval_range) { interval_range.Normalize(); }, [](std::monostate &) {}},
+                               std::get<FilterExecuteSingleRange>(elem).GetIntervalRange());
+                }
+            }
             return true;
         } else {
             String error_message = "FilterCommandBuilder::Build(): progress error.";
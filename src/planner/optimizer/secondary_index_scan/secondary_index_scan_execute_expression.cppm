@@ -42,9 +42,10 @@ ConvertToOrderedType<VarcharT> ConvertToOrderedKeyValueFromValue<VarcharT>(const
     return ConvertToOrderedKeyValue(s);
 }
 
-// The range will only monotonically shrink
-// MergeAnd is meaningful: reduce the search range
-// MergeOr is not needed if expression rewrite is done
+// Union of disjoint closed intervals [begin, end] of index keys, sorted by begin.
+// MergeAnd intersects two unions and can only shrink the range.
+// MergeOr collects the intervals of both sides, e.g. "x = 1 OR x = 5 OR x IN (7, 9)" on the same column, which are sorted and
+// merged by Normalize, so that an IN-list or a list of ranges is looked up by one walk over the index.
 // index key value type T = ConvertToOrderedType<ColumnValueType>
 export template <typename ColumnValueType>
 class FilterIntervalRangeT {
@@ -58,54 +59,81 @@ public:
         AddFilter(val_, compare_type);
     }
 
-    [[nodiscard]] bool MergeAnd(const FilterIntervalRangeT &other) {
-        AddLE(other.end_val_);
-        AddGE(other.begin_val_);
-        return begin_val_ <= end_val_;
+    [[nodiscard]] bool MergeAnd(FilterIntervalRangeT &other) {
+        Normalize();
+        other.Normalize();
+        Vector<Pair<T, T>> merged_intervals;
+        for (SizeT i = 0, j = 0; i < intervals_.size() and j < other.intervals_.size();) {
+            const auto &[begin_a, end_a] = intervals_[i];
+            const auto &[begin_b, end_b] = other.intervals_[j];
+            if (const T begin_val = std::max(begin_a, begin_b), end_val = std::min(end_a, end_b); begin_val <= end_val) {
+                merged_intervals.emplace_back(begin_val, end_val);
+            }
+            if (end_a < end_b) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+        intervals_ = std::move(merged_intervals);
+        return !intervals_.empty();
     }
 
-    [[nodiscard]] Pair<T, T> GetRange() const { return {begin_val_, end_val_}; }
-
-    inline void SetAlwaysFalse() {
-        end_val_ = std::numeric_limits<T>::lowest();
-        begin_val_ = std::numeric_limits<T>::max();
+    void MergeOr(const FilterIntervalRangeT &other) {
+        intervals_.insert(intervals_.end(), other.intervals_.begin(), other.intervals_.end());
+        normalized_ = false;
     }
 
-private:
-    // The interval range will only monotonically shrink
-    // default: the whole range of T
-    T begin_val_ = std::numeric_limits<T>::lowest();
-    T end_val_ = std::numeric_limits<T>::max();
-
-    inline void AddLE(T val) {
-        if (val < end_val_) {
-            end_val_ = val;
+    // sort the intervals and merge the overlapping ones
+    void Normalize() {
+        if (normalized_) {
+            return;
         }
-    }
-    inline void AddGE(T val) {
-        if (val > begin_val_) {
-            begin_val_ = val;
+        std::sort(intervals_.begin(), intervals_.end());
+        SizeT merged_count = 0;
+        for (const auto &[begin_val, end_val] : intervals_) {
+            if (merged_count > 0 and begin_val <= intervals_[merged_count - 1].second) {
+                intervals_[merged_count - 1].second = std::max(intervals_[merged_count - 1].second, end_val);
+            } else {
+                intervals_[merged_count++] = {begin_val, end_val};
+            }
         }
+        intervals_.resize(merged_count);
+        normalized_ = true;
     }
 
+    // sorted and disjoint after Normalize
+    [[nodiscard]] const Vector<Pair<T, T>> &GetRanges() const { return intervals_; }
+
+    inline void SetAlwaysFalse() {
+        intervals_.clear();
+        normalized_ = true;
+    }
+
+private:
+    Vector<Pair<T, T>> intervals_;
+    bool normalized_ = true;
+
     // can only be called in constructor
     inline void AddFilter(const T val, const FilterCompareType compare_type) {
+        // default: the whole range of T
+        T begin_val = std::numeric_limits<T>::lowest();
+        T end_val = std::numeric_limits<T>::max();
         switch (compare_type) {
             case FilterCompareType::kLessEqual: {
-                AddLE(val);
+                end_val = val;
                 break;
             }
             case FilterCompareType::kGreaterEqual: {
-                AddGE(val);
+                begin_val = val;
                 break;
             }
             case FilterCompareType::kEqual: {
-                AddLE(val);
-                AddGE(val);
+                begin_val = val;
+                end_val = val;
                 break;
             }
             case FilterCompareType::kAlwaysTrue: {
-                // default to the whole range of type T
                 break;
             }
             default: {
@@ -113,6 +141,7 @@ private:
                 UnrecoverableError(error_message);
             }
         }
+        intervals_.emplace_back(begin_val, end_val);
     }
 };
 
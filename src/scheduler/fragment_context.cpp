@@ -71,6 +71,8 @@ import column_def;
 import explain_statement;
 import table_entry;
 import segment_entry;
+import block_column_entry;
+import segment_index_entry;
 
 namespace infinity {
 
@@ -673,17 +675,19 @@ PhysicalSink *FragmentContext::GetSinkOperator() const { return fragment_ptr_->G
 PhysicalSource *FragmentContext::GetSourceOperator() const { return fragment_ptr_->GetSourceNode(); }
 
 SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentContext *fragment_context, QueryContext *query_context) {
+    // The operator keeps its entries and parameters, a cached plan is executed again.
 
     SizeT task_n = knn_scan_operator->TaskletCount();
     KnnExpression *knn_expr = knn_scan_operator->knn_expression_.get();
+    knn_scan_operator->ClearFilterDecisions();
     switch (fragment_context->ContextType()) {
         case FragmentType::kSerialMaterialize: {
             SerialMaterializedFragmentCtx *serial_materialize_fragment_ctx = static_cast<SerialMaterializedFragmentCtx *>(fragment_context);
             serial_materialize_fragment_ctx->knn_scan_shared_data_ =
                 MakeUnique<KnnScanSharedData>(knn_scan_operator->base_table_ref_,
-                                              std::move(knn_scan_operator->block_column_entries_),
-                                              std::move(knn_scan_operator->index_entries_),
-                                              std::move(knn_expr->opt_params_),
+                                              MakeUnique<Vector<BlockColumnEntry *>>(*knn_scan_operator->block_column_entries_),
+                                              MakeUnique<Vector<SegmentIndexEntry *>>(*knn_scan_operator->index_entries_),
+                                              knn_expr->opt_params_,
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
                                               1,
@@ -696,9 +700,9 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
             ParallelMaterializedFragmentCtx *parallel_materialize_fragment_ctx = static_cast<ParallelMaterializedFragmentCtx *>(fragment_context);
             parallel_materialize_fragment_ctx->knn_scan_shared_data_ =
                 MakeUnique<KnnScanSharedData>(knn_scan_operator->base_table_ref_,
-                                              std::move(knn_scan_operator->block_column_entries_),
-                                              std::move(knn_scan_operator->index_entries_),
-                                              std::move(knn_expr->opt_params_),
+                                              MakeUnique<Vector<BlockColumnEntry *>>(*knn_scan_operator->block_column_entries_),
+                                              MakeUnique<Vector<SegmentIndexEntry *>>(*knn_scan_operator->index_entries_),
+                                              knn_expr->opt_params_,
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
                                               1,
@@ -71,13 +71,13 @@ void FragmentTask::OnExecute() {
         // No source error
         Vector<PhysicalOperator *> &operator_refs = fragment_context->GetOperators();
 
-        bool enable_profiler = query_context->is_enable_profiling();
-        TaskProfiler profiler(TaskBinding(), enable_profiler, operator_count_);
+        bool enable_profiler = query_context->is_enable_operator_profiling();
+        TaskProfiler profiler(TaskBinding{FragmentId(), task_id_}, enable_profiler, operator_count_);
         HashMap<SizeT, SharedPtr<BaseTableRef>> table_refs;
         profiler.Begin();
         try {
             for (i64 op_idx = operator_count_ - 1; op_idx >= 0; --op_idx) {
-                profiler.StartOperator(operator_refs[op_idx]);
+                profiler.StartOperator(operator_refs[op_idx], operator_states_[op_idx].get());
                 DeferFn defer_fn([&]() { profiler.StopOperator(operator_states_[op_idx].get()); });
 
                 operator_refs[op_idx]->InputLoad(query_context, operator_states_[op_idx].get(), table_refs);
@@ -24,6 +24,7 @@ import var_file_worker;
 import third_party;
 import logger;
 import file_worker_type;
+import profiler;
 
 module buffer_obj;
 
@@ -47,8 +48,10 @@ BufferObj::~BufferObj() = default;
 
 BufferHandle BufferObj::Load() {
     std::unique_lock<std::mutex> locker(w_locker_);
+    ProfileCounters &profile_counters = ThreadProfileCounters();
     switch (status_) {
         case BufferStatus::kLoaded: {
+            ++profile_counters.buffer_hits_;
             break;
         }
         case BufferStatus::kUnloaded: {
@@ -56,6 +59,7 @@ BufferHandle BufferObj::Load() {
                 String error_message = fmt::format("attempt to buffer: {} status is UNLOADED, but not in GC queue", GetFilename());
                 UnrecoverableError(error_message);
             }
+            ++profile_counters.buffer_hits_;
             break;
         }
         case BufferStatus::kFreed: {
@@ -70,6 +74,8 @@ BufferHandle BufferObj::Load() {
             }
             bool from_spill = type_ != BufferType::kPersistent;
             file_worker_->ReadFromFile(from_spill);
+            ++profile_counters.buffer_misses_;
+            profile_counters.bytes_read_ += GetBufferSize();
             break;
         }
         case BufferStatus::kNew: {
@@ -23,6 +23,7 @@ import file_worker;
 import logger;
 import index_base;
 import index_secondary;
+import create_index_info;
 import secondary_index_data;
 import infinity_exception;
 import third_party;
@@ -42,7 +43,7 @@ void SecondaryIndexFileWorker::AllocateInMemory() {
         String error_message = "AllocateInMemory: Already allocated.";
         UnrecoverableError(error_message);
     } else if (auto &data_type = column_def_->type(); data_type->CanBuildSecondaryIndex()) [[likely]] {
-        data_ = static_cast<void *>(GetSecondaryIndexData(data_type, row_count_, true));
+        data_ = static_cast<void *>(GetSecondaryIndexData(data_type, row_count_, true, index_base_->index_type_ == IndexType::kBitmap));
         LOG_TRACE("Finished AllocateInMemory().");
     } else {
         String error_message = fmt::format("Cannot build secondary index on data type: {}", data_type->ToString());
@@ -76,7 +77,7 @@ void SecondaryIndexFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_succ
 
 void SecondaryIndexFileWorker::ReadFromFileImpl(SizeT file_size) {
     if (!data_) [[likely]] {
-        auto index = GetSecondaryIndexData(column_def_->type(), row_count_, false);
+        auto index = GetSecondaryIndexData(column_def_->type(), row_count_, false, index_base_->index_type_ == IndexType::kBitmap);
         index->ReadIndexInner(*file_handler_);
         data_ = static_cast<void *>(index);
         LOG_TRACE("Finished ReadFromFileImpl().");
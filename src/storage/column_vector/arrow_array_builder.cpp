@@ -0,0 +1,495 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include "arrow/type_fwd.h"
+#include <arrow/array/builder_nested.h>
+#include <arrow/array/builder_primitive.h>
+#include <arrow/type.h>
+#include <string>
+
+module arrow_array_builder;
+
+import stl;
+import third_party;
+import logger;
+import column_vector;
+import value;
+import data_type;
+import logical_type;
+import embedding_info;
+import sparse_info;
+import internal_types;
+import infinity_exception;
+
+namespace infinity {
+
+SharedPtr<arrow::DataType> GetArrowType(const SharedPtr<DataType> &column_type) {
+    switch (column_type->type()) {
+        case LogicalType::kBoolean:
+            return arrow::boolean();
+        case LogicalType::kTinyInt:
+            return arrow::int8();
+        case LogicalType::kSmallInt:
+            return arrow::int16();
+        case LogicalType::kInteger:
+            return arrow::int32();
+        case LogicalType::kBigInt:
+            return arrow::int64();
+        case LogicalType::kFloat16:
+            return arrow::float16();
+        case LogicalType::kBFloat16:
+            return arrow::float32();
+        case LogicalType::kFloat:
+            return arrow::float32();
+        case LogicalType::kDouble:
+            return arrow::float64();
+        case LogicalType::kDate:
+            return arrow::date32();
+        case LogicalType::kTime:
+            return arrow::time32(arrow::TimeUnit::SECOND);
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+            return arrow::timestamp(arrow::TimeUnit::SECOND);
+        case LogicalType::kVarchar:
+            return arrow::utf8();
+        case LogicalType::kSparse: {
+            const auto *sparse_info = static_cast<const SparseInfo *>(column_type->type_info().get());
+
+            SharedPtr<arrow::DataType> index_type;
+            Optional<SharedPtr<arrow::DataType>> value_type = None;
+            switch (sparse_info->IndexType()) {
+                case EmbeddingDataType::kElemInt8: {
+                    index_type = ::arrow::list(::arrow::int8());
+                    break;
+                }
+                case EmbeddingDataType::kElemInt16: {
+                    index_type = ::arrow::list(::arrow::int16());
+                    break;
+                }
+                case EmbeddingDataType::kElemInt32: {
+                    index_type = ::arrow::list(::arrow::int32());
+                    break;
+                }
+                case EmbeddingDataType::kElemInt64: {
+                    index_type = ::arrow::list(::arrow::int64());
+                    break;
+                }
+                default: {
+                    UnrecoverableError("Index type invalid");
+                }
+            }
+            switch (sparse_info->DataType()) {
+                case EmbeddingDataType::kElemBit: {
+                    break;
+                }
+                case EmbeddingDataType::kElemInt8: {
+                    value_type = ::arrow::list(::arrow::int8());
+                    break;
+                }
+                case EmbeddingDataType::kElemInt16: {
+                    value_type = ::arrow::list(::arrow::int16());
+                    break;
+                }
+                case EmbeddingDataType::kElemInt32: {
+                    value_type = ::arrow::list(::arrow::int32());
+                    break;
+                }
+                case EmbeddingDataType::kElemInt64: {
+                    value_type = ::arrow::list(::arrow::int64());
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat: {
+                    value_type = ::arrow::list(::arrow::float32());
+                    break;
+                }
+                case EmbeddingDataType::kElemDouble: {
+                    value_type = ::arrow::list(::arrow::float64());
+                    break;
+                }
+                case EmbeddingDataType::kElemUInt8: {
+                    value_type = ::arrow::list(::arrow::uint8());
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat16: {
+                    value_type = ::arrow::list(::arrow::float16());
+                    break;
+                }
+                case EmbeddingDataType::kElemBFloat16: {
+                    value_type = ::arrow::list(::arrow::float32());
+                    break;
+                }
+                default: {
+                    UnrecoverableError("Data type invalid");
+                }
+            }
+
+            arrow::FieldVector fields{::arrow::field("index", std::move(index_type))};
+            if (value_type.has_value()) {
+                fields.emplace_back(::arrow::field("value", value_type.value()));
+            }
+            return arrow::struct_(std::move(fields));
+        }
+        case LogicalType::kEmbedding:
+        case LogicalType::kTensor:
+        case LogicalType::kTensorArray: {
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_type->type_info().get());
+            const SizeT dimension = embedding_info->Dimension();
+            SharedPtr<arrow::DataType> arrow_embedding_elem_type;
+            switch (embedding_info->Type()) {
+                case EmbeddingDataType::kElemBit: {
+                    arrow_embedding_elem_type = ::arrow::boolean();
+                    break;
+                }
+                case EmbeddingDataType::kElemInt8: {
+                    arrow_embedding_elem_type = ::arrow::int8();
+                    break;
+                }
+                case EmbeddingDataType::kElemInt16: {
+                    arrow_embedding_elem_type = ::arrow::int16();
+                    break;
+                }
+                case EmbeddingDataType::kElemInt32: {
+                    arrow_embedding_elem_type = ::arrow::int32();
+                    break;
+                }
+                case EmbeddingDataType::kElemInt64: {
+                    arrow_embedding_elem_type = ::arrow::int64();
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat: {
+                    arrow_embedding_elem_type = ::arrow::float32();
+                    break;
+                }
+                case EmbeddingDataType::kElemDouble: {
+                    arrow_embedding_elem_type = ::arrow::float64();
+                    break;
+                }
+                case EmbeddingDataType::kElemUInt8: {
+                    arrow_embedding_elem_type = ::arrow::uint8();
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat16: {
+                    arrow_embedding_elem_type = ::arrow::float16();
+                    break;
+                }
+                case EmbeddingDataType::kElemBFloat16: {
+                    arrow_embedding_elem_type = ::arrow::float32();
+                    break;
+                }
+                case EmbeddingDataType::kElemInvalid: {
+                    UnrecoverableError("Invalid case EmbeddingDataType::kElemInvalid");
+                    break;
+                }
+            }
+            auto arrow_embedding_type = ::arrow::fixed_size_list(std::move(arrow_embedding_elem_type), dimension);
+            if (column_type->type() == LogicalType::kEmbedding) {
+                return arrow_embedding_type;
+            }
+            auto arrow_tensor_type = ::arrow::list(std::move(arrow_embedding_type));
+            if (column_type->type() == LogicalType::kTensor) {
+                return arrow_tensor_type;
+            }
+            auto arrow_tensor_array_type = ::arrow::list(std::move(arrow_tensor_type));
+            if (column_type->type() == LogicalType::kTensorArray) {
+                return arrow_tensor_array_type;
+            }
+            UnrecoverableError("Unreachable code!");
+            return {};
+        }
+        case LogicalType::kRowID:
+        case LogicalType::kInterval:
+        case LogicalType::kHugeInt:
+        case LogicalType::kDecimal:
+        case LogicalType::kArray:
+        case LogicalType::kTuple:
+        case LogicalType::kPoint:
+        case LogicalType::kLine:
+        case LogicalType::kLineSeg:
+        case LogicalType::kBox:
+        case LogicalType::kCircle:
+        case LogicalType::kUuid:
+        case LogicalType::kMixed:
+        case LogicalType::kNull:
+        case LogicalType::kMissing:
+        case LogicalType::kEmptyArray:
+        case LogicalType::kInvalid: {
+            String error_message = "Invalid data type";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+    }
+    return nullptr;
+}
+
+SharedPtr<arrow::Array> BuildArrowArray(const SharedPtr<DataType> &column_type, const ColumnVector &column_vector) {
+    SharedPtr<arrow::ArrayBuilder> array_builder = nullptr;
+
+    switch (column_type->type()) {
+        case LogicalType::kBoolean: {
+            array_builder = MakeShared<arrow::BooleanBuilder>();
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            array_builder = MakeShared<::arrow::Int8Builder>();
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            array_builder = MakeShared<::arrow::Int16Builder>();
+            break;
+        }
+        case LogicalType::kInteger: {
+            array_builder = MakeShared<::arrow::Int32Builder>();
+            break;
+        }
+        case LogicalType::kBigInt: {
+            array_builder = MakeShared<::arrow::Int64Builder>();
+            break;
+        }
+        case LogicalType::kFloat: {
+            array_builder = MakeShared<::arrow::FloatBuilder>();
+            break;
+        }
+        case LogicalType::kDouble: {
+            array_builder = MakeShared<::arrow::DoubleBuilder>();
+            break;
+        }
+        case LogicalType::kFloat16: {
+            array_builder = MakeShared<::arrow::HalfFloatBuilder>();
+            break;
+        }
+        case LogicalType::kBFloat16: {
+            array_builder = MakeShared<::arrow::FloatBuilder>();
+            break;
+        }
+        case LogicalType::kDate: {
+            array_builder = MakeShared<::arrow::Date32Builder>();
+            break;
+        }
+        case LogicalType::kTime: {
+            array_builder = MakeShared<::arrow::Time32Builder>(arrow::time32(arrow::TimeUnit::SECOND), arrow::DefaultMemoryPool());
+            break;
+        }
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp: {
+            array_builder = MakeShared<::arrow::TimestampBuilder>(::arrow::timestamp(arrow::TimeUnit::SECOND), arrow::DefaultMemoryPool());
+            break;
+        }
+        case LogicalType::kVarchar: {
+            array_builder = MakeShared<::arrow::StringBuilder>();
+            break;
+        }
+        case LogicalType::kSparse: {
+            const auto *sparse_info = static_cast<const SparseInfo *>(column_type->type_info().get());
+            SharedPtr<arrow::ArrayBuilder> index_builder = nullptr;
+            SharedPtr<arrow::ArrayBuilder> value_builder = nullptr;
+            switch (sparse_info->IndexType()) {
+                case EmbeddingDataType::kElemInt8: {
+                    auto int8_builder = MakeShared<::arrow::Int8Builder>();
+                    index_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int8_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt16: {
+                    auto int16_builder = MakeShared<::arrow::Int16Builder>();
+                    index_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int16_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt32: {
+                    auto int32_builder = MakeShared<::arrow::Int32Builder>();
+                    index_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int32_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt64: {
+                    auto int64_builder = MakeShared<::arrow::Int64Builder>();
+                    index_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int64_builder);
+                    break;
+                }
+                default: {
+                    UnrecoverableError("Invalid index type.");
+                }
+            }
+            switch (sparse_info->DataType()) {
+                case EmbeddingDataType::kElemBit: {
+                    break;
+                }
+                case EmbeddingDataType::kElemInt8: {
+                    auto int8_builder = MakeShared<::arrow::Int8Builder>();
+                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int8_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt16: {
+                    auto int16_builder = MakeShared<::arrow::Int16Builder>();
+                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int16_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt32: {
+                    auto int32_builder = MakeShared<::arrow::Int32Builder>();
+                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int32_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt64: {
+                    auto int64_builder = MakeShared<::arrow::Int64Builder>();
+                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), int64_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat: {
+                    auto float_builder = MakeShared<::arrow::FloatBuilder>();
+                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), float_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemDouble: {
+                    auto double_builder = MakeShared<::arrow::DoubleBuilder>();
+                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), double_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemUInt8: {
+                    auto uint8_builder = MakeShared<::arrow::UInt8Builder>();
+                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), uint8_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat16: {
+                    auto float16_builder = MakeShared<::arrow::HalfFloatBuilder>();
+                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), float16_builder);
+                    break;
+                }
+                case EmbeddingDataType::kElemBFloat16: {
+                    auto float_builder = MakeShared<::arrow::FloatBuilder>();
+                    value_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), float_builder);
+                    break;
+                }
+                default: {
+                    UnrecoverableError("Invalid data type.");
+                }
+            }
+            auto struct_type = arrow::struct_({arrow::field("index", index_builder->type()), arrow::field("value", value_builder->type())});
+            Vector<SharedPtr<arrow::ArrayBuilder>> field_builders = {index_builder};
+            if (value_builder.get() != nullptr) {
+                field_builders.emplace_back(value_builder);
+            }
+            array_builder = MakeShared<::arrow::StructBuilder>(struct_type, arrow::DefaultMemoryPool(), std::move(field_builders));
+            break;
+        }
+        case LogicalType::kEmbedding:
+        case LogicalType::kTensor:
+        case LogicalType::kTensorArray: {
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_type->type_info().get());
+            SharedPtr<::arrow::ArrayBuilder> embedding_element_builder;
+            switch (embedding_info->Type()) {
+                case EmbeddingDataType::kElemBit: {
+                    embedding_element_builder = MakeShared<::arrow::BooleanBuilder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemInt8: {
+                    embedding_element_builder = MakeShared<::arrow::Int8Builder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemInt16: {
+                    embedding_element_builder = MakeShared<::arrow::Int16Builder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemInt32: {
+                    embedding_element_builder = MakeShared<::arrow::Int32Builder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemInt64: {
+                    embedding_element_builder = MakeShared<::arrow::Int64Builder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat: {
+                    embedding_element_builder = MakeShared<::arrow::FloatBuilder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemDouble: {
+                    embedding_element_builder = MakeShared<::arrow::DoubleBuilder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemUInt8: {
+                    embedding_element_builder = MakeShared<::arrow::UInt8Builder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat16: {
+                    embedding_element_builder = MakeShared<::arrow::HalfFloatBuilder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemBFloat16: {
+                    embedding_element_builder = MakeShared<::arrow::FloatBuilder>();
+                    break;
+                }
+                case EmbeddingDataType::kElemInvalid: {
+                    String error_message = "Invalid embedding data type: EmbeddingDataType::kElemInvalid";
+                    LOG_CRITICAL(error_message);
+                    UnrecoverableError(error_message);
+                    break;
+                }
+            }
+            const SizeT dimension = embedding_info->Dimension();
+            auto embedding_arrow_array_builder =
+                MakeShared<::arrow::FixedSizeListBuilder>(arrow::DefaultMemoryPool(), embedding_element_builder, dimension);
+            if (column_type->type() == LogicalType::kEmbedding) {
+                array_builder = std::move(embedding_arrow_array_builder);
+                break;
+            }
+            auto tensor_arrow_array_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), embedding_arrow_array_builder);
+            if (column_type->type() == LogicalType::kTensor) {
+                array_builder = std::move(tensor_arrow_array_builder);
+                break;
+            }
+            auto tensor_array_arrow_array_builder = MakeShared<::arrow::ListBuilder>(arrow::DefaultMemoryPool(), tensor_arrow_array_builder);
+            if (column_type->type() == LogicalType::kTensorArray) {
+                array_builder = std::move(tensor_array_arrow_array_builder);
+                break;
+            }
+            UnrecoverableError("Unreachable code!");
+            break;
+        }
+        case LogicalType::kRowID:
+        case LogicalType::kInterval:
+        case LogicalType::kHugeInt:
+        case LogicalType::kDecimal:
+        case LogicalType::kArray:
+        case LogicalType::kTuple:
+        case LogicalType::kPoint:
+        case LogicalType::kLine:
+        case LogicalType::kLineSeg:
+        case LogicalType::kBox:
+        case LogicalType::kCircle:
+        case LogicalType::kUuid:
+        case LogicalType::kMixed:
+        case LogicalType::kNull:
+        case LogicalType::kMissing:
+        case LogicalType::kEmptyArray:
+        case LogicalType::kInvalid: {
+            String error_message = "Invalid data type";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+    }
+
+    for (SizeT i = 0; i < column_vector.Size(); ++i) {
+        auto value = column_vector.GetValue(i);
+        value.AppendToArrowArray(column_type, array_builder);
+    }
+
+    SharedPtr<arrow::Array> array;
+    auto status = array_builder->Finish(&array);
+    if (!status.ok()) {
+        String error_message = fmt::format("Failed to build arrow array: {}", status.message());
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    return array;
+}
+
+} // namespace infinity
@@ -0,0 +1,32 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module arrow_array_builder;
+
+import stl;
+import third_party;
+import data_type;
+import column_vector;
+
+namespace infinity {
+
+// Arrow counterparts of column types and column vectors, shared by parquet export and the arrow select stream
+
+export SharedPtr<arrow::DataType> GetArrowType(const SharedPtr<DataType> &column_type);
+
+export SharedPtr<arrow::Array> BuildArrowArray(const SharedPtr<DataType> &column_type, const ColumnVector &column_vector);
+
+} // namespace infinity
@@ -27,9 +27,22 @@ import compaction_alg;
 import third_party;
 import logger;
 import table_entry;
+import default_values;
 
 namespace infinity {
 
+namespace {
+
+f64 DeleteRatio(const SegmentEntry *segment_entry) {
+    SizeT row_count = segment_entry->row_count();
+    if (row_count == 0) {
+        return 0;
+    }
+    return static_cast<f64>(row_count - segment_entry->actual_row_count()) / row_count;
+}
+
+} // namespace
+
 void SegmentLayer::AddSegment(SegmentEntry *segment_entry) {
     SegmentID segment_id = segment_entry->segment_id();
     auto [iter, insert_ok] = segments_.emplace(segment_id, segment_entry);
@@ -56,9 +69,21 @@ Vector<SegmentEntry *> SegmentLayer::PickCompacting(TransactionID txn_id, SizeT
 
     Vector<SegmentEntry *> ret;
     {
-        Vector<Pair<SegmentEntry *, SizeT>> segments;
+        TxnTimeStamp oldest_ts = UNCOMMIT_TS;
+        TxnTimeStamp newest_ts = 0;
         for (auto &[segment_id, segment_entry] : segments_) {
-            segments.emplace_back(segment_entry, segment_entry->actual_row_count());
+            oldest_ts = std::min(oldest_ts, segment_entry->min_row_ts());
+            newest_ts = std::max(newest_ts, segment_entry->min_row_ts());
+        }
+        // small, heavily deleted and old segments have low score and are compacted first
+        Vector<Pair<SegmentEntry *, f64>> segments;
+        for (auto &[segment_id, segment_entry] : segments_) {
+            f64 age = 0;
+            if (newest_ts > oldest_ts) {
+                age = static_cast<f64>(newest_ts - segment_entry->min_row_ts()) / (newest_ts - oldest_ts);
+            }
+            f64 score = segment_entry->actual_row_count() / (1 + DeleteRatio(segment_entry)) / (1 + age);
+            segments.emplace_back(segment_entry, score);
         }
         Vector<int> idx(segment_n);
         std::iota(idx.begin(), idx.end(), 0);
@@ -68,7 +93,7 @@ Vector<SegmentEntry *> SegmentLayer::PickCompacting(TransactionID txn_id, SizeT
         SizeT total_row_cnt = 0;
         for (SizeT i = 0; i < M; ++i) {
             ret.push_back(segments[idx[i]].first);
-            total_row_cnt += segments[idx[i]].second;
+            total_row_cnt += segments[idx[i]].first->actual_row_count();
         }
         if (total_row_cnt > max_capacity) {
             return {};
@@ -86,6 +111,36 @@ Vector<SegmentEntry *> SegmentLayer::PickCompacting(TransactionID txn_id, SizeT
     return ret;
 }
 
+SegmentEntry *SegmentLayer::PickMostDeleted(TransactionID txn_id, f64 delete_ratio) {
+    SegmentEntry *ret = nullptr;
+    f64 max_delete_ratio = delete_ratio;
+    for (auto &[segment_id, segment_entry] : segments_) {
+        f64 segment_delete_ratio = DeleteRatio(segment_entry);
+        if (segment_delete_ratio >= max_delete_ratio) {
+            max_delete_ratio = segment_delete_ratio;
+            ret = segment_entry;
+        }
+    }
+    if (ret == nullptr) {
+        return nullptr;
+    }
+    segments_.erase(ret->segment_id());
+    auto [iter, insert_ok] = compacting_segments_map_.emplace(txn_id, Vector<SegmentEntry *>{ret});
+    if (!insert_ok) {
+        String error_message = fmt::format("TransactionID conflict: {}", txn_id);
+        UnrecoverableError(error_message);
+    }
+    return ret;
+}
+
+f64 SegmentLayer::MaxDeleteRatio() const {
+    f64 max_delete_ratio = 0;
+    for (const auto &[segment_id, segment_entry] : segments_) {
+        max_delete_ratio = std::max(max_delete_ratio, DeleteRatio(segment_entry));
+    }
+    return max_delete_ratio;
+}
+
 void SegmentLayer::CommitCompact(TransactionID txn_id) {
     SizeT remove_n = compacting_segments_map_.erase(txn_id);
     if (remove_n != 1) {
@@ -136,7 +191,38 @@ Vector<SegmentEntry *> DBTCompactionAlg::CheckCompaction(TransactionID txn_id) {
             return compact_segments;
         }
     }
-    return {};
+    return CheckDeleteCompaction(txn_id);
+}
+
+Vector<SegmentEntry *> DBTCompactionAlg::CheckDeleteCompaction(TransactionID txn_id) {
+    if (delete_ratio_ <= 0) {
+        return {};
+    }
+    // rewriting a segment rebuilds all its indexes, so the more expensive the indexes, the more deleted rows are required
+    f64 delete_ratio = std::min(delete_ratio_ * std::sqrt(index_rebuild_cost_.load()), DBT_COMPACTION_MAX_DELETE_RATIO);
+
+    int pick_layer = -1;
+    f64 max_delete_ratio = delete_ratio;
+    for (int layer = 0; layer < (int)segment_layers_.size(); ++layer) {
+        f64 layer_delete_ratio = segment_layers_[layer].MaxDeleteRatio();
+        if (layer_delete_ratio >= max_delete_ratio) {
+            max_delete_ratio = layer_delete_ratio;
+            pick_layer = layer;
+        }
+    }
+    if (pick_layer == -1) {
+        return {};
+    }
+    SegmentEntry *segment_entry = segment_layers_[pick_layer].PickMostDeleted(txn_id, delete_ratio);
+    if (segment_entry == nullptr) {
+        return {};
+    }
+    LOG_DEBUG(fmt::format("Rewrite segment {} alone, delete ratio: {}", segment_entry->segment_id(), max_delete_ratio));
+    if (++running_task_n_ == 1) {
+        status_ = CompactionStatus::kRunning;
+    }
+    txn_2_layer_.emplace(txn_id, pick_layer);
+    return {segment_entry};
 }
 
 void DBTCompactionAlg::AddSegment(SegmentEntry *new_segment) {
@@ -61,6 +61,12 @@ public:
 
     Vector<SegmentEntry *> PickCompacting(TransactionID txn_id, SizeT M, SizeT layer);
 
+    // Pick the segment with the highest delete ratio no less than `delete_ratio` to be rewritten alone
+    SegmentEntry *PickMostDeleted(TransactionID txn_id, f64 delete_ratio);
+
+    // Return the max delete ratio of segments in this layer
+    f64 MaxDeleteRatio() const;
+
     void CommitCompact(TransactionID txn_id);
 
     void RollbackCompact(TransactionID txn_id);
@@ -74,10 +80,17 @@ private:
     HashMap<TransactionID, Vector<SegmentEntry *>> compacting_segments_map_;
 };
 
+/*
+    Segments are grouped into layers by row count. When a layer holds `m` segments, `m` of them are merged into one segment of a higher layer.
+    Small, old and heavily deleted segments are picked first.
+    Besides, a segment whose delete ratio exceeds `delete_ratio` is rewritten alone. The threshold grows with the index rebuild cost of the
+    table, so that tables with expensive indexes (e.g. HNSW) are not rewritten for a few deleted rows. 0 `delete_ratio` disables it.
+*/
 export class DBTCompactionAlg final : public CompactionAlg {
 public:
-    DBTCompactionAlg(int m, int c, int s, SizeT max_segment_capacity, TableEntry *table_entry = nullptr)
-        : CompactionAlg(), config_(m, c, s), max_segment_capacity_(max_segment_capacity), table_entry_(table_entry), running_task_n_(0) {}
+    DBTCompactionAlg(int m, int c, int s, SizeT max_segment_capacity, TableEntry *table_entry = nullptr, f64 delete_ratio = 0)
+        : CompactionAlg(), config_(m, c, s), max_segment_capacity_(max_segment_capacity), delete_ratio_(delete_ratio), table_entry_(table_entry),
+          running_task_n_(0) {}
 
     virtual Vector<SegmentEntry *> CheckCompaction(TransactionID txn_id) override;
 
@@ -99,9 +112,13 @@ private:
 
     Pair<SegmentEntry *, int> FindSegmentAndLayer(SegmentID segment_id);
 
+    // return empty if no segment is deleted enough
+    Vector<SegmentEntry *> CheckDeleteCompaction(TransactionID txn_id);
+
 private:
     const DBTConfig config_;
     const SizeT max_segment_capacity_;
+    const f64 delete_ratio_;
     TableEntry *table_entry_;
 
     std::mutex mtx_;
@@ -19,6 +19,8 @@ export module compaction_alg;
 import stl;
 import segment_entry;
 import txn;
+import create_index_info;
+import default_values;
 
 namespace infinity {
 
@@ -28,6 +30,21 @@ export enum class CompactionStatus : u8 {
     kRunning,
 };
 
+// Relative cost of rebuilding one row of the index when the row is moved by compaction
+export inline f64 CompactionIndexCost(IndexType index_type) {
+    switch (index_type) {
+        case IndexType::kSecondary:
+        case IndexType::kBitmap:
+            return COMPACTION_SECONDARY_INDEX_COST;
+        case IndexType::kFullText:
+            return COMPACTION_FULLTEXT_INDEX_COST;
+        case IndexType::kHnsw:
+            return COMPACTION_HNSW_INDEX_COST;
+        default:
+            return COMPACTION_OTHER_INDEX_COST;
+    }
+}
+
 /*
     This is the algorithm to select segments to compact.
     When booting the system, call init to construct the algorithm structure
@@ -69,8 +86,13 @@ public:
 
     CompactionStatus status() const { return status_; }
 
+    // Cost of copying one row plus rebuilding all its indexes, relative to copying only. Updated before `CheckCompaction`
+    void SetIndexRebuildCost(f64 index_rebuild_cost) { index_rebuild_cost_ = index_rebuild_cost; }
+
 protected:
     CompactionStatus status_;
+
+    Atomic<f64> index_rebuild_cost_{1};
 };
 
 } // namespace infinity
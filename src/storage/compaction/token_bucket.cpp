@@ -0,0 +1,71 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <thread>
+
+module token_bucket;
+
+import stl;
+
+namespace infinity {
+
+TokenBucket::TokenBucket(i64 rate) : rate_(rate), tokens_(rate), last_refill_(std::chrono::steady_clock::now()) {}
+
+void TokenBucket::Refill(std::chrono::steady_clock::time_point now) {
+    i64 rate = rate_.load();
+    auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(now - last_refill_).count();
+    if (elapsed_us <= 0) {
+        return;
+    }
+    i64 refill = static_cast<i64>(static_cast<f64>(rate) * elapsed_us / 1000000);
+    if (refill == 0) {
+        return; // keep last_refill_ so that the fraction is not lost
+    }
+    tokens_ = std::min(rate, tokens_ + refill);
+    last_refill_ = now;
+}
+
+void TokenBucket::Acquire(SizeT tokens) {
+    i64 remain = tokens;
+    while (remain > 0) {
+        i64 rate = rate_.load();
+        if (rate <= 0) {
+            return;
+        }
+        i64 wait_us = 0;
+        {
+            std::unique_lock lock(mtx_);
+            Refill(std::chrono::steady_clock::now());
+            i64 request = std::min(remain, rate);
+            if (tokens_ >= request) {
+                tokens_ -= request;
+                remain -= request;
+                continue;
+            }
+            wait_us = (request - tokens_) * 1000000 / rate + 1;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+    }
+}
+
+void TokenBucket::SetRate(i64 rate) {
+    std::unique_lock lock(mtx_);
+    rate_.store(rate);
+    tokens_ = std::min(tokens_, rate);
+    last_refill_ = std::chrono::steady_clock::now();
+}
+
+} // namespace infinity
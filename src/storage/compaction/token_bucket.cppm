@@ -0,0 +1,53 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module token_bucket;
+
+import stl;
+
+namespace infinity {
+
+/*
+    Rate limiter shared by background jobs (compaction, index rebuild during compaction).
+    `rate` is the number of tokens (bytes) refilled per second, and the bucket holds at most one second of tokens.
+    A rate of 0 means unlimited, `Acquire` returns immediately.
+    `Acquire` sleeps, so it is called by the compaction thread before a task is scheduled, not by the scheduler workers.
+    `SetRate` can be called at any time, e.g. from `SET GLOBAL compaction_io_limit`.
+*/
+export class TokenBucket {
+public:
+    explicit TokenBucket(i64 rate);
+
+    // Block the caller until `tokens` tokens are available. A request larger than the bucket is served in slices.
+    void Acquire(SizeT tokens);
+
+    void SetRate(i64 rate);
+
+    i64 rate() const { return rate_.load(); }
+
+private:
+    // called when lock held
+    void Refill(std::chrono::steady_clock::time_point now);
+
+private:
+    Atomic<i64> rate_{};
+
+    std::mutex mtx_;
+    i64 tokens_{};
+    std::chrono::steady_clock::time_point last_refill_{};
+};
+
+} // namespace infinity
@@ -38,18 +38,27 @@ import bg_query_state;
 import txn_store;
 import memindex_tracer;
 import segment_entry;
+import column_def;
+import data_type;
 
 namespace infinity {
 
-CompactionProcessor::CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr) : catalog_(catalog), txn_mgr_(txn_mgr) {}
+CompactionProcessor::CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr, i64 io_limit)
+    : catalog_(catalog), txn_mgr_(txn_mgr), throttle_(io_limit) {}
 
 void CompactionProcessor::Start() {
     LOG_INFO("Compaction processor is started.");
     processor_thread_ = Thread([this] { Process(); });
+    compact_thread_ = Thread([this] { CompactProcess(); });
 }
 
 void CompactionProcessor::Stop() {
     LOG_INFO("Compaction processor is stopping.");
+    SharedPtr<StopProcessorTask> stop_compact_task = MakeShared<StopProcessorTask>();
+    compact_task_queue_.Enqueue(stop_compact_task);
+    stop_compact_task->Wait();
+    compact_thread_.join();
+
     SharedPtr<StopProcessorTask> stop_task = MakeShared<StopProcessorTask>();
     this->Submit(stop_task);
     stop_task->Wait();
@@ -74,6 +83,9 @@ void CompactionProcessor::DoCompact() {
     Vector<Pair<UniquePtr<BaseStatement>, Txn *>> statements = this->ScanForCompact(scan_txn);
     Vector<Pair<BGQueryContextWrapper, BGQueryState>> wrappers;
     for (const auto &[statement, txn] : statements) {
+        // Pay for the whole task before it runs. Its operators run in the shared scheduler workers, which must not
+        // sleep for the limit since the queries of the users run there too.
+        throttle_.Acquire(CompactionIOSize(statement.get(), txn));
         BGQueryContextWrapper wrapper(txn);
         BGQueryState state;
         bool res = wrapper.query_context_->ExecuteBGStatement(statement.get(), state);
@@ -107,6 +119,21 @@ CompactionProcessor::ManualDoCompact(const String &schema_name, const String &ta
     return out_commit_ts;
 }
 
+SizeT CompactionProcessor::CompactionIOSize(const BaseStatement *statement, Txn *txn) const {
+    const auto *compact_statement = static_cast<const AutoCompactStatement *>(statement);
+    TableEntry *table_entry = compact_statement->table_entry_;
+    SizeT row_size = 0;
+    for (ColumnID column_id = 0; column_id < table_entry->ColumnCount(); ++column_id) {
+        row_size += table_entry->GetColumnDefByID(column_id)->type()->Size();
+    }
+    SizeT row_count = 0;
+    for (const SegmentEntry *segment_entry : compact_statement->compactible_segments_) {
+        row_count += segment_entry->actual_row_count();
+    }
+    // rows moved by the compaction, weighted by the cost of rebuilding their indexes
+    return static_cast<SizeT>(row_count * row_size * table_entry->CompactionIndexRebuildCost(txn->TxnID(), txn->BeginTS()));
+}
+
 Vector<Pair<UniquePtr<BaseStatement>, Txn *>> CompactionProcessor::ScanForCompact(Txn *scan_txn) {
 
     Vector<Pair<UniquePtr<BaseStatement>, Txn *>> compaction_tasks;
@@ -114,12 +141,13 @@ Vector<Pair<UniquePtr<BaseStatement>, Txn *>> CompactionProcessor::ScanForCompac
     TxnTimeStamp begin_ts = scan_txn->BeginTS();
     Vector<DBEntry *> db_entries = catalog_->Databases(txn_id, begin_ts);
     for (auto *db_entry : db_entries) {
-        Vector<TableEntry *> table_entries = db_entry->TableCollections(txn_id, begin_ts);
+        // The tables not loaded since the startup are not changed, they are compacted once loaded
+        Vector<TableEntry *> table_entries = db_entry->TableCollections(txn_id, begin_ts, true /*loaded_only*/);
         for (auto *table_entry : table_entries) {
             while (true) {
                 Txn *txn = txn_mgr_->BeginTxn(MakeUnique<String>("Compact"));
                 TransactionID txn_id = txn->TxnID();
-                auto compact_segments = table_entry->CheckCompaction(txn_id);
+                auto compact_segments = table_entry->CheckCompaction(txn_id, txn->BeginTS());
                 if (compact_segments.empty()) {
                     txn_mgr_->RollBackTxn(txn);
                     break;
@@ -145,7 +173,7 @@ void CompactionProcessor::ScanAndOptimize() {
 
     Vector<DBEntry *> db_entries = catalog_->Databases(txn_id, begin_ts);
     for (auto *db_entry : db_entries) {
-        Vector<TableEntry *> table_entries = db_entry->TableCollections(txn_id, begin_ts);
+        Vector<TableEntry *> table_entries = db_entry->TableCollections(txn_id, begin_ts, true /*loaded_only*/);
         for (auto *table_entry : table_entries) {
             table_entry->OptimizeIndex(opt_txn);
         }
@@ -191,6 +219,7 @@ void CompactionProcessor::Process() {
     while (running) {
         Deque<SharedPtr<BGTask>> tasks;
         task_queue_.DequeueBulk(tasks);
+        SizeT done_count = 0;
         for (const auto &bg_task : tasks) {
             switch (bg_task->type_) {
                 case BGTaskType::kStopProcessor: {
@@ -198,10 +227,9 @@ void CompactionProcessor::Process() {
                     break;
                 }
                 case BGTaskType::kNotifyCompact: {
-                    LOG_DEBUG("Do compact start.");
-                    DoCompact();
-                    LOG_DEBUG("Do compact end.");
-                    break;
+                    // completed by the compaction thread
+                    compact_task_queue_.Enqueue(bg_task);
+                    continue;
                 }
                 case BGTaskType::kNotifyOptimize: {
                     LOG_DEBUG("Optimize start.");
@@ -223,8 +251,42 @@ void CompactionProcessor::Process() {
                 }
             }
             bg_task->Complete();
+            ++done_count;
+        }
+        task_count_ -= done_count;
+        tasks.clear();
+    }
+}
+
+void CompactionProcessor::CompactProcess() {
+    bool running = true;
+    while (running) {
+        Deque<SharedPtr<BGTask>> tasks;
+        compact_task_queue_.DequeueBulk(tasks);
+        SizeT done_count = 0;
+        for (const auto &bg_task : tasks) {
+            switch (bg_task->type_) {
+                case BGTaskType::kStopProcessor: {
+                    running = false;
+                    bg_task->Complete();
+                    continue;
+                }
+                case BGTaskType::kNotifyCompact: {
+                    LOG_DEBUG("Do compact start.");
+                    DoCompact();
+                    LOG_DEBUG("Do compact end.");
+                    break;
+                }
+                default: {
+                    String error_message = fmt::format("Invalid compaction task: {}", (u8)bg_task->type_);
+                    UnrecoverableError(error_message);
+                    break;
+                }
+            }
+            bg_task->Complete();
+            ++done_count;
         }
-        task_count_ -= tasks.size();
+        task_count_ -= done_count;
         tasks.clear();
     }
 }
@@ -21,6 +21,7 @@ import txn;
 import bg_task;
 import blocking_queue;
 import base_statement;
+import token_bucket;
 
 namespace infinity {
 
@@ -30,7 +31,7 @@ class SessionManager;
 
 export class CompactionProcessor {
 public:
-    CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr);
+    CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr, i64 io_limit = 0);
 
     void Start();
 
@@ -42,6 +43,9 @@ public:
 
     u64 RunningTaskCount() const { return task_count_; }
 
+    // Shared by all background compaction and index rebuild of compaction, in bytes per second
+    TokenBucket *throttle() { return &throttle_; }
+
     TxnTimeStamp ManualDoCompact(const String &schema_name,
                                  const String &table_name,
                                  bool rollback,
@@ -54,18 +58,28 @@ private:
 
     void DoDump(DumpIndexTask *dump_task);
 
+    // Estimated bytes a compaction task reads and writes, including the index rebuild
+    SizeT CompactionIOSize(const BaseStatement *statement, Txn *txn) const;
+
     void Process();
 
+    // Runs the compaction tasks, which wait for the IO limit here instead of in the scheduler workers running the compaction
+    void CompactProcess();
+
 private:
     BlockingQueue<SharedPtr<BGTask>> task_queue_;
+    BlockingQueue<SharedPtr<BGTask>> compact_task_queue_;
 
     Thread processor_thread_{};
+    Thread compact_thread_{};
 
     Catalog *catalog_{};
     TxnManager *txn_mgr_{};
     SessionManager *session_mgr_{};
 
     Atomic<u64> task_count_{};
+
+    TokenBucket throttle_;
 };
 
 } // namespace infinity
\ No newline at end of file
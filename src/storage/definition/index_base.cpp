@@ -26,6 +26,7 @@ import index_hnsw;
 import index_diskann;
 import index_full_text;
 import index_secondary;
+import index_bitmap;
 import index_emvb;
 import index_bmp;
 import bmp_util;
@@ -153,6 +154,10 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(char *&ptr, int32_t maxbytes) {
             res = MakeShared<IndexSecondary>(index_name, file_name, std::move(column_names));
             break;
         }
+        case IndexType::kBitmap: {
+            res = MakeShared<IndexBitmap>(index_name, file_name, std::move(column_names));
+            break;
+        }
         case IndexType::kEMVB: {
             u32 residual_pq_subspace_num = ReadBufAdv<u32>(ptr);
             u32 residual_pq_subspace_bits = ReadBufAdv<u32>(ptr);
@@ -253,6 +258,11 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
+        case IndexType::kBitmap: {
+            auto ptr = MakeShared<IndexBitmap>(index_name, file_name, std::move(column_names));
+            res = std::static_pointer_cast<IndexBase>(ptr);
+            break;
+        }
         case IndexType::kEMVB: {
             u32 residual_pq_subspace_num = index_def_json["pq_subspace_num"];
             u32 residual_pq_subspace_bits = index_def_json["pq_subspace_bits"];
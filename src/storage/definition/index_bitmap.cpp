@@ -0,0 +1,31 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module index_bitmap;
+
+import stl;
+import base_table_ref;
+import index_secondary;
+
+namespace infinity {
+
+void IndexBitmap::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) {
+    IndexSecondary::ValidateColumnDataType(base_table_ref, column_name);
+}
+
+String IndexBitmap::BuildOtherParamsString() const { return ""; }
+
+} // namespace infinity
@@ -42,6 +42,10 @@ HnswEncodeType StringToHnswEncodeType(const String &str) {
         return HnswEncodeType::kPlain;
     } else if (str == "lvq") {
         return HnswEncodeType::kLVQ;
+    } else if (str == "lvq4") {
+        return HnswEncodeType::kLVQ4;
+    } else if (str == "rabitq") {
+        return HnswEncodeType::kRabitq;
     } else {
         return HnswEncodeType::kInvalid;
     }
@@ -53,6 +57,10 @@ String HnswEncodeTypeToString(HnswEncodeType encode_type) {
             return "plain";
         case HnswEncodeType::kLVQ:
             return "lvq";
+        case HnswEncodeType::kLVQ4:
+            return "lvq4";
+        case HnswEncodeType::kRabitq:
+            return "rabitq";
         default:
             return "invalid";
     }
@@ -173,11 +181,16 @@ void IndexHnsw::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table
     SharedPtr<EmbeddingInfo> embedding_info = std::dynamic_pointer_cast<EmbeddingInfo>(data_type_ptr->type_info());
     EmbeddingDataType embedding_data_type = embedding_info->Type();
     for (const auto *param : index_param_list) {
-        if (param->param_name_ == "encode" && StringToHnswEncodeType(param->param_value_) == HnswEncodeType::kLVQ) {
+        if (param->param_name_ != "encode") {
+            continue;
+        }
+        if (HnswEncodeType encode_type = StringToHnswEncodeType(param->param_value_);
+            encode_type != HnswEncodeType::kPlain && encode_type != HnswEncodeType::kInvalid) {
             // TODO: now only support float?
             if (embedding_data_type != EmbeddingDataType::kElemFloat) {
                 Status status =
-                    Status::InvalidIndexDefinition(fmt::format("Attempt to create HNSW index with LVQ encoding on column: {}, data type: {}.",
+                    Status::InvalidIndexDefinition(fmt::format("Attempt to create HNSW index with {} encoding on column: {}, data type: {}.",
+                                                               HnswEncodeTypeToString(encode_type),
                                                                column_name,
                                                                data_type_ptr->ToString()));
                 RecoverableError(status);
@@ -30,6 +30,10 @@ namespace infinity {
 export enum class HnswEncodeType {
     kPlain,
     kLVQ,
+    // 4-bit LVQ
+    kLVQ4,
+    // one bit per dimension, RaBitQ-like
+    kRabitq,
     kInvalid,
 };
 
@@ -22,6 +22,7 @@ import inmem_position_list_decoder;
 import skiplist_reader;
 import internal_types;
 import third_party;
+import profiler;
 
 namespace infinity {
 
@@ -64,6 +65,7 @@ bool MultiPostingDecoder::DecodeCurrentDocIDBuffer(docid_t *doc_buffer) {
     if (need_decode_doc_id_) {
         index_decoder_->DecodeCurrentDocIDBuffer(doc_buffer);
         need_decode_doc_id_ = false;
+        ++ThreadProfileCounters().posting_blocks_decoded_;
         return true;
     }
     return false;
@@ -112,6 +112,23 @@ Pair<bool, RowID> PostingIterator::PeekInBlockRange(RowID doc_id, RowID doc_id_n
     return {false, INVALID_ROWID};
 }
 
+u32 PostingIterator::DecodeCurrentBlock(RowID *doc_ids, tf_t *tfs) {
+    assert(finish_decode_docid_ && current_row_id_ != INVALID_ROWID);
+    RowID row_id = last_doc_id_in_prev_block_;
+    u32 doc_count = 0;
+    do {
+        row_id += doc_buffer_[doc_count];
+        doc_ids[doc_count++] = row_id;
+    } while (row_id < last_doc_id_in_current_block_ && doc_count < MAX_DOC_PER_RECORD);
+    if (posting_option_.HasTfList()) {
+        DecodeTFBuffer();
+        std::copy_n(tf_buffer_, doc_count, tfs);
+    } else {
+        std::fill_n(tfs, doc_count, 0);
+    }
+    return doc_count;
+}
+
 void PostingIterator::MoveToCurrentDoc(bool fetch_position) {
     need_move_to_current_doc_ = false;
     in_doc_pos_iter_inited_ = false;
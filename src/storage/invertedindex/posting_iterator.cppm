@@ -49,6 +49,10 @@ public:
 
     void SeekPosition(pos_t pos, pos_t &result);
 
+    // Decode all docs of the current block, which must have been reached by SeekDoc.
+    // `doc_ids` and `tfs` must hold MAX_DOC_PER_RECORD items, return the doc count of the block.
+    u32 DecodeCurrentBlock(RowID *doc_ids, tf_t *tfs);
+
     docpayload_t GetCurrentDocPayload() {
         if (current_row_id_ == INVALID_ROWID) [[unlikely]] {
             return 0;
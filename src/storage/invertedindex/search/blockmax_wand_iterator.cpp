@@ -20,7 +20,7 @@ module blockmax_wand_iterator;
 import stl;
 import third_party;
 import index_defines;
-import term_doc_iterator;
+import doc_iterator;
 import multi_doc_iterator;
 import internal_types;
 import logger;
@@ -48,11 +48,11 @@ BlockMaxWandIterator::BlockMaxWandIterator(Vector<UniquePtr<DocIterator>> &&iter
     bm25_score_upper_bound_ = 0.0f;
     SizeT num_iterators = children_.size();
     for (SizeT i = 0; i < num_iterators; i++){
-        TermDocIterator *tdi = dynamic_cast<TermDocIterator *>(children_[i].get());
-        if (tdi == nullptr)
+        DocIterator *it = children_[i].get();
+        if (const auto type = it->GetType(); type != DocIteratorType::kTermDocIterator && type != DocIteratorType::kPhraseIterator)
             continue;
-        bm25_score_upper_bound_ += tdi->BM25ScoreUpperBound();
-        sorted_iterators_.push_back(tdi);
+        bm25_score_upper_bound_ += it->BM25ScoreUpperBound();
+        sorted_iterators_.push_back(it);
     }
     next_sum_score_bm_low_cnt_dist_.resize(100, 0);
     backup_iterators_.reserve(sorted_iterators_.size());
@@ -17,7 +17,7 @@ module;
 export module blockmax_wand_iterator;
 import stl;
 import index_defines;
-import term_doc_iterator;
+import doc_iterator;
 import multi_doc_iterator;
 import internal_types;
 
@@ -43,8 +43,8 @@ private:
     RowID common_block_min_possible_doc_id_{}; // not always exist
     RowID common_block_last_doc_id_{};
     float common_block_max_bm25_score_{};
-    Vector<TermDocIterator *> sorted_iterators_; // sort by DocID(), in ascending order
-    Vector<TermDocIterator *> backup_iterators_;
+    Vector<DocIterator *> sorted_iterators_; // TermDocIterator or PhraseDocIterator, sort by DocID(), in ascending order
+    Vector<DocIterator *> backup_iterators_;
     SizeT pivot_;
     // bm25 score cache
     bool bm25_score_cached_ = false;
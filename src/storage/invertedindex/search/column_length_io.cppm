@@ -49,6 +49,23 @@ public:
         return SeekFile(row_id);
     }
 
+    // Column lengths of ascending `row_ids`, a posting block usually lies in one chunk and is copied without checking each row
+    inline void GetColumnLengths(const RowID *row_ids, u32 row_count, u32 *column_lengths) {
+        if (row_count == 0) {
+            return;
+        }
+        column_lengths[0] = GetColumnLength(row_ids[0]);
+        if (row_ids[row_count - 1] < current_chunk_base_rowid_ + current_chunk_row_count_ && row_ids[0] >= current_chunk_base_rowid_) [[likely]] {
+            for (u32 i = 1; i < row_count; ++i) {
+                column_lengths[i] = column_lengths_[row_ids[i] - current_chunk_base_rowid_];
+            }
+            return;
+        }
+        for (u32 i = 1; i < row_count; ++i) {
+            column_lengths[i] = GetColumnLength(row_ids[i]);
+        }
+    }
+
     inline u64 GetTotalDF() const { return total_df_; }
     inline float GetAvgColumnLength() const { return avg_column_len_; }
 
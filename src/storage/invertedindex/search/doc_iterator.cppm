@@ -73,6 +73,14 @@ public:
 
     virtual void UpdateScoreThreshold(float threshold) = 0;
 
+    // Block max interface used by BlockMaxWandIterator, implemented by TermDocIterator and PhraseDocIterator.
+    // The defaults treat the whole posting list as one block of a single doc, which is always correct but never skips.
+    virtual RowID BlockLastDocID() const { return doc_id_; }
+
+    virtual float BlockMaxBM25Score() { return BM25ScoreUpperBound(); }
+
+    virtual bool NextShallow(RowID doc_id) { return Next(doc_id); }
+
     // print the query tree, for debugging
     virtual void PrintTree(std::ostream &os, const String &prefix = "", bool is_final = true) const = 0;
 
@@ -10,6 +10,7 @@ import doc_iterator;
 import internal_types;
 import third_party;
 import posting_iterator;
+import index_defines;
 import column_length_io;
 import logger;
 
@@ -25,10 +26,18 @@ void PhraseDocIterator::InitBM25Info(UniquePtr<FullTextColumnLengthReader> &&col
     float avg_column_len = column_length_reader_->GetAvgColumnLength();
     float smooth_idf = std::log(1.0F + (total_df - estimate_doc_freq_ + 0.5F) / (estimate_doc_freq_ + 0.5F));
     bm25_common_score_ = weight_ * smooth_idf * (k1 + 1.0F);
-    bm25_score_upper_bound_ = bm25_common_score_ / (1.0F + k1 * b / avg_column_len);
+    if (slop_ == 0) {
+        bm25_score_upper_bound_ = bm25_common_score_ / (1.0F + k1 * b / avg_column_len);
+    } else {
+        // the sloppy phrase freq is not bounded by the doc length
+        bm25_score_upper_bound_ = bm25_common_score_;
+    }
+    f1 = k1 * (1.0F - b);
+    f2 = k1 * b / avg_column_len;
+    f3 = f2 * std::numeric_limits<u16>::max();
     if (SHOULD_LOG_TRACE()) {
         OStringStream oss;
-        oss << "TermDocIterator: ";
+        oss << "PhraseDocIterator: ";
         if (column_name_ptr_ != nullptr) {
             oss << "column: " << *column_name_ptr_ << ",";
         }
@@ -44,6 +53,64 @@ void PhraseDocIterator::InitBM25Info(UniquePtr<FullTextColumnLengthReader> &&col
     }
 }
 
+RowID PhraseDocIterator::BlockLastDocID() const {
+    RowID last_doc_id = INVALID_ROWID;
+    for (const auto &it : pos_iters_) {
+        last_doc_id = std::min(last_doc_id, it->BlockLastDocID());
+    }
+    return last_doc_id;
+}
+
+float PhraseDocIterator::BlockMaxBM25Score() {
+    if (slop_ != 0) {
+        return BM25ScoreUpperBound();
+    }
+    u32 block_max_tf = std::numeric_limits<u32>::max();
+    u16 block_max_percentage_u16 = std::numeric_limits<u16>::max();
+    for (const auto &it : pos_iters_) {
+        const auto [tf, percentage_u16] = it->GetBlockMaxInfo();
+        block_max_tf = std::min(block_max_tf, tf);
+        block_max_percentage_u16 = std::min(block_max_percentage_u16, percentage_u16);
+    }
+    return bm25_common_score_ / (1.0F + f1 / block_max_tf + f3 / block_max_percentage_u16);
+}
+
+bool PhraseDocIterator::NextShallow(RowID doc_id) {
+    if (threshold_ > BM25ScoreUpperBound()) [[unlikely]] {
+        doc_id_ = INVALID_ROWID;
+        return false;
+    }
+    while (true) {
+        for (const auto &it : pos_iters_) {
+            if (!it->SkipTo(doc_id)) {
+                doc_id_ = INVALID_ROWID;
+                return false;
+            }
+        }
+        if (threshold_ <= 0.0f || BlockMaxBM25Score() > threshold_) {
+            return true;
+        }
+        doc_id = BlockLastDocID() + 1;
+    }
+}
+
+float PhraseDocIterator::DocMaxBM25Score(RowID doc_id) {
+    if (slop_ != 0) {
+        return BM25ScoreUpperBound();
+    }
+    tf_t max_tf = std::numeric_limits<tf_t>::max();
+    for (const auto &it : pos_iters_) {
+        max_tf = std::min(max_tf, it->GetCurrentTF());
+    }
+    if (max_tf == 0) [[unlikely]] {
+        // no tf list
+        return BM25ScoreUpperBound();
+    }
+    const float tf = max_tf;
+    const auto doc_len = column_length_reader_->GetColumnLength(doc_id);
+    return bm25_common_score_ * tf / (tf + f1 + f2 * doc_len);
+}
+
 bool PhraseDocIterator::Next(RowID doc_id) {
     assert(doc_id != INVALID_ROWID);
     if (doc_id_ != INVALID_ROWID && doc_id_ >= doc_id)
@@ -51,6 +118,9 @@ bool PhraseDocIterator::Next(RowID doc_id) {
     assert(pos_iters_.size() > 0);
     RowID target_doc_id = doc_id;
     do {
+        if (threshold_ > 0.0f && !NextShallow(target_doc_id)) {
+            return false;
+        }
         for (const auto &it : pos_iters_) {
             target_doc_id = it->SeekDoc(target_doc_id);
             if (target_doc_id == INVALID_ROWID) {
@@ -59,10 +129,15 @@ bool PhraseDocIterator::Next(RowID doc_id) {
             }
         }
         if (target_doc_id == pos_iters_[0]->DocID()) {
-            bool found = GetPhraseMatchData();
-            if (found && (threshold_ <= 0.0f || BM25Score() > threshold_)) {
-                doc_id_ = target_doc_id;
-                return true;
+            // positions are decoded only if the tf of the terms can beat the threshold
+            if (threshold_ <= 0.0f || DocMaxBM25Score(target_doc_id) > threshold_) {
+                bool found = GetPhraseMatchData();
+                if (found) {
+                    doc_id_ = target_doc_id;
+                    if (threshold_ <= 0.0f || BM25Score() > threshold_) {
+                        return true;
+                    }
+                }
             }
             target_doc_id++;
         }
@@ -35,6 +35,15 @@ public:
 
     void InitBM25Info(UniquePtr<FullTextColumnLengthReader> &&column_length_reader);
 
+    // An exact phrase occurs in a doc no more often than its rarest term, so the block max info of the term postings
+    // bounds the phrase score over the intersection of their current blocks, which ends at BlockLastDocID().
+    // A sloppy phrase has no such bound and reports its upper bound for every block.
+    RowID BlockLastDocID() const override;
+    float BlockMaxBM25Score() override;
+
+    // Same contract as TermDocIterator::NextShallow, decode skip_list of every term only.
+    bool NextShallow(RowID doc_id) override;
+
     DocIteratorType GetType() const override { return DocIteratorType::kPhraseIterator; }
     String Name() const override { return "PhraseDocIterator"; }
 
@@ -63,6 +72,10 @@ private:
     }
     bool GetExactPhraseMatchData();
     bool GetSloppyPhraseMatchData();
+
+    // Score bound of the candidate doc from the tf of every term, checked before decoding positions
+    float DocMaxBM25Score(RowID doc_id);
+
     Vector<UniquePtr<PostingIterator>> pos_iters_;
     float weight_;
     u32 slop_{};
@@ -506,9 +506,13 @@ OrQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_read
     Vector<std::unique_ptr<DocIterator>> sub_doc_iters;
     sub_doc_iters.reserve(children_.size());
     bool all_are_term = true;
+    bool all_are_term_or_phrase = true;
     for (auto &child : children_) {
         if (child->GetType() != QueryNodeType::TERM) {
             all_are_term = false;
+            if (child->GetType() != QueryNodeType::PHRASE) {
+                all_are_term_or_phrase = false;
+            }
         }
         auto iter = child->CreateSearch(table_entry, index_reader, early_term_algo);
         if (iter) {
@@ -520,7 +524,7 @@ OrQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_read
     } else if (sub_doc_iters.size() == 1) {
         return std::move(sub_doc_iters[0]);
     } else {
-        if (all_are_term && early_term_algo == EarlyTermAlgo::kBMW)
+        if (all_are_term_or_phrase && early_term_algo == EarlyTermAlgo::kBMW)
             return MakeUnique<BlockMaxWandIterator>(std::move(sub_doc_iters));
         else if (all_are_term && early_term_algo == EarlyTermAlgo::kBMM)
             return MakeUnique<BlockMaxMaxscoreIterator>(std::move(sub_doc_iters));
@@ -119,15 +119,41 @@ float TermDocIterator::BM25Score() {
     }
     calc_score_cnt_++;
     bm25_score_cache_docid_ = doc_id_;
-    // bm25_common_score_ * tf / (tf + k1 * (1.0F - b + b * column_len / avg_column_len));
+    if (threshold_ <= 0.0f) {
+        if (block_scores_.get() == nullptr || block_scores_->last_doc_id_ != BlockLastDocID()) {
+            ScoreCurrentBlock();
+        }
+        const RowID *doc_ids_end = block_scores_->doc_ids_ + block_scores_->doc_count_;
+        const RowID *doc_id_ptr = std::lower_bound(block_scores_->doc_ids_, doc_ids_end, doc_id_);
+        if (doc_id_ptr != doc_ids_end && *doc_id_ptr == doc_id_) [[likely]] {
+            SizeT i = doc_id_ptr - block_scores_->doc_ids_;
+            bm25_score_cache_ = block_scores_->scores_[i];
+            term_freq_ += block_scores_->tfs_[i];
+            return bm25_score_cache_;
+        }
+    }
     const auto tf = iter_->GetCurrentTF();
     const auto doc_len = column_length_reader_->GetColumnLength(doc_id_);
-    const float p = f1 + f2 * doc_len;
-    bm25_score_cache_ = bm25_common_score_ * tf / (tf + p);
+    bm25_score_cache_ = BM25TermScore(tf, doc_len);
     term_freq_ += tf;
     return bm25_score_cache_;
 }
 
+void TermDocIterator::ScoreCurrentBlock() {
+    if (block_scores_.get() == nullptr) {
+        block_scores_ = MakeUnique<BlockScores>();
+    }
+    BlockScores &block = *block_scores_;
+    block.last_doc_id_ = BlockLastDocID();
+    block.doc_count_ = iter_->DecodeCurrentBlock(block.doc_ids_, block.tfs_);
+    column_length_reader_->GetColumnLengths(block.doc_ids_, block.doc_count_, block.column_lengths_);
+    // no dependency between docs, vectorized by the compiler
+    const u32 doc_count = block.doc_count_;
+    for (u32 i = 0; i < doc_count; ++i) {
+        block.scores_[i] = BM25TermScore(block.tfs_[i], block.column_lengths_[i]);
+    }
+}
+
 void TermDocIterator::PrintTree(std::ostream &os, const String &prefix, bool is_final) const {
     os << prefix;
     os << (is_final ? "└──" : "├──");
@@ -47,14 +47,14 @@ public:
     void InitBM25Info(UniquePtr<FullTextColumnLengthReader> &&column_length_reader);
 
     RowID BlockMinPossibleDocID() const { return iter_->BlockLowestPossibleDocID(); }
-    RowID BlockLastDocID() const { return iter_->BlockLastDocID(); }
-    float BlockMaxBM25Score();
+    RowID BlockLastDocID() const override { return iter_->BlockLastDocID(); }
+    float BlockMaxBM25Score() override;
 
     // Move block cursor to ensure its last_doc_id is no less than given doc_id.
     // Returns false and update doc_id_ to INVALID_ROWID if the iterator is exhausted.
     // Note that this routine decode skip_list only, and doesn't update doc_id_ when returns true.
     // Caller may invoke BlockMaxBM25Score() after this routine.
-    bool NextShallow(RowID doc_id);
+    bool NextShallow(RowID doc_id) override;
 
     // Overriden methods
     DocIteratorType GetType() const override { return DocIteratorType::kTermDocIterator; }
@@ -79,6 +79,25 @@ public:
 private:
     Pair<tf_t, u32> GetScoreData();
 
+    // Without a score threshold every doc of a posting block is scored, so score the block at once
+    void ScoreCurrentBlock();
+
+    // bm25_common_score_ * tf / (tf + k1 * (1.0F - b + b * column_len / avg_column_len)), shared by the per-doc and the block
+    // scoring so both evaluate it in the same order and give the same scores
+    inline float BM25TermScore(const float tf, const float column_len) const {
+        const float p = f1 + f2 * column_len;
+        return bm25_common_score_ * tf / (tf + p);
+    }
+
+    struct BlockScores {
+        RowID last_doc_id_ = INVALID_ROWID;
+        u32 doc_count_ = 0;
+        RowID doc_ids_[MAX_DOC_PER_RECORD];
+        tf_t tfs_[MAX_DOC_PER_RECORD];
+        u32 column_lengths_[MAX_DOC_PER_RECORD];
+        float scores_[MAX_DOC_PER_RECORD];
+    };
+
     u64 column_id_;
     UniquePtr<PostingIterator> iter_;
     float weight_ = 1.0f; // changed in MultiplyWeight()
@@ -95,6 +114,7 @@ private:
     float bm25_common_score_ = 0; // include: weight * smooth_idf * (k1 + 1.0F)
     float block_max_bm25_score_cache_ = 0.0f;
     RowID block_max_bm25_score_cache_end_id_ = INVALID_ROWID;
+    UniquePtr<BlockScores> block_scores_;
 
     // debug info
     u32 calc_score_cnt_ = 0;
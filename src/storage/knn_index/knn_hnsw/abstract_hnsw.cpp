@@ -27,6 +27,11 @@ import table_index_entry;
 import table_entry;
 import memindex_tracer;
 import default_values;
+import infinity_exception;
+import third_party;
+import config;
+import local_file_system;
+import file_system_type;
 
 namespace infinity {
 
@@ -65,7 +70,7 @@ HnswIndexInMem::HnswIndexInMem(RowID begin_row_id,
     const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_def->type()->type_info().get());
 
     SizeT chunk_size = index_hnsw->block_size_;
-    SizeT max_chunk_num = (DEFAULT_SEGMENT_CAPACITY - 1) / chunk_size + 1;
+    max_chunk_num_ = (DEFAULT_SEGMENT_CAPACITY - 1) / chunk_size + 1;
 
     SizeT dim = embedding_info->Dimension();
     SizeT M = index_hnsw->M_;
@@ -75,7 +80,7 @@ HnswIndexInMem::HnswIndexInMem(RowID begin_row_id,
             using T = std::decay_t<decltype(index)>;
             if constexpr (!std::is_same_v<T, std::nullptr_t>) {
                 using IndexT = std::decay_t<decltype(*index)>;
-                hnsw_ = IndexT::Make(chunk_size, max_chunk_num, dim, M, ef_construction).release();
+                hnsw_ = IndexT::Make(chunk_size, max_chunk_num_, dim, M, ef_construction).release();
             }
         },
         hnsw_);
@@ -185,6 +190,78 @@ void HnswIndexInMem::InsertVecs(const SegmentEntry *segment_entry,
         hnsw_);
 }
 
+void HnswIndexInMem::InsertVecs(const SegmentEntry *segment_entry,
+                                BufferManager *buffer_mgr,
+                                SizeT column_id,
+                                TxnTimeStamp begin_ts,
+                                bool check_ts,
+                                SegmentOffset skip_begin,
+                                SegmentOffset skip_end,
+                                const HnswInsertConfig &config) {
+    std::visit(
+        [&](auto &&index) {
+            using T = std::decay_t<decltype(index)>;
+            if constexpr (!std::is_same_v<T, std::nullptr_t>) {
+                using IndexT = std::decay_t<decltype(*index)>;
+                using DataType = typename IndexT::DataType;
+
+                SizeT mem_usage{};
+                if (check_ts) {
+                    SkipRangeOneColumnIterator<DataType, true> iter(segment_entry, buffer_mgr, column_id, begin_ts, skip_begin, skip_end);
+                    InsertVecs(index, std::move(iter), config, mem_usage);
+                } else {
+                    SkipRangeOneColumnIterator<DataType, false> iter(segment_entry, buffer_mgr, column_id, begin_ts, skip_begin, skip_end);
+                    InsertVecs(index, std::move(iter), config, mem_usage);
+                }
+                this->AddMemUsed(mem_usage);
+            }
+        },
+        hnsw_);
+}
+
+void HnswIndexInMem::LoadBase(ChunkIndexEntry *base_chunk, const std::function<SegmentOffset(SegmentOffset)> &remap) {
+    // The base chunk is still used by the queries on the compacted segment, so copy it through a temp file instead of modifying it.
+    String tmp_path = fmt::format("{}/compact_hnsw_{}", InfinityContext::instance().config()->TempDir(), begin_row_id_.ToUint64());
+    LocalFileSystem fs;
+    BufferHandle base_handle = base_chunk->GetIndex();
+    const auto *base_hnsw = static_cast<const AbstractHnsw *>(base_handle.GetData());
+    std::visit(
+        [&](auto &&index) {
+            using T = std::decay_t<decltype(index)>;
+            if constexpr (!std::is_same_v<T, std::nullptr_t>) {
+                using IndexT = std::decay_t<decltype(*index)>;
+                const T *base_index = std::get_if<T>(base_hnsw);
+                if (base_index == nullptr) {
+                    UnrecoverableError("The compaction base of hnsw index is encoded differently from the new index.");
+                }
+                {
+                    u8 file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG | FileFlags::TRUNCATE_CREATE;
+                    auto [file_handler, status] = fs.OpenFile(tmp_path, file_flags, FileLockType::kWriteLock);
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                    (*base_index)->Save(*file_handler);
+                }
+                SizeT mem1 = index->mem_usage();
+                {
+                    auto [file_handler, status] = fs.OpenFile(tmp_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                    delete index;
+                    index = IndexT::Load(*file_handler, max_chunk_num_).release();
+                }
+                fs.DeleteFile(tmp_path);
+                index->RemapLabels(remap);
+                SizeT mem2 = index->mem_usage();
+                if (trace_ && mem2 > mem1) {
+                    this->AddMemUsed(mem2 - mem1);
+                }
+            }
+        },
+        hnsw_);
+}
+
 SharedPtr<ChunkIndexEntry> HnswIndexInMem::Dump(SegmentIndexEntry *segment_index_entry, BufferManager *buffer_mgr, SizeT *dump_size_ptr) {
     SizeT row_count = 0;
     SizeT index_size = 0;
@@ -61,6 +61,12 @@ export using AbstractHnsw = std::variant<KnnHnsw<PlainCosVecStoreType<float>, Se
                                          KnnHnsw<LVQCosVecStoreType<float, i8>, SegmentOffset> *,
                                          KnnHnsw<LVQIPVecStoreType<float, i8>, SegmentOffset> *,
                                          KnnHnsw<LVQL2VecStoreType<float, i8>, SegmentOffset> *,
+                                         KnnHnsw<LVQ4CosVecStoreType<float>, SegmentOffset> *,
+                                         KnnHnsw<LVQ4IPVecStoreType<float>, SegmentOffset> *,
+                                         KnnHnsw<LVQ4L2VecStoreType<float>, SegmentOffset> *,
+                                         KnnHnsw<RabitqCosVecStoreType<float>, SegmentOffset> *,
+                                         KnnHnsw<RabitqIPVecStoreType<float>, SegmentOffset> *,
+                                         KnnHnsw<RabitqL2VecStoreType<float>, SegmentOffset> *,
                                          std::nullptr_t>;
 
 export struct HnswIndexInMem : public BaseMemIndex {
@@ -118,6 +124,52 @@ private:
                     }
                 }
             }
+            case HnswEncodeType::kLVQ4: {
+                if constexpr (std::is_same_v<DataType, u8> || std::is_same_v<DataType, i8>) {
+                    return nullptr;
+                } else {
+                    switch (index_hnsw->metric_type_) {
+                        case MetricType::kMetricL2: {
+                            using HnswIndex = KnnHnsw<LVQ4L2VecStoreType<DataType>, SegmentOffset>;
+                            return static_cast<HnswIndex *>(nullptr);
+                        }
+                        case MetricType::kMetricInnerProduct: {
+                            using HnswIndex = KnnHnsw<LVQ4IPVecStoreType<DataType>, SegmentOffset>;
+                            return static_cast<HnswIndex *>(nullptr);
+                        }
+                        case MetricType::kMetricCosine: {
+                            using HnswIndex = KnnHnsw<LVQ4CosVecStoreType<DataType>, SegmentOffset>;
+                            return static_cast<HnswIndex *>(nullptr);
+                        }
+                        default: {
+                            return nullptr;
+                        }
+                    }
+                }
+            }
+            case HnswEncodeType::kRabitq: {
+                if constexpr (std::is_same_v<DataType, u8> || std::is_same_v<DataType, i8>) {
+                    return nullptr;
+                } else {
+                    switch (index_hnsw->metric_type_) {
+                        case MetricType::kMetricL2: {
+                            using HnswIndex = KnnHnsw<RabitqL2VecStoreType<DataType>, SegmentOffset>;
+                            return static_cast<HnswIndex *>(nullptr);
+                        }
+                        case MetricType::kMetricInnerProduct: {
+                            using HnswIndex = KnnHnsw<RabitqIPVecStoreType<DataType>, SegmentOffset>;
+                            return static_cast<HnswIndex *>(nullptr);
+                        }
+                        case MetricType::kMetricCosine: {
+                            using HnswIndex = KnnHnsw<RabitqCosVecStoreType<DataType>, SegmentOffset>;
+                            return static_cast<HnswIndex *>(nullptr);
+                        }
+                        default: {
+                            return nullptr;
+                        }
+                    }
+                }
+            }
             default: {
                 return nullptr;
             }
@@ -131,6 +183,10 @@ private:
         if constexpr (!std::is_same_v<T, std::nullptr_t>) {
             SizeT mem1 = index->mem_usage();
             auto [start, end] = index->StoreData(std::move(iter), config);
+            if (start == end) {
+                mem_usage = index->mem_usage() - mem1;
+                return;
+            }
             SizeT bucket_size = std::max(kBuildBucketSize, SizeT(end - start - 1) / thread_pool.size() + 1);
             SizeT bucket_n = (end - start - 1) / bucket_size + 1;
 
@@ -177,6 +233,20 @@ public:
                     bool check_ts,
                     const HnswInsertConfig &config = kDefaultHnswInsertConfig);
 
+    // Same as above but skip the rows in [skip_begin, skip_end), which are already in the graph loaded by `LoadBase`
+    void InsertVecs(const SegmentEntry *segment_entry,
+                    BufferManager *buffer_mgr,
+                    SizeT column_id,
+                    TxnTimeStamp begin_ts,
+                    bool check_ts,
+                    SegmentOffset skip_begin,
+                    SegmentOffset skip_end,
+                    const HnswInsertConfig &config = kDefaultHnswInsertConfig);
+
+    // Replace the empty graph with a copy of the graph in `base_chunk` and rewrite its labels with `remap`.
+    // Used by compaction to start from the largest input graph instead of rebuilding it.
+    void LoadBase(ChunkIndexEntry *base_chunk, const std::function<SegmentOffset(SegmentOffset)> &remap);
+
     SharedPtr<ChunkIndexEntry> Dump(SegmentIndexEntry *segment_index_entry, BufferManager *buffer_mgr, SizeT *dump_size = nullptr);
 
     const AbstractHnsw &get() const { return hnsw_; }
@@ -190,6 +260,7 @@ private:
     static constexpr SizeT kBuildBucketSize = 1024;
 
     RowID begin_row_id_ = {};
+    SizeT max_chunk_num_ = 0;
     AbstractHnsw hnsw_ = nullptr;
 
     SegmentIndexEntry *segment_index_entry_{};
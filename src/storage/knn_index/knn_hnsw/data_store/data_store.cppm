@@ -105,7 +105,9 @@ public:
 
     static This Make(SizeT chunk_size, SizeT max_chunk_n, SizeT dim, SizeT Mmax0, SizeT Mmax) {
         bool normalize = false;
-        if constexpr (has_compress_type<VecStoreT>::value) {
+        if constexpr (requires { requires VecStoreT::NeedNormalize; }) {
+            normalize = true;
+        } else if constexpr (has_compress_type<VecStoreT>::value) {
             normalize = std::is_same_v<VecStoreMeta, typename LVQCosVecStoreType<DataType, typename VecStoreT::CompressType>::Meta>;
         }
         VecStoreMeta vec_store_meta = VecStoreMeta::Make(dim, normalize);
@@ -291,6 +293,11 @@ public:
         return inner.GetLabel(idx);
     }
 
+    void SetLabel(SizeT vec_i, LabelType label) {
+        auto [inner, idx] = GetInner(vec_i);
+        inner.SetLabel(idx, label);
+    }
+
     std::shared_lock<std::shared_mutex> SharedLock(SizeT vec_i) const {
         const auto &[inner, idx] = GetInner(vec_i);
         return inner.SharedLock(idx);
@@ -465,6 +472,8 @@ public:
 
     LabelType GetLabel(VertexType vec_i) const { return labels_[vec_i]; }
 
+    void SetLabel(VertexType vec_i, LabelType label) { labels_[vec_i] = label; }
+
     std::shared_lock<std::shared_mutex> SharedLock(VertexType vec_i) const { return std::shared_lock<std::shared_mutex>(vertex_mutex_[vec_i]); }
 
     std::unique_lock<std::shared_mutex> UniqueLock(VertexType vec_i) { return std::unique_lock<std::shared_mutex>(vertex_mutex_[vec_i]); }
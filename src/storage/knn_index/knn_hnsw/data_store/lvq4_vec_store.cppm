@@ -0,0 +1,325 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cassert>
+#include <ostream>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <xmmintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <simde/x86/sse.h>
+#endif
+
+export module lvq4_vec_store;
+
+import stl;
+import file_system;
+import hnsw_common;
+
+namespace infinity {
+
+// Decompress: Q = scale * C + bias + Mean, the 4-bit codes C are packed two in a byte, the low nibble first
+export template <typename DataType>
+struct LVQ4Data {
+    DataType scale_;
+    DataType bias_;
+    // scale * sum(C), scale * scale * sum(C * C) and <scale * C + bias, Mean>
+    DataType norm1_scale_;
+    DataType norm2sq_scalesq_;
+    DataType mean_ip_;
+    u8 compress_vec_[];
+};
+
+export template <typename DataType>
+class LVQ4VecStoreInner;
+
+export template <typename DataType>
+class LVQ4VecStoreMeta {
+public:
+    constexpr static SizeT max_bucket_idx_ = 15;
+
+    using This = LVQ4VecStoreMeta<DataType>;
+    using Inner = LVQ4VecStoreInner<DataType>;
+    using LVQ4Data = LVQ4Data<DataType>;
+    using StoreType = const LVQ4Data *;
+    struct LVQ4Query {
+        UniquePtr<LVQ4Data> inner_;
+        operator const LVQ4Data *() const { return inner_.get(); }
+
+        LVQ4Query(SizeT compress_data_size) : inner_(new(new char[compress_data_size]) LVQ4Data) {}
+        LVQ4Query(LVQ4Query &&other) = default;
+        ~LVQ4Query() { delete[] reinterpret_cast<char *>(inner_.release()); }
+    };
+    using QueryType = LVQ4Query;
+    using DistanceType = f32;
+
+private:
+    LVQ4VecStoreMeta(SizeT dim) : dim_(dim), compress_data_size_(sizeof(LVQ4Data) + code_size(dim)) {
+        mean_ = MakeUnique<MeanType[]>(dim);
+        std::fill(mean_.get(), mean_.get() + dim, 0);
+    }
+
+public:
+    LVQ4VecStoreMeta() : dim_(0), compress_data_size_(0) {}
+    LVQ4VecStoreMeta(This &&other)
+        : dim_(std::exchange(other.dim_, 0)), compress_data_size_(std::exchange(other.compress_data_size_, 0)), mean_(std::move(other.mean_)),
+          mean_norm_sq_(other.mean_norm_sq_), normalize_(other.normalize_) {}
+    LVQ4VecStoreMeta &operator=(This &&other) {
+        if (this != &other) {
+            dim_ = std::exchange(other.dim_, 0);
+            compress_data_size_ = std::exchange(other.compress_data_size_, 0);
+            mean_ = std::move(other.mean_);
+            mean_norm_sq_ = other.mean_norm_sq_;
+            normalize_ = other.normalize_;
+        }
+        return *this;
+    }
+
+    static This Make(SizeT dim) { return This(dim); }
+    static This Make(SizeT dim, bool normalize) {
+        This ret(dim);
+        ret.normalize_ = normalize;
+        return ret;
+    }
+
+    static SizeT code_size(SizeT dim) { return (dim + 1) / 2; }
+
+    SizeT GetSizeInBytes() const { return sizeof(dim_) + sizeof(MeanType) * dim_ + sizeof(mean_norm_sq_) + sizeof(normalize_); }
+
+    void Save(FileHandler &file_handler) const {
+        file_handler.Write(&dim_, sizeof(dim_));
+        file_handler.Write(mean_.get(), sizeof(MeanType) * dim_);
+        file_handler.Write(&mean_norm_sq_, sizeof(mean_norm_sq_));
+        file_handler.Write(&normalize_, sizeof(normalize_));
+    }
+
+    static This Load(FileHandler &file_handler) {
+        SizeT dim;
+        file_handler.Read(&dim, sizeof(dim));
+        This meta(dim);
+        file_handler.Read(meta.mean_.get(), sizeof(MeanType) * dim);
+        file_handler.Read(&meta.mean_norm_sq_, sizeof(meta.mean_norm_sq_));
+        file_handler.Read(&meta.normalize_, sizeof(meta.normalize_));
+        return meta;
+    }
+
+    LVQ4Query MakeQuery(const DataType *vec) const {
+        LVQ4Query query(compress_data_size_);
+        CompressTo(vec, query.inner_.get());
+        return query;
+    }
+
+    void CompressTo(const DataType *src, LVQ4Data *dest) const {
+        Vector<DataType> normalized;
+        if (normalize_) {
+            DataType norm = 0;
+            for (SizeT j = 0; j < dim_; ++j) {
+                norm += src[j] * src[j];
+            }
+            norm = std::sqrt(norm);
+            normalized.assign(src, src + dim_);
+            if (norm != 0) {
+                for (SizeT j = 0; j < dim_; ++j) {
+                    normalized[j] /= norm;
+                }
+            }
+            src = normalized.data();
+        }
+
+        u8 *compress = dest->compress_vec_;
+        std::fill(compress, compress + code_size(dim_), 0);
+
+        DataType lower = std::numeric_limits<DataType>::max();
+        DataType upper = -std::numeric_limits<DataType>::max();
+        for (SizeT j = 0; j < dim_; ++j) {
+            auto x = static_cast<DataType>(src[j] - mean_[j]);
+            lower = std::min(lower, x);
+            upper = std::max(upper, x);
+        }
+        DataType scale = (upper - lower) / max_bucket_idx_;
+        DataType bias = lower;
+        i64 norm1 = 0;
+        i64 norm2 = 0;
+        MeanType mean_ip = 0;
+        if (scale != 0) {
+            DataType scale_inv = 1 / scale;
+            for (SizeT j = 0; j < dim_; ++j) {
+                auto c = std::floor((src[j] - mean_[j] - bias) * scale_inv + 0.5);
+                auto code = static_cast<u8>(std::clamp<decltype(c)>(c, 0, max_bucket_idx_));
+                compress[j >> 1] |= code << ((j & 1) << 2);
+                norm1 += code;
+                norm2 += code * code;
+            }
+        }
+        for (SizeT j = 0; j < dim_; ++j) {
+            mean_ip += (scale * GetCode(compress, j) + bias) * mean_[j];
+        }
+        dest->scale_ = scale;
+        dest->bias_ = bias;
+        dest->norm1_scale_ = norm1 * scale;
+        dest->norm2sq_scalesq_ = norm2 * scale * scale;
+        dest->mean_ip_ = mean_ip;
+    }
+
+    template <typename LabelType, DataIteratorConcept<const DataType *, LabelType> Iterator>
+    void Optimize(Iterator &&query_iter, const Vector<Pair<Inner *, SizeT>> &inners, SizeT &mem_usage) {
+        auto new_mean = MakeUnique<MeanType[]>(dim_);
+        auto temp_decompress = MakeUnique<DataType[]>(dim_);
+        SizeT cur_vec_num = 0;
+        for (const auto [inner, size] : inners) {
+            for (SizeT i = 0; i < size; ++i) {
+                DecompressTo(inner->GetVec(i, *this), temp_decompress.get());
+                for (SizeT j = 0; j < dim_; ++j) {
+                    new_mean[j] += temp_decompress[j];
+                }
+            }
+            cur_vec_num += size;
+        }
+        while (true) {
+            if (auto ret = query_iter.Next(); ret) {
+                auto &[vec, _] = *ret;
+                for (SizeT i = 0; i < dim_; ++i) {
+                    new_mean[i] += vec[i];
+                }
+                ++cur_vec_num;
+            } else {
+                break;
+            }
+        }
+        if (cur_vec_num == 0) {
+            return;
+        }
+        for (SizeT i = 0; i < dim_; ++i) {
+            new_mean[i] /= cur_vec_num;
+        }
+        swap(new_mean, mean_);
+        mean_norm_sq_ = 0;
+        for (SizeT i = 0; i < dim_; ++i) {
+            mean_norm_sq_ += mean_[i] * mean_[i];
+        }
+
+        for (auto [inner, size] : inners) {
+            for (SizeT i = 0; i < size; ++i) {
+                DecompressByMeanTo(inner->GetVec(i, *this), new_mean.get(), temp_decompress.get());
+                inner->SetVec(i, temp_decompress.get(), *this, mem_usage);
+            }
+        }
+    }
+
+    SizeT dim() const { return dim_; }
+    SizeT compress_data_size() const { return compress_data_size_; }
+    DataType mean_norm_sq() const { return mean_norm_sq_; }
+
+    // for unit test
+    const MeanType *mean() const { return mean_.get(); }
+
+    static u8 GetCode(const u8 *compress, SizeT j) { return (compress[j >> 1] >> ((j & 1) << 2)) & 0x0F; }
+
+private:
+    void DecompressByMeanTo(const LVQ4Data *src, const MeanType *mean, DataType *dest) const {
+        DataType scale = src->scale_;
+        DataType bias = src->bias_;
+        for (SizeT i = 0; i < dim_; ++i) {
+            dest[i] = scale * GetCode(src->compress_vec_, i) + bias + mean[i];
+        }
+    }
+
+    void DecompressTo(const LVQ4Data *src, DataType *dest) const { DecompressByMeanTo(src, mean_.get(), dest); };
+
+private:
+    SizeT dim_;
+    SizeT compress_data_size_;
+
+    UniquePtr<MeanType[]> mean_;
+    DataType mean_norm_sq_{0};
+
+    bool normalize_{false};
+
+public:
+    void Dump(std::ostream &os) const {
+        os << "[CONST] dim: " << dim_ << ", compress_data_size: " << compress_data_size_ << std::endl;
+        os << "mean: ";
+        for (SizeT i = 0; i < dim_; ++i) {
+            os << mean_[i] << " ";
+        }
+        os << std::endl;
+        os << "mean_norm_sq: " << mean_norm_sq_ << std::endl;
+    }
+};
+
+export template <typename DataType>
+class LVQ4VecStoreInner {
+public:
+    using This = LVQ4VecStoreInner<DataType>;
+    using Meta = LVQ4VecStoreMeta<DataType>;
+    using LVQ4Data = LVQ4Data<DataType>;
+
+private:
+    LVQ4VecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeUnique<char[]>(max_vec_num * meta.compress_data_size())) {}
+
+public:
+    LVQ4VecStoreInner() = default;
+
+    static This Make(SizeT max_vec_num, const Meta &meta, SizeT &mem_usage) {
+        auto ret = This(max_vec_num, meta);
+        mem_usage += max_vec_num * meta.compress_data_size();
+        return ret;
+    }
+
+    SizeT GetSizeInBytes(SizeT cur_vec_num, const Meta &meta) const { return cur_vec_num * meta.compress_data_size(); }
+
+    void Save(FileHandler &file_handler, SizeT cur_vec_num, const Meta &meta) const {
+        file_handler.Write(ptr_.get(), cur_vec_num * meta.compress_data_size());
+    }
+
+    static This Load(FileHandler &file_handler, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta, SizeT &mem_usage) {
+        assert(cur_vec_num <= max_vec_num);
+        This ret(max_vec_num, meta);
+        file_handler.Read(ret.ptr_.get(), cur_vec_num * meta.compress_data_size());
+        mem_usage += max_vec_num * meta.compress_data_size();
+        return ret;
+    }
+
+    void SetVec(SizeT idx, const DataType *vec, const Meta &meta, SizeT &mem_usage) { meta.CompressTo(vec, GetVecMut(idx, meta)); }
+
+    const LVQ4Data *GetVec(SizeT idx, const Meta &meta) const {
+        return reinterpret_cast<const LVQ4Data *>(ptr_.get() + idx * meta.compress_data_size());
+    }
+
+    void Prefetch(VertexType vec_i, const Meta &meta) const { _mm_prefetch(reinterpret_cast<const char *>(GetVec(vec_i, meta)), _MM_HINT_T0); }
+
+private:
+    LVQ4Data *GetVecMut(SizeT idx, const Meta &meta) { return reinterpret_cast<LVQ4Data *>(ptr_.get() + idx * meta.compress_data_size()); }
+
+private:
+    UniquePtr<char[]> ptr_;
+
+public:
+    void Dump(std::ostream &os, SizeT offset, SizeT chunk_size, const Meta &meta) const {
+        for (int i = 0; i < (int)chunk_size; ++i) {
+            os << "vec " << i << "(" << offset + i << "): ";
+            const LVQ4Data *vec = GetVec(i, meta);
+            os << "scale: " << vec->scale_ << ", bias: " << vec->bias_ << ", mean_ip: " << vec->mean_ip_ << std::endl;
+            os << "compress_vec: ";
+            for (SizeT j = 0; j < meta.dim(); ++j) {
+                os << static_cast<int>(Meta::GetCode(vec->compress_vec_, j)) << " ";
+            }
+            os << std::endl;
+        }
+    }
+};
+
+} // namespace infinity
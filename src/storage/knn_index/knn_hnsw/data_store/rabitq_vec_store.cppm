@@ -0,0 +1,291 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cassert>
+#include <ostream>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <xmmintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <simde/x86/sse.h>
+#endif
+
+export module rabitq_vec_store;
+
+import stl;
+import file_system;
+import hnsw_common;
+
+namespace infinity {
+
+// One bit code of the residual R = Q - Mean: bit j is set when R[j] > 0, i.e. the code is B = sign(R) / sqrt(dim).
+// The cosine of two residuals is estimated by <B1, B2> / (<B1, R1 / |R1|> * <B2, R2 / |R2|>).
+export template <typename DataType>
+struct RabitqData {
+    // |R|, <B, R / |R|> and <R, Mean>
+    DataType norm_;
+    DataType factor_;
+    DataType mean_ip_;
+    u64 code_[];
+};
+
+export template <typename DataType>
+class RabitqVecStoreInner;
+
+export template <typename DataType>
+class RabitqVecStoreMeta {
+public:
+    using This = RabitqVecStoreMeta<DataType>;
+    using Inner = RabitqVecStoreInner<DataType>;
+    using RabitqData = RabitqData<DataType>;
+    using StoreType = const RabitqData *;
+    struct RabitqQuery {
+        UniquePtr<RabitqData> inner_;
+        operator const RabitqData *() const { return inner_.get(); }
+
+        RabitqQuery(SizeT compress_data_size) : inner_(new(new char[compress_data_size]) RabitqData) {}
+        RabitqQuery(RabitqQuery &&other) = default;
+        ~RabitqQuery() { delete[] reinterpret_cast<char *>(inner_.release()); }
+    };
+    using QueryType = RabitqQuery;
+    using DistanceType = f32;
+
+private:
+    RabitqVecStoreMeta(SizeT dim) : dim_(dim), compress_data_size_(sizeof(RabitqData) + sizeof(u64) * code_size(dim)) {
+        mean_ = MakeUnique<MeanType[]>(dim);
+        std::fill(mean_.get(), mean_.get() + dim, 0);
+    }
+
+public:
+    RabitqVecStoreMeta() : dim_(0), compress_data_size_(0) {}
+    RabitqVecStoreMeta(This &&other)
+        : dim_(std::exchange(other.dim_, 0)), compress_data_size_(std::exchange(other.compress_data_size_, 0)), mean_(std::move(other.mean_)),
+          mean_norm_sq_(other.mean_norm_sq_), normalize_(other.normalize_) {}
+    RabitqVecStoreMeta &operator=(This &&other) {
+        if (this != &other) {
+            dim_ = std::exchange(other.dim_, 0);
+            compress_data_size_ = std::exchange(other.compress_data_size_, 0);
+            mean_ = std::move(other.mean_);
+            mean_norm_sq_ = other.mean_norm_sq_;
+            normalize_ = other.normalize_;
+        }
+        return *this;
+    }
+
+    static This Make(SizeT dim) { return This(dim); }
+    static This Make(SizeT dim, bool normalize) {
+        This ret(dim);
+        ret.normalize_ = normalize;
+        return ret;
+    }
+
+    // number of the 64-bit words of a code
+    static SizeT code_size(SizeT dim) { return (dim + 63) / 64; }
+
+    SizeT GetSizeInBytes() const { return sizeof(dim_) + sizeof(MeanType) * dim_ + sizeof(mean_norm_sq_) + sizeof(normalize_); }
+
+    void Save(FileHandler &file_handler) const {
+        file_handler.Write(&dim_, sizeof(dim_));
+        file_handler.Write(mean_.get(), sizeof(MeanType) * dim_);
+        file_handler.Write(&mean_norm_sq_, sizeof(mean_norm_sq_));
+        file_handler.Write(&normalize_, sizeof(normalize_));
+    }
+
+    static This Load(FileHandler &file_handler) {
+        SizeT dim;
+        file_handler.Read(&dim, sizeof(dim));
+        This meta(dim);
+        file_handler.Read(meta.mean_.get(), sizeof(MeanType) * dim);
+        file_handler.Read(&meta.mean_norm_sq_, sizeof(meta.mean_norm_sq_));
+        file_handler.Read(&meta.normalize_, sizeof(meta.normalize_));
+        return meta;
+    }
+
+    RabitqQuery MakeQuery(const DataType *vec) const {
+        RabitqQuery query(compress_data_size_);
+        CompressTo(vec, query.inner_.get());
+        return query;
+    }
+
+    void CompressTo(const DataType *src, RabitqData *dest) const {
+        Vector<DataType> normalized;
+        if (normalize_) {
+            DataType norm = 0;
+            for (SizeT j = 0; j < dim_; ++j) {
+                norm += src[j] * src[j];
+            }
+            norm = std::sqrt(norm);
+            normalized.assign(src, src + dim_);
+            if (norm != 0) {
+                for (SizeT j = 0; j < dim_; ++j) {
+                    normalized[j] /= norm;
+                }
+            }
+            src = normalized.data();
+        }
+
+        u64 *code = dest->code_;
+        std::fill(code, code + code_size(dim_), 0);
+        MeanType norm_sq = 0;
+        MeanType abs_sum = 0;
+        MeanType mean_ip = 0;
+        for (SizeT j = 0; j < dim_; ++j) {
+            MeanType r = src[j] - mean_[j];
+            if (r > 0) {
+                code[j >> 6] |= u64(1) << (j & 63);
+            }
+            norm_sq += r * r;
+            abs_sum += std::abs(r);
+            mean_ip += r * mean_[j];
+        }
+        MeanType norm = std::sqrt(norm_sq);
+        dest->norm_ = norm;
+        // <sign(R) / sqrt(dim), R / |R|>, 1 for the zero residual so that the estimator stays finite
+        dest->factor_ = norm == 0 ? 1 : abs_sum / (norm * std::sqrt(static_cast<MeanType>(dim_)));
+        dest->mean_ip_ = mean_ip;
+    }
+
+    // The bit codes can not be decompressed, so the mean is only computed before the first vector is added
+    template <typename LabelType, DataIteratorConcept<const DataType *, LabelType> Iterator>
+    void Optimize(Iterator &&query_iter, const Vector<Pair<Inner *, SizeT>> &inners, SizeT &mem_usage) {
+        for (const auto [inner, size] : inners) {
+            if (size > 0) {
+                return;
+            }
+        }
+        auto new_mean = MakeUnique<MeanType[]>(dim_);
+        SizeT cur_vec_num = 0;
+        while (true) {
+            if (auto ret = query_iter.Next(); ret) {
+                auto &[vec, _] = *ret;
+                for (SizeT i = 0; i < dim_; ++i) {
+                    new_mean[i] += vec[i];
+                }
+                ++cur_vec_num;
+            } else {
+                break;
+            }
+        }
+        if (cur_vec_num == 0) {
+            return;
+        }
+        for (SizeT i = 0; i < dim_; ++i) {
+            new_mean[i] /= cur_vec_num;
+        }
+        swap(new_mean, mean_);
+        mean_norm_sq_ = 0;
+        for (SizeT i = 0; i < dim_; ++i) {
+            mean_norm_sq_ += mean_[i] * mean_[i];
+        }
+    }
+
+    SizeT dim() const { return dim_; }
+    SizeT compress_data_size() const { return compress_data_size_; }
+    DataType mean_norm_sq() const { return mean_norm_sq_; }
+
+    // Cosine of the residuals of `v1` and `v2` estimated with the hamming distance of their codes
+    DataType EstimateCos(const RabitqData *v1, const RabitqData *v2, i32 hamming) const {
+        DataType code_ip = static_cast<DataType>(static_cast<i64>(dim_) - 2 * hamming) / dim_;
+        return std::clamp<DataType>(code_ip / (v1->factor_ * v2->factor_), -1, 1);
+    }
+
+    // for unit test
+    const MeanType *mean() const { return mean_.get(); }
+
+private:
+    SizeT dim_;
+    SizeT compress_data_size_;
+
+    UniquePtr<MeanType[]> mean_;
+    DataType mean_norm_sq_{0};
+
+    bool normalize_{false};
+
+public:
+    void Dump(std::ostream &os) const {
+        os << "[CONST] dim: " << dim_ << ", compress_data_size: " << compress_data_size_ << std::endl;
+        os << "mean: ";
+        for (SizeT i = 0; i < dim_; ++i) {
+            os << mean_[i] << " ";
+        }
+        os << std::endl;
+        os << "mean_norm_sq: " << mean_norm_sq_ << std::endl;
+    }
+};
+
+export template <typename DataType>
+class RabitqVecStoreInner {
+public:
+    using This = RabitqVecStoreInner<DataType>;
+    using Meta = RabitqVecStoreMeta<DataType>;
+    using RabitqData = RabitqData<DataType>;
+
+private:
+    RabitqVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeUnique<char[]>(max_vec_num * meta.compress_data_size())) {}
+
+public:
+    RabitqVecStoreInner() = default;
+
+    static This Make(SizeT max_vec_num, const Meta &meta, SizeT &mem_usage) {
+        auto ret = This(max_vec_num, meta);
+        mem_usage += max_vec_num * meta.compress_data_size();
+        return ret;
+    }
+
+    SizeT GetSizeInBytes(SizeT cur_vec_num, const Meta &meta) const { return cur_vec_num * meta.compress_data_size(); }
+
+    void Save(FileHandler &file_handler, SizeT cur_vec_num, const Meta &meta) const {
+        file_handler.Write(ptr_.get(), cur_vec_num * meta.compress_data_size());
+    }
+
+    static This Load(FileHandler &file_handler, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta, SizeT &mem_usage) {
+        assert(cur_vec_num <= max_vec_num);
+        This ret(max_vec_num, meta);
+        file_handler.Read(ret.ptr_.get(), cur_vec_num * meta.compress_data_size());
+        mem_usage += max_vec_num * meta.compress_data_size();
+        return ret;
+    }
+
+    void SetVec(SizeT idx, const DataType *vec, const Meta &meta, SizeT &mem_usage) { meta.CompressTo(vec, GetVecMut(idx, meta)); }
+
+    const RabitqData *GetVec(SizeT idx, const Meta &meta) const {
+        return reinterpret_cast<const RabitqData *>(ptr_.get() + idx * meta.compress_data_size());
+    }
+
+    void Prefetch(VertexType vec_i, const Meta &meta) const { _mm_prefetch(reinterpret_cast<const char *>(GetVec(vec_i, meta)), _MM_HINT_T0); }
+
+private:
+    RabitqData *GetVecMut(SizeT idx, const Meta &meta) { return reinterpret_cast<RabitqData *>(ptr_.get() + idx * meta.compress_data_size()); }
+
+private:
+    UniquePtr<char[]> ptr_;
+
+public:
+    void Dump(std::ostream &os, SizeT offset, SizeT chunk_size, const Meta &meta) const {
+        for (int i = 0; i < (int)chunk_size; ++i) {
+            os << "vec " << i << "(" << offset + i << "): ";
+            const RabitqData *vec = GetVec(i, meta);
+            os << "norm: " << vec->norm_ << ", factor: " << vec->factor_ << ", mean_ip: " << vec->mean_ip_ << std::endl;
+            os << "code: ";
+            for (SizeT j = 0; j < Meta::code_size(meta.dim()); ++j) {
+                os << vec->code_[j] << " ";
+            }
+            os << std::endl;
+        }
+    }
+};
+
+} // namespace infinity
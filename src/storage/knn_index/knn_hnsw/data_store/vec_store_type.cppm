@@ -20,6 +20,8 @@ import stl;
 import plain_vec_store;
 import sparse_vec_store;
 import lvq_vec_store;
+import lvq4_vec_store;
+import rabitq_vec_store;
 import dist_func_cos;
 import dist_func_l2;
 import dist_func_ip;
@@ -177,4 +179,137 @@ public:
     }
 };
 
+// The stores below keep fewer bits than the 8-bit LVQ. Their distances are approximate, so the searchers rerank the candidates
+// with the full precision vectors, see `NeedRerank`.
+
+export template <typename DataT>
+class LVQ4CosVecStoreType {
+public:
+    using DataType = DataT;
+    using CompressType = void;
+    using Meta = LVQ4VecStoreMeta<DataType>;
+    using Inner = LVQ4VecStoreInner<DataType>;
+    using QueryVecType = const DataType *;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = LVQ4IPDist<DataType>;
+
+    static constexpr bool HasOptimize = true;
+    static constexpr bool NeedRerank = true;
+    // the vectors are normalized when compressed, so the inner product distance is the cosine distance
+    static constexpr bool NeedNormalize = true;
+
+    template <typename CompressType>
+    static constexpr LVQ4CosVecStoreType<DataType> ToLVQ() {
+        return {};
+    }
+};
+
+export template <typename DataT>
+class LVQ4L2VecStoreType {
+public:
+    using DataType = DataT;
+    using CompressType = void;
+    using Meta = LVQ4VecStoreMeta<DataType>;
+    using Inner = LVQ4VecStoreInner<DataType>;
+    using QueryVecType = const DataType *;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = LVQ4L2Dist<DataType>;
+
+    static constexpr bool HasOptimize = true;
+    static constexpr bool NeedRerank = true;
+
+    template <typename CompressType>
+    static constexpr LVQ4L2VecStoreType<DataType> ToLVQ() {
+        return {};
+    }
+};
+
+export template <typename DataT>
+class LVQ4IPVecStoreType {
+public:
+    using DataType = DataT;
+    using CompressType = void;
+    using Meta = LVQ4VecStoreMeta<DataType>;
+    using Inner = LVQ4VecStoreInner<DataType>;
+    using QueryVecType = const DataType *;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = LVQ4IPDist<DataType>;
+
+    static constexpr bool HasOptimize = true;
+    static constexpr bool NeedRerank = true;
+
+    template <typename CompressType>
+    static constexpr LVQ4IPVecStoreType<DataType> ToLVQ() {
+        return {};
+    }
+};
+
+export template <typename DataT>
+class RabitqCosVecStoreType {
+public:
+    using DataType = DataT;
+    using CompressType = void;
+    using Meta = RabitqVecStoreMeta<DataType>;
+    using Inner = RabitqVecStoreInner<DataType>;
+    using QueryVecType = const DataType *;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = RabitqIPDist<DataType>;
+
+    static constexpr bool HasOptimize = true;
+    static constexpr bool NeedRerank = true;
+    // the vectors are normalized when compressed, so the inner product distance is the cosine distance
+    static constexpr bool NeedNormalize = true;
+
+    template <typename CompressType>
+    static constexpr RabitqCosVecStoreType<DataType> ToLVQ() {
+        return {};
+    }
+};
+
+export template <typename DataT>
+class RabitqL2VecStoreType {
+public:
+    using DataType = DataT;
+    using CompressType = void;
+    using Meta = RabitqVecStoreMeta<DataType>;
+    using Inner = RabitqVecStoreInner<DataType>;
+    using QueryVecType = const DataType *;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = RabitqL2Dist<DataType>;
+
+    static constexpr bool HasOptimize = true;
+    static constexpr bool NeedRerank = true;
+
+    template <typename CompressType>
+    static constexpr RabitqL2VecStoreType<DataType> ToLVQ() {
+        return {};
+    }
+};
+
+export template <typename DataT>
+class RabitqIPVecStoreType {
+public:
+    using DataType = DataT;
+    using CompressType = void;
+    using Meta = RabitqVecStoreMeta<DataType>;
+    using Inner = RabitqVecStoreInner<DataType>;
+    using QueryVecType = const DataType *;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = RabitqIPDist<DataType>;
+
+    static constexpr bool HasOptimize = true;
+    static constexpr bool NeedRerank = true;
+
+    template <typename CompressType>
+    static constexpr RabitqIPVecStoreType<DataType> ToLVQ() {
+        return {};
+    }
+};
+
 } // namespace infinity
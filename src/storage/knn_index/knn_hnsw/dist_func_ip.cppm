@@ -20,6 +20,8 @@ import stl;
 import hnsw_common;
 import plain_vec_store;
 import lvq_vec_store;
+import lvq4_vec_store;
+import rabitq_vec_store;
 import simd_functions;
 
 export module dist_func_ip;
@@ -183,4 +185,77 @@ LVQIPDist<DataType, i8> PlainIPDist<DataType>::ToLVQDistance(SizeT dim) && {
     return LVQIPDist<DataType, i8>(dim);
 }
 
+
+// Also the distance of the cosine stores, whose vectors are normalized when compressed
+export template <typename DataType>
+class LVQ4IPDist {
+public:
+    using This = LVQ4IPDist<DataType>;
+    using VecStoreMeta = LVQ4VecStoreMeta<DataType>;
+    using StoreType = typename VecStoreMeta::StoreType;
+    using DistanceType = typename VecStoreMeta::DistanceType;
+
+private:
+    using SIMDFuncType = i32 (*)(const u8 *, const u8 *, SizeT);
+
+    SIMDFuncType SIMDFunc = nullptr;
+
+public:
+    LVQ4IPDist() : SIMDFunc(nullptr) {}
+    LVQ4IPDist(LVQ4IPDist &&other) : SIMDFunc(std::exchange(other.SIMDFunc, nullptr)) {}
+    LVQ4IPDist &operator=(LVQ4IPDist &&other) {
+        if (this != &other) {
+            SIMDFunc = std::exchange(other.SIMDFunc, nullptr);
+        }
+        return *this;
+    }
+    ~LVQ4IPDist() = default;
+    LVQ4IPDist(SizeT) { SIMDFunc = GetSIMD_FUNCTIONS().HNSW_U4IP_ptr_; }
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        SizeT dim = vec_store_meta.dim();
+        i32 c1c2_ip = SIMDFunc(v1->compress_vec_, v2->compress_vec_, VecStoreMeta::code_size(dim));
+        auto bias1 = v1->bias_;
+        auto bias2 = v2->bias_;
+        // <R1, R2> + <R1, Mean> + <R2, Mean> + <Mean, Mean>
+        auto dist = v1->scale_ * v2->scale_ * c1c2_ip + bias2 * v1->norm1_scale_ + bias1 * v2->norm1_scale_ + dim * bias1 * bias2 + v1->mean_ip_ +
+                    v2->mean_ip_ + vec_store_meta.mean_norm_sq();
+        return -dist;
+    }
+};
+
+// Also the distance of the cosine stores, whose vectors are normalized when compressed
+export template <typename DataType>
+class RabitqIPDist {
+public:
+    using This = RabitqIPDist<DataType>;
+    using VecStoreMeta = RabitqVecStoreMeta<DataType>;
+    using StoreType = typename VecStoreMeta::StoreType;
+    using DistanceType = typename VecStoreMeta::DistanceType;
+
+private:
+    using SIMDFuncType = i32 (*)(const u64 *, const u64 *, SizeT);
+
+    SIMDFuncType SIMDFunc = nullptr;
+
+public:
+    RabitqIPDist() : SIMDFunc(nullptr) {}
+    RabitqIPDist(RabitqIPDist &&other) : SIMDFunc(std::exchange(other.SIMDFunc, nullptr)) {}
+    RabitqIPDist &operator=(RabitqIPDist &&other) {
+        if (this != &other) {
+            SIMDFunc = std::exchange(other.SIMDFunc, nullptr);
+        }
+        return *this;
+    }
+    ~RabitqIPDist() = default;
+    RabitqIPDist(SizeT) { SIMDFunc = GetSIMD_FUNCTIONS().HNSW_BinaryHamming_ptr_; }
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        i32 hamming = SIMDFunc(v1->code_, v2->code_, VecStoreMeta::code_size(vec_store_meta.dim()));
+        DataType cos = vec_store_meta.EstimateCos(v1, v2, hamming);
+        auto dist = v1->norm_ * v2->norm_ * cos + v1->mean_ip_ + v2->mean_ip_ + vec_store_meta.mean_norm_sq();
+        return -dist;
+    }
+};
+
 } // namespace infinity
\ No newline at end of file
@@ -20,6 +20,8 @@ import stl;
 import hnsw_common;
 import plain_vec_store;
 import lvq_vec_store;
+import lvq4_vec_store;
+import rabitq_vec_store;
 import simd_functions;
 
 export module dist_func_l2;
@@ -172,4 +174,71 @@ LVQL2Dist<DataType, i8> PlainL2Dist<DataType>::ToLVQDistance(SizeT dim) && {
     return LVQL2Dist<DataType, i8>(dim);
 }
 
+
+export template <typename DataType>
+class LVQ4L2Dist {
+public:
+    using This = LVQ4L2Dist<DataType>;
+    using VecStoreMeta = LVQ4VecStoreMeta<DataType>;
+    using StoreType = typename VecStoreMeta::StoreType;
+    using DistanceType = typename VecStoreMeta::DistanceType;
+
+private:
+    using SIMDFuncType = i32 (*)(const u8 *, const u8 *, SizeT);
+
+    SIMDFuncType SIMDFunc = nullptr;
+
+public:
+    LVQ4L2Dist() : SIMDFunc(nullptr) {}
+    LVQ4L2Dist(LVQ4L2Dist &&other) : SIMDFunc(std::exchange(other.SIMDFunc, nullptr)) {}
+    LVQ4L2Dist &operator=(LVQ4L2Dist &&other) {
+        if (this != &other) {
+            SIMDFunc = std::exchange(other.SIMDFunc, nullptr);
+        }
+        return *this;
+    }
+    ~LVQ4L2Dist() = default;
+    LVQ4L2Dist(SizeT) { SIMDFunc = GetSIMD_FUNCTIONS().HNSW_U4IP_ptr_; }
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        SizeT dim = vec_store_meta.dim();
+        i32 c1c2_ip = SIMDFunc(v1->compress_vec_, v2->compress_vec_, VecStoreMeta::code_size(dim));
+        auto beta = v1->bias_ - v2->bias_;
+        return v1->norm2sq_scalesq_ + v2->norm2sq_scalesq_ + beta * beta * dim - 2 * v1->scale_ * v2->scale_ * c1c2_ip +
+               2 * beta * v1->norm1_scale_ - 2 * beta * v2->norm1_scale_;
+    }
+};
+
+export template <typename DataType>
+class RabitqL2Dist {
+public:
+    using This = RabitqL2Dist<DataType>;
+    using VecStoreMeta = RabitqVecStoreMeta<DataType>;
+    using StoreType = typename VecStoreMeta::StoreType;
+    using DistanceType = typename VecStoreMeta::DistanceType;
+
+private:
+    using SIMDFuncType = i32 (*)(const u64 *, const u64 *, SizeT);
+
+    SIMDFuncType SIMDFunc = nullptr;
+
+public:
+    RabitqL2Dist() : SIMDFunc(nullptr) {}
+    RabitqL2Dist(RabitqL2Dist &&other) : SIMDFunc(std::exchange(other.SIMDFunc, nullptr)) {}
+    RabitqL2Dist &operator=(RabitqL2Dist &&other) {
+        if (this != &other) {
+            SIMDFunc = std::exchange(other.SIMDFunc, nullptr);
+        }
+        return *this;
+    }
+    ~RabitqL2Dist() = default;
+    RabitqL2Dist(SizeT) { SIMDFunc = GetSIMD_FUNCTIONS().HNSW_BinaryHamming_ptr_; }
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        i32 hamming = SIMDFunc(v1->code_, v2->code_, VecStoreMeta::code_size(vec_store_meta.dim()));
+        DataType cos = vec_store_meta.EstimateCos(v1, v2, hamming);
+        return v1->norm_ * v1->norm_ + v2->norm_ * v2->norm_ - 2 * v1->norm_ * v2->norm_ * cos;
+    }
+};
+
 } // namespace infinity
\ No newline at end of file
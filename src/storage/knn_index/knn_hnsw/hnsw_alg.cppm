@@ -28,6 +28,7 @@ import bitmask;
 
 import hnsw_common;
 import data_store;
+import profiler;
 
 // Fixme: some variable has implicit type conversion.
 // Fixme: some variable has confusing name.
@@ -60,6 +61,11 @@ public:
 
     using CompressVecStoreType = decltype(VecStoreType::template ToLVQ<i8>());
 
+    // The distances of the stores with fewer bits than the 8-bit LVQ are approximate, the searchers take `RerankFactor` times the
+    // candidates and rerank them with the full precision vectors
+    constexpr static bool NeedRerank = requires { requires VecStoreType::NeedRerank; };
+    constexpr static SizeT RerankFactor = 4;
+
     // private:
     KnnHnsw(SizeT M, SizeT ef_construction, DataStore data_store, Distance distance, SizeT ef, SizeT random_seed)
         : M_(M), ef_construction_(std::max(M_, ef_construction)), mult_(1 / std::log(1.0 * M_)), data_store_(std::move(data_store)),
@@ -108,13 +114,14 @@ public:
         data_store_.Save(file_handler);
     }
 
-    static UniquePtr<This> Load(FileHandler &file_handler) {
+    // `max_chunk_n` larger than the saved one leaves room to insert more vectors into the loaded index
+    static UniquePtr<This> Load(FileHandler &file_handler, SizeT max_chunk_n = 0) {
         SizeT M;
         file_handler.Read(&M, sizeof(M));
         SizeT ef_construction;
         file_handler.Read(&ef_construction, sizeof(ef_construction));
 
-        auto data_store = DataStore::Load(file_handler);
+        auto data_store = DataStore::Load(file_handler, max_chunk_n);
         Distance distance(data_store.dim());
 
         return MakeUnique<This>(M, ef_construction, std::move(data_store), std::move(distance), 0, 0);
@@ -130,7 +137,9 @@ private:
     }
 
     // return the nearest `ef_construction_` neighbors of `query` in layer `layer_idx`
-    template <bool WithLock, FilterConcept<LabelType> Filter = NoneType>
+    // With `TwoHop`, the vertices filtered out are not compared with the query, their neighbors passing the filter are instead. It keeps
+    // the traversal connected in the passing vertices when few vertices pass the filter.
+    template <bool WithLock, FilterConcept<LabelType> Filter = NoneType, bool TwoHop = false>
     Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<VertexType[]>>
     SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT result_n, const Filter &filter) const {
         auto d_ptr = MakeUniqueForOverwrite<DistanceType[]>(result_n);
@@ -154,6 +163,8 @@ private:
         SizeT cur_vec_num = data_store_.cur_vec_num();
         Vector<bool> visited(cur_vec_num, false);
         visited[enter_point] = true;
+        Vector<VertexType> filtered_out;
+        SizeT hop_n = 0;
 
         while (!candidate.empty()) {
             const auto [minus_c_dist, c_idx] = candidate.top();
@@ -161,6 +172,7 @@ private:
             if (result_handler.GetSize(0) == result_n && -minus_c_dist > result_handler.GetDistance0(0)) {
                 break;
             }
+            ++hop_n;
 
             std::shared_lock<std::shared_mutex> lock;
             if constexpr (WithLock) {
@@ -175,6 +187,12 @@ private:
                     continue;
                 }
                 visited[n_idx] = true;
+                if constexpr (TwoHop) {
+                    if (!filter(GetLabel(n_idx))) {
+                        filtered_out.push_back(n_idx);
+                        continue;
+                    }
+                }
                 if (prefetch_start >= 0) {
                     int lower = std::max(0, prefetch_start - prefetch_step_);
                     for (int i = prefetch_start; i >= lower; --i) {
@@ -195,8 +213,35 @@ private:
                     }
                 }
             }
+            if constexpr (TwoHop) {
+                // release the lock of `c_idx` before locking the vertices filtered out, as `Build` locks a vertex and then its neighbors
+                if constexpr (WithLock) {
+                    lock.unlock();
+                }
+                for (VertexType f_idx : filtered_out) {
+                    std::shared_lock<std::shared_mutex> f_lock;
+                    if constexpr (WithLock) {
+                        f_lock = data_store_.SharedLock(f_idx);
+                    }
+                    const auto [f_neighbors_p, f_neighbor_size] = data_store_.GetNeighbors(f_idx, layer_idx);
+                    for (int i = f_neighbor_size - 1; i >= 0; --i) {
+                        VertexType n_idx = f_neighbors_p[i];
+                        if (n_idx >= (VertexType)cur_vec_num || visited[n_idx] || !filter(GetLabel(n_idx))) {
+                            continue;
+                        }
+                        visited[n_idx] = true;
+                        auto dist = distance_(query, data_store_.GetVec(n_idx), data_store_.vec_store_meta());
+                        if (result_handler.GetSize(0) < result_n || dist < result_handler.GetDistance0(0)) {
+                            candidate.emplace(-dist, n_idx);
+                            result_handler.AddResult(0, dist, n_idx);
+                        }
+                    }
+                }
+                filtered_out.clear();
+            }
         }
         result_handler.EndWithoutSort();
+        ThreadProfileCounters().hnsw_hops_ += hop_n;
         return {result_handler.GetSize(0), std::move(d_ptr), std::move(i_ptr)};
     }
 
@@ -205,8 +250,10 @@ private:
         VertexType cur_p = enter_point;
         auto cur_dist = distance_(query, data_store_.GetVec(cur_p), data_store_.vec_store_meta());
         bool check = true;
+        SizeT hop_n = 0;
         while (check) {
             check = false;
+            ++hop_n;
 
             std::shared_lock<std::shared_mutex> lock;
             if constexpr (WithLock) {
@@ -224,6 +271,7 @@ private:
                 }
             }
         }
+        ThreadProfileCounters().hnsw_hops_ += hop_n;
         return cur_p;
     }
 
@@ -290,7 +338,7 @@ private:
 
     LabelType GetLabel(VertexType vertex_i) const { return data_store_.GetLabel(vertex_i); }
 
-    template <bool WithLock, FilterConcept<LabelType> Filter = NoneType>
+    template <bool WithLock, FilterConcept<LabelType> Filter = NoneType, bool TwoHop = false>
     Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<VertexType[]>> KnnSearchInner(const QueryVecType &q, SizeT k, const Filter &filter) const {
         QueryType query = data_store_.MakeQuery(q);
         auto [max_layer, ep] = data_store_.GetEnterPoint();
@@ -300,7 +348,7 @@ private:
         for (i32 cur_layer = max_layer; cur_layer > 0; --cur_layer) {
             ep = SearchLayerNearest<WithLock>(ep, query, cur_layer);
         }
-        return SearchLayer<WithLock, Filter>(ep, query, 0, std::max(k, ef_), filter);
+        return SearchLayer<WithLock, Filter, TwoHop>(ep, query, 0, std::max(k, ef_), filter);
     }
 
 public:
@@ -323,6 +371,15 @@ public:
 
     void Optimize() { data_store_.Optimize(); }
 
+    // Rewrite the label of every vertex, e.g. when the graph is reused for the segment its vectors are compacted into
+    template <typename Remap>
+    void RemapLabels(Remap &&remap) {
+        SizeT vec_num = GetVecNum();
+        for (SizeT vertex_i = 0; vertex_i < vec_num; ++vertex_i) {
+            data_store_.SetLabel(vertex_i, remap(GetLabel(vertex_i)));
+        }
+    }
+
     void Build(VertexType vertex_i) {
         std::unique_lock<std::shared_mutex> lock = data_store_.UniqueLock(vertex_i);
 
@@ -366,9 +423,9 @@ public:
         }
     }
 
-    template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
+    template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true, bool TwoHop = false>
     Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>> KnnSearch(const QueryVecType &q, SizeT k, const Filter &filter) const {
-        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, filter);
+        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter, TwoHop>(q, k, filter);
         auto labels = MakeUniqueForOverwrite<LabelType[]>(result_n);
         for (SizeT i = 0; i < result_n; ++i) {
             labels[i] = GetLabel(v_ptr[i]);
@@ -382,9 +439,9 @@ public:
     }
 
     // function for test, add sort for convenience
-    template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
+    template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true, bool TwoHop = false>
     Vector<Pair<DistanceType, LabelType>> KnnSearchSorted(const QueryVecType &q, SizeT k, const Filter &filter) const {
-        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, filter);
+        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter, TwoHop>(q, k, filter);
         Vector<Pair<DistanceType, LabelType>> result(result_n);
         for (SizeT i = 0; i < result_n; ++i) {
             result[i] = {d_ptr[i], GetLabel(v_ptr[i])};
@@ -398,6 +455,8 @@ public:
 
     void SetEf(SizeT ef) { ef_ = ef; }
 
+    SizeT GetEf() const { return ef_; }
+
     SizeT GetVecNum() const { return data_store_.cur_vec_num(); }
 
     SizeT mem_usage() const { return data_store_.mem_usage(); }
@@ -53,6 +53,17 @@ public:
 
     void Search(const QueryElemType *query, const QueryElemType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id, Bitmask &bitmask);
 
+    // `batch_dist_f` computes the distances of a data vector to all the queries, so each vector of the block is read once
+    template <typename DataElemType>
+    void SearchBatch(const QueryElemType *query,
+                     const DataElemType *data,
+                     u32 dim,
+                     void (*batch_dist_f)(const QueryElemType *, SizeT, const DataElemType *, SizeT, DistType *),
+                     u16 row_cnt,
+                     u32 segment_id,
+                     u16 block_id,
+                     Bitmask &bitmask);
+
     void Search(const DistType *dist, const RowID *row_ids, u16 count);
 
     void Search(SizeT query_id, const DistType *dist, const RowID *row_ids, u16 count);
@@ -138,6 +149,32 @@ void MergeKnn<QueryElemType, C, DistType>::Search(const QueryElemType *query,
     }
 }
 
+template <typename QueryElemType, template <typename, typename> typename C, typename DistType>
+template <typename DataElemType>
+void MergeKnn<QueryElemType, C, DistType>::SearchBatch(const QueryElemType *query,
+                                                       const DataElemType *data,
+                                                       u32 dim,
+                                                       void (*batch_dist_f)(const QueryElemType *, SizeT, const DataElemType *, SizeT, DistType *),
+                                                       u16 row_cnt,
+                                                       u32 segment_id,
+                                                       u16 block_id,
+                                                       Bitmask &bitmask) {
+    bool all_true = bitmask.IsAllTrue();
+    u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
+    auto dists = MakeUniqueForOverwrite<DistType[]>(this->query_count_);
+    const DataElemType *y_j = data;
+    for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
+        if (!all_true && !bitmask.IsTrue(j)) {
+            continue;
+        }
+        ++this->total_count_;
+        batch_dist_f(query, this->query_count_, y_j, dim, dists.get());
+        for (u64 i = 0; i < this->query_count_; ++i) {
+            result_handler_->AddResult(i, dists[i], RowID(segment_id, segment_offset_start + j));
+        }
+    }
+}
+
 template <typename QueryElemType, template <typename, typename> typename C, typename DistType>
 void MergeKnn<QueryElemType, C, DistType>::Search(const DistType *dist, const RowID *row_ids, u16 count) {
     this->total_count_ += count;
@@ -14,6 +14,8 @@
 
 module;
 
+#include <future>
+
 export module bmp_alg;
 
 import stl;
@@ -141,10 +143,16 @@ public:
 
     Pair<Vector<BMPDocID>, Vector<DataType>> SearchKnn(const SparseVecRef<DataType, IdxType> &query, i32 topk, const BmpSearchOptions &options) const;
 
+    // The blocks are filtered and scored by `options.thread_n_` threads of `options.thread_pool_`, each with a range of the blocks
     template <FilterConcept<BMPDocID> Filter = NoneType>
     Pair<Vector<BMPDocID>, Vector<DataType>>
     SearchKnn(const SparseVecRef<DataType, IdxType> &query, i32 topk, const BmpSearchOptions &options, const Filter &filter) const;
 
+    // The queries are searched in parallel on `options.thread_pool_`, one thread for each query
+    template <FilterConcept<BMPDocID> Filter = NoneType>
+    Vector<Pair<Vector<BMPDocID>, Vector<DataType>>>
+    SearchKnnBatch(const Vector<SparseVecRef<DataType, IdxType>> &queries, i32 topk, const BmpSearchOptions &options, const Filter &filter) const;
+
     void Save(FileHandler &file_handler) const;
 
     static BMPAlg<DataType, IdxType, CompressType> Load(FileHandler &file_handler);
@@ -152,6 +160,10 @@ public:
     SizeT GetSizeInBytes() const;
 
 private:
+    template <FilterConcept<BMPDocID> Filter>
+    Pair<Vector<BMPDocID>, Vector<DataType>>
+    SearchKnnInner(const SparseVecRef<DataType, IdxType> &query, i32 topk, const BmpSearchOptions &options, const Filter &filter) const;
+
     void WriteAdv(char *&p) const;
 
     static BMPAlg<DataType, IdxType, CompressType> ReadAdv(const char *&p);
@@ -190,7 +202,56 @@ Pair<Vector<BMPDocID>, Vector<DataType>> BMPAlg<DataType, IdxType, CompressType>
     if (options.use_lock_) {
         lock.lock();
     }
+    return SearchKnnInner(query, topk, options, filter);
+}
+
+template <typename DataType, typename IdxType, BMPCompressType CompressType>
+template <FilterConcept<BMPDocID> Filter>
+Vector<Pair<Vector<BMPDocID>, Vector<DataType>>> BMPAlg<DataType, IdxType, CompressType>::SearchKnnBatch(
+    const Vector<SparseVecRef<DataType, IdxType>> &queries,
+    i32 topk,
+    const BmpSearchOptions &options,
+    const Filter &filter) const {
+    std::shared_lock lock(mtx_, std::defer_lock);
+    if (options.use_lock_) {
+        lock.lock();
+    }
 
+    SizeT query_n = queries.size();
+    Vector<Pair<Vector<BMPDocID>, Vector<DataType>>> res(query_n);
+    if (options.thread_pool_ == nullptr || query_n <= 1) {
+        for (SizeT i = 0; i < query_n; ++i) {
+            res[i] = SearchKnnInner(queries[i], topk, options, filter);
+        }
+        return res;
+    }
+
+    BmpSearchOptions query_options = options;
+    query_options.thread_pool_ = nullptr;
+    SizeT task_n = std::min(query_n, options.thread_pool_->size() + 1);
+    auto search_queries = [&](SizeT task_id) {
+        for (SizeT i = task_id; i < query_n; i += task_n) {
+            res[i] = SearchKnnInner(queries[i], topk, query_options, filter);
+        }
+    };
+    Vector<std::future<void>> futs;
+    futs.reserve(task_n - 1);
+    for (SizeT task_id = 1; task_id < task_n; ++task_id) {
+        futs.emplace_back(options.thread_pool_->push([&, task_id](int) { search_queries(task_id); }));
+    }
+    search_queries(0);
+    for (auto &fut : futs) {
+        fut.get();
+    }
+    return res;
+}
+
+template <typename DataType, typename IdxType, BMPCompressType CompressType>
+template <FilterConcept<BMPDocID> Filter>
+Pair<Vector<BMPDocID>, Vector<DataType>> BMPAlg<DataType, IdxType, CompressType>::SearchKnnInner(const SparseVecRef<DataType, IdxType> &query,
+                                                                                                 i32 topk,
+                                                                                                 const BmpSearchOptions &options,
+                                                                                                 const Filter &filter) const {
     SizeT block_size = block_fwd_.block_size();
     SparseVecEle<DataType, IdxType> keeped_query;
     if (options.beta_ < 1.0) {
@@ -209,33 +270,19 @@ Pair<Vector<BMPDocID>, Vector<DataType>> BMPAlg<DataType, IdxType, CompressType>
         options.beta_ < 1.0 ? SparseVecRef<DataType, IdxType>(keeped_query.nnz_, keeped_query.indices_.get(), keeped_query.data_.get()) : query;
 
     DataType threshold = 0.0;
-    SizeT block_num = block_fwd_.block_num();
-    Vector<DataType> upper_bounds(block_num, 0.0);
     for (i32 i = 0; i < query_ref.nnz_; ++i) {
-        // if (i + 1 < query_ref.nnz_) {
-        //     IdxType next_query_term = query_ref.indices_[i + 1];
-        //     bm_ivt_.Prefetch(next_query_term);
-        // }
-        IdxType query_term = query_ref.indices_[i];
-        DataType query_score = query_ref.data_[i];
-        const auto &posting = bm_ivt_.GetPostings(query_term);
-        threshold = std::max(threshold, query_score * posting.kth(topk));
-        posting.data_.Calculate(upper_bounds, query_score);
+        const auto &posting = bm_ivt_.GetPostings(query_ref.indices_[i]);
+        threshold = std::max(threshold, query_ref.data_[i] * posting.kth(topk));
     }
 
-    Vector<Pair<DataType, BMPBlockID>> block_scores;
-    for (SizeT block_id = 0; block_id < block_num; ++block_id) {
-        if (upper_bounds[block_id] >= threshold) {
-            block_scores.emplace_back(upper_bounds[block_id], block_id);
-        }
+    SizeT block_num = block_fwd_.block_num();
+    SizeT thread_n = 1;
+    if (options.thread_pool_ != nullptr) {
+        thread_n = options.thread_n_ > 0 ? SizeT(options.thread_n_) : std::min(options.thread_pool_->size() + 1, block_num / BMP_MIN_BLOCKS_PER_THREAD);
+        thread_n = std::max(SizeT(1), std::min(thread_n, block_num));
     }
-    std::sort(block_scores.begin(), block_scores.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
-
-    Vector<BMPDocID> result(topk);
-    Vector<DataType> result_score(topk);
-    HeapResultHandler<CompareMin<DataType, BMPDocID>> result_handler(1 /*query_n*/, topk, result_score.data(), result.data());
 
-    auto add_result = [&](DataType score, BMPDocID doc_id) {
+    auto add_result = [&](auto &result_handler, DataType score, BMPDocID doc_id) {
         if constexpr (std::is_same_v<Filter, std::nullptr_t>) {
             result_handler.AddResult(0 /*query_id*/, score, doc_id);
         } else {
@@ -245,22 +292,78 @@ Pair<Vector<BMPDocID>, Vector<DataType>> BMPAlg<DataType, IdxType, CompressType>
         }
     };
 
-    SizeT block_scores_num = block_scores.size();
-    for (SizeT i = 0; i < block_scores_num; ++i) {
-        if (i + 1 < block_scores_num) {
-            BMPBlockID next_block_id = block_scores[i + 1].second;
-            block_fwd_.Prefetch(next_block_id);
+    Vector<DataType> upper_bounds(block_num, 0.0);
+    // the max k-th score of the threads, no block with a lower upper bound can add a result
+    Atomic<DataType> kth_score(std::numeric_limits<DataType>::lowest());
+    Vector<Vector<BMPDocID>> thread_results(thread_n, Vector<BMPDocID>(topk));
+    Vector<Vector<DataType>> thread_result_scores(thread_n, Vector<DataType>(topk));
+    Vector<SizeT> thread_result_ns(thread_n);
+
+    auto search_blocks = [&](SizeT thread_id) {
+        BMPBlockID block_begin = block_num * thread_id / thread_n;
+        BMPBlockID block_end = block_num * (thread_id + 1) / thread_n;
+        for (i32 i = 0; i < query_ref.nnz_; ++i) {
+            const auto &posting = bm_ivt_.GetPostings(query_ref.indices_[i]);
+            posting.data_.Calculate(upper_bounds, query_ref.data_[i], block_begin, block_end);
         }
-        const auto &[ub_score, block_id] = block_scores[i];
-        BMPDocID off = block_id * block_size;
-        Vector<DataType> scores = block_fwd_.GetScores(block_id, query_ref);
-        for (SizeT block_off = 0; block_off < scores.size(); ++block_off) {
-            BMPDocID doc_id = off + block_off;
-            DataType score = scores[block_off];
-            add_result(score, doc_id);
+
+        Vector<Pair<DataType, BMPBlockID>> block_scores;
+        for (BMPBlockID block_id = block_begin; block_id < block_end; ++block_id) {
+            if (upper_bounds[block_id] >= threshold) {
+                block_scores.emplace_back(upper_bounds[block_id], block_id);
+            }
         }
-        if (ub_score * options.alpha_ < result_handler.GetDistance0(0 /*query_id*/)) {
-            break;
+        std::sort(block_scores.begin(), block_scores.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+
+        HeapResultHandler<CompareMin<DataType, BMPDocID>> result_handler(1 /*query_n*/,
+                                                                         topk,
+                                                                         thread_result_scores[thread_id].data(),
+                                                                         thread_results[thread_id].data());
+        SizeT block_scores_num = block_scores.size();
+        for (SizeT i = 0; i < block_scores_num; ++i) {
+            const auto &[ub_score, block_id] = block_scores[i];
+            if (ub_score * options.alpha_ < kth_score.load(std::memory_order_relaxed)) {
+                break;
+            }
+            if (i + 1 < block_scores_num) {
+                BMPBlockID next_block_id = block_scores[i + 1].second;
+                block_fwd_.Prefetch(next_block_id);
+            }
+            BMPDocID off = block_id * block_size;
+            Vector<DataType> scores = block_fwd_.GetScores(block_id, query_ref);
+            for (SizeT block_off = 0; block_off < scores.size(); ++block_off) {
+                add_result(result_handler, scores[block_off], off + block_off);
+            }
+            if (result_handler.GetSize(0 /*query_id*/) == (u32)topk) {
+                DataType score = result_handler.GetDistance0(0 /*query_id*/);
+                DataType cur_score = kth_score.load(std::memory_order_relaxed);
+                while (cur_score < score && !kth_score.compare_exchange_weak(cur_score, score, std::memory_order_relaxed)) {
+                }
+            }
+        }
+        thread_result_ns[thread_id] = result_handler.GetSize(0 /*query_id*/);
+    };
+
+    if (thread_n == 1) {
+        search_blocks(0);
+    } else {
+        Vector<std::future<void>> futs;
+        futs.reserve(thread_n - 1);
+        for (SizeT thread_id = 1; thread_id < thread_n; ++thread_id) {
+            futs.emplace_back(options.thread_pool_->push([&, thread_id](int) { search_blocks(thread_id); }));
+        }
+        search_blocks(0);
+        for (auto &fut : futs) {
+            fut.get();
+        }
+    }
+
+    Vector<BMPDocID> result(topk);
+    Vector<DataType> result_score(topk);
+    HeapResultHandler<CompareMin<DataType, BMPDocID>> result_handler(1 /*query_n*/, topk, result_score.data(), result.data());
+    for (SizeT thread_id = 0; thread_id < thread_n; ++thread_id) {
+        for (SizeT i = 0; i < thread_result_ns[thread_id]; ++i) {
+            result_handler.AddResult(0 /*query_id*/, thread_result_scores[thread_id][i], thread_results[thread_id][i]);
         }
     }
 
@@ -269,7 +372,7 @@ Pair<Vector<BMPDocID>, Vector<DataType>> BMPAlg<DataType, IdxType, CompressType>
         for (SizeT i = 0; i < tail_scores.size(); ++i) {
             BMPDocID doc_id = block_num * block_size + i;
             DataType score = tail_scores[i];
-            add_result(score, doc_id);
+            add_result(result_handler, score, doc_id);
         }
     }
 
@@ -25,12 +25,21 @@ import infinity_exception;
 namespace infinity {
 
 template <typename DataType>
-void BlockData<DataType, BMPCompressType::kCompressed>::Calculate(Vector<DataType> &upper_bounds, DataType query_score) const {
-    SizeT block_size = block_ids_.size();
-    for (SizeT i = 0; i < block_size; ++i) {
-        BMPBlockID block_id = block_ids_[i];
-        DataType score = max_scores_[i];
-        upper_bounds[block_id] += score * query_score;
+void BlockData<DataType, BMPCompressType::kCompressed>::Calculate(Vector<DataType> &upper_bounds,
+                                                                  DataType query_score,
+                                                                  BMPBlockID block_begin,
+                                                                  BMPBlockID block_end) const {
+    // the block ids are added in ascending order
+    SizeT begin = std::lower_bound(block_ids_.begin(), block_ids_.end(), block_begin) - block_ids_.begin();
+    SizeT end = std::lower_bound(block_ids_.begin() + begin, block_ids_.end(), block_end) - block_ids_.begin();
+    if constexpr (std::is_same_v<DataType, f32>) {
+        MultiF32StoreI32(block_ids_.data() + begin, max_scores_.data() + begin, upper_bounds.data(), query_score, end - begin);
+    } else {
+        for (SizeT i = begin; i < end; ++i) {
+            BMPBlockID block_id = block_ids_[i];
+            DataType score = max_scores_[i];
+            upper_bounds[block_id] += score * query_score;
+        }
     }
 }
 
@@ -50,10 +59,21 @@ template struct BlockData<f32, BMPCompressType::kCompressed>;
 template struct BlockData<f64, BMPCompressType::kCompressed>;
 
 template <typename DataType>
-void BlockData<DataType, BMPCompressType::kRaw>::Calculate(Vector<DataType> &upper_bounds, DataType query_score) const {
-    for (BMPBlockID block_id = 0; block_id < (BMPBlockID)max_scores_.size(); ++block_id) {
-        if (max_scores_[block_id] > 0.0) {
-            upper_bounds[block_id] += max_scores_[block_id] * query_score;
+void BlockData<DataType, BMPCompressType::kRaw>::Calculate(Vector<DataType> &upper_bounds,
+                                                           DataType query_score,
+                                                           BMPBlockID block_begin,
+                                                           BMPBlockID block_end) const {
+    block_end = std::min(block_end, (BMPBlockID)max_scores_.size());
+    if (block_begin >= block_end) {
+        return;
+    }
+    if constexpr (std::is_same_v<DataType, f32>) {
+        MultiF32AddPositiveF32(max_scores_.data() + block_begin, upper_bounds.data() + block_begin, query_score, block_end - block_begin);
+    } else {
+        for (BMPBlockID block_id = block_begin; block_id < block_end; ++block_id) {
+            if (max_scores_[block_id] > 0.0) {
+                upper_bounds[block_id] += max_scores_[block_id] * query_score;
+            }
         }
     }
 }
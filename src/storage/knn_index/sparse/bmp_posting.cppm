@@ -27,7 +27,8 @@ struct BlockData {};
 template <typename DataType>
 struct BlockData<DataType, BMPCompressType::kCompressed> {
 public:
-    void Calculate(Vector<DataType> &upper_bounds, DataType query_score) const;
+    // add the max scores of the blocks in [block_begin, block_end) multiplied by `query_score` to `upper_bounds`
+    void Calculate(Vector<DataType> &upper_bounds, DataType query_score, BMPBlockID block_begin, BMPBlockID block_end) const;
 
     void AddBlock(BMPBlockID block_id, DataType max_score);
 
@@ -45,8 +46,7 @@ private:
 export template <typename DataType>
 struct BlockData<DataType, BMPCompressType::kRaw> {
 public:
-    // template <bool UseSIMD = false>
-    void Calculate(Vector<DataType> &upper_bounds, DataType query_score) const;
+    void Calculate(Vector<DataType> &upper_bounds, DataType query_score, BMPBlockID block_begin, BMPBlockID block_end) const;
 
     void AddBlock(BMPBlockID block_id, DataType max_score);
 
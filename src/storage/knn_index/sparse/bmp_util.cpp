@@ -53,6 +53,13 @@ BmpSearchOptions BMPUtil::ParseBmpSearchOptions(const Vector<UniquePtr<InitParam
                 continue;
             }
             options.use_lock_ = IsEqual(opt_param->param_value_, "T");
+        } else if (opt_param->param_name_ == "threads") {
+            i32 thread_n = std::stoi(opt_param->param_value_);
+            if (thread_n < 0) {
+                LOG_WARN("Invalid threads value, should be >= 0");
+                continue;
+            }
+            options.thread_n_ = thread_n;
         }
     }
     return options;
@@ -60,8 +60,14 @@ export struct BmpSearchOptions {
     f32 beta_ = 1.0;
     bool use_tail_ = true;
     bool use_lock_ = true;
+    // threads filtering the blocks of a query, 0 to choose by the number of the blocks. Only used with `thread_pool_`
+    i32 thread_n_ = 0;
+    ThreadPool *thread_pool_ = nullptr;
 };
 
+// the least blocks filtered by each thread of a query
+export constexpr SizeT BMP_MIN_BLOCKS_PER_THREAD = 4096;
+
 export struct BMPOptimizeOptions {
     i32 topk_ = 0;
     bool bp_reorder_ = false;
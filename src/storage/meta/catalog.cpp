@@ -16,6 +16,7 @@ module;
 
 #include <cassert>
 #include <fstream>
+#include <future>
 #include <thread>
 #include <vector>
 
@@ -60,6 +61,7 @@ import block_column_entry;
 import segment_index_entry;
 import chunk_index_entry;
 import log_file;
+import catalog_page;
 
 namespace infinity {
 
@@ -495,7 +497,7 @@ Tuple<SpecialFunction *, Status> Catalog::GetSpecialFunctionByNameNoExcept(Catal
     return {catalog->special_functions_[function_name].get(), Status::OK()};
 }
 
-nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts) {
+nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts, CatalogPageWriter *page_writer) {
     nlohmann::json json_res;
     json_res["data_dir"] = *this->data_dir_;
     TransactionID next_txn_id = this->next_txn_id_;
@@ -505,7 +507,7 @@ nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts) {
     {
         auto [_, db_meta_ptrs, meta_lock] = db_meta_map_.GetAllMetaGuard();
         for (DBMeta *db_meta_ptr : db_meta_ptrs) {
-            json_res["databases"].emplace_back(db_meta_ptr->Serialize(max_commit_ts));
+            json_res["databases"].emplace_back(db_meta_ptr->Serialize(max_commit_ts, page_writer));
         }
     }
 
@@ -642,7 +644,10 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
                 auto column_defs = add_table_entry_op->column_defs_;
                 auto entry_type = add_table_entry_op->table_entry_type_;
                 auto row_count = add_table_entry_op->row_count_;
-                SegmentID unsealed_id = add_table_entry_op->unsealed_id_;
+                Vector<SegmentID> unsealed_ids = add_table_entry_op->unsealed_ids_;
+                if (unsealed_ids.empty()) {
+                    unsealed_ids.push_back(add_table_entry_op->unsealed_id_);
+                }
                 SegmentID next_segment_id = add_table_entry_op->next_segment_id_;
 
                 auto *db_entry = this->GetDatabaseReplay(db_name, txn_id, begin_ts);
@@ -662,7 +667,7 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
                                                                 begin_ts,
                                                                 commit_ts,
                                                                 row_count,
-                                                                unsealed_id,
+                                                                unsealed_ids,
                                                                 next_segment_id);
                         },
                         txn_id,
@@ -680,7 +685,7 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
                                                         begin_ts,
                                                         commit_ts,
                                                         row_count,
-                                                        unsealed_id,
+                                                        unsealed_ids,
                                                         next_segment_id);
                 };
                 if (merge_flag == MergeFlag::kNew || merge_flag == MergeFlag::kDeleteAndNew) {
@@ -956,14 +961,14 @@ UniquePtr<Catalog> Catalog::LoadFromFile(const String &data_dir, const FullCatal
         UnrecoverableError(status.message());
     }
     SizeT file_size = fs.GetFileSize(*catalog_file_handler);
-    String json_str(file_size, 0);
-    SizeT n_bytes = catalog_file_handler->Read(json_str.data(), file_size);
+    String catalog_str(file_size, 0);
+    SizeT n_bytes = catalog_file_handler->Read(catalog_str.data(), file_size);
     if (file_size != n_bytes) {
         Status status = Status::CatalogCorrupted(catalog_path);
         RecoverableError(status);
     }
 
-    nlohmann::json catalog_json = nlohmann::json::parse(json_str);
+    nlohmann::json catalog_json = DecodeCatalogCheckpoint(catalog_path, catalog_str);
     return Deserialize(data_dir, catalog_json, buffer_mgr);
 }
 
@@ -995,10 +1000,12 @@ void Catalog::SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_catalog_p
     String full_path = fmt::format("{}/{}", *catalog_dir_, CatalogFile::FullCheckpointFilename(max_commit_ts));
     String catalog_tmp_path = fmt::format("{}/{}", *catalog_dir_, CatalogFile::TempFullCheckpointFilename(max_commit_ts));
 
-    // Serialize catalog to string
+    // Serialize catalog to string, the table entries are written into the pages
     full_ckp_commit_ts_ = max_commit_ts;
-    nlohmann::json catalog_json = Serialize(max_commit_ts);
-    String catalog_str = catalog_json.dump();
+    CatalogPageWriter page_writer(*catalog_dir_, max_commit_ts, &table_change_tracker_);
+    nlohmann::json catalog_json = Serialize(max_commit_ts, &page_writer);
+    page_writer.Finish();
+    String catalog_str = EncodeCatalogCheckpoint(catalog_json);
 
     // Save catalog to tmp file.
     // FIXME: Temp implementation, will be replaced by async task.
@@ -1023,10 +1030,13 @@ void Catalog::SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_catalog_p
     catalog_file_handler->Rename(catalog_tmp_path, full_path);
 
     global_catalog_delta_entry_->InitFullCheckpointTs(max_commit_ts);
+    referenced_page_files_ = page_writer.referenced_files();
 
     LOG_DEBUG(fmt::format("Saved catalog to: {}", full_path));
 }
 
+void Catalog::RecyclePagesFile() { CatalogFile::RecyclePagesFile(referenced_page_files_, *catalog_dir_); }
+
 // called by bg_task
 bool Catalog::SaveDeltaCatalog(TxnTimeStamp last_ckp_ts, TxnTimeStamp &max_commit_ts, String &delta_catalog_path, String &delta_catalog_name) {
     // Pick the delta entry to flush and set the max commit ts.
@@ -1060,6 +1070,8 @@ bool Catalog::SaveDeltaCatalog(TxnTimeStamp last_ckp_ts, TxnTimeStamp &max_commi
             default:
                 break;
         }
+        // the flushed data changes the checkpoint state of the entry, added after the flush is done
+        table_change_tracker_.AddChange(*op->encode_, op->commit_ts_);
     }
 
     // Save the global catalog delta entry to disk.
@@ -1092,9 +1104,19 @@ bool Catalog::SaveDeltaCatalog(TxnTimeStamp last_ckp_ts, TxnTimeStamp &max_commi
     return true;
 }
 
-void Catalog::AddDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry) { global_catalog_delta_entry_->AddDeltaEntry(std::move(delta_entry)); }
+void Catalog::AddDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry) {
+    for (const auto &op : delta_entry->operations()) {
+        table_change_tracker_.AddChange(*op->encode_, op->commit_ts_);
+    }
+    global_catalog_delta_entry_->AddDeltaEntry(std::move(delta_entry));
+}
 
-void Catalog::ReplayDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry) { global_catalog_delta_entry_->ReplayDeltaEntry(std::move(delta_entry)); }
+void Catalog::ReplayDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry) {
+    for (const auto &op : delta_entry->operations()) {
+        table_change_tracker_.AddChange(*op->encode_, op->commit_ts_);
+    }
+    global_catalog_delta_entry_->ReplayDeltaEntry(std::move(delta_entry));
+}
 
 void Catalog::PickCleanup(CleanupScanner *scanner) { db_meta_map_.PickCleanup(scanner); }
 
@@ -1122,12 +1144,31 @@ void Catalog::MemIndexCommitLoop() {
 }
 
 void Catalog::MemIndexRecover(BufferManager *buffer_manager, TxnTimeStamp ts) {
+    // The memory indexes of different tables are independent, recover them concurrently
+    Vector<TableMeta *> table_metas;
+    Vector<std::shared_lock<std::shared_mutex>> table_meta_locks;
     auto db_meta_map_guard = db_meta_map_.GetMetaMap();
     for (auto &[_, db_meta] : *db_meta_map_guard) {
         auto [db_entry, status] = db_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
-        if (status.ok()) {
-            db_entry->MemIndexRecover(buffer_manager, ts);
+        if (!status.ok()) {
+            continue;
         }
+        auto [table_names, db_table_metas, table_meta_lock] = db_entry->GetAllTableMetas();
+        table_metas.insert(table_metas.end(), db_table_metas.begin(), db_table_metas.end());
+        table_meta_locks.push_back(std::move(table_meta_lock));
+    }
+
+    ThreadPool &recover_thread_pool = InfinityContext::instance().GetAppendThreadPool();
+    Vector<std::future<void>> futures;
+    futures.reserve(table_metas.size());
+    for (TableMeta *table_meta : table_metas) {
+        futures.emplace_back(recover_thread_pool.push([table_meta, buffer_manager, ts](int) { table_meta->MemIndexRecover(buffer_manager, ts); }));
+    }
+    for (auto &future : futures) {
+        future.wait();
+    }
+    for (auto &future : futures) {
+        future.get();
     }
 }
 
@@ -43,6 +43,7 @@ import column_def;
 import meta_entry_interface;
 import cleanup_scanner;
 import log_file;
+import catalog_page;
 
 namespace infinity {
 
@@ -222,10 +223,14 @@ public:
 
 public:
     // Serialization and Deserialization
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, CatalogPageWriter *page_writer = nullptr);
 
+    // The tables changed since the last full checkpoint are written into a new page file, the others reference their old pages
     void SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_path, String &full_name);
 
+    // Delete the page files no longer referenced, called after the full checkpoint is done
+    void RecyclePagesFile();
+
     bool SaveDeltaCatalog(TxnTimeStamp last_ckp_ts, TxnTimeStamp &max_commit_ts, String &delta_path, String &delta_name);
 
     void AddDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry);
@@ -310,6 +315,10 @@ public:
 
 private:
     UniquePtr<GlobalCatalogDeltaEntry> global_catalog_delta_entry_{MakeUnique<GlobalCatalogDeltaEntry>()};
+
+    TableChangeTracker table_change_tracker_{};
+    // page files referenced by the last full checkpoint
+    Set<String> referenced_page_files_{};
 };
 
 } // namespace infinity
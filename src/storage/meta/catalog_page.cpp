@@ -0,0 +1,174 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+#include <vector>
+
+module catalog_page;
+
+import stl;
+import third_party;
+import file_system;
+import file_system_type;
+import local_file_system;
+import status;
+import infinity_exception;
+import logger;
+import log_file;
+
+namespace infinity {
+
+namespace {
+
+constexpr std::string_view CATALOG_CHECKPOINT_MAGIC = "INFCATLG";
+constexpr u32 CATALOG_CHECKPOINT_VERSION = 1;
+
+} // namespace
+
+nlohmann::json TablePage::Serialize() const {
+    nlohmann::json json_res;
+    json_res["file"] = file_name_;
+    json_res["offset"] = offset_;
+    json_res["size"] = size_;
+    return json_res;
+}
+
+TablePage TablePage::Deserialize(const nlohmann::json &page_json) {
+    TablePage page;
+    page.file_name_ = page_json["file"];
+    page.offset_ = page_json["offset"];
+    page.size_ = page_json["size"];
+    return page;
+}
+
+void TableChangeTracker::AddChange(const String &encode, TxnTimeStamp commit_ts) {
+    SizeT pos = encode.find('#', 1);
+    if (pos == String::npos) {
+        // database entry
+        return;
+    }
+    pos = encode.find('#', pos + 1);
+    String table_encode = encode.substr(0, pos);
+
+    std::unique_lock lock(mtx_);
+    TableChange &change = changes_[std::move(table_encode)];
+    change.version_ = ++version_;
+    change.max_commit_ts_ = std::max(change.max_commit_ts_, commit_ts);
+}
+
+u64 TableChangeTracker::Version() const {
+    std::unique_lock lock(mtx_);
+    return version_;
+}
+
+bool TableChangeTracker::Changed(const String &table_encode, const TablePage &page) const {
+    std::unique_lock lock(mtx_);
+    auto iter = changes_.find(table_encode);
+    if (iter == changes_.end()) {
+        return false;
+    }
+    return iter->second.version_ > page.version_ || iter->second.max_commit_ts_ > page.max_commit_ts_;
+}
+
+CatalogPageWriter::CatalogPageWriter(String catalog_dir, TxnTimeStamp max_commit_ts, const TableChangeTracker *change_tracker)
+    : catalog_dir_(std::move(catalog_dir)), file_name_(CatalogFile::PagesFilename(max_commit_ts)), max_commit_ts_(max_commit_ts),
+      change_tracker_(change_tracker), version_(change_tracker->Version()) {}
+
+CatalogPageWriter::~CatalogPageWriter() {
+    if (file_handler_.get() != nullptr) {
+        file_handler_->Close();
+    }
+}
+
+TablePage CatalogPageWriter::Write(const nlohmann::json &table_meta_json) {
+    String page_path = fmt::format("{}/{}", catalog_dir_, file_name_);
+    if (file_handler_.get() == nullptr) {
+        LocalFileSystem fs;
+        u8 fileflags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG | FileFlags::TRUNCATE_CREATE;
+        auto [file_handler, status] = fs.OpenFile(page_path, fileflags, FileLockType::kWriteLock);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        file_handler_ = std::move(file_handler);
+    }
+    Vector<u8> page_data = nlohmann::json::to_msgpack(table_meta_json);
+    i64 n_bytes = file_handler_->Write(page_data.data(), page_data.size());
+    if (n_bytes != static_cast<i64>(page_data.size())) {
+        Status status = Status::DataCorrupted(page_path);
+        RecoverableError(status);
+    }
+
+    TablePage page{file_name_, offset_, page_data.size(), version_, max_commit_ts_};
+    offset_ += page_data.size();
+    referenced_files_.insert(file_name_);
+    return page;
+}
+
+void CatalogPageWriter::Finish() {
+    if (file_handler_.get() == nullptr) {
+        return;
+    }
+    file_handler_->Sync();
+    file_handler_->Close();
+    file_handler_.reset();
+    LOG_DEBUG(fmt::format("Saved {} bytes of table pages to: {}/{}", offset_, catalog_dir_, file_name_));
+}
+
+nlohmann::json ReadTablePage(const String &catalog_dir, const TablePage &page) {
+    String page_path = fmt::format("{}/{}", catalog_dir, page.file_name_);
+    LocalFileSystem fs;
+    auto [file_handler, status] = fs.OpenFile(page_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+    if (!status.ok()) {
+        UnrecoverableError(status.message());
+    }
+    Vector<u8> page_data(page.size_);
+    i64 n_bytes = fs.ReadAt(*file_handler, page.offset_, page_data.data(), page.size_);
+    file_handler->Close();
+    if (n_bytes != static_cast<i64>(page.size_)) {
+        Status status = Status::CatalogCorrupted(page_path);
+        RecoverableError(status);
+    }
+    return nlohmann::json::from_msgpack(page_data);
+}
+
+String EncodeCatalogCheckpoint(const nlohmann::json &catalog_json) {
+    Vector<u8> catalog_data = nlohmann::json::to_msgpack(catalog_json);
+    String content;
+    content.reserve(CATALOG_CHECKPOINT_MAGIC.size() + sizeof(u32) + catalog_data.size());
+    content.append(CATALOG_CHECKPOINT_MAGIC);
+    u32 version = CATALOG_CHECKPOINT_VERSION;
+    content.append(reinterpret_cast<const char *>(&version), sizeof(version));
+    content.append(reinterpret_cast<const char *>(catalog_data.data()), catalog_data.size());
+    return content;
+}
+
+nlohmann::json DecodeCatalogCheckpoint(const String &catalog_path, const String &content) {
+    SizeT header_size = CATALOG_CHECKPOINT_MAGIC.size() + sizeof(u32);
+    if (content.size() < header_size || std::string_view(content).substr(0, CATALOG_CHECKPOINT_MAGIC.size()) != CATALOG_CHECKPOINT_MAGIC) {
+        // json text of the full checkpoint before the table pages
+        return nlohmann::json::parse(content);
+    }
+    u32 version = 0;
+    std::memcpy(&version, content.data() + CATALOG_CHECKPOINT_MAGIC.size(), sizeof(version));
+    if (version != CATALOG_CHECKPOINT_VERSION) {
+        Status status = Status::CatalogCorrupted(catalog_path);
+        RecoverableError(status);
+    }
+    const auto *data = reinterpret_cast<const u8 *>(content.data()) + header_size;
+    return nlohmann::json::from_msgpack(data, data + (content.size() - header_size));
+}
+
+} // namespace infinity
@@ -0,0 +1,108 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module catalog_page;
+
+import stl;
+import third_party;
+import file_system;
+
+namespace infinity {
+
+// Location of a serialized table meta in a page file written by a full checkpoint.
+// A page holds a whole table meta with all its segments, blocks and indexes, pages are not split below the table: any change
+// of a table rewrites its whole page, and only the pages of unchanged tables are reused.
+export struct TablePage {
+    String file_name_{};
+    u64 offset_{};
+    u64 size_{};
+    // version of the table changes when the full checkpoint writing the page started, 0 for the pages loaded at startup,
+    // see `TableChangeTracker`
+    u64 version_{};
+    // max commit ts of the full checkpoint writing the page, the changes committed after it are not in the page
+    TxnTimeStamp max_commit_ts_{};
+
+    nlohmann::json Serialize() const;
+
+    static TablePage Deserialize(const nlohmann::json &page_json);
+};
+
+// Versions of the changes of each table. Every delta op committed, replayed or flushed changes the table of its entry.
+// A change is added after it is applied to the catalog, so a table serialized after `Version()` is read contains the changes up to it.
+export class TableChangeTracker {
+public:
+    // `encode` is the encode of any entry under a table: "#db#table#...", `commit_ts` is the commit ts of the delta op
+    void AddChange(const String &encode, TxnTimeStamp commit_ts);
+
+    u64 Version() const;
+
+    // Whether the table of `table_encode` has a change which is not in `page`: a change added after the full checkpoint writing
+    // the page started, or a change committed after the max commit ts of that checkpoint.
+    bool Changed(const String &table_encode, const TablePage &page) const;
+
+private:
+    struct TableChange {
+        u64 version_{};
+        TxnTimeStamp max_commit_ts_{};
+    };
+
+    mutable std::mutex mtx_{};
+    u64 version_{0};
+    HashMap<String, TableChange> changes_{};
+};
+
+/*
+    Writes the table metas changed since their last pages into the page file of a full checkpoint, and collects the page files
+    referenced by the full checkpoint. The file is only created when a page is written.
+*/
+export class CatalogPageWriter {
+public:
+    // The version of `change_tracker` is taken here, construct the writer before the catalog is serialized
+    CatalogPageWriter(String catalog_dir, TxnTimeStamp max_commit_ts, const TableChangeTracker *change_tracker);
+
+    ~CatalogPageWriter();
+
+    const TableChangeTracker *change_tracker() const { return change_tracker_; }
+
+    TablePage Write(const nlohmann::json &table_meta_json);
+
+    void AddReference(const String &file_name) { referenced_files_.insert(file_name); }
+
+    // Sync the page file, called before the full checkpoint file is written
+    void Finish();
+
+    const Set<String> &referenced_files() const { return referenced_files_; }
+
+private:
+    String catalog_dir_{};
+    String file_name_{};
+    TxnTimeStamp max_commit_ts_{};
+    const TableChangeTracker *change_tracker_{};
+    u64 version_{};
+    UniquePtr<FileHandler> file_handler_{};
+    u64 offset_{};
+    Set<String> referenced_files_{};
+};
+
+export nlohmann::json ReadTablePage(const String &catalog_dir, const TablePage &page);
+
+// Content of a full checkpoint file: magic, format version and the catalog json in msgpack.
+export String EncodeCatalogCheckpoint(const nlohmann::json &catalog_json);
+
+// Also accepts the json text written by the older versions
+export nlohmann::json DecodeCatalogCheckpoint(const String &catalog_path, const String &content);
+
+} // namespace infinity
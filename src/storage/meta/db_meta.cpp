@@ -111,7 +111,7 @@ SharedPtr<String> DBMeta::ToString() {
     return res;
 }
 
-nlohmann::json DBMeta::Serialize(TxnTimeStamp max_commit_ts) {
+nlohmann::json DBMeta::Serialize(TxnTimeStamp max_commit_ts, CatalogPageWriter *page_writer) {
     nlohmann::json json_res;
 
     json_res["data_dir"] = *this->data_dir_;
@@ -121,7 +121,7 @@ nlohmann::json DBMeta::Serialize(TxnTimeStamp max_commit_ts) {
 
     for (const auto &entry : entry_candidates) {
         DBEntry* db_entry = static_cast<DBEntry*>(entry);
-        json_res["db_entries"].emplace_back(db_entry->Serialize(max_commit_ts));
+        json_res["db_entries"].emplace_back(db_entry->Serialize(max_commit_ts, page_writer));
     }
 
     return json_res;
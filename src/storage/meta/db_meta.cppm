@@ -30,6 +30,7 @@ import entry_list;
 
 import meta_entry_interface;
 import cleanup_scanner;
+import catalog_page;
 
 namespace infinity {
 
@@ -47,7 +48,7 @@ public:
 
     SharedPtr<String> ToString();
 
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, CatalogPageWriter *page_writer = nullptr);
 
     static UniquePtr<DBMeta> Deserialize(const String &data_dir, const nlohmann::json &db_meta_json, BufferManager *buffer_mgr);
 
@@ -53,6 +53,9 @@ export struct AppendState {
 
     Vector<AppendRange> append_ranges_{};
 
+    // segments of the append stream reserved for the rows, in the order they are filled
+    Vector<SharedPtr<SegmentEntry>> reserved_segments_{};
+
     [[nodiscard]] inline bool Finished() const { return current_count_ == total_count_; }
 };
 
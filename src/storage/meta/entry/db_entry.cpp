@@ -195,7 +195,7 @@ TableEntry *DBEntry::GetTableReplay(const String &table_name, TransactionID txn_
     return table_meta->GetEntryReplay(txn_id, begin_ts);
 }
 
-Vector<TableEntry *> DBEntry::TableCollections(TransactionID txn_id, TxnTimeStamp begin_ts) {
+Vector<TableEntry *> DBEntry::TableCollections(TransactionID txn_id, TxnTimeStamp begin_ts, bool loaded_only) {
     Vector<TableEntry *> results;
 
     {
@@ -203,6 +203,9 @@ Vector<TableEntry *> DBEntry::TableCollections(TransactionID txn_id, TxnTimeStam
         results.reserve((*map_guard).size());
         for (auto &table_collection_meta_pair : *map_guard) {
             TableMeta *table_meta = table_collection_meta_pair.second.get();
+            if (loaded_only && !table_meta->Loaded()) {
+                continue;
+            }
             auto [table_entry, status] = table_meta->GetEntryNolock(txn_id, begin_ts);
             if (!status.ok()) {
                 LOG_TRACE(fmt::format("error when get table entry: {} table name: {}", status.message(), *table_meta->table_name_));
@@ -249,7 +252,7 @@ SharedPtr<String> DBEntry::ToString() {
     return res;
 }
 
-nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts) {
+nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts, CatalogPageWriter *page_writer) {
     nlohmann::json json_res;
 
     json_res["db_name"] = *this->db_name_;
@@ -265,7 +268,7 @@ nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts) {
     {
         auto [_, table_meta_ptrs, meta_lock] = table_meta_map_.GetAllMetaGuard();
         for (TableMeta *table_meta : table_meta_ptrs) {
-            json_res["tables"].emplace_back(table_meta->Serialize(max_commit_ts));
+            json_res["tables"].emplace_back(table_meta->Serialize(max_commit_ts, page_writer));
         }
     }
 
@@ -324,19 +327,12 @@ void DBEntry::Cleanup() {
 void DBEntry::MemIndexCommit() {
     auto table_meta_map_guard = table_meta_map_.GetMetaMap();
     for (auto &[_, table_meta] : *table_meta_map_guard) {
-        auto [table_entry, status] = table_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
-        if (status.ok()) {
-            table_entry->MemIndexCommit();
+        if (!table_meta->Loaded()) {
+            continue;
         }
-    }
-}
-
-void DBEntry::MemIndexRecover(BufferManager *buffer_manager, TxnTimeStamp ts) {
-    auto table_meta_map_guard = table_meta_map_.GetMetaMap();
-    for (auto &[_, table_meta] : *table_meta_map_guard) {
         auto [table_entry, status] = table_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
         if (status.ok()) {
-            table_entry->MemIndexRecover(buffer_manager, ts);
+            table_entry->MemIndexCommit();
         }
     }
 }
@@ -31,6 +31,7 @@ import meta_map;
 import random;
 import meta_entry_interface;
 import cleanup_scanner;
+import catalog_page;
 
 namespace infinity {
 
@@ -74,7 +75,7 @@ public:
 public:
     SharedPtr<String> ToString();
 
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, CatalogPageWriter *page_writer = nullptr);
 
     static UniquePtr<DBEntry> Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr);
 
@@ -121,7 +122,8 @@ public:
 
     TableEntry *GetTableReplay(const String &table_name, TransactionID txn_id, TxnTimeStamp begin_ts);
 
-    Vector<TableEntry *> TableCollections(TransactionID txn_id, TxnTimeStamp begin_ts);
+    // With `loaded_only`, skip the tables not loaded since the startup, see `TableMeta::Load`
+    Vector<TableEntry *> TableCollections(TransactionID txn_id, TxnTimeStamp begin_ts, bool loaded_only = false);
 
     Status GetTablesDetail(Txn *txn, Vector<TableDetail> &output_table_array);
 
@@ -154,6 +156,5 @@ public:
     void Cleanup() override;
 
     void MemIndexCommit();
-    void MemIndexRecover(BufferManager *buffer_manager, TxnTimeStamp ts);
 };
 } // namespace infinity
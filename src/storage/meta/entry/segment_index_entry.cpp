@@ -192,6 +192,7 @@ Vector<UniquePtr<IndexFileWorker>> SegmentIndexEntry::CreateFileWorkers(SharedPt
         case IndexType::kFullText:
         case IndexType::kEMVB:
         case IndexType::kSecondary:
+        case IndexType::kBitmap:
         case IndexType::kBMP:
         case IndexType::kDiskAnn: {
             // these indexes don't use BufferManager
@@ -302,7 +303,8 @@ void SegmentIndexEntry::MemIndexInsert(SharedPtr<BlockEntry> block_entry,
             memory_hnsw_index_->InsertVecs(block_offset, block_column_entry, buffer_manager, row_offset, row_count);
             break;
         }
-        case IndexType::kSecondary: {
+        case IndexType::kSecondary:
+        case IndexType::kBitmap: {
             if (memory_secondary_index_.get() == nullptr) {
                 std::unique_lock<std::shared_mutex> lck(rw_locker_);
                 memory_secondary_index_ = SecondaryIndexInMem::NewSecondaryIndexInMem(column_def, begin_row_id);
@@ -391,7 +393,8 @@ SharedPtr<ChunkIndexEntry> SegmentIndexEntry::MemIndexDump(bool spill, SizeT *du
             }
             break;
         }
-        case IndexType::kSecondary: {
+        case IndexType::kSecondary:
+        case IndexType::kBitmap: {
             if (memory_secondary_index_.get() == nullptr) {
                 break;
             }
@@ -464,7 +467,8 @@ u32 SegmentIndexEntry::MemIndexRowCount() {
         case IndexType::kHnsw: {
             return memory_hnsw_index_.get() ? memory_hnsw_index_->GetRowCount() : 0;
         }
-        case IndexType::kSecondary: {
+        case IndexType::kSecondary:
+        case IndexType::kBitmap: {
             return memory_secondary_index_.get() ? memory_secondary_index_->GetRowCount() : 0;
         }
         case IndexType::kEMVB: {
@@ -525,7 +529,20 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             auto memory_hnsw_index = HnswIndexInMem::Make(base_row_id, index_base, column_def.get(), this);
             HnswInsertConfig insert_config;
             insert_config.optimize_ = true;
-            memory_hnsw_index->InsertVecs(segment_entry, buffer_mgr, column_def->id(), begin_ts, config.check_ts_, insert_config);
+            if (const auto *compact_base = config.compact_base_; compact_base != nullptr) {
+                // Only insert the vectors that are not in the reused graph
+                memory_hnsw_index->LoadBase(compact_base->chunk_index_entry_.get(), compact_base->remap_);
+                memory_hnsw_index->InsertVecs(segment_entry,
+                                              buffer_mgr,
+                                              column_def->id(),
+                                              begin_ts,
+                                              config.check_ts_,
+                                              compact_base->skip_begin_,
+                                              compact_base->skip_end_,
+                                              insert_config);
+            } else {
+                memory_hnsw_index->InsertVecs(segment_entry, buffer_mgr, column_def->id(), begin_ts, config.check_ts_, insert_config);
+            }
 
             dumped_memindex_entry = memory_hnsw_index->Dump(this, buffer_manager_);
             dumped_memindex_entry->SaveIndexFile();
@@ -535,7 +552,8 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             }
             break;
         }
-        case IndexType::kSecondary: {
+        case IndexType::kSecondary:
+        case IndexType::kBitmap: {
             memory_secondary_index_ = SecondaryIndexInMem::NewSecondaryIndexInMem(column_def, base_row_id);
             u64 column_id = column_def->id();
             auto block_entry_iter = BlockEntryIter(segment_entry);
@@ -594,13 +612,14 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
     }
 }
 
-Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts) {
+Status
+SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts, const CompactIndexBase *compact_base) {
     TxnTimeStamp begin_ts = txn->BeginTS();
     auto *buffer_mgr = txn->buffer_mgr();
     const IndexBase *index_base = table_index_entry_->index_base();
     const ColumnDef *column_def = table_index_entry_->column_def().get();
 
-    PopulateEntireConfig populate_entire_config{.prepare_ = prepare, .check_ts_ = check_ts};
+    PopulateEntireConfig populate_entire_config{.prepare_ = prepare, .check_ts_ = check_ts, .compact_base_ = compact_base};
     switch (index_base->index_type_) {
         case IndexType::kIVFFlat: {
             if (column_def->type()->type() != LogicalType::kEmbedding) {
@@ -636,6 +655,7 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
         case IndexType::kHnsw:
         case IndexType::kFullText:
         case IndexType::kSecondary:
+        case IndexType::kBitmap:
         case IndexType::kEMVB:
         case IndexType::kBMP: {
             PopulateEntirely(segment_entry, txn, populate_entire_config);
@@ -881,7 +901,8 @@ SegmentIndexEntry::GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT se
         case IndexType::kFullText: {
             return MakeUnique<CreateIndexParam>(index_base, column_def);
         }
-        case IndexType::kSecondary: {
+        case IndexType::kSecondary:
+        case IndexType::kBitmap: {
             return MakeUnique<CreateSecondaryIndexParam>(index_base, column_def, seg_row_count);
         }
         case IndexType::kEMVB: {
@@ -979,7 +1000,8 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
             merged_chunk_index_entry = memory_bmp_index->Dump(this, buffer_mgr);
             break;
         }
-        case IndexType::kSecondary: {
+        case IndexType::kSecondary:
+        case IndexType::kBitmap: {
             merged_chunk_index_entry = CreateSecondaryIndexChunkIndexEntry(base_rowid, row_count, buffer_mgr);
             BufferHandle handle = merged_chunk_index_entry->GetIndex();
             auto data_ptr = static_cast<SecondaryIndexData *>(handle.GetDataMut());
@@ -50,9 +50,19 @@ class SecondaryIndexInMem;
 class EMVBIndexInMem;
 class BMPIndexInMem;
 
+// An index chunk of a compacted segment that the new segment's index starts from instead of being rebuilt, only for hnsw now.
+// `remap_` maps the offsets in the compacted segment to the new segment, and they must cover [skip_begin_, skip_end_) of the new segment.
+export struct CompactIndexBase {
+    SharedPtr<ChunkIndexEntry> chunk_index_entry_{};
+    std::function<SegmentOffset(SegmentOffset)> remap_{};
+    SegmentOffset skip_begin_{};
+    SegmentOffset skip_end_{};
+};
+
 export struct PopulateEntireConfig {
     bool prepare_;
     bool check_ts_;
+    const CompactIndexBase *compact_base_ = nullptr;
 };
 
 export class SegmentIndexEntry : public BaseEntry, public EntryInterface {
@@ -137,7 +147,7 @@ public:
 
     u32 MemIndexRowCount();
 
-    Status CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts);
+    Status CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts, const CompactIndexBase *compact_base = nullptr);
 
     Status CreateIndexDo(atomic_u64 &create_index_idx);
 
@@ -56,6 +56,7 @@ import parsed_expr;
 import constant_expr;
 import infinity_context;
 import persistence_manager;
+import config;
 
 namespace infinity {
 
@@ -86,14 +87,20 @@ TableEntry::TableEntry(bool is_delete,
                        TableMeta *table_meta,
                        TransactionID txn_id,
                        TxnTimeStamp begin_ts,
-                       SegmentID unsealed_id,
+                       Vector<SegmentID> unsealed_ids,
                        SegmentID next_segment_id)
     : BaseEntry(EntryType::kTable, is_delete, table_meta ? base_dir : MakeShared<String>(), TableEntry::EncodeIndex(*table_name, table_meta)),
       table_meta_(table_meta), table_entry_dir_(std::move(table_entry_dir)), table_name_(std::move(table_name)), columns_(columns),
-      table_entry_type_(table_entry_type), unsealed_id_(unsealed_id), next_segment_id_(next_segment_id) {
+      table_entry_type_(table_entry_type), unsealed_ids_(std::move(unsealed_ids)), next_segment_id_(next_segment_id) {
     begin_ts_ = begin_ts;
     txn_id_ = txn_id;
 
+    if (unsealed_ids_.empty()) {
+        unsealed_ids_.push_back(INVALID_SEGMENT_ID);
+    }
+    unsealed_segments_.resize(unsealed_ids_.size());
+    reserved_rows_.resize(unsealed_ids_.size(), 0);
+
     SizeT column_count = columns.size();
     for (SizeT idx = 0; idx < column_count; ++idx) {
         column_name2column_id_[columns[idx]->name()] = idx;
@@ -101,7 +108,12 @@ TableEntry::TableEntry(bool is_delete,
 
     // this->SetCompactionAlg(nullptr);
     if (!is_delete) {
-        this->SetCompactionAlg(MakeUnique<DBTCompactionAlg>(DBT_COMPACTION_M, DBT_COMPACTION_C, DBT_COMPACTION_S, DEFAULT_SEGMENT_CAPACITY, this));
+        this->SetCompactionAlg(MakeUnique<DBTCompactionAlg>(DBT_COMPACTION_M,
+                                                            DBT_COMPACTION_C,
+                                                            DBT_COMPACTION_S,
+                                                            DEFAULT_SEGMENT_CAPACITY,
+                                                            this,
+                                                            DBT_COMPACTION_DELETE_RATIO));
         compaction_alg_->Enable({});
     }
 }
@@ -130,10 +142,18 @@ SharedPtr<TableEntry> TableEntry::NewTableEntry(bool is_delete,
                                   table_meta,
                                   txn_id,
                                   begin_ts,
-                                  INVALID_SEGMENT_ID,
+                                  TableEntry::NewUnsealedIDs(),
                                   0 /*next_segment_id*/);
 }
 
+Vector<SegmentID> TableEntry::NewUnsealedIDs() {
+    SizeT append_stream_count = 1;
+    if (Config *config = InfinityContext::instance().config(); config != nullptr) {
+        append_stream_count = config->AppendStreamCount();
+    }
+    return Vector<SegmentID>(append_stream_count, INVALID_SEGMENT_ID);
+}
+
 SharedPtr<TableEntry> TableEntry::ReplayTableEntry(bool is_delete,
                                                    TableMeta *table_meta,
                                                    SharedPtr<String> base_dir,
@@ -145,7 +165,7 @@ SharedPtr<TableEntry> TableEntry::ReplayTableEntry(bool is_delete,
                                                    TxnTimeStamp begin_ts,
                                                    TxnTimeStamp commit_ts,
                                                    SizeT row_count,
-                                                   SegmentID unsealed_id,
+                                                   Vector<SegmentID> unsealed_ids,
                                                    SegmentID next_segment_id) noexcept {
     auto table_entry = MakeShared<TableEntry>(is_delete,
                                               std::move(base_dir),
@@ -156,7 +176,7 @@ SharedPtr<TableEntry> TableEntry::ReplayTableEntry(bool is_delete,
                                               table_meta,
                                               txn_id,
                                               begin_ts,
-                                              unsealed_id,
+                                              std::move(unsealed_ids),
                                               next_segment_id);
     // TODO need to check if commit_ts influence replay catalog delta entry
     table_entry->commit_ts_.store(commit_ts);
@@ -229,7 +249,9 @@ void TableEntry::UpdateEntryReplay(const SharedPtr<TableEntry> &table_entry) {
     begin_ts_ = table_entry->begin_ts_;
     commit_ts_.store(table_entry->commit_ts_);
     row_count_ = table_entry->row_count();
-    unsealed_id_ = table_entry->unsealed_id();
+    unsealed_ids_ = table_entry->unsealed_ids();
+    unsealed_segments_.resize(unsealed_ids_.size());
+    reserved_rows_.resize(unsealed_ids_.size(), 0);
     next_segment_id_ = table_entry->next_segment_id();
 }
 
@@ -296,8 +318,12 @@ void TableEntry::AddSegmentReplay(SharedPtr<SegmentEntry> new_segment) {
     if (compaction_alg_.get() != nullptr) {
         compaction_alg_->AddSegment(new_segment.get());
     }
-    if (segment_id == unsealed_id_) {
-        unsealed_segment_ = std::move(new_segment);
+    for (SizeT stream_idx = 0; stream_idx < unsealed_ids_.size(); ++stream_idx) {
+        if (segment_id == unsealed_ids_[stream_idx]) {
+            reserved_rows_[stream_idx] = new_segment->row_count();
+            unsealed_segments_[stream_idx] = std::move(new_segment);
+            break;
+        }
     }
 }
 
@@ -352,6 +378,7 @@ void TableEntry::Import(SharedPtr<SegmentEntry> segment_entry, Txn *txn) {
         switch (index_base->index_type_) {
             case IndexType::kFullText:
             case IndexType::kSecondary:
+            case IndexType::kBitmap:
             case IndexType::kEMVB:
             case IndexType::kHnsw:
             case IndexType::kBMP: {
@@ -387,9 +414,43 @@ void TableEntry::AddCompactNew(SharedPtr<SegmentEntry> segment_entry) {
     }
 }
 
-void TableEntry::AppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, BufferManager *buffer_mgr, bool is_replay) {
-    SizeT row_count = 0;
+void TableEntry::ReserveAppend(TransactionID txn_id, void *txn_store) {
+    TxnTableStore *txn_store_ptr = (TxnTableStore *)txn_store;
+    AppendState *append_state_ptr = txn_store_ptr->GetAppendState();
+    Txn *txn = txn_store_ptr->GetTxn();
+    SizeT to_reserve = append_state_ptr->total_count_ - append_state_ptr->current_count_;
+    if (to_reserve == 0) {
+        return;
+    }
 
+    std::unique_lock<std::shared_mutex> rw_locker(this->rw_locker_); // prevent another read conflict with this append operation
+    SizeT stream_idx = AppendStreamIdx(txn_id);
+    SharedPtr<SegmentEntry> &unsealed_segment = unsealed_segments_[stream_idx];
+    SizeT &reserved_rows = reserved_rows_[stream_idx];
+    while (to_reserve > 0) {
+        if (unsealed_segment.get() == nullptr || reserved_rows >= unsealed_segment->row_capacity()) {
+            // unsealed segment of the stream is unpopulated or full
+            if (unsealed_segment.get() != nullptr) {
+                // The segment is full, need to be set sealed.
+                txn_store_ptr->AddSealedSegment(unsealed_segment.get());
+            }
+
+            SegmentID new_segment_id = this->next_segment_id_++;
+
+            unsealed_segment = SegmentEntry::NewSegmentEntry(this, new_segment_id, txn);
+            unsealed_ids_[stream_idx] = new_segment_id;
+            reserved_rows = 0;
+            this->segment_map_.emplace(new_segment_id, unsealed_segment);
+            LOG_TRACE(fmt::format("Created a new segment {} for append stream {}", new_segment_id, stream_idx));
+        }
+        SizeT reserved = std::min(to_reserve, unsealed_segment->row_capacity() - reserved_rows);
+        reserved_rows += reserved;
+        to_reserve -= reserved;
+        append_state_ptr->reserved_segments_.push_back(unsealed_segment);
+    }
+}
+
+void TableEntry::AppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, BufferManager *buffer_mgr, bool is_replay) {
     // Read-only no lock needed.
     if (this->Deleted()) {
         String error_message = "Table is deleted";
@@ -398,7 +459,6 @@ void TableEntry::AppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp
     }
     TxnTableStore *txn_store_ptr = (TxnTableStore *)txn_store;
     AppendState *append_state_ptr = txn_store_ptr->GetAppendState();
-    Txn *txn = txn_store_ptr->GetTxn();
     if (append_state_ptr->Finished()) {
         // Import update row count
         if (append_state_ptr->blocks_.empty()) {
@@ -410,38 +470,37 @@ void TableEntry::AppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp
         return;
     }
 
-    while (!append_state_ptr->Finished()) {
-        {
-            std::unique_lock<std::shared_mutex> rw_locker(this->rw_locker_); // prevent another read conflict with this append operation
-            if (unsealed_segment_.get() == nullptr || unsealed_segment_->Room() <= 0) {
-                // unsealed_segment_ is unpopulated or full
-                if (unsealed_segment_.get() != nullptr) {
-                    // The segment is full, need to be set sealed.
-                    txn_store_ptr->AddSealedSegment(unsealed_segment_.get());
-                }
+    this->row_count_ += CopyAppendData(txn_id, txn_store, commit_ts, buffer_mgr, is_replay);
+}
 
-                SegmentID new_segment_id = this->next_segment_id_++;
+SizeT TableEntry::CopyAppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, BufferManager *buffer_mgr, bool is_replay) {
+    SizeT row_count = 0;
 
-                this->unsealed_segment_ = SegmentEntry::NewSegmentEntry(this, new_segment_id, txn);
-                // FIXME: Why not use new_segment_id directly?
-                unsealed_id_ = unsealed_segment_->segment_id();
-                this->segment_map_.emplace(new_segment_id, this->unsealed_segment_);
-                LOG_TRACE(fmt::format("Created a new segment {}", new_segment_id));
-            }
-        }
-        u64 actual_appended = unsealed_segment_->AppendData(txn_id, commit_ts, append_state_ptr, buffer_mgr, txn);
+    TxnTableStore *txn_store_ptr = (TxnTableStore *)txn_store;
+    AppendState *append_state_ptr = txn_store_ptr->GetAppendState();
+    Txn *txn = txn_store_ptr->GetTxn();
+    if (append_state_ptr->reserved_segments_.empty()) {
+        ReserveAppend(txn_id, txn_store);
+    }
 
-        LOG_TRACE(fmt::format("Segment {} is appended with {} rows", this->unsealed_segment_->segment_id(), actual_appended));
+    // Only this txn appends to the reserved rows, no table lock needed.
+    for (const auto &segment_entry : append_state_ptr->reserved_segments_) {
+        u64 actual_appended = segment_entry->AppendData(txn_id, commit_ts, append_state_ptr, buffer_mgr, txn);
+
+        LOG_TRACE(fmt::format("Segment {} is appended with {} rows", segment_entry->segment_id(), actual_appended));
         row_count += actual_appended;
     }
+    if (!append_state_ptr->Finished()) {
+        String error_message = fmt::format("Append {} rows, but {} rows are reserved", append_state_ptr->current_count_, append_state_ptr->total_count_);
+        UnrecoverableError(error_message);
+    }
 
     // Needn't inserting into MemIndex since MemIndexRecover is responsible for recovering MemIndex
     if (!is_replay) {
         // Realtime index insertion.
         MemIndexInsert(txn, append_state_ptr->append_ranges_);
     }
-
-    this->row_count_ += row_count;
+    return row_count;
 }
 
 Status TableEntry::Delete(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, DeleteState &delete_state) {
@@ -657,6 +716,7 @@ void TableEntry::MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges) {
             case IndexType::kFullText:
             case IndexType::kEMVB:
             case IndexType::kSecondary:
+            case IndexType::kBitmap:
             case IndexType::kBMP: {
                 for (auto &[seg_id, ranges] : seg_append_ranges) {
                     MemIndexInsertInner(table_index_entry, txn, seg_id, ranges);
@@ -688,7 +748,7 @@ void TableEntry::MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *tx
             table_index_entry->UpdateFulltextSegmentTs(txn->CommitTS());
         }
     }
-    table_index_entry->last_segment_ = segment_index_entry;
+    table_index_entry->AddLastSegment(segment_index_entry);
     Vector<SharedPtr<BlockEntry>> block_entries;
     SizeT num_ranges = append_ranges.size();
     SizeT dump_idx = SizeT(-1);
@@ -723,6 +783,10 @@ void TableEntry::MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *tx
             }
         }
     }
+    if (segment_entry->Room() <= 0) {
+        // the stream goes on with a new segment
+        table_index_entry->RemoveLastSegment(seg_id);
+    }
 }
 
 // void TableEntry::MemIndexDump(Txn *txn, bool spill) {
@@ -835,8 +899,8 @@ void TableEntry::MemIndexRecover(BufferManager *buffer_manager, TxnTimeStamp ts)
                 message = fmt::format("Table {}.{} index {} segment {} MemIndex recovered.", *GetDBName(), *table_name_, index_name, segment_id);
                 LOG_INFO(message);
             }
-            if (segment_id == unsealed_id_) {
-                table_index_entry->last_segment_ = segment_index_entry;
+            if (IsUnsealedID(segment_id)) {
+                table_index_entry->AddLastSegment(segment_index_entry);
             }
         }
     }
@@ -904,6 +968,7 @@ void TableEntry::OptimizeIndex(Txn *txn) {
             case IndexType::kHnsw:
             case IndexType::kEMVB:
             case IndexType::kSecondary:
+            case IndexType::kBitmap:
             case IndexType::kBMP: {
                 TxnTimeStamp begin_ts = txn->BeginTS();
                 auto segment_index_guard = table_index_entry->GetSegmentIndexesGuard();
@@ -953,6 +1018,16 @@ SharedPtr<SegmentEntry> TableEntry::GetSegmentByID(SegmentID seg_id, Txn *txn) c
     return segment;
 }
 
+Pair<Vector<SegmentID>, SegmentID> TableEntry::GetAppendStreams() {
+    std::shared_lock lock(this->rw_locker_);
+    return {unsealed_ids_, next_segment_id_};
+}
+
+bool TableEntry::IsUnsealedID(SegmentID segment_id) const {
+    std::shared_lock lock(this->rw_locker_);
+    return std::find(unsealed_ids_.begin(), unsealed_ids_.end(), segment_id) != unsealed_ids_.end();
+}
+
 Pair<SizeT, Status> TableEntry::GetSegmentRowCountBySegmentID(u32 seg_id) {
     auto iter = this->segment_map_.find(seg_id);
     if (iter != this->segment_map_.end()) {
@@ -1054,7 +1129,8 @@ nlohmann::json TableEntry::Serialize(TxnTimeStamp max_commit_ts) {
             checkpoint_row_count += segment_entry->checkpoint_row_count();
         }
         json_res["row_count"] = checkpoint_row_count;
-        json_res["unsealed_id"] = unsealed_id_;
+        json_res["unsealed_id"] = unsealed_ids_[0];
+        json_res["unsealed_ids"] = unsealed_ids_;
 
         // Serialize indexes
         SizeT table_index_count = table_index_meta_candidates.size();
@@ -1106,7 +1182,12 @@ UniquePtr<TableEntry> TableEntry::Deserialize(const nlohmann::json &table_entry_
 
     TransactionID txn_id = table_entry_json["txn_id"];
     TxnTimeStamp begin_ts = table_entry_json["begin_ts"];
-    SegmentID unsealed_id = table_entry_json["unsealed_id"];
+    Vector<SegmentID> unsealed_ids;
+    if (table_entry_json.contains("unsealed_ids")) {
+        unsealed_ids = table_entry_json["unsealed_ids"].get<Vector<SegmentID>>();
+    } else {
+        unsealed_ids.push_back(table_entry_json["unsealed_id"]);
+    }
     SegmentID next_segment_id = table_entry_json["next_segment_id"];
 
     UniquePtr<TableEntry> table_entry = MakeUnique<TableEntry>(deleted,
@@ -1118,7 +1199,7 @@ UniquePtr<TableEntry> TableEntry::Deserialize(const nlohmann::json &table_entry_
                                                                table_meta,
                                                                txn_id,
                                                                begin_ts,
-                                                               unsealed_id,
+                                                               std::move(unsealed_ids),
                                                                next_segment_id);
     table_entry->row_count_ = row_count;
 
@@ -1127,9 +1208,13 @@ UniquePtr<TableEntry> TableEntry::Deserialize(const nlohmann::json &table_entry_
             SharedPtr<SegmentEntry> segment_entry = SegmentEntry::Deserialize(segment_json, table_entry.get(), buffer_mgr);
             table_entry->segment_map_.emplace(segment_entry->segment_id(), segment_entry);
         }
-        // here the unsealed_segment_ may be nullptr
-        if (table_entry->segment_map_.find(unsealed_id) != table_entry->segment_map_.end()) {
-            table_entry->unsealed_segment_ = table_entry->segment_map_.at(unsealed_id);
+        // here the unsealed segment of a stream may be nullptr
+        for (SizeT stream_idx = 0; stream_idx < table_entry->unsealed_ids_.size(); ++stream_idx) {
+            auto iter = table_entry->segment_map_.find(table_entry->unsealed_ids_[stream_idx]);
+            if (iter != table_entry->segment_map_.end()) {
+                table_entry->unsealed_segments_[stream_idx] = iter->second;
+                table_entry->reserved_rows_[stream_idx] = iter->second->row_count();
+            }
         }
     }
 
@@ -1191,13 +1276,27 @@ void TableEntry::AddDeleteToCompactionAlg(SegmentID segment_id) {
     compaction_alg_->DeleteInSegment(segment_id);
 }
 
-Vector<SegmentEntry *> TableEntry::CheckCompaction(TransactionID txn_id) {
+Vector<SegmentEntry *> TableEntry::CheckCompaction(TransactionID txn_id, TxnTimeStamp begin_ts) {
     if (compaction_alg_.get() == nullptr) {
         return {};
     }
+    compaction_alg_->SetIndexRebuildCost(CompactionIndexRebuildCost(txn_id, begin_ts));
     return compaction_alg_->CheckCompaction(txn_id);
 }
 
+f64 TableEntry::CompactionIndexRebuildCost(TransactionID txn_id, TxnTimeStamp begin_ts) {
+    f64 cost = 1; // copy the row
+    auto index_meta_map_guard = index_meta_map_.GetMetaMap();
+    for (auto &[index_name, table_index_meta] : *index_meta_map_guard) {
+        auto [table_index_entry, status] = table_index_meta->GetEntryNolock(txn_id, begin_ts);
+        if (!status.ok()) {
+            continue;
+        }
+        cost += CompactionIndexCost(table_index_entry->index_base()->index_type_);
+    }
+    return cost;
+}
+
 bool TableEntry::CompactPrepare() const {
     if (compaction_alg_.get() == nullptr) {
         LOG_WARN(fmt::format("Table {} compaction algorithm not set", *this->GetTableName()));
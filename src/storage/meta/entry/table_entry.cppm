@@ -75,7 +75,7 @@ public:
                         TableMeta *table_meta,
                         TransactionID txn_id,
                         TxnTimeStamp begin_ts,
-                        SegmentID unsealed_id,
+                        Vector<SegmentID> unsealed_ids,
                         SegmentID next_segment_id);
 
     static SharedPtr<TableEntry> NewTableEntry(bool is_delete,
@@ -88,6 +88,9 @@ public:
                                                TransactionID txn_id,
                                                TxnTimeStamp begin_ts);
 
+    // Unsealed segment ids of a new table, one per append stream
+    static Vector<SegmentID> NewUnsealedIDs();
+
     static SharedPtr<TableEntry> ReplayTableEntry(bool is_delete,
                                                   TableMeta *table_meta,
                                                   SharedPtr<String> base_dir,
@@ -99,7 +102,7 @@ public:
                                                   TxnTimeStamp begin_ts,
                                                   TxnTimeStamp commit_ts,
                                                   SizeT row_count,
-                                                  SegmentID unsealed_id,
+                                                  Vector<SegmentID> unsealed_ids,
                                                   SegmentID next_segment_id) noexcept;
 
 public:
@@ -155,8 +158,18 @@ public:
 
     void AddCompactNew(SharedPtr<SegmentEntry> segment_entry);
 
+    // Reserve the rows of the txn in the unsealed segments of its append stream. Called in commit order, so that the rows are placed
+    // the same when the wal is replayed.
+    void ReserveAppend(TransactionID txn_id, void *txn_store);
+
     void AppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, BufferManager *buffer_mgr, bool is_replay = false);
 
+    // Copy the rows into the segments reserved by `ReserveAppend` and return the number of rows, the row count of the table is
+    // left to the caller. The appends of different streams don't share any segment and may run concurrently.
+    SizeT CopyAppendData(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, BufferManager *buffer_mgr, bool is_replay = false);
+
+    void IncreaseRowCount(SizeT row_count) { row_count_ += row_count; }
+
     void RollbackAppend(TransactionID txn_id, TxnTimeStamp commit_ts, void *txn_store);
 
     Status Delete(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, DeleteState &delete_state);
@@ -221,7 +234,19 @@ public:
 
     inline TableEntryType EntryType() const { return table_entry_type_; }
 
-    SegmentID unsealed_id() const { return unsealed_id_; }
+    // unsealed segment of the first append stream
+    SegmentID unsealed_id() const { return unsealed_ids_[0]; }
+
+    const Vector<SegmentID> &unsealed_ids() const { return unsealed_ids_; }
+
+    bool IsUnsealedID(SegmentID segment_id) const;
+
+    // unsealed segment ids and next segment id
+    Pair<Vector<SegmentID>, SegmentID> GetAppendStreams();
+
+    SizeT AppendStreamCount() const { return unsealed_ids_.size(); }
+
+    SizeT AppendStreamIdx(TransactionID txn_id) const { return txn_id % unsealed_ids_.size(); }
 
     Pair<SizeT, Status> GetSegmentRowCountBySegmentID(u32 seg_id);
 
@@ -284,8 +309,11 @@ private:
     // From data table
     Atomic<SizeT> row_count_{}; // this is actual row count
     Map<SegmentID, SharedPtr<SegmentEntry>> segment_map_{};
-    SharedPtr<SegmentEntry> unsealed_segment_{};
-    SegmentID unsealed_id_{};
+    // Each append stream has its own unsealed segment, a committing txn appends to the stream of its txn id.
+    Vector<SharedPtr<SegmentEntry>> unsealed_segments_{};
+    Vector<SegmentID> unsealed_ids_{};
+    // rows of the unsealed segment reserved by the appends, including the ones not copied yet
+    Vector<SizeT> reserved_rows_{};
     Atomic<SegmentID> next_segment_id_{};
 
     // for full text search cache
@@ -299,7 +327,10 @@ public:
 
     void AddDeleteToCompactionAlg(SegmentID segment_id);
 
-    Vector<SegmentEntry *> CheckCompaction(TransactionID txn_id);
+    Vector<SegmentEntry *> CheckCompaction(TransactionID txn_id, TxnTimeStamp begin_ts);
+
+    // Cost of compacting one row with all indexes visible to the txn rebuilt, relative to copying the row only
+    f64 CompactionIndexRebuildCost(TransactionID txn_id, TxnTimeStamp begin_ts);
 
     bool CompactPrepare() const;
 
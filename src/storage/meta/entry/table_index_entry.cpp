@@ -259,19 +259,52 @@ SharedPtr<TableIndexEntry> TableIndexEntry::Deserialize(const nlohmann::json &in
 }
 
 void TableIndexEntry::MemIndexCommit() {
-    if (last_segment_.get() != nullptr) {
-        last_segment_->MemIndexCommit();
+    Vector<SharedPtr<SegmentIndexEntry>> last_segments;
+    {
+        std::lock_guard lck(last_segments_mtx_);
+        for (const auto &[segment_id, segment_index_entry] : last_segments_) {
+            last_segments.push_back(segment_index_entry);
+        }
+    }
+    for (auto &segment_index_entry : last_segments) {
+        segment_index_entry->MemIndexCommit();
     }
 }
 
 SharedPtr<ChunkIndexEntry> TableIndexEntry::MemIndexDump(Txn *txn, TxnTableStore *txn_table_store, bool spill, SizeT *dump_size) {
-    if (last_segment_.get() == nullptr) {
-        return nullptr;
+    Vector<SharedPtr<SegmentIndexEntry>> last_segments;
+    {
+        std::lock_guard lck(last_segments_mtx_);
+        for (const auto &[segment_id, segment_index_entry] : last_segments_) {
+            last_segments.push_back(segment_index_entry);
+        }
     }
-    auto chunk_index_entry = last_segment_->MemIndexDump(spill, dump_size);
-    txn_table_store->AddChunkIndexStore(this, chunk_index_entry.get());
-    last_segment_->AddWalIndexDump(chunk_index_entry.get(), txn);
-    return chunk_index_entry;
+    SharedPtr<ChunkIndexEntry> last_chunk_index_entry = nullptr;
+    for (auto &segment_index_entry : last_segments) {
+        SizeT segment_dump_size = 0;
+        auto chunk_index_entry = segment_index_entry->MemIndexDump(spill, &segment_dump_size);
+        if (dump_size != nullptr) {
+            *dump_size += segment_dump_size;
+        }
+        if (chunk_index_entry.get() == nullptr) {
+            continue;
+        }
+        txn_table_store->AddChunkIndexStore(this, chunk_index_entry.get());
+        segment_index_entry->AddWalIndexDump(chunk_index_entry.get(), txn);
+        last_chunk_index_entry = std::move(chunk_index_entry);
+    }
+    return last_chunk_index_entry;
+}
+
+void TableIndexEntry::AddLastSegment(SharedPtr<SegmentIndexEntry> segment_index_entry) {
+    std::lock_guard lck(last_segments_mtx_);
+    SegmentID segment_id = segment_index_entry->segment_id();
+    last_segments_[segment_id] = std::move(segment_index_entry);
+}
+
+void TableIndexEntry::RemoveLastSegment(SegmentID segment_id) {
+    std::lock_guard lck(last_segments_mtx_);
+    last_segments_.erase(segment_id);
 }
 
 SharedPtr<SegmentIndexEntry> TableIndexEntry::PopulateEntirely(SegmentEntry *segment_entry, Txn *txn, const PopulateEntireConfig &config) {
@@ -280,6 +313,7 @@ SharedPtr<SegmentIndexEntry> TableIndexEntry::PopulateEntirely(SegmentEntry *seg
         case IndexType::kEMVB:
         case IndexType::kFullText:
         case IndexType::kSecondary:
+        case IndexType::kBitmap:
         case IndexType::kBMP: {
             break;
         }
@@ -297,14 +331,18 @@ SharedPtr<SegmentIndexEntry> TableIndexEntry::PopulateEntirely(SegmentEntry *seg
 }
 
 Tuple<Vector<SegmentIndexEntry *>, Status>
-TableIndexEntry::CreateIndexPrepare(BaseTableRef *table_ref, Txn *txn, bool prepare, bool is_replay, bool check_ts) {
+TableIndexEntry::CreateIndexPrepare(BaseTableRef *table_ref,
+                                    Txn *txn,
+                                    bool prepare,
+                                    bool is_replay,
+                                    bool check_ts,
+                                    const HashMap<SegmentID, CompactIndexBase> *compact_bases) {
     TableEntry *table_entry = table_ref->table_entry_ptr_;
     auto &block_index = table_ref->block_index_;
     if (table_ref->index_index_.get() == nullptr) {
         table_ref->index_index_ = MakeShared<IndexIndex>();
     }
     Vector<SegmentIndexEntry *> segment_index_entries;
-    SegmentID unsealed_id = table_entry->unsealed_id();
     for (const auto &[segment_id, segment_info] : block_index->segment_block_index_) {
         SegmentOffset segment_offset = segment_info.segment_offset_;
 
@@ -312,13 +350,19 @@ TableIndexEntry::CreateIndexPrepare(BaseTableRef *table_ref, Txn *txn, bool prep
         auto *segment_entry = segment_info.segment_entry_;
         SharedPtr<SegmentIndexEntry> segment_index_entry = SegmentIndexEntry::NewIndexEntry(this, segment_id, txn, create_index_param.get());
         if (!is_replay) {
-            segment_index_entry->CreateIndexPrepare(segment_entry, txn, prepare, check_ts);
+            const CompactIndexBase *compact_base = nullptr;
+            if (compact_bases != nullptr) {
+                if (auto iter = compact_bases->find(segment_id); iter != compact_bases->end()) {
+                    compact_base = &iter->second;
+                }
+            }
+            segment_index_entry->CreateIndexPrepare(segment_entry, txn, prepare, check_ts, compact_base);
         }
         std::unique_lock w_lock(rw_locker_);
         index_by_segment_.emplace(segment_id, segment_index_entry);
         segment_index_entries.push_back(segment_index_entry.get());
-        if (unsealed_id == segment_id) {
-            last_segment_ = segment_index_entry;
+        if (table_entry->IsUnsealedID(segment_id)) {
+            AddLastSegment(segment_index_entry);
         }
     }
     return {segment_index_entries, Status::OK()};
@@ -113,15 +113,26 @@ public:
     void MemIndexCommit();
 
     // MemIndexCommit is blocking.
-    // Dump or spill the memory indexer
+    // Dump or spill the memory indexers, the last dumped chunk is returned
     SharedPtr<ChunkIndexEntry> MemIndexDump(Txn *txn, TxnTableStore *txn_table_store, bool spill = false, SizeT *dump_size = nullptr);
 
+    // The segment being appended by an append stream of the table, its memory index is committed and dumped by the above
+    void AddLastSegment(SharedPtr<SegmentIndexEntry> segment_index_entry);
+
+    // Called when the segment is full and its memory index is dumped
+    void RemoveLastSegment(SegmentID segment_id);
+
     // PopulateEntirely is blocking.
     // Populate index entirely for the segment
     SharedPtr<SegmentIndexEntry> PopulateEntirely(SegmentEntry *segment_entry, Txn *txn, const PopulateEntireConfig &config);
 
     Tuple<Vector<SegmentIndexEntry *>, Status>
-    CreateIndexPrepare(BaseTableRef *table_ref, Txn *txn, bool prepare, bool is_replay, bool check_ts = true);
+    CreateIndexPrepare(BaseTableRef *table_ref,
+                       Txn *txn,
+                       bool prepare,
+                       bool is_replay,
+                       bool check_ts = true,
+                       const HashMap<SegmentID, CompactIndexBase> *compact_bases = nullptr);
 
     Status CreateIndexDo(BaseTableRef *table_ref, HashMap<SegmentID, atomic_u64> &create_index_idxes, Txn *txn);
 
@@ -158,7 +169,9 @@ private:
     SharedPtr<ColumnDef> column_def_{};
 
     Map<SegmentID, SharedPtr<SegmentIndexEntry>> index_by_segment_{};
-    SharedPtr<SegmentIndexEntry> last_segment_{};
+    // One per append stream of the table, guarded by last_segments_mtx_ since the streams insert concurrently
+    std::mutex last_segments_mtx_{};
+    Map<SegmentID, SharedPtr<SegmentIndexEntry>> last_segments_{};
 
 public:
     void Cleanup() override;
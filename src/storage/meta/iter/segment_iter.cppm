@@ -139,6 +139,32 @@ private:
     SizeT cap_;
 };
 
+// Skip the rows in [skip_begin, skip_end), e.g. the rows already covered by an index reused from a compacted segment
+export template <typename DataType, bool CheckTS>
+class SkipRangeOneColumnIterator : public OneColumnIterator<DataType, CheckTS> {
+public:
+    SkipRangeOneColumnIterator(const SegmentEntry *entry,
+                               BufferManager *buffer_mgr,
+                               ColumnID column_id,
+                               TxnTimeStamp iterate_ts,
+                               SegmentOffset skip_begin,
+                               SegmentOffset skip_end)
+        : OneColumnIterator<DataType, CheckTS>(entry, buffer_mgr, column_id, iterate_ts), skip_begin_(skip_begin), skip_end_(skip_end) {}
+
+    Optional<Pair<const DataType *, SegmentOffset>> Next() {
+        while (true) {
+            auto ret = OneColumnIterator<DataType, CheckTS>::Next();
+            if (!ret || ret->second < skip_begin_ || ret->second >= skip_end_) {
+                return ret;
+            }
+        }
+    }
+
+private:
+    SegmentOffset skip_begin_;
+    SegmentOffset skip_end_;
+};
+
 export template <typename DataType, typename IdxType, bool CheckTS>
 class OneColumnIterator<SparseVecRef<DataType, IdxType>, CheckTS> {
 public:
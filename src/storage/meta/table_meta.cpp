@@ -34,6 +34,7 @@ import status;
 import infinity_exception;
 import column_def;
 import block_index;
+import catalog_page;
 
 namespace infinity {
 
@@ -65,6 +66,7 @@ Tuple<TableEntry *, Status> TableMeta::CreateEntry(std::shared_lock<std::shared_
                                                    TxnTimeStamp begin_ts,
                                                    TxnManager *txn_mgr,
                                                    ConflictType conflict_type) {
+    Load();
     auto init_table_entry = [&](TransactionID txn_id, TxnTimeStamp begin_ts) {
         return TableEntry::NewTableEntry(false, this->base_dir_, this->db_entry_dir_, table_name, columns, table_entry_type, this, txn_id, begin_ts);
     };
@@ -77,6 +79,7 @@ Tuple<SharedPtr<TableEntry>, Status> TableMeta::DropEntry(std::shared_lock<std::
                                                           TxnManager *txn_mgr,
                                                           const String &table_name,
                                                           ConflictType conflict_type) {
+    Load();
     auto init_drop_entry = [&](TransactionID txn_id, TxnTimeStamp begin_ts) {
         Vector<SharedPtr<ColumnDef>> dummy_columns;
         return TableEntry::NewTableEntry(true,
@@ -93,6 +96,7 @@ Tuple<SharedPtr<TableEntry>, Status> TableMeta::DropEntry(std::shared_lock<std::
 }
 
 Tuple<SharedPtr<TableInfo>, Status> TableMeta::GetTableInfo(std::shared_lock<std::shared_mutex> &&r_lock, Txn *txn) {
+    Load();
     TransactionID txn_id = txn->TxnID();
     TxnTimeStamp begin_ts = txn->BeginTS();
     auto [table_entry, status] = table_entry_list_.GetEntry(std::move(r_lock), txn_id, begin_ts);
@@ -112,11 +116,15 @@ Tuple<SharedPtr<TableInfo>, Status> TableMeta::GetTableInfo(std::shared_lock<std
     return {table_info, status};
 }
 
-void TableMeta::DeleteEntry(TransactionID txn_id) { auto erase_list = table_entry_list_.DeleteEntry(txn_id); }
+void TableMeta::DeleteEntry(TransactionID txn_id) {
+    Load();
+    auto erase_list = table_entry_list_.DeleteEntry(txn_id);
+}
 
 void TableMeta::CreateEntryReplay(std::function<SharedPtr<TableEntry>(TransactionID, TxnTimeStamp)> &&init_entry,
                                   TransactionID txn_id,
                                   TxnTimeStamp begin_ts) {
+    Load();
     auto [entry, status] = table_entry_list_.AddEntryReplay(std::move(init_entry), txn_id, begin_ts);
     if (!status.ok()) {
         UnrecoverableError(status.message());
@@ -126,6 +134,7 @@ void TableMeta::CreateEntryReplay(std::function<SharedPtr<TableEntry>(Transactio
 void TableMeta::UpdateEntryReplay(std::function<void(SharedPtr<TableEntry>, TransactionID, TxnTimeStamp)> &&update_entry,
                                   TransactionID txn_id,
                                   TxnTimeStamp begin_ts) {
+    Load();
     auto status = table_entry_list_.UpdateEntryReplay(std::move(update_entry), txn_id, begin_ts);
     if (!status.ok()) {
         UnrecoverableError(status.message());
@@ -135,6 +144,7 @@ void TableMeta::UpdateEntryReplay(std::function<void(SharedPtr<TableEntry>, Tran
 void TableMeta::DropEntryReplay(std::function<SharedPtr<TableEntry>(TransactionID, TxnTimeStamp)> &&init_entry,
                                 TransactionID txn_id,
                                 TxnTimeStamp begin_ts) {
+    Load();
     auto [dropped_entry, status] = table_entry_list_.DropEntryReplay(std::move(init_entry), txn_id, begin_ts);
     if (!status.ok()) {
         UnrecoverableError(status.message());
@@ -142,6 +152,7 @@ void TableMeta::DropEntryReplay(std::function<SharedPtr<TableEntry>(TransactionI
 }
 
 TableEntry *TableMeta::GetEntryReplay(TransactionID txn_id, TxnTimeStamp begin_ts) {
+    Load();
     auto [entry, status] = table_entry_list_.GetEntryReplay(txn_id, begin_ts);
     if (!status.ok()) {
         UnrecoverableError(status.message());
@@ -157,12 +168,32 @@ SharedPtr<String> TableMeta::ToString() {
     return res;
 }
 
-nlohmann::json TableMeta::Serialize(TxnTimeStamp max_commit_ts) {
+nlohmann::json TableMeta::Serialize(TxnTimeStamp max_commit_ts, CatalogPageWriter *page_writer) {
     nlohmann::json json_res;
 
     json_res["db_entry_dir"] = *this->db_entry_dir_;
     json_res["table_name"] = *this->table_name_;
 
+    if (page_writer != nullptr) {
+        const TableChangeTracker *change_tracker = page_writer->change_tracker();
+        Optional<TablePage> page;
+        {
+            std::unique_lock lock(page_mtx_);
+            page = page_;
+        }
+        if (!page.has_value() || change_tracker->Changed(TableEntry::EncodeIndex(*table_name_, this), *page)) {
+            // The changes added after the page writer took its version, or committed after max_commit_ts, are written by the next full checkpoint
+            page = page_writer->Write(Serialize(max_commit_ts));
+
+            std::unique_lock lock(page_mtx_);
+            page_ = page;
+        }
+        page_writer->AddReference(page->file_name_);
+        json_res["page"] = page->Serialize();
+        return json_res;
+    }
+
+    Load();
     Vector<BaseEntry *> entry_candidates = table_entry_list_.GetCandidateEntry(max_commit_ts, EntryType::kTable);
 
     for (const auto &entry : entry_candidates) {
@@ -180,6 +211,7 @@ nlohmann::json TableMeta::Serialize(TxnTimeStamp max_commit_ts) {
  *        LIST: [👇(a new entry).... table_entry2 , table_entry1 , dummy_entry]
  *        The raw catalog is json, so the dummy entry is not included.
  *        The dummy entry is added during the deserialization.
+ *        If the table entries are in a page of the full checkpoint, they are loaded on the first access.
  * @param table_meta_json
  * @param db_entry
  * @param buffer_mgr
@@ -188,25 +220,79 @@ nlohmann::json TableMeta::Serialize(TxnTimeStamp max_commit_ts) {
 UniquePtr<TableMeta> TableMeta::Deserialize(const nlohmann::json &table_meta_json, DBEntry *db_entry, BufferManager *buffer_mgr) {
     SharedPtr<String> db_entry_dir = MakeShared<String>(table_meta_json["db_entry_dir"]);
     SharedPtr<String> table_name = MakeShared<String>(table_meta_json["table_name"]);
-    LOG_TRACE(fmt::format("load table {}", *table_name));
     UniquePtr<TableMeta> table_meta = MakeUnique<TableMeta>(db_entry->base_dir(), db_entry_dir, table_name, db_entry);
+    if (table_meta_json.contains("page")) {
+        LOG_TRACE(fmt::format("table {} is loaded on the first access", *table_name));
+        table_meta->page_ = TablePage::Deserialize(table_meta_json["page"]);
+        table_meta->buffer_mgr_ = buffer_mgr;
+        table_meta->loaded_.store(false);
+        return table_meta;
+    }
+    table_meta->LoadEntries(table_meta_json, buffer_mgr);
+
+    return table_meta;
+}
+
+void TableMeta::LoadEntries(const nlohmann::json &table_meta_json, BufferManager *buffer_mgr) {
+    LOG_TRACE(fmt::format("load table {}", *table_name_));
     if (table_meta_json.contains("table_entries")) {
         for (const auto &table_entry_json : table_meta_json["table_entries"]) {
-            UniquePtr<TableEntry> table_entry = TableEntry::Deserialize(table_entry_json, table_meta.get(), buffer_mgr);
-            table_meta->PushBackEntry(std::move(table_entry));
+            UniquePtr<TableEntry> table_entry = TableEntry::Deserialize(table_entry_json, this, buffer_mgr);
+            PushBackEntry(std::move(table_entry));
         }
     }
-    table_meta->Sort();
+    Sort();
+}
 
-    return table_meta;
+void TableMeta::Load() {
+    if (loaded_.load()) {
+        return;
+    }
+    std::unique_lock lock(page_mtx_);
+    if (loaded_.load()) {
+        return;
+    }
+    String catalog_dir = fmt::format("{}/{}", *base_dir_, CATALOG_FILE_DIR);
+    LoadEntries(ReadTablePage(catalog_dir, *page_), buffer_mgr_);
+    if (memindex_recover_ts_.has_value()) {
+        auto [table_entry, status] = table_entry_list_.GetEntryNolock(0UL, MAX_TIMESTAMP);
+        if (status.ok()) {
+            table_entry->MemIndexRecover(buffer_mgr_, *memindex_recover_ts_);
+        }
+    }
+    loaded_.store(true);
+    LOG_INFO(fmt::format("Loaded table {} from page file {}", *table_name_, page_->file_name_));
+}
+
+void TableMeta::MemIndexRecover(BufferManager *buffer_mgr, TxnTimeStamp ts) {
+    {
+        std::unique_lock lock(page_mtx_);
+        if (!loaded_.load()) {
+            memindex_recover_ts_ = ts;
+            return;
+        }
+    }
+    auto [table_entry, status] = table_entry_list_.GetEntryNolock(0UL, MAX_TIMESTAMP);
+    if (status.ok()) {
+        table_entry->MemIndexRecover(buffer_mgr, ts);
+    }
 }
 
 void TableMeta::Sort() { table_entry_list_.SortEntryListByTS(); }
 
 void TableMeta::PushBackEntry(const SharedPtr<TableEntry> &new_table_entry) { table_entry_list_.PushBackEntry(new_table_entry); }
 
-void TableMeta::Cleanup() { table_entry_list_.Cleanup(); }
+void TableMeta::Cleanup() {
+    Load();
+    table_entry_list_.Cleanup();
+}
 
-bool TableMeta::PickCleanup(CleanupScanner *scanner) { return table_entry_list_.PickCleanup(scanner); }
+bool TableMeta::PickCleanup(CleanupScanner *scanner) {
+    if (!Loaded()) {
+        // Nothing is changed since the table is loaded from the full checkpoint
+        return false;
+    }
+    return table_entry_list_.PickCleanup(scanner);
+}
 
 } // namespace infinity
@@ -31,6 +31,7 @@ import entry_list;
 import meta_info;
 import meta_entry_interface;
 import cleanup_scanner;
+import catalog_page;
 
 namespace infinity {
 
@@ -58,10 +59,18 @@ public:
 
     SharedPtr<String> ToString();
 
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    // With `page_writer`, the table entries are written into a page unless the page of the last full checkpoint is unchanged, and
+    // only the page is referenced by the result. The page is reused or rewritten as a whole, see `TablePage`
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, CatalogPageWriter *page_writer = nullptr);
 
+    // The table entries referenced by a page are loaded on the first access, see `Load`
     static UniquePtr<TableMeta> Deserialize(const nlohmann::json &table_meta_json, DBEntry *db_entry, BufferManager *buffer_mgr);
 
+    bool Loaded() const { return loaded_.load(); }
+
+    // Skip the table if it is not loaded yet, it is recovered when loaded
+    void MemIndexRecover(BufferManager *buffer_mgr, TxnTimeStamp ts);
+
     [[nodiscard]] const SharedPtr<String> &table_name_ptr() const { return table_name_; }
     [[nodiscard]] const String &table_name() const { return *table_name_; }
     [[nodiscard]] const SharedPtr<String> &db_name_ptr() const;
@@ -71,6 +80,8 @@ public:
     DBEntry *db_entry() { return db_entry_; }
 
     List<SharedPtr<TableEntry>> GetAllEntries() const {
+        // loading the entries from the page doesn't change what the meta holds
+        const_cast<TableMeta *>(this)->Load();
         return table_entry_list_.GetAllEntries();
     }
 private:
@@ -93,10 +104,12 @@ private:
     Tuple<SharedPtr<TableInfo>, Status> GetTableInfo(std::shared_lock<std::shared_mutex> &&r_lock, Txn *txn);
 
     Tuple<TableEntry *, Status> GetEntry(std::shared_lock<std::shared_mutex> &&r_lock, TransactionID txn_id, TxnTimeStamp begin_ts) {
+        Load();
         return table_entry_list_.GetEntry(std::move(r_lock), txn_id, begin_ts);
     }
 
     Tuple<TableEntry *, Status> GetEntryNolock(TransactionID txn_id, TxnTimeStamp begin_ts) {
+        Load();
         return table_entry_list_.GetEntryNolock(txn_id, begin_ts);
     }
 
@@ -117,6 +130,11 @@ private:
     void PushBackEntry(const SharedPtr<TableEntry>& new_table_entry);
 
     void Sort();
+
+    void LoadEntries(const nlohmann::json &table_meta_json, BufferManager *buffer_mgr);
+
+    // Deserialize the table entries from the page of the full checkpoint
+    void Load();
 private:
     SharedPtr<String> base_dir_{};
     SharedPtr<String> db_entry_dir_{};
@@ -127,12 +145,19 @@ private:
 private:
     EntryList<TableEntry> table_entry_list_{};
 
+    std::mutex page_mtx_{};
+    // page of the table entries in the last full checkpoint
+    Optional<TablePage> page_{};
+    Atomic<bool> loaded_{true};
+    BufferManager *buffer_mgr_{};
+    Optional<TxnTimeStamp> memindex_recover_ts_{};
+
 public:
     void Cleanup() override;
 
     bool PickCleanup(CleanupScanner *scanner) override;
 
-    bool Empty() override { return table_entry_list_.Empty(); }
+    bool Empty() override { return Loaded() && table_entry_list_.Empty(); }
 };
 
 } // namespace infinity
@@ -121,6 +121,30 @@ void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
 
 CommonQueryFilter::CommonQueryFilter(SharedPtr<BaseExpression> original_filter, SharedPtr<BaseTableRef> base_table_ref, TxnTimeStamp begin_ts)
     : begin_ts_(begin_ts), original_filter_(std::move(original_filter)), base_table_ref_(std::move(base_table_ref)) {
+    InitTasks();
+}
+
+void CommonQueryFilter::Reset(TxnTimeStamp begin_ts) {
+    begin_ts_ = begin_ts;
+    finish_build_.clear(std::memory_order_release);
+    filter_result_.clear();
+    filter_result_row_count_.clear();
+    filter_result_count_ = 0;
+    tasks_.clear();
+    total_task_num_ = 0;
+    begin_task_num_ = 0;
+    end_task_num_ = 0;
+    current_segment_id_ = INVALID_SEGMENT_ID;
+    decode_status_ = 0;
+    doc_id_list_ = nullptr;
+    doc_id_bitmask_ = nullptr;
+    doc_id_list_size_ = 0;
+    pos_ = 0;
+    always_true_ = false;
+    InitTasks();
+}
+
+void CommonQueryFilter::InitTasks() {
     const auto &segment_index = base_table_ref_->block_index_->segment_block_index_;
     if (segment_index.empty()) {
         finish_build_.test_and_set(std::memory_order_release);
@@ -224,6 +248,7 @@ void CommonQueryFilter::BuildFilter(u32 task_id, Txn *txn) {
         result_count) {
         std::lock_guard lock(result_mutex_);
         filter_result_count_ += result_count;
+        filter_result_row_count_.emplace(segment_id, result_count);
         filter_result_.emplace(segment_id, std::move(result_elem));
     }
 }
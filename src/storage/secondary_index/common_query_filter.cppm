@@ -49,6 +49,8 @@ export struct CommonQueryFilter {
     atomic_flag finish_build_;
     std::mutex result_mutex_;
     Map<SegmentID, std::variant<Vector<u32>, Bitmask>> filter_result_;
+    // number of the rows passing the filter in each segment of `filter_result_`
+    Map<SegmentID, SizeT> filter_result_row_count_;
     SizeT filter_result_count_ = 0;
 
     // task info
@@ -60,6 +62,10 @@ export struct CommonQueryFilter {
 
     CommonQueryFilter(SharedPtr<BaseExpression> original_filter, SharedPtr<BaseTableRef> base_table_ref, TxnTimeStamp begin_ts);
 
+    // Drop the result of the last build and build again for the snapshot now in `base_table_ref_` at `begin_ts`.
+    // The pushed down filters chosen by the optimizer are kept, a cached plan is executed by another txn.
+    void Reset(TxnTimeStamp begin_ts);
+
     // 1. try to finish building the filter
     // 2. return true if the filter is available for query
     // if other threads are building the filter, the filter is not available for query
@@ -98,6 +104,8 @@ export struct CommonQueryFilter {
     bool PassFilter(RowID doc_id);
 
 private:
+    void InitTasks();
+
     void BuildFilter(u32 task_id, Txn *txn);
 
     // for PassFilter
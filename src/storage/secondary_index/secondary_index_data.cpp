@@ -112,11 +112,15 @@ class SecondaryIndexDataT final : public SecondaryIndexData {
     bool need_save_ = false;
     UniquePtr<OrderedKeyType[]> key_;
     UniquePtr<SegmentOffset[]> offset_;
+    // bitmap index only, saved after the pgm index
+    const bool with_dictionary_ = false;
+    SecondaryIndexDictionary<OrderedKeyType> dictionary_;
 
 public:
     static constexpr u32 PairSize = sizeof(OrderedKeyType) + sizeof(SegmentOffset);
 
-    SecondaryIndexDataT(const u32 chunk_row_count, const bool allocate) : SecondaryIndexData(chunk_row_count) {
+    SecondaryIndexDataT(const u32 chunk_row_count, const bool allocate, const bool with_dictionary)
+        : SecondaryIndexData(chunk_row_count), with_dictionary_(with_dictionary) {
         pgm_index_ = GenerateSecondaryPGMIndex<OrderedKeyType>();
         if (allocate) {
             need_save_ = true;
@@ -132,9 +136,19 @@ public:
             UnrecoverableError(error_message);
         }
         pgm_index_->SaveIndex(file_handler);
+        if (with_dictionary_) {
+            dictionary_.Save(file_handler);
+        }
     }
 
-    void ReadIndexInner(FileHandler &file_handler) override { pgm_index_->LoadIndex(file_handler); }
+    void ReadIndexInner(FileHandler &file_handler) override {
+        pgm_index_->LoadIndex(file_handler);
+        if (with_dictionary_) {
+            dictionary_.Load(file_handler);
+        }
+    }
+
+    const void *GetDictionary() const override { return with_dictionary_ ? &dictionary_ : nullptr; }
 
     void InsertData(void *ptr, SharedPtr<ChunkIndexEntry> &chunk_index) override {
         if (!need_save_) {
@@ -198,10 +212,14 @@ public:
             }
         }
         pgm_index_->BuildIndex(chunk_row_count_, key_.get());
+        if (with_dictionary_) {
+            dictionary_.Build(key_.get(), offset_.get(), chunk_row_count_);
+        }
     }
 };
 
-SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type, const u32 chunk_row_count, const bool allocate) {
+SecondaryIndexData *
+GetSecondaryIndexData(const SharedPtr<DataType> &data_type, const u32 chunk_row_count, const bool allocate, const bool with_dictionary) {
     if (!(data_type->CanBuildSecondaryIndex())) {
         String error_message = fmt::format("Cannot build secondary index on data type: {}", data_type->ToString());
         UnrecoverableError(error_message);
@@ -209,37 +227,37 @@ SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type,
     }
     switch (data_type->type()) {
         case LogicalType::kTinyInt: {
-            return new SecondaryIndexDataT<TinyIntT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<TinyIntT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kSmallInt: {
-            return new SecondaryIndexDataT<SmallIntT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<SmallIntT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kInteger: {
-            return new SecondaryIndexDataT<IntegerT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<IntegerT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kBigInt: {
-            return new SecondaryIndexDataT<BigIntT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<BigIntT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kFloat: {
-            return new SecondaryIndexDataT<FloatT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<FloatT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kDouble: {
-            return new SecondaryIndexDataT<DoubleT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<DoubleT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kDate: {
-            return new SecondaryIndexDataT<DateT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<DateT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kTime: {
-            return new SecondaryIndexDataT<TimeT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<TimeT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kDateTime: {
-            return new SecondaryIndexDataT<DateTimeT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<DateTimeT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kTimestamp: {
-            return new SecondaryIndexDataT<TimestampT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<TimestampT>(chunk_row_count, allocate, with_dictionary);
         }
         case LogicalType::kVarchar: {
-            return new SecondaryIndexDataT<VarcharT>(chunk_row_count, allocate);
+            return new SecondaryIndexDataT<VarcharT>(chunk_row_count, allocate, with_dictionary);
         }
         default: {
             String error_message = fmt::format("Need to add secondary index support for data type: {}", data_type->ToString());
@@ -127,6 +127,83 @@ LogicalType GetLogicalType<BigIntT> = LogicalType::kBigInt;
 template <>
 LogicalType GetLogicalType<VarcharT> = LogicalType::kVarchar;
 
+// Dictionary of a chunk of a bitmap index, built when the chunk is dumped or merged.
+// The rows of keys_[i] are the positions [key_begin_[i], key_begin_[i + 1]) in the sorted (key, offset) pairs of the chunk.
+// The rows of a frequent key are also kept as a bitmap of segment offsets (bitmaps_[bitmap_id_[i]]), which is merged into
+// a result bitmask word by word. A bitmap is kept when it is not larger than the u32 array of the same rows.
+export template <typename KeyType>
+struct SecondaryIndexDictionary {
+    static constexpr u32 kNoBitmap = std::numeric_limits<u32>::max();
+
+    Vector<KeyType> keys_;
+    Vector<u32> key_begin_;
+    Vector<u32> bitmap_id_;
+    u32 bitmap_word_count_ = 0;
+    Vector<Vector<u64>> bitmaps_;
+
+    void Build(const KeyType *keys, const SegmentOffset *offsets, u32 count) {
+        keys_.clear();
+        key_begin_.clear();
+        bitmap_id_.clear();
+        bitmaps_.clear();
+        SegmentOffset max_offset = 0;
+        for (u32 i = 0; i < count; ++i) {
+            if (i == 0 or keys[i] != keys[i - 1]) {
+                keys_.push_back(keys[i]);
+                key_begin_.push_back(i);
+            }
+            max_offset = std::max(max_offset, offsets[i]);
+        }
+        key_begin_.push_back(count);
+        bitmap_word_count_ = count == 0 ? 0 : max_offset / 64 + 1;
+        bitmap_id_.assign(keys_.size(), kNoBitmap);
+        for (u32 i = 0; i < keys_.size(); ++i) {
+            // 32 bits for every row in array, 64 bits for every word in bitmap
+            if (const u32 row_cnt = key_begin_[i + 1] - key_begin_[i]; row_cnt < 2 * bitmap_word_count_) {
+                continue;
+            }
+            bitmap_id_[i] = bitmaps_.size();
+            auto &bitmap = bitmaps_.emplace_back(bitmap_word_count_, 0);
+            for (u32 pos = key_begin_[i]; pos < key_begin_[i + 1]; ++pos) {
+                bitmap[offsets[pos] / 64] |= u64(1) << (offsets[pos] % 64);
+            }
+        }
+    }
+
+    void Save(FileHandler &file_handler) const {
+        u32 key_cnt = keys_.size();
+        file_handler.Write(&key_cnt, sizeof(key_cnt));
+        file_handler.Write(keys_.data(), key_cnt * sizeof(KeyType));
+        file_handler.Write(key_begin_.data(), (key_cnt + 1) * sizeof(u32));
+        file_handler.Write(bitmap_id_.data(), key_cnt * sizeof(u32));
+        u32 bitmap_cnt = bitmaps_.size();
+        file_handler.Write(&bitmap_cnt, sizeof(bitmap_cnt));
+        file_handler.Write(&bitmap_word_count_, sizeof(bitmap_word_count_));
+        for (const auto &bitmap : bitmaps_) {
+            file_handler.Write(bitmap.data(), bitmap_word_count_ * sizeof(u64));
+        }
+    }
+
+    void Load(FileHandler &file_handler) {
+        u32 key_cnt = 0;
+        file_handler.Read(&key_cnt, sizeof(key_cnt));
+        keys_.resize(key_cnt);
+        file_handler.Read(keys_.data(), key_cnt * sizeof(KeyType));
+        key_begin_.resize(key_cnt + 1);
+        file_handler.Read(key_begin_.data(), (key_cnt + 1) * sizeof(u32));
+        bitmap_id_.resize(key_cnt);
+        file_handler.Read(bitmap_id_.data(), key_cnt * sizeof(u32));
+        u32 bitmap_cnt = 0;
+        file_handler.Read(&bitmap_cnt, sizeof(bitmap_cnt));
+        file_handler.Read(&bitmap_word_count_, sizeof(bitmap_word_count_));
+        bitmaps_.resize(bitmap_cnt);
+        for (auto &bitmap : bitmaps_) {
+            bitmap.resize(bitmap_word_count_);
+            file_handler.Read(bitmap.data(), bitmap_word_count_ * sizeof(u64));
+        }
+    }
+};
+
 export class SecondaryIndexData {
 protected:
     u32 chunk_row_count_ = 0;
@@ -149,6 +226,9 @@ public:
 
     [[nodiscard]] inline u32 GetChunkRowCount() const { return chunk_row_count_; }
 
+    // SecondaryIndexDictionary<OrderedKeyType> of a bitmap index chunk, nullptr for secondary index
+    [[nodiscard]] virtual const void *GetDictionary() const { return nullptr; }
+
     virtual void SaveIndexInner(FileHandler &file_handler) const = 0;
 
     virtual void ReadIndexInner(FileHandler &file_handler) = 0;
@@ -158,7 +238,8 @@ public:
     virtual void InsertMergeData(Vector<ChunkIndexEntry *> &old_chunks, SharedPtr<ChunkIndexEntry> &merged_chunk_index_entry) = 0;
 };
 
-export SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type, u32 chunk_row_count, bool allocate);
+// with_dictionary: the chunk belongs to a bitmap index
+export SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type, u32 chunk_row_count, bool allocate, bool with_dictionary = false);
 
 export u32 GetSecondaryIndexDataPairSize(const SharedPtr<DataType> &data_type);
 
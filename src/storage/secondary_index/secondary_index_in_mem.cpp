@@ -62,8 +62,8 @@ public:
         return new_chunk_index_entry;
     }
     Pair<u32, std::variant<Vector<u32>, Bitmask>> RangeQuery(const void *input) override {
-        const auto &[segment_row_count, b, e] = *static_cast<const std::tuple<u32, KeyType, KeyType> *>(input);
-        return RangeQueryInner(segment_row_count, b, e);
+        const auto &[segment_row_count, ranges] = *static_cast<const std::tuple<u32, const Vector<Pair<KeyType, KeyType>> *> *>(input);
+        return RangeQueryInner(segment_row_count, *ranges);
     }
 
 private:
@@ -94,11 +94,18 @@ private:
         }
     }
 
-    Pair<u32, std::variant<Vector<u32>, Bitmask>> RangeQueryInner(const u32 segment_row_count, const KeyType b, const KeyType e) {
+    // ranges: sorted and disjoint closed intervals of keys
+    Pair<u32, std::variant<Vector<u32>, Bitmask>> RangeQueryInner(const u32 segment_row_count, const Vector<Pair<KeyType, KeyType>> &ranges) {
         std::shared_lock lock(map_mutex_);
-        const auto begin = in_mem_secondary_index_.lower_bound(b);
-        const auto end = in_mem_secondary_index_.upper_bound(e);
-        const u32 result_size = std::distance(begin, end);
+        using Iterator = typename MultiMap<KeyType, u32>::const_iterator;
+        Vector<Pair<Iterator, Iterator>> result_runs;
+        u32 result_size = 0;
+        for (const auto &[b, e] : ranges) {
+            const Iterator begin = in_mem_secondary_index_.lower_bound(b);
+            const Iterator end = in_mem_secondary_index_.upper_bound(e);
+            result_size += std::distance(begin, end);
+            result_runs.emplace_back(begin, end);
+        }
         Pair<u32, std::variant<Vector<u32>, Bitmask>> result_var;
         result_var.first = result_size;
         // use array or bitmask for result
@@ -106,15 +113,19 @@ private:
         if (result_size <= 1024 or result_size <= std::bit_ceil(segment_row_count) / 32) {
             auto &result = result_var.second.emplace<Vector<u32>>();
             result.reserve(result_size);
-            for (auto it = begin; it != end; ++it) {
-                result.push_back(it->second);
+            for (const auto &[begin, end] : result_runs) {
+                for (auto it = begin; it != end; ++it) {
+                    result.push_back(it->second);
+                }
             }
         } else {
             auto &result = result_var.second.emplace<Bitmask>();
             result.Initialize(segment_row_count);
             result.SetAllFalse();
-            for (auto it = begin; it != end; ++it) {
-                result.SetTrue(it->second);
+            for (const auto &[begin, end] : result_runs) {
+                for (auto it = begin; it != end; ++it) {
+                    result.SetTrue(it->second);
+                }
             }
         }
         return result_var;
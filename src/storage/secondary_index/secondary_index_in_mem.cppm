@@ -34,6 +34,7 @@ public:
     virtual u32 GetRowCount() const = 0;
     virtual void Insert(u16 block_id, BlockColumnEntry *block_column_entry, BufferManager *buffer_manager, u32 row_offset, u32 row_count) = 0;
     virtual SharedPtr<ChunkIndexEntry> Dump(SegmentIndexEntry *segment_index_entry, BufferManager *buffer_mgr) = 0;
+    // input: Tuple<u32 segment_row_count, const Vector<Pair<KeyType, KeyType>> *sorted_disjoint_ranges>
     virtual Pair<u32, std::variant<Vector<u32>, Bitmask>> RangeQuery(const void *input) = 0;
 
     static SharedPtr<SecondaryIndexInMem> NewSecondaryIndexInMem(const SharedPtr<ColumnDef> &column_def, RowID begin_row_id, u32 max_size = 5 << 20);
@@ -47,6 +47,7 @@ import log_file;
 import query_context;
 import infinity_context;
 import memindex_tracer;
+import plan_cache;
 
 namespace infinity {
 
@@ -86,7 +87,7 @@ void Storage::Init() {
                                       new_catalog_->next_txn_id(),
                                       system_start_ts);
 
-    compact_processor_ = MakeUnique<CompactionProcessor>(new_catalog_.get(), txn_mgr_.get());
+    compact_processor_ = MakeUnique<CompactionProcessor>(new_catalog_.get(), txn_mgr_.get(), config_ptr_->CompactionIOLimit());
 
     txn_mgr_->Start();
     // start WalManager after TxnManager since it depends on TxnManager.
@@ -137,6 +138,9 @@ void Storage::UnInit() {
     bg_processor_->Stop();
     wal_mgr_->Stop();
 
+    // cached plans refer to the catalog
+    PlanCache::instance().Clear();
+
     txn_mgr_.reset();
     if (compact_processor_.get() != nullptr) {
         compact_processor_.reset();
@@ -294,10 +294,13 @@ Tuple<SharedPtr<TableIndexInfo>, Status> Txn::GetTableIndexInfo(const String &db
     return catalog_->GetTableIndexInfo(db_name, table_name, index_name, txn_id_, begin_ts);
 }
 
-Pair<Vector<SegmentIndexEntry *>, Status>
-Txn::CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_ref, bool prepare, bool check_ts) {
+Pair<Vector<SegmentIndexEntry *>, Status> Txn::CreateIndexPrepare(TableIndexEntry *table_index_entry,
+                                                                  BaseTableRef *table_ref,
+                                                                  bool prepare,
+                                                                  bool check_ts,
+                                                                  const HashMap<SegmentID, CompactIndexBase> *compact_bases) {
     auto *table_entry = table_ref->table_entry_ptr_;
-    auto [segment_index_entries, status] = table_index_entry->CreateIndexPrepare(table_ref, this, prepare, false, check_ts);
+    auto [segment_index_entries, status] = table_index_entry->CreateIndexPrepare(table_ref, this, prepare, false, check_ts, compact_bases);
     if (!status.ok()) {
         return {segment_index_entries, status};
     }
@@ -425,6 +428,25 @@ WalEntry *Txn::GetWALEntry() const { return wal_entry_.get(); }
 //     txn_context_.SetTxnBegin(begin_ts);
 // }
 
+namespace {
+
+bool IsCatalogCommand(WalCommandType type) {
+    switch (type) {
+        case WalCommandType::CREATE_DATABASE:
+        case WalCommandType::DROP_DATABASE:
+        case WalCommandType::CREATE_TABLE:
+        case WalCommandType::DROP_TABLE:
+        case WalCommandType::ALTER_INFO:
+        case WalCommandType::CREATE_INDEX:
+        case WalCommandType::DROP_INDEX:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
 TxnTimeStamp Txn::Commit() {
     if (wal_entry_->cmds_.empty() && txn_store_.ReadOnly()) {
         // Don't need to write empty WalEntry (read-only transactions).
@@ -434,6 +456,14 @@ TxnTimeStamp Txn::Commit() {
         return commit_ts;
     }
 
+    // wal_entry_ is dropped on conflict, remember whether this txn changes the catalog before committing
+    for (const auto &cmd : wal_entry_->cmds_) {
+        if (IsCatalogCommand(cmd->GetType())) {
+            catalog_changed_ = true;
+            break;
+        }
+    }
+
     // register commit ts in wal manager here, define the commit sequence
     TxnTimeStamp commit_ts = txn_mgr_->GetCommitTimeStampW(this);
     LOG_TRACE(fmt::format("Txn: {} is committing, committing ts: {}", txn_id_, commit_ts));
@@ -447,6 +477,7 @@ TxnTimeStamp Txn::Commit() {
         LOG_ERROR(fmt::format("Txn: {} is rollbacked. rollback ts: {}", txn_id_, commit_ts));
         wal_entry_ = nullptr;
         txn_mgr_->SendToWAL(this);
+        txn_mgr_->FinishCommitVersion(this);
         RecoverableError(Status::TxnConflict(txn_id_, "Txn conflict reason."));
     }
 
@@ -457,6 +488,8 @@ TxnTimeStamp Txn::Commit() {
     // Wait until CommitTxnBottom is done.
     std::unique_lock<std::mutex> lk(commit_lock_);
     commit_cv_.wait(lk, [this] { return commit_bottom_done_; });
+    // the data written by this txn is visible now
+    txn_mgr_->FinishCommitVersion(this);
 
     txn_store_.MaintainCompactionAlg();
 
@@ -477,6 +510,8 @@ bool Txn::CheckConflict(Txn *other_txn) {
     return txn_store_.CheckConflict(other_txn->txn_store_);
 }
 
+Vector<TxnTableStore *> Txn::PrepareAppend() { return txn_store_.PrepareAppend(txn_id_); }
+
 void Txn::CommitBottom() {
     LOG_TRACE(fmt::format("Txn bottom: {} is started.", txn_id_));
     // prepare to commit txn local data into table
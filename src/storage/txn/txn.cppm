@@ -61,6 +61,7 @@ class CatalogDeltaOperation;
 class BaseTableRef;
 enum class CompactStatementType;
 struct SegmentIndexEntry;
+struct CompactIndexBase;
 
 export class Txn {
 public:
@@ -97,6 +98,9 @@ public:
 
     bool CheckConflict(Txn *txn);
 
+    // Reserve the rows appended by the txn, called by the wal thread in commit order before the rows are copied
+    Vector<TxnTableStore *> PrepareAppend();
+
     void CommitBottom();
 
     void CancelCommitBottom();
@@ -139,8 +143,12 @@ public:
 
     Tuple<SharedPtr<TableIndexInfo>, Status> GetTableIndexInfo(const String &db_name, const String &table_name, const String &index_name);
 
-    Pair<Vector<SegmentIndexEntry *>, Status>
-    CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_ref, bool prepare, bool check_ts = true);
+    // `compact_bases` (by new segment id) is passed by compaction to reuse the index of the compacted segments
+    Pair<Vector<SegmentIndexEntry *>, Status> CreateIndexPrepare(TableIndexEntry *table_index_entry,
+                                                                 BaseTableRef *table_ref,
+                                                                 bool prepare,
+                                                                 bool check_ts = true,
+                                                                 const HashMap<SegmentID, CompactIndexBase> *compact_bases = nullptr);
 
     Status CreateIndexDo(BaseTableRef *table_ref, const String &index_name, HashMap<SegmentID, atomic_u64> &create_index_idxes);
 
@@ -196,6 +204,9 @@ public:
 
     void SetTxnWrite() { txn_context_.SetTxnType(TxnType::kWrite); }
 
+    // True if the txn creates or drops a database, table or index
+    bool CatalogChanged() const { return catalog_changed_; }
+
     // WAL and replay OPS
     void AddWalCmd(const SharedPtr<WalCmd> &cmd);
 
@@ -249,6 +260,8 @@ private:
     std::condition_variable commit_cv_{};
     bool commit_bottom_done_{false};
 
+    bool catalog_changed_{false};
+
     // String
     SharedPtr<String> txn_text_{nullptr};
 };
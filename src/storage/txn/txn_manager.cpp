@@ -120,12 +120,33 @@ TxnTimeStamp TxnManager::GetCommitTimeStampR(Txn *txn) {
 TxnTimeStamp TxnManager::GetCommitTimeStampW(Txn *txn) {
     std::lock_guard guard(locker_);
     TxnTimeStamp commit_ts = ++start_ts_;
+    if (txn->CatalogChanged()) {
+        ++catalog_version_;
+        ++committing_catalog_txn_count_;
+    }
     wait_conflict_ck_.emplace(commit_ts, nullptr);
     finishing_txns_.emplace(txn);
     txn->SetTxnWrite();
     return commit_ts;
 }
 
+Optional<u64> TxnManager::catalog_version() {
+    std::lock_guard guard(locker_);
+    if (committing_catalog_txn_count_ > 0) {
+        return None;
+    }
+    return catalog_version_;
+}
+
+void TxnManager::FinishCommitVersion(Txn *txn) {
+    if (!txn->CatalogChanged()) {
+        return;
+    }
+    std::lock_guard guard(locker_);
+    ++catalog_version_;
+    --committing_catalog_txn_count_;
+}
+
 bool TxnManager::CheckConflict(Txn *txn) {
     TxnTimeStamp commit_ts = txn->CommitTS();
     Vector<Txn *> candidate_txns;
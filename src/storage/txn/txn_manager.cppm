@@ -104,6 +104,14 @@ public:
 
     u64 total_rollbacked_txn_count() const { return total_rollbacked_txn_count_; }
 
+    // Increased when a txn which creates or drops a database, table or index starts and finishes committing. Plans of the plan
+    // cache are only valid at the catalog version they are built. Data commits don't change it.
+    // None while such a txn is committing, whether its changes are seen by a new txn depends on timing then.
+    Optional<u64> catalog_version();
+
+    // Called when a write txn which got its commit ts finishes committing or is rolled back
+    void FinishCommitVersion(Txn *txn);
+
 private:
     void FinishTxn(Txn *txn);
 
@@ -137,6 +145,10 @@ private:
 
     Atomic<u64> total_committed_txn_count_{0};
     Atomic<u64> total_rollbacked_txn_count_{0};
+
+    // protected by locker_
+    u64 catalog_version_{0};
+    SizeT committing_catalog_txn_count_{0};
 };
 
 } // namespace infinity
@@ -373,14 +373,37 @@ void TxnTableStore::PrepareCommit1() const {
     }
 }
 
+void TxnTableStore::PrepareAppend(TransactionID txn_id) {
+    append_only_ = !blocks_.empty() && delete_state_.rows_.empty() && compact_state_.type_ == CompactStatementType::kInvalid &&
+                   flushed_segments_.empty() && txn_segments_store_.empty() && txn_indexes_.empty() && txn_indexes_store_.empty();
+    if (!blocks_.empty()) {
+        append_state_ = MakeUnique<AppendState>(this->blocks_);
+        table_entry_->ReserveAppend(txn_id, this);
+    }
+    std::tie(unsealed_ids_, next_segment_id_) = table_entry_->GetAppendStreams();
+    append_prepared_ = true;
+}
+
+void TxnTableStore::CommitAppend(TransactionID txn_id, TxnTimeStamp commit_ts, BufferManager *buffer_mgr) {
+    table_entry_->CopyAppendData(txn_id, this, commit_ts, buffer_mgr);
+    appended_ = true;
+}
+
 // TODO: remove commit_ts
 void TxnTableStore::PrepareCommit(TransactionID txn_id, TxnTimeStamp commit_ts, BufferManager *buffer_mgr) {
-    // Init append state
-    append_state_ = MakeUnique<AppendState>(this->blocks_);
-
-    // Start to append
     LOG_TRACE(fmt::format("Transaction local storage table: {}, Start to prepare commit", *table_entry_->GetTableName()));
-    Catalog::Append(table_entry_, txn_id, this, commit_ts, buffer_mgr);
+    if (appended_) {
+        // The rows are copied by `CommitAppend`, count them in commit order
+        table_entry_->IncreaseRowCount(append_state_->current_count_);
+    } else {
+        // Init append state
+        if (append_state_.get() == nullptr) {
+            append_state_ = MakeUnique<AppendState>(this->blocks_);
+        }
+
+        // Start to append
+        Catalog::Append(table_entry_, txn_id, this, commit_ts, buffer_mgr);
+    }
 
     // Attention: "compact" needs to be ahead of "delete"
     if (compact_state_.type_ != CompactStatementType::kInvalid) {
@@ -456,7 +479,14 @@ void TxnTableStore::AddDeltaOp(CatalogDeltaEntry *local_delta_ops, TxnManager *t
     }
 
     if (!added) {
-        local_delta_ops->AddOperation(MakeUnique<AddTableEntryOp>(table_entry_, commit_ts));
+        auto add_table_entry_op = MakeUnique<AddTableEntryOp>(table_entry_, commit_ts);
+        if (append_prepared_) {
+            // The txns committed after this one may have reserved new segments already
+            add_table_entry_op->unsealed_id_ = unsealed_ids_[0];
+            add_table_entry_op->unsealed_ids_ = unsealed_ids_;
+            add_table_entry_op->next_segment_id_ = next_segment_id_;
+        }
+        local_delta_ops->AddOperation(std::move(add_table_entry_op));
     }
 
     Vector<Pair<TableIndexEntry *, int>> txn_indexes_vec(txn_indexes_.begin(), txn_indexes_.end());
@@ -586,6 +616,18 @@ void TxnStore::PrepareCommit1() {
     }
 }
 
+Vector<TxnTableStore *> TxnStore::PrepareAppend(TransactionID txn_id) {
+    Vector<TxnTableStore *> table_stores;
+    for (const auto &[table_name, table_store] : txn_tables_store_) {
+        if (!table_store->HasUpdate()) {
+            continue;
+        }
+        table_store->PrepareAppend(txn_id);
+        table_stores.push_back(table_store.get());
+    }
+    return table_stores;
+}
+
 void TxnStore::PrepareCommit(TransactionID txn_id, TxnTimeStamp commit_ts, BufferManager *buffer_mgr) {
     for (const auto &[table_name, table_store] : txn_tables_store_) {
         table_store->PrepareCommit(txn_id, commit_ts, buffer_mgr);
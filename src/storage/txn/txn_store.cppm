@@ -127,6 +127,16 @@ public:
 
     void PrepareCommit1() const;
 
+    // Reserve the appended rows in the append stream of the txn and record the append streams of the table for the delta op,
+    // called in commit order before the rows of the committing txns are copied
+    void PrepareAppend(TransactionID txn_id);
+
+    // Copy the rows reserved by `PrepareAppend` ahead of `PrepareCommit`, only when the txn appends and changes nothing else
+    void CommitAppend(TransactionID txn_id, TxnTimeStamp commit_ts, BufferManager *buffer_mgr);
+
+    // Whether the txn only appends rows to the table, set by `PrepareAppend`
+    bool AppendOnly() const { return append_only_; }
+
     void PrepareCommit(TransactionID txn_id, TxnTimeStamp commit_ts, BufferManager *buffer_mgr);
 
     void Commit(TransactionID txn_id, TxnTimeStamp commit_ts);
@@ -186,6 +196,12 @@ private:
     Vector<SharedPtr<DataBlock>> blocks_{};
 
     UniquePtr<AppendState> append_state_{};
+    bool append_only_{false};
+    bool appended_{false};
+    // append streams of the table right after the rows of this txn are reserved, see `PrepareAppend`
+    bool append_prepared_{false};
+    Vector<SegmentID> unsealed_ids_{};
+    SegmentID next_segment_id_{};
     DeleteState delete_state_{};
 
     SizeT current_block_id_{0};
@@ -221,6 +237,9 @@ public:
 
     void PrepareCommit1();
 
+    // Reserve the rows appended to each table, return the table stores with any change
+    Vector<TxnTableStore *> PrepareAppend(TransactionID txn_id);
+
     void PrepareCommit(TransactionID txn_id, TxnTimeStamp commit_ts, BufferManager *buffer_mgr);
 
     void CommitBottom(TransactionID txn_id, TxnTimeStamp commit_ts);
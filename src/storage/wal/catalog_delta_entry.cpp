@@ -57,6 +57,9 @@ String ToString(CatalogDeltaOpType op_type) {
         case CatalogDeltaOpType::ADD_COLUMN_ENTRY: {
             return "AddColumn";
         }
+        case CatalogDeltaOpType::ADD_TABLE_ENTRY_V2: {
+            return "AddTableV2";
+        }
         case CatalogDeltaOpType::ADD_TABLE_INDEX_ENTRY: {
             return "AddTableIndex";
         }
@@ -159,7 +162,11 @@ UniquePtr<CatalogDeltaOperation> CatalogDeltaOperation::ReadAdv(char *&ptr, i32
             break;
         }
         case CatalogDeltaOpType::ADD_TABLE_ENTRY: {
-            operation = AddTableEntryOp::ReadAdv(ptr, ptr_end);
+            operation = AddTableEntryOp::ReadAdv(ptr, ptr_end, false);
+            break;
+        }
+        case CatalogDeltaOpType::ADD_TABLE_ENTRY_V2: {
+            operation = AddTableEntryOp::ReadAdv(ptr, ptr_end, true);
             break;
         }
         case CatalogDeltaOpType::ADD_SEGMENT_ENTRY: {
@@ -349,7 +356,7 @@ AddDBEntryOp::AddDBEntryOp(DBEntry *db_entry, TxnTimeStamp commit_ts)
 AddTableEntryOp::AddTableEntryOp(TableEntry *table_entry, TxnTimeStamp commit_ts)
     : CatalogDeltaOperation(CatalogDeltaOpType::ADD_TABLE_ENTRY, table_entry, commit_ts), table_entry_dir_(table_entry->TableEntryDir()),
       column_defs_(table_entry->column_defs()), row_count_(table_entry->row_count()), // TODO: fix it
-      unsealed_id_(table_entry->unsealed_id()), next_segment_id_(table_entry->next_segment_id()) {}
+      unsealed_id_(table_entry->unsealed_id()), next_segment_id_(table_entry->next_segment_id()), unsealed_ids_(table_entry->unsealed_ids()) {}
 
 AddSegmentEntryOp::AddSegmentEntryOp(SegmentEntry *segment_entry, TxnTimeStamp commit_ts, String segment_filter_binary_data)
     : CatalogDeltaOperation(CatalogDeltaOpType::ADD_SEGMENT_ENTRY, segment_entry, commit_ts), status_(segment_entry->status()),
@@ -401,6 +408,7 @@ AddChunkIndexEntryOp::AddChunkIndexEntryOp(ChunkIndexEntry *chunk_index_entry, T
         case IndexType::kHnsw:
         case IndexType::kEMVB:
         case IndexType::kSecondary:
+        case IndexType::kBitmap:
         case IndexType::kBMP: {
             String full_dir = fmt::format("{}/{}", *chunk_index_entry->base_dir_, *(segment_index_entry->index_dir()));
             String file_name = ChunkIndexEntry::IndexFileName(segment_index_entry->segment_id(), chunk_index_entry->chunk_id_);
@@ -423,7 +431,7 @@ UniquePtr<AddDBEntryOp> AddDBEntryOp::ReadAdv(char *&ptr) {
     return add_db_op;
 }
 
-UniquePtr<AddTableEntryOp> AddTableEntryOp::ReadAdv(char *&ptr, char *ptr_end) {
+UniquePtr<AddTableEntryOp> AddTableEntryOp::ReadAdv(char *&ptr, char *ptr_end, bool with_unsealed_ids) {
     auto add_table_op = MakeUnique<AddTableEntryOp>();
     add_table_op->ReadAdvBase(ptr);
 
@@ -454,6 +462,12 @@ UniquePtr<AddTableEntryOp> AddTableEntryOp::ReadAdv(char *&ptr, char *ptr_end) {
     add_table_op->row_count_ = ReadBufAdv<SizeT>(ptr);
     add_table_op->unsealed_id_ = ReadBufAdv<SegmentID>(ptr);
     add_table_op->next_segment_id_ = ReadBufAdv<SegmentID>(ptr);
+    if (with_unsealed_ids) {
+        i32 unsealed_ids_size = ReadBufAdv<i32>(ptr);
+        for (i32 i = 0; i < unsealed_ids_size; ++i) {
+            add_table_op->unsealed_ids_.push_back(ReadBufAdv<SegmentID>(ptr));
+        }
+    }
     return add_table_op;
 }
 
@@ -557,6 +571,7 @@ SizeT AddTableEntryOp::GetSizeInBytes() const {
 
     total_size += sizeof(SizeT);
     total_size += sizeof(SegmentID) * 2;
+    total_size += sizeof(i32) + sizeof(SegmentID) * unsealed_ids_.size();
     return total_size;
 }
 
@@ -619,7 +634,8 @@ void AddDBEntryOp::WriteAdv(char *&buf) const {
 }
 
 void AddTableEntryOp::WriteAdv(char *&buf) const {
-    WriteBufAdv(buf, this->type_);
+    // the layout with the unsealed ids has its own tag, so that the ops written before are still readable
+    WriteBufAdv(buf, CatalogDeltaOpType::ADD_TABLE_ENTRY_V2);
     WriteAdvBase(buf);
     WriteBufAdv(buf, *this->table_entry_dir_);
 
@@ -639,6 +655,10 @@ void AddTableEntryOp::WriteAdv(char *&buf) const {
     WriteBufAdv(buf, this->row_count_);
     WriteBufAdv(buf, this->unsealed_id_);
     WriteBufAdv(buf, this->next_segment_id_);
+    WriteBufAdv(buf, (i32)(unsealed_ids_.size()));
+    for (SegmentID unsealed_id : unsealed_ids_) {
+        WriteBufAdv(buf, unsealed_id);
+    }
 }
 
 void AddSegmentEntryOp::WriteAdv(char *&buf) const {
@@ -720,7 +740,7 @@ const String AddTableEntryOp::ToString() const {
         sstream << fmt::format(" column_def: {}", column_def->ToString());
     }
     sstream << fmt::format(" row_count: {}", row_count_) << fmt::format(" unsealed_id: {}", unsealed_id_)
-            << fmt::format(" next_segment_id: {}", next_segment_id_);
+            << fmt::format(" next_segment_id: {}", next_segment_id_) << fmt::format(" unsealed_ids: [{}]", fmt::join(unsealed_ids_, ", "));
     return sstream.str();
 }
 
@@ -802,7 +822,8 @@ bool AddTableEntryOp::operator==(const CatalogDeltaOperation &rhs) const {
     auto *rhs_op = dynamic_cast<const AddTableEntryOp *>(&rhs);
     bool res = rhs_op != nullptr && CatalogDeltaOperation::operator==(rhs) && IsEqual(*table_entry_dir_, *rhs_op->table_entry_dir_) &&
                table_entry_type_ == rhs_op->table_entry_type_ && row_count_ == rhs_op->row_count_ && unsealed_id_ == rhs_op->unsealed_id_ &&
-               next_segment_id_ == rhs_op->next_segment_id_ && column_defs_.size() == rhs_op->column_defs_.size();
+               next_segment_id_ == rhs_op->next_segment_id_ && unsealed_ids_ == rhs_op->unsealed_ids_ &&
+               column_defs_.size() == rhs_op->column_defs_.size();
     if (!res) {
         return false;
     }
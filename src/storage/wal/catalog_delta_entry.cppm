@@ -53,6 +53,9 @@ export enum class CatalogDeltaOpType : i8 {
     ADD_SEGMENT_ENTRY = 3,
     ADD_BLOCK_ENTRY = 4,
     ADD_COLUMN_ENTRY = 5,
+    // Only the tag of the serialized ADD_TABLE_ENTRY op with the unsealed segment id of each stream.
+    // The op read with it is an ADD_TABLE_ENTRY op, ADD_TABLE_ENTRY is still read in the layout without the ids.
+    ADD_TABLE_ENTRY_V2 = 6,
 
     // -----------------------------
     // INDEX
@@ -143,7 +146,7 @@ public:
 /// class AddTableEntryOp
 export class AddTableEntryOp : public CatalogDeltaOperation {
 public:
-    static UniquePtr<AddTableEntryOp> ReadAdv(char *&ptr, char *ptr_end);
+    static UniquePtr<AddTableEntryOp> ReadAdv(char *&ptr, char *ptr_end, bool with_unsealed_ids);
 
     AddTableEntryOp() : CatalogDeltaOperation(CatalogDeltaOpType::ADD_TABLE_ENTRY) {}
 
@@ -163,6 +166,8 @@ public:
     SizeT row_count_{0};
     SegmentID unsealed_id_{};
     SegmentID next_segment_id_{0};
+    // unsealed segment of each append stream, unsealed_id_ is the first one
+    Vector<SegmentID> unsealed_ids_{};
 };
 
 /// class AddSegmentEntryOp
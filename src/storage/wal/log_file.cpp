@@ -64,6 +64,8 @@ String CatalogFile::TempFullCheckpointFilename(TxnTimeStamp max_commit_ts) { ret
 
 String CatalogFile::DeltaCheckpointFilename(TxnTimeStamp max_commit_ts) { return fmt::format("DELTA.{}", max_commit_ts); }
 
+String CatalogFile::PagesFilename(TxnTimeStamp max_commit_ts) { return fmt::format("PAGES.{}", max_commit_ts); }
+
 void CatalogFile::RecycleCatalogFile(TxnTimeStamp max_commit_ts, const String &catalog_dir) {
     auto [full_infos, delta_infos] = ParseCheckpointFilenames(catalog_dir);
     bool found = false;
@@ -89,6 +91,18 @@ void CatalogFile::RecycleCatalogFile(TxnTimeStamp max_commit_ts, const String &c
     }
 }
 
+void CatalogFile::RecyclePagesFile(const Set<String> &referenced_files, const String &catalog_dir) {
+    LocalFileSystem fs;
+    for (const auto &entry : fs.ListDirectory(catalog_dir)) {
+        const auto &filename = entry->path().filename().string();
+        if (!entry->is_regular_file() || !filename.starts_with("PAGES.") || referenced_files.contains(filename)) {
+            continue;
+        }
+        fs.DeleteFile(entry->path().string());
+        LOG_DEBUG(fmt::format("WalManager::Checkpoint delete catalog file: {}", entry->path().string()));
+    }
+}
+
 Pair<Vector<FullCatalogFileInfo>, Vector<DeltaCatalogFileInfo>> CatalogFile::ParseCheckpointFilenames(const String &catalog_dir) {
     LocalFileSystem fs;
     const auto &entries = fs.ListDirectory(catalog_dir);
@@ -138,6 +152,9 @@ Pair<Vector<FullCatalogFileInfo>, Vector<DeltaCatalogFileInfo>> CatalogFile::Par
                 continue;
             }
             auto file_prefix = filename.substr(0, dot_pos);
+            if (IsEqual(file_prefix, String("PAGES"))) {
+                continue;
+            }
             if (!IsEqual(file_prefix, String("DELTA"))) {
                 LOG_WARN(fmt::format("Catalog file {} has wrong file name", entry->path().string()));
                 continue;
@@ -52,6 +52,12 @@ public:
 
     static String DeltaCheckpointFilename(TxnTimeStamp max_commit_ts);
 
+    // table pages written by the full checkpoint of max_commit_ts, they may be referenced by the later full checkpoints
+    static String PagesFilename(TxnTimeStamp max_commit_ts);
+
+    // Delete the page files not referenced by the latest full checkpoint
+    static void RecyclePagesFile(const Set<String> &referenced_files, const String &catalog_dir);
+
     // max_commit_ts is the largest commit ts before the latest full checkpoint
     static void RecycleCatalogFile(TxnTimeStamp max_commit_ts, const String &catalog_dir);
 
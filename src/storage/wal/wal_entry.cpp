@@ -220,6 +220,7 @@ WalChunkIndexInfo::WalChunkIndexInfo(ChunkIndexEntry *chunk_index_entry)
         case IndexType::kHnsw:
         case IndexType::kEMVB:
         case IndexType::kSecondary:
+        case IndexType::kBitmap:
         case IndexType::kBMP: {
             String full_dir = fmt::format("{}/{}", *chunk_index_entry->base_dir_, *(segment_index_entry->index_dir()));
             String file_name = ChunkIndexEntry::IndexFileName(segment_index_entry->segment_id(), chunk_index_entry->chunk_id_);
@@ -16,6 +16,7 @@ module;
 
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <thread>
 
 import stl;
@@ -55,6 +56,7 @@ import default_values;
 import defer_op;
 import index_base;
 import base_table_ref;
+import infinity_context;
 
 module wal_manager;
 
@@ -216,12 +218,7 @@ void WalManager::Flush() {
             }
         }
 
-        for (const auto &entry : log_batch) {
-            Txn *txn = txn_mgr->GetTxn(entry->txn_id_);
-            if (txn != nullptr) {
-                txn->CommitBottom();
-            }
-        }
+        CommitBottoms(log_batch);
         log_batch.clear();
 
         // Check if the wal file is too large, swap to a new one.
@@ -265,6 +262,83 @@ bool WalManager::TrySubmitCheckpointTask(SharedPtr<CheckpointTaskBase> ckp_task)
  * CHECKPOINT WAL FILE
  *****************************************************************************/
 
+// Commit the bottom halves of the txns in commit order. The appended rows are reserved in commit order first, so that they are
+// placed in the same segments when the wal is replayed. Then the rows of a txn are copied on the append thread pool ahead of its
+// commit bottom, once the txns before it appending to the same append stream of the table, or changing the table otherwise, are
+// committed. The copying txn is the only writer of its blocks, and the delta ops of the committed txns don't see its rows.
+void WalManager::CommitBottoms(const Deque<WalEntry *> &log_batch) {
+    TxnManager *txn_mgr = storage_->txn_manager();
+    struct PendingAppend {
+        SizeT txn_idx_{};
+        TxnTableStore *table_store_{};
+        std::future<void> future_{};
+    };
+    using AppendStream = Pair<TableEntry *, SizeT>;
+
+    Vector<Txn *> txns;
+    Vector<Vector<AppendStream>> txn_streams;
+    Vector<Vector<TableEntry *>> txn_barriers;
+    // appends of each append stream, in commit order
+    Map<AppendStream, Deque<PendingAppend>> stream_appends;
+    // txns changing the table other than appending, in commit order
+    Map<TableEntry *, Deque<SizeT>> table_barriers;
+    for (const auto &entry : log_batch) {
+        Txn *txn = txn_mgr->GetTxn(entry->txn_id_);
+        if (txn == nullptr) {
+            continue;
+        }
+        SizeT txn_idx = txns.size();
+        txns.push_back(txn);
+        txn_streams.emplace_back();
+        txn_barriers.emplace_back();
+        for (TxnTableStore *table_store : txn->PrepareAppend()) {
+            TableEntry *table_entry = table_store->GetTableEntry();
+            if (table_store->AppendOnly()) {
+                AppendStream stream{table_entry, table_entry->AppendStreamIdx(txn->TxnID())};
+                stream_appends[stream].push_back(PendingAppend{txn_idx, table_store, {}});
+                txn_streams.back().push_back(stream);
+            } else {
+                table_barriers[table_entry].push_back(txn_idx);
+                txn_barriers.back().push_back(table_entry);
+            }
+        }
+    }
+
+    // Nothing to copy concurrently, the rows are copied by the commit bottoms
+    bool concurrent = stream_appends.size() > 1;
+    ThreadPool &append_thread_pool = InfinityContext::instance().GetAppendThreadPool();
+    for (SizeT txn_idx = 0; txn_idx < txns.size(); ++txn_idx) {
+        if (concurrent) {
+            for (auto &[stream, appends] : stream_appends) {
+                if (appends.empty() || appends.front().future_.valid()) {
+                    continue;
+                }
+                PendingAppend &append = appends.front();
+                if (auto iter = table_barriers.find(stream.first); iter != table_barriers.end() && !iter->second.empty() &&
+                                                                   iter->second.front() < append.txn_idx_) {
+                    continue;
+                }
+                TxnTableStore *table_store = append.table_store_;
+                append.future_ = append_thread_pool.push([table_store](int) {
+                    Txn *txn = table_store->GetTxn();
+                    table_store->CommitAppend(txn->TxnID(), txn->CommitTS(), txn->buffer_mgr());
+                });
+            }
+        }
+        for (const AppendStream &stream : txn_streams[txn_idx]) {
+            Deque<PendingAppend> &appends = stream_appends[stream];
+            if (appends.front().future_.valid()) {
+                appends.front().future_.get();
+            }
+            appends.pop_front();
+        }
+        txns[txn_idx]->CommitBottom();
+        for (TableEntry *table_entry : txn_barriers[txn_idx]) {
+            table_barriers[table_entry].pop_front();
+        }
+    }
+}
+
 // Do checkpoint for transactions which lsn no larger than the given one.
 void WalManager::Checkpoint(bool is_full_checkpoint) {
     TxnManager *txn_mgr = storage_->txn_manager();
@@ -331,6 +405,7 @@ void WalManager::FullCheckpointInner(Txn *txn) {
     last_full_ckp_ts_ = max_commit_ts;
     const auto &catalog_dir = *storage_->catalog()->CatalogDir();
     CatalogFile::RecycleCatalogFile(max_commit_ts, catalog_dir);
+    storage_->catalog()->RecyclePagesFile();
 }
 
 void WalManager::DeltaCheckpointInner(Txn *txn) {
@@ -585,10 +660,8 @@ i64 WalManager::ReplayWalFile() {
         }
         last_commit_ts = replay_entries[replay_count]->commit_ts_;
         last_txn_id = replay_entries[replay_count]->txn_id_;
-
-        LOG_TRACE(replay_entries[replay_count]->ToString());
-        ReplayWalEntry(*replay_entries[replay_count]);
     }
+    ReplayWalEntries(replay_entries);
 
     LOG_INFO(fmt::format("Latest txn commit_ts: {}, latest txn id: {}", last_commit_ts, last_txn_id));
     storage_->catalog()->next_txn_id_ = last_txn_id;
@@ -749,77 +822,180 @@ Vector<SharedPtr<WalEntry>> WalManager::CollectWalEntries() const {
 
 void WalManager::ReplayWalEntry(const WalEntry &entry) {
     for (const auto &cmd : entry.cmds_) {
-        LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd->GetType()).c_str(), entry.commit_ts_));
-        switch (cmd->GetType()) {
-            case WalCommandType::CREATE_DATABASE: {
-                WalCmdCreateDatabaseReplay(*dynamic_cast<const WalCmdCreateDatabase *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DROP_DATABASE: {
-                WalCmdDropDatabaseReplay(*dynamic_cast<const WalCmdDropDatabase *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::CREATE_TABLE: {
-                WalCmdCreateTableReplay(*dynamic_cast<const WalCmdCreateTable *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DROP_TABLE: {
-                WalCmdDropTableReplay(*dynamic_cast<const WalCmdDropTable *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::ALTER_INFO: {
-                Status status = Status::NotSupport("WalCmdAlterInfo Replay Not implemented");
-                RecoverableError(status);
-                break;
-            }
-            case WalCommandType::CREATE_INDEX: {
-                WalCmdCreateIndexReplay(*dynamic_cast<const WalCmdCreateIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DROP_INDEX: {
-                WalCmdDropIndexReplay(*dynamic_cast<const WalCmdDropIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::IMPORT: {
-                WalCmdImportReplay(*dynamic_cast<const WalCmdImport *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::APPEND: {
-                WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DELETE: {
-                WalCmdDeleteReplay(*dynamic_cast<const WalCmdDelete *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            // case WalCommandType::SET_SEGMENT_STATUS_SEALED:
-            //     WalCmdSetSegmentStatusSealedReplay(*dynamic_cast<const WalCmdSetSegmentStatusSealed *>(cmd.get()), entry.txn_id_,
-            //     entry.commit_ts_); break;
-            // case WalCommandType::UPDATE_SEGMENT_BLOOM_FILTER_DATA:
-            //     WalCmdUpdateSegmentBloomFilterDataReplay(*dynamic_cast<const WalCmdUpdateSegmentBloomFilterData *>(cmd.get()),
-            //                                              entry.txn_id_,
-            //                                              entry.commit_ts_);
-            //     break;
-            case WalCommandType::CHECKPOINT: {
-                break;
-            }
-            case WalCommandType::COMPACT: {
-                WalCmdCompactReplay(*static_cast<const WalCmdCompact *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::OPTIMIZE: {
-                auto *optimize_cmd = const_cast<WalCmdOptimize *>(static_cast<const WalCmdOptimize *>(cmd.get()));
-                WalCmdOptimizeReplay(*optimize_cmd, entry.txn_id_, entry.commit_ts_);
-                break;
+        ReplayWalCmd(cmd.get(), entry.txn_id_, entry.commit_ts_);
+    }
+}
+
+namespace {
+
+// The table changed by a data command, the commands of different tables can be replayed concurrently.
+// Returns None for the commands changing the catalog structure.
+Optional<Pair<String, String>> ReplayTableOfWalCmd(const WalCmd *cmd) {
+    switch (cmd->GetType()) {
+        case WalCommandType::IMPORT: {
+            const auto *import_cmd = static_cast<const WalCmdImport *>(cmd);
+            return Pair<String, String>{import_cmd->db_name_, import_cmd->table_name_};
+        }
+        case WalCommandType::APPEND: {
+            const auto *append_cmd = static_cast<const WalCmdAppend *>(cmd);
+            return Pair<String, String>{append_cmd->db_name_, append_cmd->table_name_};
+        }
+        case WalCommandType::DELETE: {
+            const auto *delete_cmd = static_cast<const WalCmdDelete *>(cmd);
+            return Pair<String, String>{delete_cmd->db_name_, delete_cmd->table_name_};
+        }
+        case WalCommandType::COMPACT: {
+            const auto *compact_cmd = static_cast<const WalCmdCompact *>(cmd);
+            return Pair<String, String>{compact_cmd->db_name_, compact_cmd->table_name_};
+        }
+        case WalCommandType::OPTIMIZE: {
+            const auto *optimize_cmd = static_cast<const WalCmdOptimize *>(cmd);
+            return Pair<String, String>{optimize_cmd->db_name_, optimize_cmd->table_name_};
+        }
+        case WalCommandType::DUMP_INDEX: {
+            const auto *dump_index_cmd = static_cast<const WalCmdDumpIndex *>(cmd);
+            return Pair<String, String>{dump_index_cmd->db_name_, dump_index_cmd->table_name_};
+        }
+        default: {
+            return None;
+        }
+    }
+}
+
+struct ReplayCmd {
+    WalCmd *cmd_{};
+    TransactionID txn_id_{};
+    TxnTimeStamp commit_ts_{};
+};
+
+} // namespace
+
+void WalManager::ReplayWalEntries(const Vector<SharedPtr<WalEntry>> &replay_entries) {
+    // Data commands of each table since the last command changing the catalog structure, in the wal order
+    Map<Pair<String, String>, Vector<ReplayCmd>> table_cmds;
+    SizeT concurrent_replay_count = 0;
+    auto replay_table_cmds = [&] {
+        if (table_cmds.size() <= 1) {
+            for (const auto &[_, cmds] : table_cmds) {
+                for (const ReplayCmd &replay_cmd : cmds) {
+                    ReplayWalCmd(replay_cmd.cmd_, replay_cmd.txn_id_, replay_cmd.commit_ts_);
+                }
             }
-            case WalCommandType::DUMP_INDEX: {
-                WalCmdDumpIndexReplay(*static_cast<WalCmdDumpIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
+            table_cmds.clear();
+            return;
+        }
+        ThreadPool &replay_thread_pool = InfinityContext::instance().GetAppendThreadPool();
+        Vector<std::future<void>> futures;
+        futures.reserve(table_cmds.size());
+        for (const auto &[_, cmds] : table_cmds) {
+            futures.emplace_back(replay_thread_pool.push([this, &cmds](int) {
+                for (const ReplayCmd &replay_cmd : cmds) {
+                    ReplayWalCmd(replay_cmd.cmd_, replay_cmd.txn_id_, replay_cmd.commit_ts_);
+                }
+            }));
+        }
+        // All the tasks reference `table_cmds`, wait for all of them before rethrowing the first error
+        for (auto &future : futures) {
+            future.wait();
+        }
+        for (auto &future : futures) {
+            future.get();
+        }
+        concurrent_replay_count += table_cmds.size();
+        table_cmds.clear();
+    };
+
+    for (const auto &entry : replay_entries) {
+        LOG_TRACE(entry->ToString());
+        for (const auto &cmd : entry->cmds_) {
+            if (cmd->GetType() == WalCommandType::CHECKPOINT) {
+                continue;
             }
-            default: {
-                String error_message = "WalManager::ReplayWalEntry unknown wal command type";
-                UnrecoverableError(error_message);
+            auto table = ReplayTableOfWalCmd(cmd.get());
+            if (table.has_value()) {
+                table_cmds[std::move(*table)].push_back(ReplayCmd{cmd.get(), entry->txn_id_, entry->commit_ts_});
+                continue;
             }
+            // The structure changes are applied after all the data commands before them
+            replay_table_cmds();
+            ReplayWalCmd(cmd.get(), entry->txn_id_, entry->commit_ts_);
+        }
+    }
+    replay_table_cmds();
+    LOG_INFO(fmt::format("Replayed the data commands of {} table batches concurrently", concurrent_replay_count));
+}
+
+void WalManager::ReplayWalCmd(WalCmd *cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
+    LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd->GetType()).c_str(), commit_ts));
+    switch (cmd->GetType()) {
+        case WalCommandType::CREATE_DATABASE: {
+            WalCmdCreateDatabaseReplay(*dynamic_cast<const WalCmdCreateDatabase *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DROP_DATABASE: {
+            WalCmdDropDatabaseReplay(*dynamic_cast<const WalCmdDropDatabase *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::CREATE_TABLE: {
+            WalCmdCreateTableReplay(*dynamic_cast<const WalCmdCreateTable *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DROP_TABLE: {
+            WalCmdDropTableReplay(*dynamic_cast<const WalCmdDropTable *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::ALTER_INFO: {
+            Status status = Status::NotSupport("WalCmdAlterInfo Replay Not implemented");
+            RecoverableError(status);
+            break;
+        }
+        case WalCommandType::CREATE_INDEX: {
+            WalCmdCreateIndexReplay(*dynamic_cast<const WalCmdCreateIndex *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DROP_INDEX: {
+            WalCmdDropIndexReplay(*dynamic_cast<const WalCmdDropIndex *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::IMPORT: {
+            WalCmdImportReplay(*dynamic_cast<const WalCmdImport *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::APPEND: {
+            WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DELETE: {
+            WalCmdDeleteReplay(*dynamic_cast<const WalCmdDelete *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        // case WalCommandType::SET_SEGMENT_STATUS_SEALED:
+        //     WalCmdSetSegmentStatusSealedReplay(*dynamic_cast<const WalCmdSetSegmentStatusSealed *>(cmd), txn_id,
+        //     commit_ts); break;
+        // case WalCommandType::UPDATE_SEGMENT_BLOOM_FILTER_DATA:
+        //     WalCmdUpdateSegmentBloomFilterDataReplay(*dynamic_cast<const WalCmdUpdateSegmentBloomFilterData *>(cmd),
+        //                                              txn_id,
+        //                                              commit_ts);
+        //     break;
+        case WalCommandType::CHECKPOINT: {
+            break;
+        }
+        case WalCommandType::COMPACT: {
+            WalCmdCompactReplay(*static_cast<const WalCmdCompact *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::OPTIMIZE: {
+            auto *optimize_cmd = const_cast<WalCmdOptimize *>(static_cast<const WalCmdOptimize *>(cmd));
+            WalCmdOptimizeReplay(*optimize_cmd, txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DUMP_INDEX: {
+            WalCmdDumpIndexReplay(*static_cast<WalCmdDumpIndex *>(cmd), txn_id, commit_ts);
+            break;
+        }
+        default: {
+            String error_message = "WalManager::ReplayWalCmd unknown wal command type";
+            UnrecoverableError(error_message);
         }
     }
 }
@@ -853,7 +1029,7 @@ void WalManager::WalCmdCreateTableReplay(const WalCmdCreateTable &cmd, Transacti
                                                 begin_ts,
                                                 commit_ts,
                                                 0 /*row_count*/,
-                                                INVALID_SEGMENT_ID /*unsealed_id*/,
+                                                TableEntry::NewUnsealedIDs(),
                                                 0 /*next_segment_id*/);
         },
         txn_id,
@@ -887,7 +1063,7 @@ void WalManager::WalCmdDropTableReplay(const WalCmdDropTable &cmd, TransactionID
                                                 begin_ts,
                                                 commit_ts,
                                                 0 /*row_count*/,
-                                                INVALID_SEGMENT_ID /*unsealed_id*/,
+                                                {INVALID_SEGMENT_ID} /*unsealed_ids*/,
                                                 0 /*next_segment_id*/);
         },
         txn_id,
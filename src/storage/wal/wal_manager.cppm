@@ -71,6 +71,9 @@ public:
 
     void ReplayWalEntry(const WalEntry &entry);
 
+    // Replay the entries in order, the data commands of different tables between two catalog structure changes are replayed concurrently
+    void ReplayWalEntries(const Vector<SharedPtr<WalEntry>> &replay_entries);
+
 
     TxnTimeStamp GetCheckpointedTS();
 
@@ -83,6 +86,11 @@ private:
     i64 GetLastCkpWalSize();
     void SetLastCkpWalSize(i64 wal_size);
 
+    // Commit the bottom halves of the txns of a batch, copying their appended rows concurrently where possible
+    void CommitBottoms(const Deque<WalEntry *> &log_batch);
+
+    void ReplayWalCmd(WalCmd *cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
+
     void WalCmdCreateDatabaseReplay(const WalCmdCreateDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdDropDatabaseReplay(const WalCmdDropDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdCreateTableReplay(const WalCmdCreateTable &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
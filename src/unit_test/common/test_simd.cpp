@@ -1,9 +1,14 @@
 #include "unit_test/base_test.h"
 #include <iostream>
+#include <random>
 #include <vector>
 
 import stl;
 import simd_init;
+import simd_functions;
+import distance_simd_functions;
+import internal_types;
+import maxsim_simd_funcs;
 
 class SimdInitTest : public BaseTest {};
 
@@ -19,3 +24,81 @@ TEST_F(SimdInitTest, GetSupportedSimdTypesList) {
     alignas(alignof(u16)) u8 v[2] = {1, 0};
     EXPECT_EQ(*reinterpret_cast<const u16 *>(v), 1u);
 }
+
+TEST_F(SimdInitTest, HalfBatchDistance) {
+    SizeT dim = 203;
+    SizeT query_n = 7;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<f32> distrib(-1.0f, 1.0f);
+
+    Vector<f32> queries(query_n * dim);
+    Vector<f32> data(dim);
+    Vector<u16> f16_data(dim);
+    Vector<u16> bf16_data(dim);
+    for (auto &v : queries) {
+        v = distrib(rng);
+    }
+    for (SizeT j = 0; j < dim; ++j) {
+        data[j] = distrib(rng);
+        f16_data[j] = Float16T(data[j]).raw;
+        bf16_data[j] = BFloat16T(data[j]).raw;
+    }
+
+    const auto &simd_functions = GetSIMD_FUNCTIONS();
+    auto check = [&](HalfBatchDistanceFuncType batch_func, F32DistanceFuncType f32_func, const Vector<u16> &half_data, bool bf16) {
+        Vector<f32> widened(dim);
+        for (SizeT j = 0; j < dim; ++j) {
+            widened[j] = bf16 ? f32(BFloat16T(half_data[j])) : f32(Float16T(half_data[j]));
+        }
+        // all the query counts to cover the groups and the remainder of the batch
+        for (SizeT n = 1; n <= query_n; ++n) {
+            Vector<f32> dists(n);
+            batch_func(queries.data(), n, half_data.data(), dim, dists.data());
+            for (SizeT i = 0; i < n; ++i) {
+                f32 expected = f32_func(queries.data() + i * dim, widened.data(), dim);
+                EXPECT_NEAR(dists[i], expected, 1e-3f * std::max(1.0f, std::abs(expected)));
+            }
+        }
+    };
+    check(simd_functions.F16L2Batch_func_ptr_, L2Distance_common, f16_data, false);
+    check(simd_functions.F16IPBatch_func_ptr_, IPDistance_common, f16_data, false);
+    check(simd_functions.F16CosBatch_func_ptr_, CosineDistance_common, f16_data, false);
+    check(simd_functions.BF16L2Batch_func_ptr_, L2Distance_common, bf16_data, true);
+    check(simd_functions.BF16IPBatch_func_ptr_, IPDistance_common, bf16_data, true);
+    check(simd_functions.BF16CosBatch_func_ptr_, CosineDistance_common, bf16_data, true);
+}
+
+TEST_F(SimdInitTest, MaxSimBit) {
+    SizeT dim = 203;
+    SizeT vec_n = 100;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<f32> distrib(-1.0f, 1.0f);
+
+    Vector<f32> vecs(vec_n * dim);
+    for (auto &v : vecs) {
+        v = distrib(rng);
+    }
+
+    const auto &simd_functions = GetSIMD_FUNCTIONS();
+    SizeT bytes = (dim + 7) / 8;
+    Vector<u8> bits(vec_n * bytes);
+    Vector<u8> plain_bits(vec_n * bytes);
+    for (SizeT i = 0; i < vec_n; ++i) {
+        simd_functions.MaxSimF32ToBits_func_ptr_(vecs.data() + i * dim, bits.data() + i * bytes, dim);
+        maxsim_f32_to_bits_plain(vecs.data() + i * dim, plain_bits.data() + i * bytes, dim);
+    }
+    EXPECT_EQ(bits, plain_bits);
+
+    for (SizeT i = 0; i + 1 < vec_n; ++i) {
+        // different lengths to cover the residual of each kernel
+        SizeT n = bytes - i % bytes;
+        const u8 *v1 = bits.data() + i * bytes;
+        const u8 *v2 = bits.data() + (i + 1) * bytes;
+        u32 expected = 0;
+        for (SizeT j = 0; j < n * 8 && j < dim; ++j) {
+            expected += (vecs[i * dim + j] > 0.0f) != (vecs[(i + 1) * dim + j] > 0.0f);
+        }
+        EXPECT_EQ(simd_functions.MaxSimBitHamming_func_ptr_(v1, v2, n), expected);
+        EXPECT_EQ(maxsim_bit_hamming_plain(v1, v2, n), expected);
+    }
+}
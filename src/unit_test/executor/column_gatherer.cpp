@@ -0,0 +1,168 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import storage;
+import global_resource_usage;
+import infinity_context;
+import status;
+import catalog;
+import txn;
+import buffer_manager;
+import txn_manager;
+import column_vector;
+import table_def;
+import value;
+import physical_import;
+import default_values;
+import logical_type;
+import internal_types;
+import extra_ddl_info;
+import column_def;
+import data_type;
+import segment_entry;
+import block_entry;
+import table_entry;
+import block_index;
+import column_gatherer;
+
+using namespace infinity;
+
+class ColumnGathererTest : public BaseTestParamStr {
+protected:
+    void SetUp() override {
+        RemoveDbDirs();
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::string config_path_str = GetParam();
+        std::shared_ptr<std::string> config_path = nullptr;
+        if (config_path_str != BaseTestParamStr::NULL_CONFIG_PATH) {
+            config_path = infinity::MakeShared<std::string>(config_path_str);
+        }
+        infinity::InfinityContext::instance().Init(config_path);
+    }
+
+    void TearDown() override {
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+        CleanupDbDirs();
+    }
+
+    // the value of a row is segment_id * SEGMENT_STRIDE + segment_offset
+    static constexpr i64 SEGMENT_STRIDE = 1000000;
+
+    void AddSegment(TxnManager *txn_mgr, BufferManager *buffer_mgr, const String &table_name, SizeT segment_size) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("import table"));
+        auto [table_entry, status] = txn->GetTableByName("default_db", table_name);
+        EXPECT_TRUE(status.ok());
+
+        SegmentID segment_id = Catalog::GetNextSegmentID(table_entry);
+        auto segment_entry = SegmentEntry::NewSegmentEntry(table_entry, segment_id, txn);
+        SizeT segment_offset = 0;
+        while (segment_offset < segment_size) {
+            auto block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, 1, txn);
+            SizeT write_size = std::min(SizeT(DEFAULT_BLOCK_CAPACITY), segment_size - segment_offset);
+            Vector<ColumnVector> column_vectors;
+            {
+                auto column_vector = ColumnVector(MakeShared<DataType>(LogicalType::kBigInt));
+                column_vector.Initialize();
+                for (SizeT i = 0; i < write_size; ++i) {
+                    column_vector.AppendValue(Value::MakeBigInt(segment_id * SEGMENT_STRIDE + segment_offset + i));
+                }
+                column_vectors.push_back(std::move(column_vector));
+            }
+            block_entry->AppendBlock(column_vectors, 0, write_size, buffer_mgr);
+            segment_entry->AppendBlockEntry(std::move(block_entry));
+            segment_offset += write_size;
+        }
+        PhysicalImport::SaveSegmentData(table_entry, txn, segment_entry);
+        txn_mgr->CommitTxn(txn);
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestWithDifferentParams,
+                         ColumnGathererTest,
+                         ::testing::Values(BaseTestParamStr::NULL_CONFIG_PATH, BaseTestParamStr::CONFIG_PATH));
+
+TEST_P(ColumnGathererTest, gather_across_blocks_and_segments) {
+    String table_name = "tbl1";
+    Storage *storage = InfinityContext::instance().storage();
+    BufferManager *buffer_mgr = storage->buffer_manager();
+    TxnManager *txn_mgr = storage->txn_manager();
+
+    {
+        Vector<SharedPtr<ColumnDef>> columns;
+        std::set<ConstraintType> constraints;
+        columns.emplace_back(MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kBigInt), "c1", constraints));
+        auto tbl1_def = MakeUnique<TableDef>(MakeShared<String>("default_db"), MakeShared<String>(table_name), columns);
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+        Status status = txn->CreateTable("default_db", std::move(tbl1_def), ConflictType::kIgnore);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+    // two segments of three blocks each
+    SizeT segment_size = 2 * DEFAULT_BLOCK_CAPACITY + 100;
+    AddSegment(txn_mgr, buffer_mgr, table_name, segment_size);
+    AddSegment(txn_mgr, buffer_mgr, table_name, segment_size);
+
+    auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("gather"));
+    auto [table_entry, status] = txn->GetTableByName("default_db", table_name);
+    EXPECT_TRUE(status.ok());
+    SharedPtr<BlockIndex> block_index = table_entry->GetBlockIndex(txn);
+    EXPECT_EQ(block_index->SegmentCount(), 2u);
+    EXPECT_EQ(block_index->BlockCount(), 6u);
+
+    // runs crossing block boundaries, single rows, and rows of every block of both segments
+    Vector<RowID> row_ids;
+    for (SegmentID segment_id = 0; segment_id < 2; ++segment_id) {
+        for (SegmentOffset offset = DEFAULT_BLOCK_CAPACITY - 3; offset < DEFAULT_BLOCK_CAPACITY + 3; ++offset) {
+            row_ids.emplace_back(segment_id, offset);
+        }
+        row_ids.emplace_back(segment_id, 0);
+        row_ids.emplace_back(segment_id, 2 * DEFAULT_BLOCK_CAPACITY + 99);
+    }
+
+    auto check = [&](const Vector<RowID> &gather_row_ids) {
+        ColumnGatherer gatherer(block_index.get(), buffer_mgr, Vector<SizeT>{0});
+        ColumnVector output(MakeShared<DataType>(LogicalType::kBigInt));
+        output.Initialize();
+        gatherer.Gather(gather_row_ids.data(), gather_row_ids.size(), Vector<ColumnVector *>{&output});
+        ASSERT_EQ(output.Size(), gather_row_ids.size());
+        for (SizeT i = 0; i < gather_row_ids.size(); ++i) {
+            const RowID &row_id = gather_row_ids[i];
+            EXPECT_EQ(output.GetValue(i), Value::MakeBigInt(row_id.segment_id_ * SEGMENT_STRIDE + row_id.segment_offset_));
+        }
+    };
+
+    // in storage order
+    std::sort(row_ids.begin(), row_ids.end());
+    check(row_ids);
+
+    // in an arbitrary order, as a knn or match result is ordered by score
+    std::mt19937 rng(42);
+    std::shuffle(row_ids.begin(), row_ids.end(), rng);
+    check(row_ids);
+    std::reverse(row_ids.begin(), row_ids.end());
+    check(row_ids);
+
+    txn_mgr->CommitTxn(txn);
+}
@@ -30,6 +30,8 @@ import search_expr;
 import column_expr;
 import column_def;
 import data_type;
+import column_vector;
+import compilation_config;
 
 class InfinityTest : public BaseTest {};
 
@@ -247,6 +249,101 @@ TEST_F(InfinityTest, test1) {
     Infinity::LocalUnInit();
 }
 
+TEST_F(InfinityTest, insert_columns) {
+    using namespace infinity;
+    String path = GetHomeDir();
+    RemoveDbDirs();
+    Infinity::LocalInit(path);
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    QueryResult result = infinity->Query("create table t1 (c1 integer, c2 smallint, c3 double, c4 varchar, c5 integer default 7)");
+    EXPECT_TRUE(result.IsOk());
+
+    {
+        // the columns arrive in the types the client sent, c1 and c3 are cast to the table types and c5 gets its default
+        auto make_column = [](LogicalType logical_type, const Vector<Value> &values) {
+            auto column_vector = MakeShared<ColumnVector>(MakeShared<DataType>(logical_type));
+            column_vector->Initialize();
+            for (const auto &value : values) {
+                column_vector->AppendValue(value);
+            }
+            return column_vector;
+        };
+        Vector<SharedPtr<ColumnVector>> columns;
+        columns.push_back(make_column(LogicalType::kBigInt, {Value::MakeBigInt(1), Value::MakeBigInt(2)}));
+        columns.push_back(make_column(LogicalType::kSmallInt, {Value::MakeSmallInt(10), Value::MakeSmallInt(20)}));
+        columns.push_back(make_column(LogicalType::kFloat, {Value::MakeFloat(0.5f), Value::MakeFloat(1.5f)}));
+        columns.push_back(make_column(LogicalType::kVarchar, {Value::MakeVarchar("abc"), Value::MakeVarchar("a longer string than inline")}));
+        result = infinity->InsertColumns("default_db", "t1", {"C1", "c2", "c3", "c4"}, columns);
+        EXPECT_TRUE(result.IsOk());
+
+        // a column of another row count, a duplicated and an unknown column are rejected
+        auto short_column = make_column(LogicalType::kBigInt, {Value::MakeBigInt(3)});
+        result = infinity->InsertColumns("default_db", "t1", {"c1", "c2"}, {short_column, columns[1]});
+        EXPECT_FALSE(result.IsOk());
+        result = infinity->InsertColumns("default_db", "t1", {"c1", "c1"}, {columns[0], columns[0]});
+        EXPECT_FALSE(result.IsOk());
+        result = infinity->InsertColumns("default_db", "t1", {"c6"}, {columns[0]});
+        EXPECT_FALSE(result.IsOk());
+    }
+
+    // integer and float literals are cast to the column types
+    result = infinity->Query("insert into t1 values (3, 30, 2, 'xyz', 8)");
+    EXPECT_TRUE(result.IsOk());
+
+    result = infinity->Query("select c1, c2, c3, c4, c5 from t1");
+    EXPECT_TRUE(result.IsOk());
+    SharedPtr<DataBlock> data_block = result.result_table_->GetDataBlockById(0);
+    EXPECT_EQ(data_block->row_count(), 3);
+    EXPECT_EQ(data_block->GetValue(0, 0), Value::MakeInt(1));
+    EXPECT_EQ(data_block->GetValue(0, 2), Value::MakeInt(3));
+    EXPECT_EQ(data_block->GetValue(1, 1), Value::MakeSmallInt(20));
+    EXPECT_EQ(data_block->GetValue(1, 2), Value::MakeSmallInt(30));
+    EXPECT_EQ(data_block->GetValue(2, 1), Value::MakeDouble(1.5));
+    EXPECT_EQ(data_block->GetValue(2, 2), Value::MakeDouble(2));
+    EXPECT_EQ(data_block->GetValue(3, 1).GetVarchar(), "a longer string than inline");
+    EXPECT_EQ(data_block->GetValue(4, 0), Value::MakeInt(7));
+    EXPECT_EQ(data_block->GetValue(4, 2), Value::MakeInt(8));
+
+    infinity->LocalDisconnect();
+    Infinity::LocalUnInit();
+}
+
+TEST_F(InfinityTest, compact_lvq_hnsw) {
+    using namespace infinity;
+    String path = GetHomeDir();
+    RemoveDbDirs();
+    Infinity::LocalInit(path);
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    QueryResult result = infinity->Query("create table t1 (c1 integer, c2 embedding(float, 4))");
+    EXPECT_TRUE(result.IsOk());
+    String copy_sql = "copy t1 from '" + String(test_data_path()) + "/csv/embedding_float_dim4.csv' with (delimiter ',', format csv)";
+    result = infinity->Query("create index idx1 on t1 (c2) using hnsw with (m = 16, ef_construction = 200, metric = l2)");
+    EXPECT_TRUE(result.IsOk());
+    result = infinity->Query(copy_sql);
+    EXPECT_TRUE(result.IsOk());
+
+    // the index chunk of the first segment is lvq encoded, so it can not be the base of the new plain index
+    result = infinity->Query("optimize idx1 on t1 with (compress_to_lvq)");
+    EXPECT_TRUE(result.IsOk());
+    result = infinity->Query(copy_sql);
+    EXPECT_TRUE(result.IsOk());
+    result = infinity->Query("compact table t1");
+    EXPECT_TRUE(result.IsOk());
+
+    result = infinity->Query("select c1 from t1 search match vector (c2, [0.3, 0.3, 0.2, 0.2], 'float', 'l2', 3)");
+    EXPECT_TRUE(result.IsOk());
+    SharedPtr<DataBlock> data_block = result.result_table_->GetDataBlockById(0);
+    EXPECT_EQ(data_block->row_count(), 3);
+    EXPECT_EQ(data_block->GetValue(0, 0), Value::MakeInt(8));
+    EXPECT_EQ(data_block->GetValue(0, 1), Value::MakeInt(8));
+    EXPECT_EQ(data_block->GetValue(0, 2), Value::MakeInt(6));
+
+    infinity->LocalDisconnect();
+    Infinity::LocalUnInit();
+}
+
 TEST_F(InfinityTest, test2) {
     using namespace infinity;
     String path = GetHomeDir();
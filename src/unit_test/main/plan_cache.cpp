@@ -0,0 +1,152 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import infinity;
+import query_result;
+import plan_cache;
+
+class PlanCacheTest : public BaseTest {};
+
+TEST_F(PlanCacheTest, test1) {
+    using namespace infinity;
+    String path = GetHomeDir();
+    RemoveDbDirs();
+    Infinity::LocalInit(path);
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    PlanCache &plan_cache = PlanCache::instance();
+    {
+        QueryResult result = infinity->Query("create table t1(c1 int, c2 int);");
+        EXPECT_TRUE(result.IsOk());
+        result = infinity->Query("insert into t1 values (1, 10), (2, 20), (3, 30);");
+        EXPECT_TRUE(result.IsOk());
+    }
+    {
+        u64 hit_count = plan_cache.hit_count();
+        QueryResult result = infinity->Query("select c1, c2 from t1 where c1 > 1;");
+        EXPECT_TRUE(result.IsOk());
+        EXPECT_EQ(result.result_table_->row_count(), 2u);
+        EXPECT_EQ(plan_cache.hit_count(), hit_count);
+
+        // same statement, no data changed
+        result = infinity->Query("select c1, c2 from t1 where c1 > 1;");
+        EXPECT_TRUE(result.IsOk());
+        EXPECT_EQ(result.result_table_->row_count(), 2u);
+        EXPECT_EQ(plan_cache.hit_count(), hit_count + 1);
+
+        // different constant
+        result = infinity->Query("select c1, c2 from t1 where c1 > 2;");
+        EXPECT_TRUE(result.IsOk());
+        EXPECT_EQ(result.result_table_->row_count(), 1u);
+        EXPECT_EQ(plan_cache.hit_count(), hit_count + 1);
+    }
+    {
+        // the insert keeps the cached plans, the new row is read by the snapshot of the next txn
+        QueryResult result = infinity->Query("insert into t1 values (4, 40);");
+        EXPECT_TRUE(result.IsOk());
+
+        u64 hit_count = plan_cache.hit_count();
+        result = infinity->Query("select c1, c2 from t1 where c1 > 1;");
+        EXPECT_TRUE(result.IsOk());
+        EXPECT_EQ(result.result_table_->row_count(), 3u);
+        EXPECT_EQ(plan_cache.hit_count(), hit_count + 1);
+    }
+    {
+        // an index change invalidates the cached plans
+        QueryResult result = infinity->Query("create index idx1 on t1(c2);");
+        EXPECT_TRUE(result.IsOk());
+
+        u64 hit_count = plan_cache.hit_count();
+        result = infinity->Query("select c1, c2 from t1 where c1 > 1;");
+        EXPECT_TRUE(result.IsOk());
+        EXPECT_EQ(result.result_table_->row_count(), 3u);
+        EXPECT_EQ(plan_cache.hit_count(), hit_count);
+
+        result = infinity->Query("select c1, c2 from t1 where c1 > 1;");
+        EXPECT_TRUE(result.IsOk());
+        EXPECT_EQ(result.result_table_->row_count(), 3u);
+        EXPECT_EQ(plan_cache.hit_count(), hit_count + 1);
+    }
+    {
+        QueryResult result = infinity->Query("drop table t1;");
+        EXPECT_TRUE(result.IsOk());
+        result = infinity->Query("select c1, c2 from t1 where c1 > 1;");
+        EXPECT_FALSE(result.IsOk());
+    }
+
+    Infinity::LocalUnInit();
+    EXPECT_EQ(plan_cache.size(), 0u);
+}
+
+TEST_F(PlanCacheTest, test_interleaved_writes) {
+    using namespace infinity;
+    String path = GetHomeDir();
+    RemoveDbDirs();
+    Infinity::LocalInit(path);
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    PlanCache &plan_cache = PlanCache::instance();
+    {
+        QueryResult result = infinity->Query("create table t1(c1 int, c2 embedding(float, 2));");
+        EXPECT_TRUE(result.IsOk());
+        result = infinity->Query("insert into t1 values (1, [1.0, 1.0]), (2, [2.0, 2.0]), (3, [3.0, 3.0]);");
+        EXPECT_TRUE(result.IsOk());
+    }
+    const String scan_sql = "select c1 from t1 where c1 > 1;";
+    const String knn_sql = "select c1 from t1 search match vector (c2, [0.0, 0.0], 'float', 'l2', 10) where c1 > 1;";
+    auto check = [&](SizeT expect_row_count) {
+        // the second execution of each statement reuses the plan and must see the same rows
+        for (int i = 0; i < 2; ++i) {
+            QueryResult result = infinity->Query(scan_sql);
+            EXPECT_TRUE(result.IsOk());
+            EXPECT_EQ(result.result_table_->row_count(), expect_row_count);
+            result = infinity->Query(knn_sql);
+            EXPECT_TRUE(result.IsOk());
+            EXPECT_EQ(result.result_table_->row_count(), expect_row_count);
+        }
+    };
+    {
+        u64 hit_count = plan_cache.hit_count();
+        check(2);
+        EXPECT_EQ(plan_cache.hit_count(), hit_count + 2);
+    }
+    {
+        QueryResult result = infinity->Query("insert into t1 values (4, [4.0, 4.0]), (5, [5.0, 5.0]);");
+        EXPECT_TRUE(result.IsOk());
+        u64 hit_count = plan_cache.hit_count();
+        check(4);
+        EXPECT_EQ(plan_cache.hit_count(), hit_count + 4);
+        result = infinity->Query("delete from t1 where c1 = 2;");
+        EXPECT_TRUE(result.IsOk());
+        check(3);
+        result = infinity->Query("insert into t1 values (6, [6.0, 6.0]);");
+        EXPECT_TRUE(result.IsOk());
+        result = infinity->Query("delete from t1 where c1 > 4;");
+        EXPECT_TRUE(result.IsOk());
+        check(2);
+    }
+    {
+        // a cached plan holds no snapshot of the txn it was executed in
+        QueryResult result = infinity->Query("drop table t1;");
+        EXPECT_TRUE(result.IsOk());
+        result = infinity->Query(scan_sql);
+        EXPECT_FALSE(result.IsOk());
+    }
+
+    Infinity::LocalUnInit();
+    EXPECT_EQ(plan_cache.size(), 0u);
+}
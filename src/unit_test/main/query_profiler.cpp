@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "unit_test/base_test.h"
+#include <thread>
 
 import stl;
 import profiler;
@@ -112,4 +113,26 @@ TEST_F(QueryProfilerTest, test3) {
     profiler.StopPhase(infinity::QueryPhase::kExecution);
 
     std::cout << profiler.ToString() << std::endl;
-}
\ No newline at end of file
+}
+
+// The counters are per thread, the difference around a piece of work is the work done by the thread
+TEST_F(QueryProfilerTest, test_thread_counters) {
+    infinity::ProfileCounters begin = infinity::ThreadProfileCounters();
+    infinity::ThreadProfileCounters().buffer_hits_ += 2;
+    infinity::ThreadProfileCounters().hnsw_hops_ += 10;
+    std::thread([] { infinity::ThreadProfileCounters().buffer_hits_ += 100; }).join();
+
+    infinity::ProfileCounters diff = infinity::ThreadProfileCounters() - begin;
+    EXPECT_EQ(diff.buffer_hits_, 2u);
+    EXPECT_EQ(diff.buffer_misses_, 0u);
+    EXPECT_EQ(diff.hnsw_hops_, 10u);
+
+    infinity::ProfileCounters sum;
+    sum += diff;
+    sum += diff;
+    EXPECT_EQ(sum.buffer_hits_, 4u);
+    EXPECT_EQ(sum.hnsw_hops_, 20u);
+
+    infinity::QueryProfiler profiler(true);
+    EXPECT_TRUE(profiler.GetOperatorProfiles().empty());
+}
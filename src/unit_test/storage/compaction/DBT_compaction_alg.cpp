@@ -504,3 +504,60 @@ TEST_F(DBTCompactionTest, RollbackTest) {
         }
     }
 }
+
+TEST_F(DBTCompactionTest, DeleteRatioTest) {
+    TransactionID txn_id = 0;
+
+    int m = 3;
+    int c = 3;
+    int s = 1;
+    f64 delete_ratio = 0.3;
+    DBTCompactionAlg DBTCompact(m, c, s, MockSegmentEntry::segment_capacity, nullptr, delete_ratio);
+    DBTCompact.Enable(Vector<SegmentEntry *>{});
+
+    Vector<SharedPtr<SegmentEntry>> segment_entries; // hold lifetime
+    auto segment_entry = MockSegmentEntry::Make(10);
+    auto *shrink_segment = static_cast<MockSegmentEntry *>(segment_entry.get());
+    segment_entries.emplace_back(segment_entry);
+    DBTCompact.AddSegment(segment_entry.get());
+    {
+        auto segments = DBTCompact.CheckCompaction(++txn_id);
+        EXPECT_TRUE(segments.empty());
+    }
+    {
+        shrink_segment->ShrinkSegment(2);
+        DBTCompact.DeleteInSegment(shrink_segment->segment_id());
+        auto segments = DBTCompact.CheckCompaction(++txn_id);
+        EXPECT_TRUE(segments.empty());
+    }
+    {
+        shrink_segment->ShrinkSegment(3);
+        DBTCompact.DeleteInSegment(shrink_segment->segment_id());
+        // the index is expensive to rebuild, 50% deleted rows is not enough
+        DBTCompact.SetIndexRebuildCost(17);
+        auto segments = DBTCompact.CheckCompaction(++txn_id);
+        EXPECT_TRUE(segments.empty());
+    }
+    {
+        DBTCompact.SetIndexRebuildCost(1);
+        auto segments = DBTCompact.CheckCompaction(++txn_id);
+        EXPECT_EQ(segments.size(), 1u);
+        EXPECT_EQ(segments[0], segment_entry.get());
+        DBTCompact.RollbackCompact(txn_id);
+    }
+    {
+        auto segments = DBTCompact.CheckCompaction(++txn_id);
+        EXPECT_EQ(segments.size(), 1u);
+        auto compacted_segments = MockSegmentEntry::MockCompact(segments);
+        EXPECT_EQ(compacted_segments.size(), 1u);
+        segment_entries.insert(segment_entries.end(), compacted_segments.begin(), compacted_segments.end());
+        EXPECT_EQ(compacted_segments[0]->actual_row_count(), 5u);
+
+        DBTCompact.CommitCompact(txn_id);
+        for (auto &segment : compacted_segments) {
+            DBTCompact.AddSegment(segment.get());
+            auto segments = DBTCompact.CheckCompaction(++txn_id);
+            EXPECT_TRUE(segments.empty());
+        }
+    }
+}
@@ -122,3 +122,36 @@ TEST_P(PostingWriterTest, test1) {
         }
     }
 }
+
+TEST_P(PostingWriterTest, test_decode_block) {
+    Vector<docid_t> expected = {1, 3, 5, 7, 9, 10};
+    VectorWithLock<u32> column_length_array(20, 10);
+    SharedPtr<PostingWriter> posting = MakeShared<PostingWriter>(posting_format_, column_length_array);
+    for (u32 i = 0; i < expected.size(); ++i) {
+        posting->AddPosition(1);
+        posting->AddPosition(3);
+        posting->EndDocument(expected[i], 0);
+    }
+
+    SharedPtr<Vector<SegmentPosting>> seg_postings = MakeShared<Vector<SegmentPosting>>();
+    SegmentPosting seg_posting;
+    RowID base_row_id = 0;
+    seg_posting.Init(base_row_id, posting);
+    seg_postings->push_back(seg_posting);
+    PostingIterator iter(flag_);
+    iter.Init(seg_postings, 0);
+
+    RowID doc_id = iter.SeekDoc(expected[2]);
+    ASSERT_EQ(doc_id, expected[2]);
+    RowID doc_ids[MAX_DOC_PER_RECORD];
+    tf_t tfs[MAX_DOC_PER_RECORD];
+    u32 doc_count = iter.DecodeCurrentBlock(doc_ids, tfs);
+    ASSERT_EQ(doc_count, expected.size());
+    for (u32 i = 0; i < doc_count; ++i) {
+        ASSERT_EQ(doc_ids[i], expected[i]);
+        ASSERT_EQ(tfs[i], (tf_t)2);
+    }
+    // the iterator is not moved by decoding the block
+    ASSERT_EQ(iter.GetCurrentTF(), (tf_t)2);
+    ASSERT_EQ(iter.SeekDoc(expected[3]), expected[3]);
+}
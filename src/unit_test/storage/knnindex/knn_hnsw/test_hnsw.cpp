@@ -184,6 +184,68 @@ public:
         }
     }
 
+    // Reuse a saved graph as the base of a larger one, like compaction does
+    template <typename Hnsw>
+    void TestMerge() {
+        int dim = 16;
+        int M = 8;
+        int ef_construction = 200;
+        int chunk_size = 128;
+        int max_chunk_n = 10;
+        int element_size = max_chunk_n * chunk_size;
+        int base_size = element_size / 2;
+
+        std::mt19937 rng;
+        rng.seed(0);
+        std::uniform_real_distribution<float> distrib_real;
+
+        auto data = MakeUnique<float[]>(dim * element_size);
+        for (int i = 0; i < dim * element_size; ++i) {
+            data[i] = distrib_real(rng);
+        }
+
+        LocalFileSystem fs;
+        {
+            // the base holds the second half of data, labeled from 0
+            auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n / 2, dim, M, ef_construction);
+            auto iter = DenseVectorIter<float, LabelT>(data.get() + base_size * dim, dim, element_size - base_size);
+            hnsw_index->InsertVecs(std::move(iter));
+
+            u8 file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+            auto [file_handler, status] = fs.OpenFile(save_dir_ + "/test_hnsw.bin", file_flags, FileLockType::kNoLock);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            hnsw_index->Save(*file_handler);
+        }
+        {
+            u8 file_flags = FileFlags::READ_FLAG;
+            auto [file_handler, status] = fs.OpenFile(save_dir_ + "/test_hnsw.bin", file_flags, FileLockType::kNoLock);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+
+            auto hnsw_index = Hnsw::Load(*file_handler, max_chunk_n);
+            hnsw_index->RemapLabels([&](LabelT label) { return label + base_size; });
+            auto iter = DenseVectorIter<float, LabelT>(data.get(), dim, base_size);
+            hnsw_index->InsertVecs(std::move(iter));
+            EXPECT_EQ(hnsw_index->GetVecNum(), SizeT(element_size));
+            hnsw_index->Check();
+
+            hnsw_index->SetEf(10);
+            int correct = 0;
+            for (int i = 0; i < element_size; ++i) {
+                const float *query = data.get() + i * dim;
+                auto result = hnsw_index->KnnSearchSorted(query, 1);
+                if (result[0].second == (LabelT)i) {
+                    ++correct;
+                }
+            }
+            float correct_rate = float(correct) / element_size;
+            EXPECT_GE(correct_rate, 0.95);
+        }
+    }
+
     template <typename Hnsw>
     void TestParallel() {
         int dim = 16;
@@ -327,3 +389,8 @@ TEST_F(HnswAlgTest, test6) {
     using CompressedHnsw = KnnHnsw<LVQL2VecStoreType<float, int8_t>, LabelT>;
     TestCompress<Hnsw, CompressedHnsw>();
 }
+
+TEST_F(HnswAlgTest, test_merge) {
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<float>, LabelT>;
+    TestMerge<Hnsw>();
+}
@@ -13,6 +13,7 @@
 //  limitations under the License.
 
 #include "unit_test/base_test.h"
+#include <random>
 
 import stl;
 import bitmask;
@@ -140,4 +141,65 @@ TEST_F(HnswAlgBitmaskTest, test1) {
         EXPECT_NEAR(result[0].first, 0.2, error);
         EXPECT_NEAR(result[0].second, 3, error);
     }
-}
\ No newline at end of file
+}
+TEST_F(HnswAlgBitmaskTest, test_two_hop) {
+    using LabelT = u64;
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<f32>, LabelT>;
+
+    int dim = 16;
+    int element_size = 4000;
+    int M = 16;
+    int ef_construction = 200;
+    SizeT top_k = 10;
+    // about 3% of the vectors pass the filter
+    int pass_step = 32;
+
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_real_distribution<float> distrib_real;
+
+    auto data = MakeUnique<f32[]>(dim * element_size);
+    for (int i = 0; i < dim * element_size; ++i) {
+        data[i] = distrib_real(rng);
+    }
+    auto hnsw_index = Hnsw::Make(element_size, 1, dim, M, ef_construction);
+    auto iter = DenseVectorIter<f32, LabelT>(data.get(), dim, element_size);
+    hnsw_index->InsertVecs(std::move(iter));
+    hnsw_index->SetEf(50);
+
+    auto p_bitmask = Bitmask::Make(element_size);
+    p_bitmask->SetAllFalse();
+    for (int i = 0; i < element_size; i += pass_step) {
+        p_bitmask->SetTrue(i);
+    }
+    BitmaskFilter<LabelT> filter(*p_bitmask);
+
+    SizeT correct = 0;
+    SizeT query_n = 100;
+    for (SizeT q = 0; q < query_n; ++q) {
+        const f32 *query = data.get() + (q * 7 + 1) * dim;
+        Vector<Pair<f32, LabelT>> truth;
+        for (int i = 0; i < element_size; i += pass_step) {
+            f32 dist = 0;
+            for (int j = 0; j < dim; ++j) {
+                f32 diff = query[j] - data[i * dim + j];
+                dist += diff * diff;
+            }
+            truth.emplace_back(dist, i);
+        }
+        std::sort(truth.begin(), truth.end());
+
+        auto result = hnsw_index->KnnSearchSorted<BitmaskFilter<LabelT>, true, true>(query, top_k, filter);
+        EXPECT_EQ(result.size(), top_k);
+        for (const auto &[_, label] : result) {
+            EXPECT_TRUE(p_bitmask->IsTrue(label));
+            for (SizeT i = 0; i < top_k; ++i) {
+                if (truth[i].second == label) {
+                    ++correct;
+                    break;
+                }
+            }
+        }
+    }
+    EXPECT_GE(f32(correct) / (query_n * top_k), 0.9);
+}
@@ -0,0 +1,166 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <cstdint>
+#include <random>
+
+import stl;
+import hnsw_alg;
+import file_system;
+import file_system_type;
+import local_file_system;
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-variable"
+import data_store;
+#pragma clang diagnostic pop
+
+import vec_store_type;
+import hnsw_common;
+import hnsw_simd_func;
+import simd_functions;
+import infinity_exception;
+
+using namespace infinity;
+
+class HnswQuantTest : public BaseTest {
+public:
+    using LabelT = u64;
+
+    const std::string save_dir_ = GetFullTmpDir();
+
+    // The vectors are searched by themselves, the label of the query is expected in the candidates to rerank
+    template <typename Hnsw>
+    void TestSelfSearch(float min_correct_rate) {
+        static_assert(Hnsw::NeedRerank);
+
+        int dim = 64;
+        int M = 16;
+        int ef_construction = 200;
+        int chunk_size = 128;
+        int max_chunk_n = 10;
+        int element_size = max_chunk_n * chunk_size;
+        SizeT candidate_n = Hnsw::RerankFactor;
+
+        std::mt19937 rng;
+        rng.seed(0);
+        std::uniform_real_distribution<float> distrib_real;
+
+        auto data = MakeUnique<float[]>(dim * element_size);
+        for (int i = 0; i < dim * element_size; ++i) {
+            data[i] = distrib_real(rng);
+        }
+
+        auto test_func = [&](auto &hnsw_index) {
+            hnsw_index->Check();
+
+            hnsw_index->SetEf(50);
+            int correct = 0;
+            for (int i = 0; i < element_size; ++i) {
+                const float *query = data.get() + i * dim;
+                auto result = hnsw_index->KnnSearchSorted(query, candidate_n);
+                for (const auto &[_, label] : result) {
+                    if (label == (LabelT)i) {
+                        ++correct;
+                        break;
+                    }
+                }
+            }
+            float correct_rate = float(correct) / element_size;
+            EXPECT_GE(correct_rate, min_correct_rate);
+        };
+
+        LocalFileSystem fs;
+        {
+            auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+            auto iter = DenseVectorIter<float, LabelT>(data.get(), dim, element_size);
+            HnswInsertConfig insert_config;
+            insert_config.optimize_ = true;
+            hnsw_index->InsertVecs(std::move(iter), insert_config);
+
+            test_func(hnsw_index);
+
+            u8 file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+            auto [file_handler, status] = fs.OpenFile(save_dir_ + "/test_hnsw_quant.bin", file_flags, FileLockType::kNoLock);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            hnsw_index->Save(*file_handler);
+        }
+        {
+            u8 file_flags = FileFlags::READ_FLAG;
+            auto [file_handler, status] = fs.OpenFile(save_dir_ + "/test_hnsw_quant.bin", file_flags, FileLockType::kNoLock);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            auto hnsw_index = Hnsw::Load(*file_handler);
+
+            test_func(hnsw_index);
+        }
+    }
+};
+
+TEST_F(HnswQuantTest, test_simd) {
+    SizeT byte_n = 203;
+    SizeT vec_n = 1000;
+
+    std::default_random_engine rng;
+    std::uniform_int_distribution<u32> dist_u8(0, 255);
+    std::uniform_int_distribution<u64> dist_u64;
+
+    auto u4_vecs1 = MakeUnique<u8[]>(byte_n * vec_n);
+    auto u4_vecs2 = MakeUnique<u8[]>(byte_n * vec_n);
+    auto bit_vecs1 = MakeUnique<u64[]>(byte_n * vec_n);
+    auto bit_vecs2 = MakeUnique<u64[]>(byte_n * vec_n);
+    for (SizeT i = 0; i < byte_n * vec_n; ++i) {
+        u4_vecs1[i] = dist_u8(rng);
+        u4_vecs2[i] = dist_u8(rng);
+        bit_vecs1[i] = dist_u64(rng);
+        bit_vecs2[i] = dist_u64(rng);
+    }
+
+    const auto &simd_functions = GetSIMD_FUNCTIONS();
+    for (SizeT i = 0; i < vec_n; ++i) {
+        // different lengths to cover the residual of each kernel
+        SizeT n = byte_n - i % 64;
+        const u8 *u4_v1 = u4_vecs1.get() + i * byte_n;
+        const u8 *u4_v2 = u4_vecs2.get() + i * byte_n;
+        EXPECT_EQ(simd_functions.HNSW_U4IP_ptr_(u4_v1, u4_v2, n), U4IPBF(u4_v1, u4_v2, n));
+
+        const u64 *bit_v1 = bit_vecs1.get() + i * byte_n;
+        const u64 *bit_v2 = bit_vecs2.get() + i * byte_n;
+        EXPECT_EQ(simd_functions.HNSW_BinaryHamming_ptr_(bit_v1, bit_v2, n), BinaryHammingBF(bit_v1, bit_v2, n));
+    }
+}
+
+TEST_F(HnswQuantTest, test_lvq4_l2) {
+    using Hnsw = KnnHnsw<LVQ4L2VecStoreType<float>, LabelT>;
+    TestSelfSearch<Hnsw>(0.95);
+}
+
+TEST_F(HnswQuantTest, test_lvq4_cos) {
+    using Hnsw = KnnHnsw<LVQ4CosVecStoreType<float>, LabelT>;
+    TestSelfSearch<Hnsw>(0.95);
+}
+
+TEST_F(HnswQuantTest, test_rabitq_l2) {
+    using Hnsw = KnnHnsw<RabitqL2VecStoreType<float>, LabelT>;
+    TestSelfSearch<Hnsw>(0.9);
+}
+
+TEST_F(HnswQuantTest, test_rabitq_cos) {
+    using Hnsw = KnnHnsw<RabitqCosVecStoreType<float>, LabelT>;
+    TestSelfSearch<Hnsw>(0.9);
+}
@@ -111,6 +111,48 @@ protected:
             test_query(index);
         }
     }
+
+    // The block ranges searched by several threads and the batch search give the same scores as the single thread search
+    template <typename DataType, typename IdxType, BMPCompressType CompressType>
+    void TestParallelFunc(u32 block_size) {
+        using BMPAlg = BMPAlg<DataType, IdxType, CompressType>;
+
+        u32 nrow = 2000;
+        u32 ncol = 1000;
+        f32 sparsity = 0.05;
+        u32 query_n = 50;
+        u32 topk = 10;
+
+        const SparseMatrix dataset = SparseTestUtil<DataType, IdxType>::GenerateDataset(nrow, ncol, sparsity, 0.0, 10.0);
+        const SparseMatrix query_set = SparseTestUtil<DataType, IdxType>::GenerateDataset(query_n, ncol, sparsity, 0.0, 10.0);
+
+        BMPAlg index(ncol, block_size);
+        for (SparseMatrixIter iter(dataset); iter.HasNext(); iter.Next()) {
+            index.AddDoc(iter.val(), iter.row_id());
+        }
+        BMPOptimizeOptions optimize_options{.topk_ = static_cast<i32>(topk)};
+        index.Optimize(optimize_options);
+
+        ThreadPool thread_pool(4);
+        BmpSearchOptions options;
+        options.use_lock_ = false;
+        BmpSearchOptions parallel_options = options;
+        parallel_options.thread_pool_ = &thread_pool;
+        parallel_options.thread_n_ = 4;
+
+        Vector<SparseVecRef<DataType, IdxType>> queries;
+        for (SparseMatrixIter iter(query_set); iter.HasNext(); iter.Next()) {
+            queries.push_back(iter.val());
+        }
+        auto batch_results = index.SearchKnnBatch(queries, topk, parallel_options, nullptr);
+        ASSERT_EQ(batch_results.size(), queries.size());
+        for (SizeT i = 0; i < queries.size(); ++i) {
+            auto [indices, scores] = index.SearchKnn(queries[i], topk, options);
+            auto [parallel_indices, parallel_scores] = index.SearchKnn(queries[i], topk, parallel_options);
+            EXPECT_EQ(scores, parallel_scores);
+            EXPECT_EQ(scores, batch_results[i].second);
+        }
+    }
 };
 
 TEST_F(BMPIndexTest, test1) {
@@ -130,4 +172,18 @@ TEST_F(BMPIndexTest, test1) {
         u32 block_size = 8;
         TestFunc<f64, i32, BMPCompressType::kCompressed>(block_size);
     }
-}
\ No newline at end of file
+}
+TEST_F(BMPIndexTest, test_parallel) {
+    {
+        u32 block_size = 8;
+        TestParallelFunc<f32, i32, BMPCompressType::kCompressed>(block_size);
+    }
+    {
+        u32 block_size = 16;
+        TestParallelFunc<f32, i32, BMPCompressType::kRaw>(block_size);
+    }
+    {
+        u32 block_size = 8;
+        TestParallelFunc<f64, i32, BMPCompressType::kRaw>(block_size);
+    }
+}
@@ -122,7 +122,7 @@ TEST_P(TableEntryTest, test1) {
                                                                nullptr,
                                                                0 /*txn_id*/,
                                                                0 /*begin_ts*/,
-                                                               INVALID_SEGMENT_ID /*unsealed_id*/,
+                                                               Vector<SegmentID>{INVALID_SEGMENT_ID} /*unsealed_ids*/,
                                                                0 /*next_segment_id*/);
 }
 
@@ -28,6 +28,8 @@ import infinity_context;
 import data_type;
 import logical_type;
 import constant_expr;
+import crc;
+import serialize;
 
 using namespace infinity;
 
@@ -183,6 +185,55 @@ TEST_P(CatalogDeltaEntryTest, test_DeltaOpEntry) {
     infinity::InfinityContext::instance().UnInit();
 }
 
+TEST_P(CatalogDeltaEntryTest, read_add_table_op_without_unsealed_ids) {
+    auto op = MakeUnique<AddTableEntryOp>();
+    op->encode_ = MakeUnique<String>("#db_test#table_test");
+    op->table_entry_dir_ = MakeShared<String>("data/db_test/table_test");
+    op->row_count_ = 10;
+    op->unsealed_id_ = 3;
+    op->next_segment_id_ = 4;
+    i32 new_op_size = op->GetSizeInBytes();
+    auto new_op_buffer = MakeUnique<char[]>(new_op_size);
+    {
+        char *ptr = new_op_buffer.get();
+        op->WriteAdv(ptr);
+        EXPECT_EQ(*(CatalogDeltaOpType *)new_op_buffer.get(), CatalogDeltaOpType::ADD_TABLE_ENTRY_V2);
+    }
+
+    // the op in the layout written before the unsealed ids are added: ADD_TABLE_ENTRY tag, no unsealed ids at the end
+    i32 op_size = new_op_size - sizeof(i32);
+    i32 buffer_size = sizeof(i32) + sizeof(u32) + sizeof(TxnTimeStamp) + sizeof(i32) + op_size + sizeof(i32);
+    auto buffer = MakeUnique<char[]>(buffer_size);
+    {
+        char *ptr = buffer.get();
+        WriteBufAdv(ptr, buffer_size);
+        WriteBufAdv(ptr, u32(0));
+        WriteBufAdv(ptr, TxnTimeStamp(0));
+        WriteBufAdv(ptr, i32(1));
+        char *op_ptr = ptr;
+        std::memcpy(ptr, new_op_buffer.get(), op_size);
+        WriteBufAdv(op_ptr, CatalogDeltaOpType::ADD_TABLE_ENTRY);
+        ptr += op_size;
+        WriteBufAdv(ptr, buffer_size);
+        u32 crc = CRC32IEEE::makeCRC(reinterpret_cast<const unsigned char *>(buffer.get()), buffer_size);
+        char *crc_ptr = buffer.get() + sizeof(i32);
+        WriteBufAdv(crc_ptr, crc);
+    }
+
+    char *ptr = buffer.get();
+    auto catalog_delta_entry = CatalogDeltaEntry::ReadAdv(ptr, buffer_size);
+    ASSERT_NE(catalog_delta_entry, nullptr);
+    EXPECT_EQ(ptr - buffer.get(), buffer_size);
+    ASSERT_EQ(catalog_delta_entry->operations().size(), 1u);
+    auto *read_op = static_cast<AddTableEntryOp *>(catalog_delta_entry->operations()[0].get());
+    EXPECT_EQ(read_op->GetType(), CatalogDeltaOpType::ADD_TABLE_ENTRY);
+    EXPECT_EQ(read_op->row_count_, 10u);
+    EXPECT_EQ(read_op->unsealed_id_, 3u);
+    EXPECT_EQ(read_op->next_segment_id_, 4u);
+    EXPECT_TRUE(read_op->unsealed_ids_.empty());
+    infinity::InfinityContext::instance().UnInit();
+}
+
 TEST_P(CatalogDeltaEntryTest, MergeEntries) {
     auto global_catalog_delta_entry = std::make_unique<GlobalCatalogDeltaEntry>();
     auto local_catalog_delta_entry = std::make_unique<CatalogDeltaEntry>();
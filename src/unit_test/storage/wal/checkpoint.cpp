@@ -556,4 +556,195 @@ TEST_P(CheckpointTest, test_fullcheckpoint_withsmallest_walfile) {
     EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
     infinity::GlobalResourceUsage::UnInit();
 #endif
-}
\ No newline at end of file
+}
+TEST_P(CheckpointTest, test_fullcheckpoint_table_pages) {
+#ifdef INFINITY_DEBUG
+    infinity::GlobalResourceUsage::Init();
+#endif
+
+    auto db_name = MakeShared<String>("default_db");
+    Vector<SharedPtr<String>> table_names{MakeShared<String>("tbl1"), MakeShared<String>("tbl2")};
+    Vector<SharedPtr<ColumnDef>> columns;
+    Vector<SharedPtr<DataType>> column_types;
+    {
+        std::set<ConstraintType> constraints;
+        auto column_def_ptr = MakeShared<ColumnDef>(0, MakeShared<DataType>(DataType(LogicalType::kInteger)), "col1", constraints);
+        columns.emplace_back(column_def_ptr);
+        column_types.emplace_back(column_def_ptr->type());
+    }
+
+    String catalog_dir;
+    int insert_n = 100;
+    auto count_pages_files = [&] {
+        SizeT count = 0;
+        for (const auto &entry : std::filesystem::directory_iterator(catalog_dir)) {
+            if (entry.path().filename().string().starts_with("PAGES.")) {
+                ++count;
+            }
+        }
+        return count;
+    };
+    {
+        infinity::InfinityContext::instance().Init(nullptr /*config_path*/);
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+        catalog_dir = *storage->catalog()->CatalogDir();
+
+        for (const auto &table_name : table_names) {
+            auto tbl_def = MakeUnique<TableDef>(db_name, table_name, columns);
+
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+            auto status = txn->CreateTable(*db_name, std::move(tbl_def), ConflictType::kIgnore);
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+
+        auto append = [&](const String &table_name) {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("insert table"));
+            auto [table_entry, get_status] = txn->GetTableByName(*db_name, table_name);
+            EXPECT_TRUE(get_status.ok());
+
+            SharedPtr<DataBlock> input_block = MakeShared<DataBlock>();
+            input_block->Init(column_types);
+            for (int i = 0; i < insert_n; ++i) {
+                input_block->AppendValue(0 /*column_idx*/, Value::MakeInt(i));
+            }
+            input_block->Finalize();
+
+            auto append_status = txn->Append(table_entry, input_block);
+            EXPECT_TRUE(append_status.ok());
+            txn_mgr->CommitTxn(txn);
+        };
+        auto full_checkpoint = [&] {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("full ckp"), true);
+            SharedPtr<ForceCheckpointTask> force_ckp_task = MakeShared<ForceCheckpointTask>(txn, true /*full_check_point*/);
+            storage->bg_processor()->Submit(force_ckp_task);
+            force_ckp_task->Wait();
+            txn_mgr->CommitTxn(txn);
+        };
+        append(*table_names[0]);
+        append(*table_names[1]);
+        full_checkpoint();
+        EXPECT_EQ(count_pages_files(), 1u);
+
+        // only tbl1 is written into the new page file, tbl2 still references the old one
+        append(*table_names[0]);
+        full_checkpoint();
+        EXPECT_GE(count_pages_files(), 1u);
+        EXPECT_LE(count_pages_files(), 2u);
+
+        infinity::InfinityContext::instance().UnInit();
+    }
+    {
+        infinity::InfinityContext::instance().Init(nullptr /*config_path*/);
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        auto *txn_mgr = storage->txn_manager();
+
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("get table"));
+        for (SizeT i = 0; i < table_names.size(); ++i) {
+            auto [table_entry, status] = txn->GetTableByName(*db_name, *table_names[i]);
+            EXPECT_TRUE(status.ok());
+            EXPECT_EQ(table_entry->row_count(), SizeT(insert_n * (i == 0 ? 2 : 1)));
+        }
+        txn_mgr->CommitTxn(txn);
+
+        infinity::InfinityContext::instance().UnInit();
+    }
+
+#ifdef INFINITY_DEBUG
+    EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+    EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+    infinity::GlobalResourceUsage::UnInit();
+#endif
+}
+
+TEST_P(CheckpointTest, test_fullcheckpoint_table_pages_commit_during_checkpoint) {
+#ifdef INFINITY_DEBUG
+    infinity::GlobalResourceUsage::Init();
+#endif
+
+    auto db_name = MakeShared<String>("default_db");
+    auto table_name = MakeShared<String>("tbl1");
+    Vector<SharedPtr<ColumnDef>> columns;
+    Vector<SharedPtr<DataType>> column_types;
+    {
+        std::set<ConstraintType> constraints;
+        auto column_def_ptr = MakeShared<ColumnDef>(0, MakeShared<DataType>(DataType(LogicalType::kInteger)), "col1", constraints);
+        columns.emplace_back(column_def_ptr);
+        column_types.emplace_back(column_def_ptr->type());
+    }
+
+    int insert_n = 100;
+    {
+        infinity::InfinityContext::instance().Init(nullptr /*config_path*/);
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+        Catalog *catalog = storage->catalog();
+
+        {
+            auto tbl_def = MakeUnique<TableDef>(db_name, table_name, columns);
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+            auto status = txn->CreateTable(*db_name, std::move(tbl_def), ConflictType::kIgnore);
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+
+        auto append = [&] {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("insert table"));
+            auto [table_entry, get_status] = txn->GetTableByName(*db_name, *table_name);
+            EXPECT_TRUE(get_status.ok());
+
+            SharedPtr<DataBlock> input_block = MakeShared<DataBlock>();
+            input_block->Init(column_types);
+            for (int i = 0; i < insert_n; ++i) {
+                input_block->AppendValue(0 /*column_idx*/, Value::MakeInt(i));
+            }
+            input_block->Finalize();
+
+            auto append_status = txn->Append(table_entry, input_block);
+            EXPECT_TRUE(append_status.ok());
+            return txn_mgr->CommitTxn(txn);
+        };
+        auto full_checkpoint = [&] {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("full ckp"), true);
+            SharedPtr<ForceCheckpointTask> force_ckp_task = MakeShared<ForceCheckpointTask>(txn, true /*full_check_point*/);
+            storage->bg_processor()->Submit(force_ckp_task);
+            force_ckp_task->Wait();
+            txn_mgr->CommitTxn(txn);
+        };
+
+        TxnTimeStamp first_commit_ts = append();
+        // the second append commits after a full checkpoint chose first_commit_ts as its max commit ts but before the table is serialized
+        append();
+        {
+            String full_path, full_name;
+            catalog->SaveFullCatalog(first_commit_ts, full_path, full_name);
+        }
+
+        // the page written above misses the second append, the next full checkpoints must not reuse it
+        full_checkpoint();
+        append();
+        full_checkpoint();
+
+        infinity::InfinityContext::instance().UnInit();
+    }
+    {
+        infinity::InfinityContext::instance().Init(nullptr /*config_path*/);
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        auto *txn_mgr = storage->txn_manager();
+
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("get table"));
+        auto [table_entry, status] = txn->GetTableByName(*db_name, *table_name);
+        EXPECT_TRUE(status.ok());
+        EXPECT_EQ(table_entry->row_count(), SizeT(insert_n * 3));
+        txn_mgr->CommitTxn(txn);
+
+        infinity::InfinityContext::instance().UnInit();
+    }
+
+#ifdef INFINITY_DEBUG
+    EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+    EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+    infinity::GlobalResourceUsage::UnInit();
+#endif
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "unit_test/base_test.h"
+#include <thread>
 
 import stl;
 import global_resource_usage;
@@ -55,6 +56,12 @@ protected:
                    : std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_close_ckp_vfs.toml");
     }
 
+    static std::shared_ptr<std::string> append_stream_config() {
+        return GetParam() == BaseTestParamStr::NULL_CONFIG_PATH
+                   ? std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_append_stream.toml")
+                   : std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_append_stream_vfs.toml");
+    }
+
     void SetUp() override {
         RemoveDbDirs();
         system(("mkdir -p " + String(GetFullPersistDir())).c_str());
@@ -306,4 +313,115 @@ TEST_P(RepeatReplayTest, import) {
         CheckTable(txn_mgr, 3);
         infinity::InfinityContext::instance().UnInit();
     }
-}
\ No newline at end of file
+}
+
+TEST_P(RepeatReplayTest, append_streams) {
+    std::shared_ptr<std::string> config_path = RepeatReplayTest::append_stream_config();
+
+    auto db_name = std::make_shared<std::string>("default_db");
+    auto column_def1 = std::make_shared<ColumnDef>(0, std::make_shared<DataType>(LogicalType::kInteger), "col1", std::set<ConstraintType>());
+    auto table_name = std::make_shared<std::string>("tb1");
+    auto table_def = TableDef::Make(db_name, table_name, {column_def1});
+
+    constexpr int thread_n = 4;
+    constexpr int append_n = 8;
+    auto TestAppend = [&](TxnManager *txn_mgr, int v) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("insert table"));
+
+        auto column_vector = MakeShared<ColumnVector>(table_def->columns()[0]->type());
+        column_vector->Initialize();
+        column_vector->AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+        auto data_block = DataBlock::Make();
+        data_block->Init({column_vector});
+
+        auto [table_entry, status] = txn->GetTableByName(*db_name, *table_name);
+        EXPECT_TRUE(status.ok());
+
+        status = txn->Append(table_entry, data_block);
+        ASSERT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    };
+    auto ConcurrentAppend = [&](TxnManager *txn_mgr) {
+        Vector<std::thread> threads;
+        for (int i = 0; i < thread_n; ++i) {
+            threads.emplace_back([&, i] {
+                for (int j = 0; j < append_n; ++j) {
+                    TestAppend(txn_mgr, i * append_n + j);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    };
+    // rows of each segment
+    auto GetSegmentRows = [&](TxnManager *txn_mgr) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("get table"));
+
+        auto [table_entry, status] = txn->GetTableByName(*db_name, *table_name);
+        EXPECT_TRUE(status.ok());
+        EXPECT_EQ(table_entry->AppendStreamCount(), 4ul);
+
+        Map<SegmentID, SizeT> segment_rows;
+        SizeT row_count = 0;
+        for (const auto &[segment_id, segment_entry] : table_entry->segment_map()) {
+            segment_rows[segment_id] = segment_entry->row_count();
+            row_count += segment_entry->row_count();
+        }
+        EXPECT_EQ(table_entry->row_count(), row_count);
+        EXPECT_LE(segment_rows.size(), table_entry->AppendStreamCount());
+
+        txn_mgr->CommitTxn(txn);
+        return segment_rows;
+    };
+
+    Map<SegmentID, SizeT> segment_rows;
+    {
+        infinity::InfinityContext::instance().Init(config_path);
+        Storage *storage = InfinityContext::instance().storage();
+
+        TxnManager *txn_mgr = storage->txn_manager();
+        {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+            txn->CreateTable(*db_name, table_def, ConflictType::kError);
+            txn_mgr->CommitTxn(txn);
+        }
+        ConcurrentAppend(txn_mgr);
+        segment_rows = GetSegmentRows(txn_mgr);
+        EXPECT_GT(segment_rows.size(), 1ul);
+        infinity::InfinityContext::instance().UnInit();
+    }
+    {
+        // the rows are placed in the same segments when the wal is replayed
+        infinity::InfinityContext::instance().Init(config_path);
+        Storage *storage = InfinityContext::instance().storage();
+
+        TxnManager *txn_mgr = storage->txn_manager();
+        EXPECT_EQ(GetSegmentRows(txn_mgr), segment_rows);
+        { //  manually add delta checkpoint
+            auto *txn_force_ckp = txn_mgr->BeginTxn(MakeUnique<String>("delta checkpoint"));
+            auto force_ckp_task = MakeShared<ForceCheckpointTask>(txn_force_ckp, false /*is_full_checkpoint*/);
+            storage->bg_processor()->Submit(force_ckp_task);
+            force_ckp_task->Wait();
+            txn_mgr->CommitTxn(txn_force_ckp);
+        }
+        ConcurrentAppend(txn_mgr);
+        segment_rows = GetSegmentRows(txn_mgr);
+        infinity::InfinityContext::instance().UnInit();
+    }
+    {
+        // replay with full checkpoint + delta checkpoint + wal
+        infinity::InfinityContext::instance().Init(config_path);
+        Storage *storage = InfinityContext::instance().storage();
+
+        TxnManager *txn_mgr = storage->txn_manager();
+        auto replayed_segment_rows = GetSegmentRows(txn_mgr);
+        EXPECT_EQ(replayed_segment_rows, segment_rows);
+        SizeT row_count = 0;
+        for (const auto &[segment_id, rows] : replayed_segment_rows) {
+            row_count += rows;
+        }
+        EXPECT_EQ(row_count, SizeT(2 * thread_n * append_n));
+        infinity::InfinityContext::instance().UnInit();
+    }
+}
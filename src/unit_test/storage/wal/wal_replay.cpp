@@ -475,6 +475,98 @@ TEST_P(WalReplayTest, wal_replay_append) {
     }
 }
 
+TEST_P(WalReplayTest, wal_replay_append_tables) {
+    // The appends of different tables are replayed concurrently, the appends of each table keep the wal order
+    SizeT table_count = 4;
+    SizeT append_round = 3;
+    SizeT row_count = 8;
+    auto table_name = [](SizeT table_idx) { return "tbl" + std::to_string(table_idx); };
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+
+        Vector<SharedPtr<ColumnDef>> columns;
+        {
+            std::set<ConstraintType> constraints;
+            auto column_def_ptr = MakeShared<ColumnDef>(0, MakeShared<DataType>(DataType(LogicalType::kBigInt)), "big_int_col", constraints);
+            columns.emplace_back(column_def_ptr);
+        }
+        for (SizeT table_idx = 0; table_idx < table_count; ++table_idx) {
+            auto tbl_def = MakeUnique<TableDef>(MakeShared<String>("default_db"), MakeShared<String>(table_name(table_idx)), columns);
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+            Status status = txn->CreateTable("default_db", std::move(tbl_def), ConflictType::kIgnore);
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+        for (SizeT round = 0; round < append_round; ++round) {
+            for (SizeT table_idx = 0; table_idx < table_count; ++table_idx) {
+                auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("insert table"));
+                SharedPtr<DataBlock> input_block = MakeShared<DataBlock>();
+                Vector<SharedPtr<DataType>> column_types{MakeShared<DataType>(LogicalType::kBigInt)};
+                input_block->Init(column_types, row_count);
+                for (SizeT i = 0; i < row_count; ++i) {
+                    input_block->AppendValue(0, Value::MakeBigInt(static_cast<i64>(round * row_count + i)));
+                }
+                input_block->Finalize();
+                auto [table_entry, status] = txn->GetTableByName("default_db", table_name(table_idx));
+                EXPECT_TRUE(status.ok());
+                txn->Append(table_entry, input_block);
+                txn_mgr->CommitTxn(txn);
+            }
+        }
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+    // Restart the db instance
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+        {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("check table"));
+            TxnTimeStamp begin_ts = txn->BeginTS();
+            for (SizeT table_idx = 0; table_idx < table_count; ++table_idx) {
+                auto [table_entry, status] = txn->GetTableByName("default_db", table_name(table_idx));
+                EXPECT_TRUE(status.ok());
+                EXPECT_EQ(table_entry->row_count(), append_round * row_count);
+
+                auto segment_entry = table_entry->GetSegmentByID(0, begin_ts);
+                EXPECT_NE(segment_entry, nullptr);
+                auto *block_entry = segment_entry->GetBlockEntryByID(0).get();
+                EXPECT_EQ(block_entry->row_count(), append_round * row_count);
+
+                ColumnVector col0 = block_entry->GetColumnBlockEntry(0)->GetConstColumnVector(storage->buffer_manager());
+                for (SizeT i = 0; i < append_round * row_count; ++i) {
+                    Value v0 = col0.GetValue(i);
+                    EXPECT_EQ(v0.GetValue<BigIntT>(), static_cast<i64>(i));
+                }
+            }
+            txn_mgr->CommitTxn(txn);
+        }
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+}
+
 TEST_P(WalReplayTest, wal_replay_import) {
     {
 #ifdef INFINITY_DEBUG
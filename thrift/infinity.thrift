@@ -409,6 +409,7 @@ BMP,
 Secondary,
 EMVB,
 DiskAnn,
+Bitmap,
 }
 
 struct IndexInfo {
@@ -501,6 +502,7 @@ struct InsertRequest {
 3:  list<string> column_names = [],
 4:  list<Field> fields = [],
 5:  i64 session_id,
+6:  list<ColumnField> column_fields = [],
 }
 
 struct ImportRequest{
@@ -564,6 +566,8 @@ struct SelectRequest {
 9:  optional ParsedExpr limit_expr,
 10:  optional ParsedExpr offset_expr,
 11:  optional list<OrderByExpr> order_by_list = [],
+12:  optional bool arrow_stream = false,
+13:  optional i64 cursor_id,
 }
 
 struct SelectResponse {
@@ -571,6 +575,8 @@ struct SelectResponse {
 2: string error_msg,
 3: list<ColumnDef> column_defs = [],
 4: list<ColumnField> column_fields = [];
+5: optional i64 cursor_id,
+6: optional binary arrow_batch,
 }
 
 struct DeleteRequest {
@@ -666,6 +672,11 @@ struct ShowBlockColumnResponse {
 8: string extra_file_names,
 }
 
+struct CloseCursorRequest {
+1: i64 session_id,
+2: i64 cursor_id,
+}
+
 // Service
 service InfinityService {
 CommonResponse Connect(1:ConnectRequest request),
@@ -709,4 +720,6 @@ ShowIndexResponse ShowIndex(1:ShowIndexRequest request),
 
 CommonResponse Optimize(1:OptimizeRequest request),
 
+CommonResponse CloseCursor(1:CloseCursorRequest request),
+
 }
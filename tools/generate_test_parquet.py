@@ -11,12 +11,16 @@ def generate(generate_if_exist: bool, copy_dir: str):
 
     table_name = "parquet_test_table"
     table_name1 = "parquet_test_table1"
+    table_name2 = "parquet_test_table2"
     parquet_filename = "gen_test.parquet"
     parquet_filename1 = "gen_test1.parquet"
+    parquet_filename2 = "gen_test_bigint.parquet"
     parquet_path = parquet_dir + "/" + parquet_filename
+    parquet_path2 = parquet_dir + "/" + parquet_filename2
     import_slt_path = import_slt_dir + "/test_import_gen_parquet.slt"
     copy_path = copy_dir + "/" + parquet_filename
     copy_path1 = copy_dir + "/tmp/" + parquet_filename1
+    copy_path2 = copy_dir + "/" + parquet_filename2
 
     os.makedirs(parquet_dir, exist_ok=True)
     os.makedirs(import_slt_dir, exist_ok=True)
@@ -51,6 +55,12 @@ def generate(generate_if_exist: bool, copy_dir: str):
     with pq.ParquetWriter(parquet_path, pa_table.schema) as writer:
         writer.write_table(pa_table)
 
+    # bigints which are not exact doubles
+    bigint_vec = [2**53, 2**53 + 1, 2**53 + 2]
+    pa_table2 = pa.table({"col3": pa.array(bigint_vec, type=pa.int64())})
+    with pq.ParquetWriter(parquet_path2, pa_table2.schema) as writer:
+        writer.write_table(pa_table2)
+
     with open(import_slt_path, "w") as slt_file:
         slt_file.write("statement ok\n")
         slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
@@ -122,6 +132,100 @@ def generate(generate_if_exist: bool, copy_dir: str):
             )
         slt_file.write("\n")
 
+        # columns matched by name, rows filtered by the predicate on the columns of the target table
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name2))
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "CREATE TABLE {} (col3 BIGINT, col1 Boolean);\n".format(table_name2)
+        )
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "COPY {} FROM '{}' WITH (FORMAT PARQUET, FILTER 'col3 >= 5 and 8 > col3');\n".format(
+                table_name2, copy_path
+            )
+        )
+        slt_file.write("\n")
+
+        slt_file.write("query I\n")
+        slt_file.write("SELECT * FROM {};\n".format(table_name2))
+        slt_file.write("----\n")
+        for i in range(5, 8):
+            slt_file.write(
+                "{} {}\n".format(int64_vec[i], "true" if bool_vec[i] else "false")
+            )
+        slt_file.write("\n")
+
+        slt_file.write("statement error\n")
+        slt_file.write(
+            "COPY {} FROM '{}' WITH (FORMAT PARQUET, FILTER 'col1 > 5');\n".format(
+                table_name2, copy_path
+            )
+        )
+        slt_file.write("\n")
+
+        # a fractional bound of an integer column
+        slt_file.write("statement ok\n")
+        slt_file.write("DELETE FROM {};\n".format(table_name2))
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "COPY {} FROM '{}' WITH (FORMAT PARQUET, FILTER 'col3 > 4.5 and col3 <= 6.5');\n".format(
+                table_name2, copy_path
+            )
+        )
+        slt_file.write("\n")
+
+        slt_file.write("query I\n")
+        slt_file.write("SELECT * FROM {};\n".format(table_name2))
+        slt_file.write("----\n")
+        for i in range(5, 7):
+            slt_file.write(
+                "{} {}\n".format(int64_vec[i], "true" if bool_vec[i] else "false")
+            )
+        slt_file.write("\n")
+
+        # col2 is in the file but not in the target table
+        slt_file.write("statement error\n")
+        slt_file.write(
+            "COPY {} FROM '{}' WITH (FORMAT PARQUET, FILTER 'col2 > 5');\n".format(
+                table_name2, copy_path
+            )
+        )
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE {};\n".format(table_name2))
+        slt_file.write("\n")
+
+        # bigints are compared without rounding them to doubles
+        slt_file.write("statement ok\n")
+        slt_file.write("CREATE TABLE {} (col3 BIGINT);\n".format(table_name2))
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "COPY {} FROM '{}' WITH (FORMAT PARQUET, FILTER 'col3 = {}');\n".format(
+                table_name2, copy_path2, bigint_vec[1]
+            )
+        )
+        slt_file.write("\n")
+
+        slt_file.write("query I\n")
+        slt_file.write("SELECT * FROM {};\n".format(table_name2))
+        slt_file.write("----\n")
+        slt_file.write("{}\n".format(bigint_vec[1]))
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE {};\n".format(table_name2))
+        slt_file.write("\n")
+
         slt_file.write("statement ok\n")
         slt_file.write("DROP TABLE {};\n".format(table_name1))
         slt_file.write("\n")